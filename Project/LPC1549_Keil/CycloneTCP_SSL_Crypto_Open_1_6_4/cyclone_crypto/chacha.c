@@ -0,0 +1,290 @@
+/**
+ * @file chacha.c
+ * @brief ChaCha20 encryption algorithm
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCrypto Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * ChaCha is a stream cipher designed by D. J. Bernstein. It operates on a
+ * 512-bit state made of 32-bit words using only additions, rotations and
+ * XORs, which makes it fast in software on cores without AES hardware.
+ * Refer to RFC 7539 for more details
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL CRYPTO_TRACE_LEVEL
+
+//Dependencies
+#include <string.h>
+#include "crypto.h"
+#include "chacha.h"
+
+//Check crypto library configuration
+#if (CHACHA_SUPPORT == ENABLED)
+
+//ChaCha quarter-round function
+#define CHACHA_QUARTER_ROUND(a, b, c, d) \
+{ \
+   a += b; \
+   d ^= a; \
+   d = ROL32(d, 16); \
+   c += d; \
+   b ^= c; \
+   b = ROL32(b, 12); \
+   a += b; \
+   d ^= a; \
+   d = ROL32(d, 8); \
+   c += d; \
+   b ^= c; \
+   b = ROL32(b, 7); \
+}
+
+//Common interface for encryption algorithms
+const CipherAlgo chacha20CipherAlgo =
+{
+   "ChaCha20",
+   sizeof(ChachaContext),
+   CIPHER_ALGO_TYPE_STREAM,
+   0,
+   (CipherAlgoInit) chacha20Init,
+   (CipherAlgoEncryptStream) chachaCipher,
+   (CipherAlgoDecryptStream) chachaCipher,
+   NULL,
+   NULL
+};
+
+
+/**
+ * @brief Initialize a ChaCha context using the supplied key and nonce
+ *
+ * The block counter is 32-bit wide and starts at zero. The nonce is
+ * 96-bit wide, as specified in RFC 7539
+ *
+ * @param[in] context Pointer to the ChaCha context to initialize
+ * @param[in] nr Number of rounds (8, 12 or 20)
+ * @param[in] key Pointer to the key
+ * @param[in] keyLength Length of the key, in bytes (must be 32)
+ * @param[in] nonce Pointer to the nonce
+ * @param[in] nonceLength Length of the nonce, in bytes (must be 12)
+ * @return Error code
+ **/
+
+error_t chachaInit(ChachaContext *context, uint_t nr, const uint8_t *key,
+   size_t keyLength, const uint8_t *nonce, size_t nonceLength)
+{
+   uint_t i;
+
+   //Check parameters
+   if(context == NULL || key == NULL || nonce == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //The number of rounds must be 8, 12 or 20
+   if(nr != 8 && nr != 12 && nr != 20)
+      return ERROR_INVALID_PARAMETER;
+   //Check the length of the key and the nonce
+   if(keyLength != CHACHA_KEY_SIZE || nonceLength != CHACHA_NONCE_SIZE)
+      return ERROR_INVALID_PARAMETER;
+
+   //Save the number of rounds
+   context->nr = nr;
+
+   //The first four words are constants ("expand 32-byte k")
+   context->state[0] = 0x61707865;
+   context->state[1] = 0x3320646E;
+   context->state[2] = 0x79622D32;
+   context->state[3] = 0x6B206574;
+
+   //The next eight words are taken from the key
+   for(i = 0; i < 8; i++)
+      context->state[4 + i] = LOAD32LE(key + 4 * i);
+
+   //Block counter
+   context->state[12] = 0;
+
+   //The last three words are taken from the nonce
+   for(i = 0; i < 3; i++)
+      context->state[13 + i] = LOAD32LE(nonce + 4 * i);
+
+   //No key stream is available yet
+   context->pos = CHACHA_BLOCK_SIZE;
+
+   //No error to report
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Initialize a ChaCha20 context using the supplied key
+ *
+ * This function implements the common interface for encryption algorithms.
+ * The nonce is set to zero. Callers that need a different nonce (such
+ * as ChaCha20-Poly1305) should use chachaInit() instead
+ *
+ * @param[in] context Pointer to the ChaCha context to initialize
+ * @param[in] key Pointer to the key
+ * @param[in] keyLength Length of the key, in bytes
+ * @return Error code
+ **/
+
+error_t chacha20Init(ChachaContext *context, const uint8_t *key, size_t keyLength)
+{
+   uint8_t nonce[CHACHA_NONCE_SIZE];
+
+   //Use an all-zero nonce
+   memset(nonce, 0, CHACHA_NONCE_SIZE);
+
+   //ChaCha20 uses 20 rounds
+   return chachaInit(context, 20, key, keyLength, nonce, CHACHA_NONCE_SIZE);
+}
+
+
+/**
+ * @brief Encrypt/decrypt data with the ChaCha algorithm
+ * @param[in] context Pointer to the ChaCha context
+ * @param[in] input Pointer to the data to encrypt/decrypt. If NULL, the
+ *   raw key stream is written to the output buffer
+ * @param[out] output Pointer to the resulting data
+ * @param[in] length Number of bytes to be processed
+ **/
+
+void chachaCipher(ChachaContext *context, const uint8_t *input,
+   uint8_t *output, size_t length)
+{
+   size_t i;
+   size_t n;
+
+   //Process the data
+   while(length > 0)
+   {
+      //Generate a new key stream block if necessary
+      if(context->pos >= CHACHA_BLOCK_SIZE)
+         chachaProcessBlock(context);
+
+      //Number of key stream bytes available
+      n = MIN(length, CHACHA_BLOCK_SIZE - context->pos);
+
+      //Raw key stream requested?
+      if(input == NULL)
+      {
+         //Copy the key stream
+         memcpy(output, context->block + context->pos, n);
+      }
+      else
+      {
+         //XOR the data with the key stream
+         for(i = 0; i < n; i++)
+            output[i] = input[i] ^ context->block[context->pos + i];
+
+         //Advance input pointer
+         input += n;
+      }
+
+      //Advance output pointer
+      output += n;
+      //Update the number of key stream bytes consumed
+      context->pos += n;
+      //Remaining bytes to process
+      length -= n;
+   }
+}
+
+
+/**
+ * @brief Generate a key stream block and increment the block counter
+ * @param[in] context Pointer to the ChaCha context
+ **/
+
+void chachaProcessBlock(ChachaContext *context)
+{
+   uint_t i;
+   uint32_t *s;
+   uint32_t x0, x1, x2, x3, x4, x5, x6, x7;
+   uint32_t x8, x9, x10, x11, x12, x13, x14, x15;
+
+   //Point to the input state
+   s = context->state;
+
+   //The working state is kept in local variables so that the compiler
+   //can map it to registers
+   x0 = s[0];
+   x1 = s[1];
+   x2 = s[2];
+   x3 = s[3];
+   x4 = s[4];
+   x5 = s[5];
+   x6 = s[6];
+   x7 = s[7];
+   x8 = s[8];
+   x9 = s[9];
+   x10 = s[10];
+   x11 = s[11];
+   x12 = s[12];
+   x13 = s[13];
+   x14 = s[14];
+   x15 = s[15];
+
+   //Each double round consists of a column round and a diagonal round
+   for(i = 0; i < context->nr; i += 2)
+   {
+      //Column round
+      CHACHA_QUARTER_ROUND(x0, x4, x8, x12);
+      CHACHA_QUARTER_ROUND(x1, x5, x9, x13);
+      CHACHA_QUARTER_ROUND(x2, x6, x10, x14);
+      CHACHA_QUARTER_ROUND(x3, x7, x11, x15);
+
+      //Diagonal round
+      CHACHA_QUARTER_ROUND(x0, x5, x10, x15);
+      CHACHA_QUARTER_ROUND(x1, x6, x11, x12);
+      CHACHA_QUARTER_ROUND(x2, x7, x8, x13);
+      CHACHA_QUARTER_ROUND(x3, x4, x9, x14);
+   }
+
+   //Add the input state to the working state and serialize
+   //the result in little-endian order
+   STORE32LE(x0 + s[0], context->block);
+   STORE32LE(x1 + s[1], context->block + 4);
+   STORE32LE(x2 + s[2], context->block + 8);
+   STORE32LE(x3 + s[3], context->block + 12);
+   STORE32LE(x4 + s[4], context->block + 16);
+   STORE32LE(x5 + s[5], context->block + 20);
+   STORE32LE(x6 + s[6], context->block + 24);
+   STORE32LE(x7 + s[7], context->block + 28);
+   STORE32LE(x8 + s[8], context->block + 32);
+   STORE32LE(x9 + s[9], context->block + 36);
+   STORE32LE(x10 + s[10], context->block + 40);
+   STORE32LE(x11 + s[11], context->block + 44);
+   STORE32LE(x12 + s[12], context->block + 48);
+   STORE32LE(x13 + s[13], context->block + 52);
+   STORE32LE(x14 + s[14], context->block + 56);
+   STORE32LE(x15 + s[15], context->block + 60);
+
+   //Increment the block counter
+   s[12]++;
+
+   //The key stream block is ready for use
+   context->pos = 0;
+}
+
+#endif
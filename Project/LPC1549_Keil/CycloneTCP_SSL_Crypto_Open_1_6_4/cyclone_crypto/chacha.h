@@ -0,0 +1,71 @@
+/**
+ * @file chacha.h
+ * @brief ChaCha20 encryption algorithm
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCrypto Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+#ifndef _CHACHA_H
+#define _CHACHA_H
+
+//Dependencies
+#include "crypto.h"
+
+//Common interface for encryption algorithms
+#define CHACHA20_CIPHER_ALGO (&chacha20CipherAlgo)
+
+//ChaCha related constants
+#define CHACHA_KEY_SIZE 32
+#define CHACHA_NONCE_SIZE 12
+#define CHACHA_BLOCK_SIZE 64
+
+
+/**
+ * @brief ChaCha algorithm context
+ **/
+
+typedef struct
+{
+   uint_t nr;                             ///<Number of rounds
+   uint32_t state[16];                    ///<Input state (constants, key, counter and nonce)
+   uint8_t block[CHACHA_BLOCK_SIZE];      ///<Current key stream block
+   size_t pos;                            ///<Number of key stream bytes consumed
+} ChachaContext;
+
+
+//ChaCha related constants
+extern const CipherAlgo chacha20CipherAlgo;
+
+//ChaCha related functions
+error_t chachaInit(ChachaContext *context, uint_t nr, const uint8_t *key,
+   size_t keyLength, const uint8_t *nonce, size_t nonceLength);
+
+error_t chacha20Init(ChachaContext *context, const uint8_t *key, size_t keyLength);
+
+void chachaCipher(ChachaContext *context, const uint8_t *input,
+   uint8_t *output, size_t length);
+
+void chachaProcessBlock(ChachaContext *context);
+
+#endif
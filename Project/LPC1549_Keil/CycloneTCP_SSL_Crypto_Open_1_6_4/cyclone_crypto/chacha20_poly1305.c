@@ -0,0 +1,208 @@
+/**
+ * @file chacha20_poly1305.c
+ * @brief ChaCha20Poly1305 AEAD
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCrypto Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * ChaCha20Poly1305 is an authenticated encryption algorithm that combines
+ * the ChaCha20 stream cipher with the Poly1305 authenticator. The one-time
+ * Poly1305 key is derived from the first ChaCha20 key stream block.
+ * Refer to RFC 7539 for more details
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL CRYPTO_TRACE_LEVEL
+
+//Dependencies
+#include <string.h>
+#include "crypto.h"
+#include "chacha.h"
+#include "poly1305.h"
+#include "chacha20_poly1305.h"
+
+//Check crypto library configuration
+#if (CHACHA20_POLY1305_SUPPORT == ENABLED)
+
+
+/**
+ * @brief Authenticated encryption using ChaCha20Poly1305
+ * @param[in] k 256-bit key
+ * @param[in] kLen Length of the key
+ * @param[in] n 96-bit nonce
+ * @param[in] nLen Length of the nonce
+ * @param[in] a Additional authenticated data
+ * @param[in] aLen Length of the additional data
+ * @param[in] p Plaintext to be encrypted
+ * @param[out] c Ciphertext resulting from the encryption (may be equal to p)
+ * @param[in] length Total number of data bytes to be encrypted
+ * @param[out] t MAC resulting from the encryption process
+ * @param[in] tLen Length of the MAC
+ * @return Error code
+ **/
+
+error_t chacha20Poly1305Encrypt(const uint8_t *k, size_t kLen,
+   const uint8_t *n, size_t nLen, const uint8_t *a, size_t aLen,
+   const uint8_t *p, uint8_t *c, size_t length, uint8_t *t, size_t tLen)
+{
+   error_t error;
+   uint8_t temp[CHACHA_BLOCK_SIZE];
+   ChachaContext chachaContext;
+   Poly1305Context poly1305Context;
+
+   //Check the length of the MAC
+   if(tLen != POLY1305_TAG_SIZE)
+      return ERROR_INVALID_PARAMETER;
+
+   //Initialize ChaCha20 context
+   error = chachaInit(&chachaContext, 20, k, kLen, n, nLen);
+   //Any error to report?
+   if(error) return error;
+
+   //The one-time Poly1305 key is the first 32 bytes of the key stream
+   //block whose counter is zero. The rest of this block is discarded
+   chachaCipher(&chachaContext, NULL, temp, CHACHA_BLOCK_SIZE);
+   poly1305Init(&poly1305Context, temp);
+
+   //Encryption starts with the key stream block whose counter is one
+   chachaCipher(&chachaContext, p, c, length);
+
+   //Both the additional data and the ciphertext are padded with zeroes
+   //to a multiple of 16 bytes
+   memset(temp, 0, POLY1305_BLOCK_SIZE);
+
+   //Authenticate the additional data
+   poly1305Update(&poly1305Context, a, aLen);
+   if((aLen % POLY1305_BLOCK_SIZE) != 0)
+      poly1305Update(&poly1305Context, temp, POLY1305_BLOCK_SIZE - (aLen % POLY1305_BLOCK_SIZE));
+
+   //Authenticate the ciphertext
+   poly1305Update(&poly1305Context, c, length);
+   if((length % POLY1305_BLOCK_SIZE) != 0)
+      poly1305Update(&poly1305Context, temp, POLY1305_BLOCK_SIZE - (length % POLY1305_BLOCK_SIZE));
+
+   //The lengths are encoded as 64-bit little-endian integers
+   STORE32LE((uint32_t) aLen, temp);
+   STORE32LE(0, temp + 4);
+   STORE32LE((uint32_t) length, temp + 8);
+   STORE32LE(0, temp + 12);
+   poly1305Update(&poly1305Context, temp, 16);
+
+   //Compute the MAC
+   poly1305Final(&poly1305Context, t);
+
+   //Clear the ChaCha20 context and the one-time key
+   memset(&chachaContext, 0, sizeof(ChachaContext));
+   memset(temp, 0, CHACHA_BLOCK_SIZE);
+
+   //Successful encryption
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Authenticated decryption using ChaCha20Poly1305
+ * @param[in] k 256-bit key
+ * @param[in] kLen Length of the key
+ * @param[in] n 96-bit nonce
+ * @param[in] nLen Length of the nonce
+ * @param[in] a Additional authenticated data
+ * @param[in] aLen Length of the additional data
+ * @param[in] c Ciphertext to be decrypted
+ * @param[out] p Plaintext resulting from the decryption (may be equal to c)
+ * @param[in] length Total number of data bytes to be decrypted
+ * @param[in] t MAC to be verified
+ * @param[in] tLen Length of the MAC
+ * @return Error code
+ **/
+
+error_t chacha20Poly1305Decrypt(const uint8_t *k, size_t kLen,
+   const uint8_t *n, size_t nLen, const uint8_t *a, size_t aLen,
+   const uint8_t *c, uint8_t *p, size_t length, const uint8_t *t, size_t tLen)
+{
+   error_t error;
+   uint8_t mask;
+   size_t i;
+   uint8_t temp[CHACHA_BLOCK_SIZE];
+   ChachaContext chachaContext;
+   Poly1305Context poly1305Context;
+
+   //Check the length of the MAC
+   if(tLen != POLY1305_TAG_SIZE)
+      return ERROR_INVALID_PARAMETER;
+
+   //Initialize ChaCha20 context
+   error = chachaInit(&chachaContext, 20, k, kLen, n, nLen);
+   //Any error to report?
+   if(error) return error;
+
+   //The one-time Poly1305 key is the first 32 bytes of the key stream
+   //block whose counter is zero. The rest of this block is discarded
+   chachaCipher(&chachaContext, NULL, temp, CHACHA_BLOCK_SIZE);
+   poly1305Init(&poly1305Context, temp);
+
+   //The MAC is computed over the ciphertext, before decryption. Both the
+   //additional data and the ciphertext are padded with zeroes to a multiple
+   //of 16 bytes
+   memset(temp, 0, POLY1305_BLOCK_SIZE);
+
+   //Authenticate the additional data
+   poly1305Update(&poly1305Context, a, aLen);
+   if((aLen % POLY1305_BLOCK_SIZE) != 0)
+      poly1305Update(&poly1305Context, temp, POLY1305_BLOCK_SIZE - (aLen % POLY1305_BLOCK_SIZE));
+
+   //Authenticate the ciphertext
+   poly1305Update(&poly1305Context, c, length);
+   if((length % POLY1305_BLOCK_SIZE) != 0)
+      poly1305Update(&poly1305Context, temp, POLY1305_BLOCK_SIZE - (length % POLY1305_BLOCK_SIZE));
+
+   //The lengths are encoded as 64-bit little-endian integers
+   STORE32LE((uint32_t) aLen, temp);
+   STORE32LE(0, temp + 4);
+   STORE32LE((uint32_t) length, temp + 8);
+   STORE32LE(0, temp + 12);
+   poly1305Update(&poly1305Context, temp, 16);
+
+   //Compute the MAC
+   poly1305Final(&poly1305Context, temp);
+
+   //Decryption starts with the key stream block whose counter is one
+   chachaCipher(&chachaContext, c, p, length);
+
+   //Clear the ChaCha20 context
+   memset(&chachaContext, 0, sizeof(ChachaContext));
+
+   //The calculated MAC is compared in constant time
+   for(mask = 0, i = 0; i < tLen; i++)
+      mask |= temp[i] ^ t[i];
+
+   //Clear the calculated MAC and the one-time key
+   memset(temp, 0, CHACHA_BLOCK_SIZE);
+
+   //Return status code
+   return mask ? ERROR_FAILURE : NO_ERROR;
+}
+
+#endif
@@ -48,37 +48,58 @@
 
 
 /**
- * @brief Authenticated encryption using CCM
- * @param[in] cipher Cipher algorithm
- * @param[in] context Cipher algorithm context
+ * @brief Initialize CCM context
+ * @param[in] context Pointer to the CCM context
+ * @param[in] cipherAlgo Cipher algorithm
+ * @param[in] cipherContext Pointer to the cipher algorithm context
+ * @return Error code
+ **/
+
+error_t ccmInit(CcmContext *context, const CipherAlgo *cipherAlgo, void *cipherContext)
+{
+   //Check parameters
+   if(context == NULL || cipherAlgo == NULL || cipherContext == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //CCM supports only symmetric block ciphers whose block size is 128 bits
+   if(cipherAlgo->type != CIPHER_ALGO_TYPE_BLOCK || cipherAlgo->blockSize != 16)
+      return ERROR_INVALID_PARAMETER;
+
+   //Save cipher algorithm context
+   context->cipherAlgo = cipherAlgo;
+   context->cipherContext = cipherContext;
+
+   //Successful initialization
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Start processing a new message
+ *
+ * Since the length of the payload is authenticated before the payload
+ * itself, it must be known in advance
+ *
+ * @param[in] context Pointer to the CCM context
  * @param[in] n Nonce
  * @param[in] nLen Length of the nonce
  * @param[in] a Additional authenticated data
  * @param[in] aLen Length of the additional data
- * @param[in] p Plaintext to be encrypted
- * @param[out] c Ciphertext resulting from the encryption
- * @param[in] length Total number of data bytes to be encrypted
- * @param[out] t MAC resulting from the encryption process
+ * @param[in] length Total number of data bytes to be processed
  * @param[in] tLen Length of the MAC
  * @return Error code
  **/
 
-error_t ccmEncrypt(const CipherAlgo *cipher, void *context, const uint8_t *n, size_t nLen,
-   const uint8_t *a, size_t aLen, const uint8_t *p, uint8_t *c, size_t length, uint8_t *t, size_t tLen)
+error_t ccmStart(CcmContext *context, const uint8_t *n, size_t nLen,
+   const uint8_t *a, size_t aLen, size_t length, size_t tLen)
 {
    size_t m;
    size_t q;
    size_t qLen;
    uint8_t b[16];
-   uint8_t y[16];
-   uint8_t s[16];
 
-   //Check parameters
-   if(cipher == NULL || context == NULL)
-      return ERROR_INVALID_PARAMETER;
-
-   //CCM supports only symmetric block ciphers whose block size is 128 bits
-   if(cipher->type != CIPHER_ALGO_TYPE_BLOCK || cipher->blockSize != 16)
+   //Make sure the CCM context is valid
+   if(context == NULL)
       return ERROR_INVALID_PARAMETER;
 
    //Check the length of the nonce
@@ -112,7 +133,7 @@ error_t ccmEncrypt(const CipherAlgo *cipher, void *context, const uint8_t *n, si
       return ERROR_INVALID_LENGTH;
 
    //Set Y(0) = CIPH(B(0))
-   cipher->encryptBlock(context, b, y);
+   context->cipherAlgo->encryptBlock(context->cipherContext, b, context->y);
 
    //Any additional data?
    if(aLen > 0)
@@ -144,9 +165,9 @@ error_t ccmEncrypt(const CipherAlgo *cipher, void *context, const uint8_t *n, si
       }
 
       //XOR B(1) with Y(0)
-      ccmXorBlock(y, b, y, 16);
+      ccmXorBlock(context->y, b, context->y, 16);
       //Compute Y(1) = CIPH(B(1) ^ Y(0))
-      cipher->encryptBlock(context, y, y);
+      context->cipherAlgo->encryptBlock(context->cipherContext, context->y, context->y);
 
       //Number of remaining data bytes
       aLen -= m;
@@ -159,9 +180,9 @@ error_t ccmEncrypt(const CipherAlgo *cipher, void *context, const uint8_t *n, si
          m = MIN(aLen, 16);
 
          //XOR B(i) with Y(i-1)
-         ccmXorBlock(y, a, y, m);
+         ccmXorBlock(context->y, a, context->y, m);
          //Compute Y(i) = CIPH(B(i) ^ Y(i-1))
-         cipher->encryptBlock(context, y, y);
+         context->cipherAlgo->encryptBlock(context->cipherContext, context->y, context->y);
 
          //Next block
          aLen -= m;
@@ -170,213 +191,197 @@ error_t ccmEncrypt(const CipherAlgo *cipher, void *context, const uint8_t *n, si
    }
 
    //Format CTR(0)
-   b[0] = qLen - 1;
+   context->ctr[0] = qLen - 1;
    //Copy the nonce
-   memcpy(b + 1, n, nLen);
+   memcpy(context->ctr + 1, n, nLen);
    //Initialize counter value
-   memset(b + 1 + nLen, 0, qLen);
+   memset(context->ctr + 1 + nLen, 0, qLen);
+
+   //Compute S(0) = CIPH(CTR(0)) and save MSB(S(0))
+   context->cipherAlgo->encryptBlock(context->cipherContext, context->ctr, context->t);
+
+   //Save message parameters
+   context->qLen = qLen;
+   context->tLen = tLen;
+   context->length = length;
+   //No data has been processed yet
+   context->pos = 0;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Encrypt a chunk of plaintext
+ *
+ * This function can be called any number of times between ccmStart()
+ * and ccmEncryptFinal(). The chunks do not need to be block-aligned
+ *
+ * @param[in] context Pointer to the CCM context
+ * @param[in] p Plaintext to be encrypted
+ * @param[out] c Ciphertext resulting from the encryption
+ * @param[in] length Number of data bytes to be encrypted
+ * @return Error code
+ **/
 
-   //Compute S(0) = CIPH(CTR(0))
-   cipher->encryptBlock(context, b, s);
-   //Save MSB(S(0))
-   memcpy(t, s, tLen);
+error_t ccmEncryptUpdate(CcmContext *context, const uint8_t *p, uint8_t *c, size_t length)
+{
+   size_t k;
+   size_t n;
+
+   //The total length must match the value specified in ccmStart()
+   if(length > (context->length - context->pos))
+      return ERROR_INVALID_LENGTH;
 
    //Encrypt plaintext
    while(length > 0)
    {
-      //The encryption operates in a block-by-block fashion
-      m = MIN(length, 16);
+      //Current position in the block
+      n = context->pos % 16;
+
+      //Start of a new block?
+      if(n == 0)
+      {
+         //Increment counter
+         ccmIncCounter(context->ctr, context->qLen);
+         //Compute S(i) = CIPH(CTR(i))
+         context->cipherAlgo->encryptBlock(context->cipherContext, context->ctr, context->s);
+      }
+
+      //Number of bytes to process at a time
+      k = MIN(length, 16 - n);
 
       //XOR B(i) with Y(i-1)
-      ccmXorBlock(y, p, y, m);
-      //Compute Y(i) = CIPH(B(i) ^ Y(i-1))
-      cipher->encryptBlock(context, y, y);
-
-      //Increment counter
-      ccmIncCounter(b, qLen);
-      //Compute S(i) = CIPH(CTR(i))
-      cipher->encryptBlock(context, b, s);
+      ccmXorBlock(context->y + n, p, context->y + n, k);
       //Compute C(i) = B(i) XOR S(i)
-      ccmXorBlock(c, p, s, m);
+      ccmXorBlock(c, p, context->s + n, k);
 
-      //Next block
-      length -= m;
-      p += m;
-      c += m;
-   }
+      //Update the number of data bytes processed so far
+      context->pos += k;
 
-   //Compute MAC
-   ccmXorBlock(t, t, y, tLen);
+      //Compute Y(i) = CIPH(B(i) ^ Y(i-1)) once a complete block is available
+      if((context->pos % 16) == 0)
+         context->cipherAlgo->encryptBlock(context->cipherContext, context->y, context->y);
 
-   //Successful encryption
+      //Next chunk
+      p += k;
+      c += k;
+      length -= k;
+   }
+
+   //Successful processing
    return NO_ERROR;
 }
 
 
 /**
- * @brief Authenticated decryption using CCM
- * @param[in] cipher Cipher algorithm
- * @param[in] context Cipher algorithm context
- * @param[in] n Nonce
- * @param[in] nLen Length of the nonce
- * @param[in] a Additional authenticated data
- * @param[in] aLen Length of the additional data
+ * @brief Decrypt a chunk of ciphertext
+ *
+ * This function can be called any number of times between ccmStart()
+ * and ccmDecryptFinal(). The chunks do not need to be block-aligned
+ *
+ * @param[in] context Pointer to the CCM context
  * @param[in] c Ciphertext to be decrypted
  * @param[out] p Plaintext resulting from the decryption
- * @param[in] length Total number of data bytes to be decrypted
- * @param[in] t MAC to be verified
- * @param[in] tLen Length of the MAC
+ * @param[in] length Number of data bytes to be decrypted
  * @return Error code
  **/
 
-error_t ccmDecrypt(const CipherAlgo *cipher, void *context, const uint8_t *n, size_t nLen,
-   const uint8_t *a, size_t aLen, const uint8_t *c, uint8_t *p, size_t length, const uint8_t *t, size_t tLen)
+error_t ccmDecryptUpdate(CcmContext *context, const uint8_t *c, uint8_t *p, size_t length)
 {
-   size_t m;
-   size_t q;
-   size_t qLen;
-   uint8_t b[16];
-   uint8_t y[16];
-   uint8_t r[16];
-   uint8_t s[16];
+   size_t k;
+   size_t n;
 
-   //Check parameters
-   if(cipher == NULL || context == NULL)
-      return ERROR_INVALID_PARAMETER;
-
-   //CCM supports only symmetric block ciphers whose block size is 128 bits
-   if(cipher->type != CIPHER_ALGO_TYPE_BLOCK || cipher->blockSize != 16)
-      return ERROR_INVALID_PARAMETER;
-
-   //Check the length of the nonce
-   if(nLen < 7 || nLen > 13)
+   //The total length must match the value specified in ccmStart()
+   if(length > (context->length - context->pos))
       return ERROR_INVALID_LENGTH;
-   //Check the length of the MAC
-   if(tLen < 4 || tLen > 16 || tLen % 2)
-      return ERROR_INVALID_LENGTH;
-
-   //Q is the bit string representation of the octet length of C
-   q = length;
-   //Compute the octet length of Q
-   qLen = 15 - nLen;
 
-   //Format the leading octet of the first block
-   b[0] = (aLen > 0) ? 0x40 : 0x00;
-   //Encode the octet length of T
-   b[0] |= ((tLen - 2) / 2) << 3;
-   //Encode the octet length of Q
-   b[0] |= qLen - 1;
-
-   //Copy the nonce
-   memcpy(b + 1, n, nLen);
-
-   //Encode the length field Q
-   for(m = 0; m < qLen; m++, q >>= 8)
-      b[15 - m] = q & 0xFF;
-
-   //Invalid length?
-   if(q != 0)
-      return ERROR_INVALID_LENGTH;
-
-   //Set Y(0) = CIPH(B(0))
-   cipher->encryptBlock(context, b, y);
-
-   //Any additional data?
-   if(aLen > 0)
+   //Decrypt ciphertext
+   while(length > 0)
    {
-      //Format the associated data
-      memset(b, 0, 16);
+      //Current position in the block
+      n = context->pos % 16;
 
-      //Check the length of the associated data string
-      if(aLen < 0xFF00)
-      {
-         //The length is encoded as 2 octets
-         STORE16BE(aLen, b);
-         //Number of bytes to copy
-         m = MIN(aLen, 16 - 2);
-         //Concatenate the associated data A
-         memcpy(b + 2, a, m);
-      }
-      else
+      //Start of a new block?
+      if(n == 0)
       {
-         //The length is encoded as 6 octets
-         b[0] = 0xFF;
-         b[1] = 0xFE;
-         //MSB is stored first
-         STORE32BE(aLen, b + 2);
-         //Number of bytes to copy
-         m = MIN(aLen, 16 - 6);
-         //Concatenate the associated data A
-         memcpy(b + 6, a, m);
+         //Increment counter
+         ccmIncCounter(context->ctr, context->qLen);
+         //Compute S(i) = CIPH(CTR(i))
+         context->cipherAlgo->encryptBlock(context->cipherContext, context->ctr, context->s);
       }
 
-      //XOR B(1) with Y(0)
-      ccmXorBlock(y, b, y, 16);
-      //Compute Y(1) = CIPH(B(1) ^ Y(0))
-      cipher->encryptBlock(context, y, y);
+      //Number of bytes to process at a time
+      k = MIN(length, 16 - n);
 
-      //Number of remaining data bytes
-      aLen -= m;
-      a += m;
+      //Compute B(i) = C(i) XOR S(i)
+      ccmXorBlock(p, c, context->s + n, k);
+      //XOR B(i) with Y(i-1)
+      ccmXorBlock(context->y + n, p, context->y + n, k);
 
-      //Process the remaining data bytes
-      while(aLen > 0)
-      {
-         //Associated data are processed in a block-by-block fashion
-         m = MIN(aLen, 16);
+      //Update the number of data bytes processed so far
+      context->pos += k;
 
-         //XOR B(i) with Y(i-1)
-         ccmXorBlock(y, a, y, m);
-         //Compute Y(i) = CIPH(B(i) ^ Y(i-1))
-         cipher->encryptBlock(context, y, y);
+      //Compute Y(i) = CIPH(B(i) ^ Y(i-1)) once a complete block is available
+      if((context->pos % 16) == 0)
+         context->cipherAlgo->encryptBlock(context->cipherContext, context->y, context->y);
 
-         //Next block
-         aLen -= m;
-         a += m;
-      }
+      //Next chunk
+      c += k;
+      p += k;
+      length -= k;
    }
 
-   //Format CTR(0)
-   b[0] = qLen - 1;
-   //Copy the nonce
-   memcpy(b + 1, n, nLen);
-   //Initialize counter value
-   memset(b + 1 + nLen, 0, qLen);
+   //Successful processing
+   return NO_ERROR;
+}
 
-   //Compute S(0) = CIPH(CTR(0))
-   cipher->encryptBlock(context, b, s);
-   //Save MSB(S(0))
-   memcpy(r, s, tLen);
 
-   //Decrypt ciphertext
-   while(length > 0)
-   {
-      //The decryption operates in a block-by-block fashion
-      m = MIN(length, 16);
+/**
+ * @brief Finish encrypting the current message
+ * @param[in] context Pointer to the CCM context
+ * @param[out] t MAC resulting from the encryption process
+ * @return Error code
+ **/
 
-      //Increment counter
-      ccmIncCounter(b, qLen);
-      //Compute S(i) = CIPH(CTR(i))
-      cipher->encryptBlock(context, b, s);
-      //Compute B(i) = C(i) XOR S(i)
-      ccmXorBlock(p, c, s, m);
+error_t ccmEncryptFinal(CcmContext *context, uint8_t *t)
+{
+   //The whole payload must have been processed
+   if(context->pos != context->length)
+      return ERROR_INVALID_LENGTH;
 
-      //XOR B(i) with Y(i-1)
-      ccmXorBlock(y, p, y, m);
-      //Compute Y(i) = CIPH(B(i) ^ Y(i-1))
-      cipher->encryptBlock(context, y, y);
-
-      //Next block
-      length -= m;
-      c += m;
-      p += m;
-   }
+   //The last block of data may be incomplete
+   if((context->pos % 16) != 0)
+      context->cipherAlgo->encryptBlock(context->cipherContext, context->y, context->y);
 
    //Compute MAC
-   ccmXorBlock(r, r, y, tLen);
+   ccmXorBlock(t, context->t, context->y, context->tLen);
+
+   //Successful encryption
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Finish decrypting the current message
+ * @param[in] context Pointer to the CCM context
+ * @param[in] t MAC to be verified
+ * @return Error code
+ **/
+
+error_t ccmDecryptFinal(CcmContext *context, const uint8_t *t)
+{
+   error_t error;
+   uint8_t r[16];
+
+   //Compute the expected MAC
+   error = ccmEncryptFinal(context, r);
+   //Any error to report?
+   if(error) return error;
 
    //Verify MAC
-   if(memcmp(r, t, tLen))
+   if(memcmp(r, t, context->tLen))
       return ERROR_FAILURE;
 
    //Successful decryption
@@ -384,6 +389,90 @@ error_t ccmDecrypt(const CipherAlgo *cipher, void *context, const uint8_t *n, si
 }
 
 
+/**
+ * @brief Authenticated encryption using CCM
+ * @param[in] cipher Cipher algorithm
+ * @param[in] context Cipher algorithm context
+ * @param[in] n Nonce
+ * @param[in] nLen Length of the nonce
+ * @param[in] a Additional authenticated data
+ * @param[in] aLen Length of the additional data
+ * @param[in] p Plaintext to be encrypted
+ * @param[out] c Ciphertext resulting from the encryption
+ * @param[in] length Total number of data bytes to be encrypted
+ * @param[out] t MAC resulting from the encryption process
+ * @param[in] tLen Length of the MAC
+ * @return Error code
+ **/
+
+error_t ccmEncrypt(const CipherAlgo *cipher, void *context, const uint8_t *n, size_t nLen,
+   const uint8_t *a, size_t aLen, const uint8_t *p, uint8_t *c, size_t length, uint8_t *t, size_t tLen)
+{
+   error_t error;
+   CcmContext ccmContext;
+
+   //Initialize CCM context
+   error = ccmInit(&ccmContext, cipher, context);
+   //Any error to report?
+   if(error) return error;
+
+   //Process the nonce and the additional data
+   error = ccmStart(&ccmContext, n, nLen, a, aLen, length, tLen);
+   //Any error to report?
+   if(error) return error;
+
+   //Encrypt plaintext
+   error = ccmEncryptUpdate(&ccmContext, p, c, length);
+   //Any error to report?
+   if(error) return error;
+
+   //Compute MAC
+   return ccmEncryptFinal(&ccmContext, t);
+}
+
+
+/**
+ * @brief Authenticated decryption using CCM
+ * @param[in] cipher Cipher algorithm
+ * @param[in] context Cipher algorithm context
+ * @param[in] n Nonce
+ * @param[in] nLen Length of the nonce
+ * @param[in] a Additional authenticated data
+ * @param[in] aLen Length of the additional data
+ * @param[in] c Ciphertext to be decrypted
+ * @param[out] p Plaintext resulting from the decryption
+ * @param[in] length Total number of data bytes to be decrypted
+ * @param[in] t MAC to be verified
+ * @param[in] tLen Length of the MAC
+ * @return Error code
+ **/
+
+error_t ccmDecrypt(const CipherAlgo *cipher, void *context, const uint8_t *n, size_t nLen,
+   const uint8_t *a, size_t aLen, const uint8_t *c, uint8_t *p, size_t length, const uint8_t *t, size_t tLen)
+{
+   error_t error;
+   CcmContext ccmContext;
+
+   //Initialize CCM context
+   error = ccmInit(&ccmContext, cipher, context);
+   //Any error to report?
+   if(error) return error;
+
+   //Process the nonce and the additional data
+   error = ccmStart(&ccmContext, n, nLen, a, aLen, length, tLen);
+   //Any error to report?
+   if(error) return error;
+
+   //Decrypt ciphertext
+   error = ccmDecryptUpdate(&ccmContext, c, p, length);
+   //Any error to report?
+   if(error) return error;
+
+   //Verify MAC
+   return ccmDecryptFinal(&ccmContext, t);
+}
+
+
 /**
  * @brief XOR operation
  * @param[out] a Block resulting from the XOR operation
@@ -32,7 +32,38 @@
 //Dependencies
 #include "crypto.h"
 
+
+/**
+ * @brief CCM context
+ **/
+
+typedef struct
+{
+   const CipherAlgo *cipherAlgo;  ///<Cipher algorithm
+   void *cipherContext;           ///<Cipher algorithm context
+   size_t qLen;                   ///<Octet length of the length field Q
+   size_t tLen;                   ///<Length of the MAC
+   size_t length;                 ///<Total number of data bytes to be processed
+   size_t pos;                    ///<Number of data bytes processed so far
+   uint8_t y[16];                 ///<CBC-MAC value
+   uint8_t ctr[16];               ///<Counter block
+   uint8_t s[16];                 ///<Current key stream block
+   uint8_t t[16];                 ///<MSB(S(0))
+} CcmContext;
+
+
 //CCM related functions
+error_t ccmInit(CcmContext *context, const CipherAlgo *cipherAlgo, void *cipherContext);
+
+error_t ccmStart(CcmContext *context, const uint8_t *n, size_t nLen,
+   const uint8_t *a, size_t aLen, size_t length, size_t tLen);
+
+error_t ccmEncryptUpdate(CcmContext *context, const uint8_t *p, uint8_t *c, size_t length);
+error_t ccmDecryptUpdate(CcmContext *context, const uint8_t *c, uint8_t *p, size_t length);
+
+error_t ccmEncryptFinal(CcmContext *context, uint8_t *t);
+error_t ccmDecryptFinal(CcmContext *context, const uint8_t *t);
+
 error_t ccmEncrypt(const CipherAlgo *cipher, void *context, const uint8_t *n, size_t nLen,
    const uint8_t *a, size_t aLen, const uint8_t *p, uint8_t *c, size_t length, uint8_t *t, size_t tLen);
 
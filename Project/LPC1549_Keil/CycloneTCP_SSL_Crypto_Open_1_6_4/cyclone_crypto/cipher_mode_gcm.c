@@ -44,219 +44,180 @@
 //Check crypto library configuration
 #if (GCM_SUPPORT == ENABLED)
 
+#if (GCM_TABLE_W == 4)
+
+//Reduction table (4-bit table-driven multiplication)
+static const uint32_t r[16] =
+{
+   0x00000000, 0x1C200000, 0x38400000, 0x24600000,
+   0x70800000, 0x6CA00000, 0x48C00000, 0x54E00000,
+   0xE1000000, 0xFD200000, 0xD9400000, 0xC5600000,
+   0x91800000, 0x8DA00000, 0xA9C00000, 0xB5E00000
+};
+
+#else
+
+//Reduction table (8-bit table-driven multiplication)
+static const uint16_t r[256] =
+{
+   0x0000, 0x01C2, 0x0384, 0x0246, 0x0708, 0x06CA, 0x048C, 0x054E,
+   0x0E10, 0x0FD2, 0x0D94, 0x0C56, 0x0918, 0x08DA, 0x0A9C, 0x0B5E,
+   0x1C20, 0x1DE2, 0x1FA4, 0x1E66, 0x1B28, 0x1AEA, 0x18AC, 0x196E,
+   0x1230, 0x13F2, 0x11B4, 0x1076, 0x1538, 0x14FA, 0x16BC, 0x177E,
+   0x3840, 0x3982, 0x3BC4, 0x3A06, 0x3F48, 0x3E8A, 0x3CCC, 0x3D0E,
+   0x3650, 0x3792, 0x35D4, 0x3416, 0x3158, 0x309A, 0x32DC, 0x331E,
+   0x2460, 0x25A2, 0x27E4, 0x2626, 0x2368, 0x22AA, 0x20EC, 0x212E,
+   0x2A70, 0x2BB2, 0x29F4, 0x2836, 0x2D78, 0x2CBA, 0x2EFC, 0x2F3E,
+   0x7080, 0x7142, 0x7304, 0x72C6, 0x7788, 0x764A, 0x740C, 0x75CE,
+   0x7E90, 0x7F52, 0x7D14, 0x7CD6, 0x7998, 0x785A, 0x7A1C, 0x7BDE,
+   0x6CA0, 0x6D62, 0x6F24, 0x6EE6, 0x6BA8, 0x6A6A, 0x682C, 0x69EE,
+   0x62B0, 0x6372, 0x6134, 0x60F6, 0x65B8, 0x647A, 0x663C, 0x67FE,
+   0x48C0, 0x4902, 0x4B44, 0x4A86, 0x4FC8, 0x4E0A, 0x4C4C, 0x4D8E,
+   0x46D0, 0x4712, 0x4554, 0x4496, 0x41D8, 0x401A, 0x425C, 0x439E,
+   0x54E0, 0x5522, 0x5764, 0x56A6, 0x53E8, 0x522A, 0x506C, 0x51AE,
+   0x5AF0, 0x5B32, 0x5974, 0x58B6, 0x5DF8, 0x5C3A, 0x5E7C, 0x5FBE,
+   0xE100, 0xE0C2, 0xE284, 0xE346, 0xE608, 0xE7CA, 0xE58C, 0xE44E,
+   0xEF10, 0xEED2, 0xEC94, 0xED56, 0xE818, 0xE9DA, 0xEB9C, 0xEA5E,
+   0xFD20, 0xFCE2, 0xFEA4, 0xFF66, 0xFA28, 0xFBEA, 0xF9AC, 0xF86E,
+   0xF330, 0xF2F2, 0xF0B4, 0xF176, 0xF438, 0xF5FA, 0xF7BC, 0xF67E,
+   0xD940, 0xD882, 0xDAC4, 0xDB06, 0xDE48, 0xDF8A, 0xDDCC, 0xDC0E,
+   0xD750, 0xD692, 0xD4D4, 0xD516, 0xD058, 0xD19A, 0xD3DC, 0xD21E,
+   0xC560, 0xC4A2, 0xC6E4, 0xC726, 0xC268, 0xC3AA, 0xC1EC, 0xC02E,
+   0xCB70, 0xCAB2, 0xC8F4, 0xC936, 0xCC78, 0xCDBA, 0xCFFC, 0xCE3E,
+   0x9180, 0x9042, 0x9204, 0x93C6, 0x9688, 0x974A, 0x950C, 0x94CE,
+   0x9F90, 0x9E52, 0x9C14, 0x9DD6, 0x9898, 0x995A, 0x9B1C, 0x9ADE,
+   0x8DA0, 0x8C62, 0x8E24, 0x8FE6, 0x8AA8, 0x8B6A, 0x892C, 0x88EE,
+   0x83B0, 0x8272, 0x8034, 0x81F6, 0x84B8, 0x857A, 0x873C, 0x86FE,
+   0xA9C0, 0xA802, 0xAA44, 0xAB86, 0xAEC8, 0xAF0A, 0xAD4C, 0xAC8E,
+   0xA7D0, 0xA612, 0xA454, 0xA596, 0xA0D8, 0xA11A, 0xA35C, 0xA29E,
+   0xB5E0, 0xB422, 0xB664, 0xB7A6, 0xB2E8, 0xB32A, 0xB16C, 0xB0AE,
+   0xBBF0, 0xBA32, 0xB874, 0xB9B6, 0xBCF8, 0xBD3A, 0xBF7C, 0xBEBE
+};
+
+#endif
+
 
 /**
- * @brief Authenticated encryption using GCM
- * @param[in] cipher Cipher algorithm
- * @param[in] context Cipher algorithm context
- * @param[in] iv Initialization vector
- * @param[in] ivLen Length of the initialization vector
- * @param[in] a Additional authenticated data
- * @param[in] aLen Length of the additional data
- * @param[in] p Plaintext to be encrypted
- * @param[out] c Ciphertext resulting from the encryption
- * @param[in] length Total number of data bytes to be encrypted
- * @param[out] t Authentication tag
- * @param[in] tLen Length of the authentication tag
+ * @brief Initialize GCM context
+ *
+ * The hash subkey H is computed and the table of its multiples is
+ * precalculated once for all. The same context can then be used to
+ * process any number of messages under the same key
+ *
+ * @param[in] context Pointer to the GCM context
+ * @param[in] cipherAlgo Cipher algorithm
+ * @param[in] cipherContext Pointer to the cipher algorithm context
  * @return Error code
  **/
 
-error_t gcmEncrypt(const CipherAlgo *cipher, void *context, const uint8_t *iv, size_t ivLen,
-   const uint8_t *a, size_t aLen, const uint8_t *p, uint8_t *c, size_t length, uint8_t *t, size_t tLen)
+error_t gcmInit(GcmContext *context, const CipherAlgo *cipherAlgo, void *cipherContext)
 {
-   size_t k;
-   size_t n;
-   uint8_t b[16];
+   uint_t i;
+   uint_t j;
+   uint32_t c;
    uint8_t h[16];
-   uint8_t j[16];
-   uint8_t s[16];
 
    //Check parameters
-   if(cipher == NULL || context == NULL)
+   if(context == NULL || cipherAlgo == NULL || cipherContext == NULL)
       return ERROR_INVALID_PARAMETER;
 
    //GCM supports only symmetric block ciphers whose block size is 128 bits
-   if(cipher->type != CIPHER_ALGO_TYPE_BLOCK || cipher->blockSize != 16)
+   if(cipherAlgo->type != CIPHER_ALGO_TYPE_BLOCK || cipherAlgo->blockSize != 16)
       return ERROR_INVALID_PARAMETER;
 
-   //The length of the IV shall meet SP 800-38D requirements
-   if(ivLen < 1)
-      return ERROR_INVALID_PARAMETER;
-   //Check the length of the authentication tag
-   if(tLen < 4 || tLen > 16)
-      return ERROR_INVALID_PARAMETER;
+   //Save cipher algorithm context
+   context->cipherAlgo = cipherAlgo;
+   context->cipherContext = cipherContext;
 
    //Generate the hash subkey H
-   memset(h, 0, 16 );
-   cipher->encryptBlock(context, h, h);
-
-   //Check whether the length of the IV is 96 bits
-   if(ivLen == 12)
+   memset(h, 0, 16);
+   cipherAlgo->encryptBlock(cipherContext, h, h);
+
+   //M(0) = 0
+   memset(context->m[0], 0, 16);
+
+   //The most significant bit of the index is the coefficient of x^0,
+   //hence M(N/2) = H
+   j = GCM_TABLE_N / 2;
+   context->m[j][0] = LOAD32BE(h);
+   context->m[j][1] = LOAD32BE(h + 4);
+   context->m[j][2] = LOAD32BE(h + 8);
+   context->m[j][3] = LOAD32BE(h + 12);
+
+   //Compute M(j/2) = M(j) * x
+   for(; j > 1; j /= 2)
    {
-      //When the length of the IV is 96 bits, the padding string is
-      //appended to the IV to form the pre-counter block
-      memcpy(j, iv, 12);
-      STORE32BE(1, j + 12);
+      //The multiplication of a polynomial by x in GF(2^128) corresponds
+      //to a shift of indices
+      c = context->m[j][3] & 0x01;
+      context->m[j / 2][3] = (context->m[j][3] >> 1) | (context->m[j][2] << 31);
+      context->m[j / 2][2] = (context->m[j][2] >> 1) | (context->m[j][1] << 31);
+      context->m[j / 2][1] = (context->m[j][1] >> 1) | (context->m[j][0] << 31);
+      context->m[j / 2][0] = context->m[j][0] >> 1;
+
+      //If the highest term of the result is equal to one, then perform reduction
+      if(c != 0)
+         context->m[j / 2][0] ^= 0xE1000000;
    }
-   else
-   {
-      //Initialize GHASH calculation
-      memset(j, 0, 16);
 
-      //Length of the IV
-      n = ivLen;
-
-      //Process the initialization vector
-      while(n > 0)
+   //The remaining entries are obtained by linearity
+   for(j = 2; j < GCM_TABLE_N; j *= 2)
+   {
+      for(i = 1; i < j; i++)
       {
-         //The IV processed in a block-by-block fashion
-         k = MIN(n, 16);
-
-         //Apply GHASH function
-         gcmXorBlock(j, j, iv, k);
-         gcmMul(j, h);
-
-         //Next block
-         iv += k;
-         n -= k;
+         //Compute M(j + i) = M(j) + M(i)
+         context->m[j + i][0] = context->m[j][0] ^ context->m[i][0];
+         context->m[j + i][1] = context->m[j][1] ^ context->m[i][1];
+         context->m[j + i][2] = context->m[j][2] ^ context->m[i][2];
+         context->m[j + i][3] = context->m[j][3] ^ context->m[i][3];
       }
-
-      //The string is appended with 64 additional 0 bits, followed by the
-      //64-bit representation of the length of the IV
-      memset(b, 0, 16);
-      STORE32BE(ivLen * 8, b + 12);
-
-      //The GHASH function is applied to the resulting string to form the
-      //pre-counter block
-      gcmXorBlock(j, j, b, 16);
-      gcmMul(j, h);
-   }
-
-   //Compute MSB(CIPH(J(0)))
-   cipher->encryptBlock(context, j, b);
-   memcpy(t, b, tLen);
-
-   //Initialize GHASH calculation
-   memset(s, 0, 16);
-   //Length of the AAD
-   n = aLen;
-
-   //Process AAD
-   while(n > 0)
-   {
-      //Additional data are processed in a block-by-block fashion
-      k = MIN(n, 16);
-
-      //Apply GHASH function
-      gcmXorBlock(s, s, a, k);
-      gcmMul(s, h);
-
-      //Next block
-      a += k;
-      n -= k;
    }
 
-   //Length of the plaintext
-   n = length;
-
-   //Process plaintext
-   while(n > 0)
-   {
-      //The encryption operates in a block-by-block fashion
-      k = MIN(n, 16);
-
-      //Increment counter
-      gcmIncCounter(j);
-
-      //Encrypt plaintext
-      cipher->encryptBlock(context, j, b);
-      gcmXorBlock(c, p, b, k);
+   //Clear the hash subkey from the stack
+   memset(h, 0, 16);
 
-      //Apply GHASH function
-      gcmXorBlock(s, s, c, k);
-      gcmMul(s, h);
-
-      //Next block
-      p += k;
-      c += k;
-      n -= k;
-   }
-
-   //Append the 64-bit representation of the length of the AAD and the ciphertext
-   memset(b, 0, 16);
-   STORE32BE(aLen * 8, b + 4);
-   STORE32BE(length * 8, b + 12);
-
-   //The GHASH function is applied to the result to produce a single output block S
-   gcmXorBlock(s, s, b, 16);
-   gcmMul(s, h);
-
-   //Let T = MSB(GCTR(J(0), S)
-   gcmXorBlock(t, t, s, tLen);
-
-   //Successful encryption
+   //Successful initialization
    return NO_ERROR;
 }
 
 
 /**
- * @brief Authenticated decryption using GCM
- * @param[in] cipher Cipher algorithm
- * @param[in] context Cipher algorithm context
+ * @brief Start processing a new message
+ * @param[in] context Pointer to the GCM context
  * @param[in] iv Initialization vector
  * @param[in] ivLen Length of the initialization vector
  * @param[in] a Additional authenticated data
  * @param[in] aLen Length of the additional data
- * @param[in] c Ciphertext to be decrypted
- * @param[out] p Plaintext resulting from the decryption
- * @param[in] length Total number of data bytes to be decrypted
- * @param[in] t Authentication tag
- * @param[in] tLen Length of the authentication tag
  * @return Error code
  **/
 
-error_t gcmDecrypt(const CipherAlgo *cipher, void *context, const uint8_t *iv, size_t ivLen,
-   const uint8_t *a, size_t aLen, const uint8_t *c, uint8_t *p, size_t length, const uint8_t *t, size_t tLen)
+error_t gcmStart(GcmContext *context, const uint8_t *iv, size_t ivLen,
+   const uint8_t *a, size_t aLen)
 {
    size_t k;
    size_t n;
    uint8_t b[16];
-   uint8_t h[16];
-   uint8_t j[16];
-   uint8_t r[16];
-   uint8_t s[16];
 
-   //Check parameters
-   if(cipher == NULL || context == NULL)
-      return ERROR_INVALID_PARAMETER;
-
-   //GCM supports only symmetric block ciphers whose block size is 128 bits
-   if(cipher->type != CIPHER_ALGO_TYPE_BLOCK || cipher->blockSize != 16)
+   //Make sure the GCM context is valid
+   if(context == NULL)
       return ERROR_INVALID_PARAMETER;
 
    //The length of the IV shall meet SP 800-38D requirements
    if(ivLen < 1)
       return ERROR_INVALID_PARAMETER;
-   //Check the length of the authentication tag
-   if(tLen < 4 || tLen > 16)
-      return ERROR_INVALID_PARAMETER;
-
-   //Generate the hash subkey H
-   memset(h, 0, 16 );
-   cipher->encryptBlock(context, h, h);
 
    //Check whether the length of the IV is 96 bits
    if(ivLen == 12)
    {
       //When the length of the IV is 96 bits, the padding string is
       //appended to the IV to form the pre-counter block
-      memcpy(j, iv, 12);
-      STORE32BE(1, j + 12);
+      memcpy(context->j, iv, 12);
+      STORE32BE(1, context->j + 12);
    }
    else
    {
       //Initialize GHASH calculation
-      memset(j, 0, 16);
+      memset(context->j, 0, 16);
 
       //Length of the IV
       n = ivLen;
@@ -268,8 +229,8 @@ error_t gcmDecrypt(const CipherAlgo *cipher, void *context, const uint8_t *iv, s
          k = MIN(n, 16);
 
          //Apply GHASH function
-         gcmXorBlock(j, j, iv, k);
-         gcmMul(j, h);
+         gcmXorBlock(context->j, context->j, iv, k);
+         gcmMul(context, context->j);
 
          //Next block
          iv += k;
@@ -283,16 +244,15 @@ error_t gcmDecrypt(const CipherAlgo *cipher, void *context, const uint8_t *iv, s
 
       //The GHASH function is applied to the resulting string to form the
       //pre-counter block
-      gcmXorBlock(j, j, b, 16);
-      gcmMul(j, h);
+      gcmXorBlock(context->j, context->j, b, 16);
+      gcmMul(context, context->j);
    }
 
    //Compute MSB(CIPH(J(0)))
-   cipher->encryptBlock(context, j, b);
-   memcpy(r, b, tLen);
+   context->cipherAlgo->encryptBlock(context->cipherContext, context->j, context->t);
 
    //Initialize GHASH calculation
-   memset(s, 0, 16);
+   memset(context->s, 0, 16);
    //Length of the AAD
    n = aLen;
 
@@ -303,51 +263,188 @@ error_t gcmDecrypt(const CipherAlgo *cipher, void *context, const uint8_t *iv, s
       k = MIN(n, 16);
 
       //Apply GHASH function
-      gcmXorBlock(s, s, a, k);
-      gcmMul(s, h);
+      gcmXorBlock(context->s, context->s, a, k);
+      gcmMul(context, context->s);
 
       //Next block
       a += k;
       n -= k;
    }
 
-   //Length of the ciphertext
-   n = length;
+   //Save the length of the AAD
+   context->aLen = aLen;
+   //No data has been processed yet
+   context->length = 0;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Encrypt a chunk of plaintext
+ *
+ * This function can be called any number of times between gcmStart()
+ * and gcmEncryptFinal(). The chunks do not need to be block-aligned
+ *
+ * @param[in] context Pointer to the GCM context
+ * @param[in] p Plaintext to be encrypted
+ * @param[out] c Ciphertext resulting from the encryption
+ * @param[in] length Number of data bytes to be encrypted
+ **/
+
+void gcmEncryptUpdate(GcmContext *context, const uint8_t *p, uint8_t *c, size_t length)
+{
+   size_t k;
+   size_t n;
+
+   //Process plaintext
+   while(length > 0)
+   {
+      //Current position in the key stream block
+      n = context->length % 16;
+
+      //Start of a new block?
+      if(n == 0)
+      {
+         //Increment counter
+         gcmIncCounter(context->j);
+         //Generate the next key stream block
+         context->cipherAlgo->encryptBlock(context->cipherContext, context->j, context->b);
+      }
+
+      //Number of bytes to process at a time
+      k = MIN(length, 16 - n);
+
+      //Encrypt plaintext
+      gcmXorBlock(c, p, context->b + n, k);
+      //Accumulate the ciphertext
+      gcmXorBlock(context->s + n, context->s + n, c, k);
+
+      //Update the number of data bytes processed so far
+      context->length += k;
+
+      //Apply GHASH function once a complete block has been accumulated
+      if((context->length % 16) == 0)
+         gcmMul(context, context->s);
+
+      //Next chunk
+      p += k;
+      c += k;
+      length -= k;
+   }
+}
+
+
+/**
+ * @brief Decrypt a chunk of ciphertext
+ *
+ * This function can be called any number of times between gcmStart()
+ * and gcmDecryptFinal(). The chunks do not need to be block-aligned
+ *
+ * @param[in] context Pointer to the GCM context
+ * @param[in] c Ciphertext to be decrypted
+ * @param[out] p Plaintext resulting from the decryption
+ * @param[in] length Number of data bytes to be decrypted
+ **/
+
+void gcmDecryptUpdate(GcmContext *context, const uint8_t *c, uint8_t *p, size_t length)
+{
+   size_t k;
+   size_t n;
 
    //Process ciphertext
-   while(n > 0)
+   while(length > 0)
    {
-      //The decryption operates in a block-by-block fashion
-      k = MIN(n, 16);
+      //Current position in the key stream block
+      n = context->length % 16;
 
-      //Apply GHASH function
-      gcmXorBlock(s, s, c, k);
-      gcmMul(s, h);
+      //Start of a new block?
+      if(n == 0)
+      {
+         //Increment counter
+         gcmIncCounter(context->j);
+         //Generate the next key stream block
+         context->cipherAlgo->encryptBlock(context->cipherContext, context->j, context->b);
+      }
 
-      //Increment counter
-      gcmIncCounter(j);
+      //Number of bytes to process at a time
+      k = MIN(length, 16 - n);
 
+      //Accumulate the ciphertext
+      gcmXorBlock(context->s + n, context->s + n, c, k);
       //Decrypt ciphertext
-      cipher->encryptBlock(context, j, b);
-      gcmXorBlock(p, c, b, k);
+      gcmXorBlock(p, c, context->b + n, k);
 
-      //Next block
+      //Update the number of data bytes processed so far
+      context->length += k;
+
+      //Apply GHASH function once a complete block has been accumulated
+      if((context->length % 16) == 0)
+         gcmMul(context, context->s);
+
+      //Next chunk
       c += k;
       p += k;
-      n -= k;
+      length -= k;
    }
+}
+
+
+/**
+ * @brief Finish encrypting the current message
+ * @param[in] context Pointer to the GCM context
+ * @param[out] t Authentication tag
+ * @param[in] tLen Length of the authentication tag
+ * @return Error code
+ **/
+
+error_t gcmEncryptFinal(GcmContext *context, uint8_t *t, size_t tLen)
+{
+   uint8_t b[16];
+
+   //Check the length of the authentication tag
+   if(tLen < 4 || tLen > 16)
+      return ERROR_INVALID_PARAMETER;
+
+   //The last block of data may be incomplete
+   if((context->length % 16) != 0)
+      gcmMul(context, context->s);
 
    //Append the 64-bit representation of the length of the AAD and the ciphertext
    memset(b, 0, 16);
-   STORE32BE(aLen * 8, b + 4);
-   STORE32BE(length * 8, b + 12);
+   STORE32BE(context->aLen * 8, b + 4);
+   STORE32BE(context->length * 8, b + 12);
 
    //The GHASH function is applied to the result to produce a single output block S
-   gcmXorBlock(s, s, b, 16);
-   gcmMul(s, h);
+   gcmXorBlock(context->s, context->s, b, 16);
+   gcmMul(context, context->s);
+
+   //Let T = MSB(GCTR(J(0), S)
+   gcmXorBlock(t, context->t, context->s, tLen);
+
+   //Successful encryption
+   return NO_ERROR;
+}
 
-   //Let R = MSB(GCTR(J(0), S)
-   gcmXorBlock(r, r, s, tLen);
+
+/**
+ * @brief Finish decrypting the current message
+ * @param[in] context Pointer to the GCM context
+ * @param[in] t Authentication tag
+ * @param[in] tLen Length of the authentication tag
+ * @return Error code
+ **/
+
+error_t gcmDecryptFinal(GcmContext *context, const uint8_t *t, size_t tLen)
+{
+   error_t error;
+   uint8_t r[16];
+
+   //Compute the expected authentication tag
+   error = gcmEncryptFinal(context, r, tLen);
+   //Any error to report?
+   if(error) return error;
 
    //Verify the authentication tag
    if(memcmp(r, t, tLen))
@@ -359,43 +456,150 @@ error_t gcmDecrypt(const CipherAlgo *cipher, void *context, const uint8_t *iv, s
 
 
 /**
- * @brief Multiplication operation
- * @param[in, out] x First block
- * @param[in] y Second block
+ * @brief Authenticated encryption using GCM
+ * @param[in] context Pointer to the GCM context
+ * @param[in] iv Initialization vector
+ * @param[in] ivLen Length of the initialization vector
+ * @param[in] a Additional authenticated data
+ * @param[in] aLen Length of the additional data
+ * @param[in] p Plaintext to be encrypted
+ * @param[out] c Ciphertext resulting from the encryption
+ * @param[in] length Total number of data bytes to be encrypted
+ * @param[out] t Authentication tag
+ * @param[in] tLen Length of the authentication tag
+ * @return Error code
  **/
 
-void gcmMul(uint8_t *x, const uint8_t *y)
+error_t gcmEncrypt(GcmContext *context, const uint8_t *iv, size_t ivLen,
+   const uint8_t *a, size_t aLen, const uint8_t *p, uint8_t *c, size_t length, uint8_t *t, size_t tLen)
 {
-   size_t i;
-   uint8_t z[16];
-   uint8_t v[16];
+   error_t error;
 
-   //Let Z(0) = 0
-   memset(z, 0, 16);
-   //Let V(0) = Y
-   memcpy(v, y, 16);
+   //Check the length of the authentication tag
+   if(tLen < 4 || tLen > 16)
+      return ERROR_INVALID_PARAMETER;
 
-   //Iterate 128 times
-   for(i = 0; i < 128; i++)
-   {
-      if(x[i / 8] & (0x80 >> (i % 8)))
-      {
-         gcmXorBlock(z, z, v, 16);
-      }
+   //Process the IV and the additional data
+   error = gcmStart(context, iv, ivLen, a, aLen);
+   //Any error to report?
+   if(error) return error;
 
-      if(v[15] & 0x01)
-      {
-         gcmShiftBlock(v);
-         v[0] ^= 0xE1;
-      }
-      else
-      {
-         gcmShiftBlock(v);
-      }
+   //Encrypt plaintext
+   gcmEncryptUpdate(context, p, c, length);
+
+   //Compute the authentication tag
+   return gcmEncryptFinal(context, t, tLen);
+}
+
+
+/**
+ * @brief Authenticated decryption using GCM
+ * @param[in] context Pointer to the GCM context
+ * @param[in] iv Initialization vector
+ * @param[in] ivLen Length of the initialization vector
+ * @param[in] a Additional authenticated data
+ * @param[in] aLen Length of the additional data
+ * @param[in] c Ciphertext to be decrypted
+ * @param[out] p Plaintext resulting from the decryption
+ * @param[in] length Total number of data bytes to be decrypted
+ * @param[in] t Authentication tag
+ * @param[in] tLen Length of the authentication tag
+ * @return Error code
+ **/
+
+error_t gcmDecrypt(GcmContext *context, const uint8_t *iv, size_t ivLen,
+   const uint8_t *a, size_t aLen, const uint8_t *c, uint8_t *p, size_t length, const uint8_t *t, size_t tLen)
+{
+   error_t error;
+
+   //Check the length of the authentication tag
+   if(tLen < 4 || tLen > 16)
+      return ERROR_INVALID_PARAMETER;
+
+   //Process the IV and the additional data
+   error = gcmStart(context, iv, ivLen, a, aLen);
+   //Any error to report?
+   if(error) return error;
+
+   //Decrypt ciphertext
+   gcmDecryptUpdate(context, c, p, length);
+
+   //Verify the authentication tag
+   return gcmDecryptFinal(context, t, tLen);
+}
+
+
+/**
+ * @brief Multiplication operation in GF(2^128)
+ * @param[in] context Pointer to the GCM context
+ * @param[in, out] x Input value that is multiplied by H
+ **/
+
+void gcmMul(GcmContext *context, uint8_t *x)
+{
+   int_t i;
+   uint_t b;
+   uint32_t c;
+   uint32_t z[4];
+
+   //Let Z = 0
+   z[0] = 0;
+   z[1] = 0;
+   z[2] = 0;
+   z[3] = 0;
+
+   //Horner's method, starting with the highest-order coefficients
+   for(i = 15; i >= 0; i--)
+   {
+#if (GCM_TABLE_W == 4)
+      //Process the low nibble first
+      b = x[i] & 0x0F;
+
+      //Multiply Z by x^4 and perform modular reduction
+      c = z[3] & 0x0F;
+      z[3] = (z[3] >> 4) | (z[2] << 28);
+      z[2] = (z[2] >> 4) | (z[1] << 28);
+      z[1] = (z[1] >> 4) | (z[0] << 28);
+      z[0] = (z[0] >> 4) ^ r[c];
+
+      //Add M(b) = b * H
+      z[0] ^= context->m[b][0];
+      z[1] ^= context->m[b][1];
+      z[2] ^= context->m[b][2];
+      z[3] ^= context->m[b][3];
+
+      //Then process the high nibble
+      b = (x[i] >> 4) & 0x0F;
+
+      //Multiply Z by x^4 and perform modular reduction
+      c = z[3] & 0x0F;
+      z[3] = (z[3] >> 4) | (z[2] << 28);
+      z[2] = (z[2] >> 4) | (z[1] << 28);
+      z[1] = (z[1] >> 4) | (z[0] << 28);
+      z[0] = (z[0] >> 4) ^ r[c];
+#else
+      //Process the whole byte at once
+      b = x[i];
+
+      //Multiply Z by x^8 and perform modular reduction
+      c = z[3] & 0xFF;
+      z[3] = (z[3] >> 8) | (z[2] << 24);
+      z[2] = (z[2] >> 8) | (z[1] << 24);
+      z[1] = (z[1] >> 8) | (z[0] << 24);
+      z[0] = (z[0] >> 8) ^ ((uint32_t) r[c] << 16);
+#endif
+      //Add M(b) = b * H
+      z[0] ^= context->m[b][0];
+      z[1] ^= context->m[b][1];
+      z[2] ^= context->m[b][2];
+      z[3] ^= context->m[b][3];
    }
 
    //Copy the resulting block
-   memcpy(x, z, 16);
+   STORE32BE(z[0], x);
+   STORE32BE(z[1], x + 4);
+   STORE32BE(z[2], x + 8);
+   STORE32BE(z[3], x + 12);
 }
 
 
@@ -417,23 +621,6 @@ void gcmXorBlock(uint8_t *a, const uint8_t *b, const uint8_t *c, size_t n)
 }
 
 
-/**
- * @brief Shift operation
- * @param[in,out] a Block to be shifted
- **/
-
-void gcmShiftBlock(uint8_t *a)
-{
-   size_t i;
-
-   //Shift the block to the right
-   for(i = 0; i < 15; i++)
-      a[15 - i] = (a[15 - i] >> 1) | (a[14 - i] << 7);
-
-   a[0] = (a[0] >> 1);
-}
-
-
 /**
  * @brief Increment counter block
  * @param[in,out] a Pointer to the counter block
@@ -32,16 +32,55 @@
 //Dependencies
 #include "crypto.h"
 
+//Size of the precalculated table (4-bit or 8-bit)
+#ifndef GCM_TABLE_W
+   #define GCM_TABLE_W 4
+#elif (GCM_TABLE_W != 4 && GCM_TABLE_W != 8)
+   #error GCM_TABLE_W parameter is not valid
+#endif
+
+//Number of entries in the precalculated table
+#define GCM_TABLE_N (1 << GCM_TABLE_W)
+
+
+/**
+ * @brief GCM context
+ **/
+
+typedef struct
+{
+   const CipherAlgo *cipherAlgo;  ///<Cipher algorithm
+   void *cipherContext;           ///<Cipher algorithm context
+   uint32_t m[GCM_TABLE_N][4];    ///<Precalculated table (multiples of H)
+   uint8_t j[16];                 ///<Counter block
+   uint8_t s[16];                 ///<GHASH accumulator
+   uint8_t b[16];                 ///<Current key stream block
+   uint8_t t[16];                 ///<MSB(CIPH(J(0)))
+   size_t aLen;                   ///<Length of the additional data
+   size_t length;                 ///<Number of data bytes processed so far
+} GcmContext;
+
+
 //GCM related functions
-error_t gcmEncrypt(const CipherAlgo *cipher, void *context, const uint8_t *iv, size_t ivLen,
+error_t gcmInit(GcmContext *context, const CipherAlgo *cipherAlgo, void *cipherContext);
+
+error_t gcmStart(GcmContext *context, const uint8_t *iv, size_t ivLen,
+   const uint8_t *a, size_t aLen);
+
+void gcmEncryptUpdate(GcmContext *context, const uint8_t *p, uint8_t *c, size_t length);
+void gcmDecryptUpdate(GcmContext *context, const uint8_t *c, uint8_t *p, size_t length);
+
+error_t gcmEncryptFinal(GcmContext *context, uint8_t *t, size_t tLen);
+error_t gcmDecryptFinal(GcmContext *context, const uint8_t *t, size_t tLen);
+
+error_t gcmEncrypt(GcmContext *context, const uint8_t *iv, size_t ivLen,
    const uint8_t *a, size_t aLen, const uint8_t *p, uint8_t *c, size_t length, uint8_t *t, size_t tLen);
 
-error_t gcmDecrypt(const CipherAlgo *cipher, void *context, const uint8_t *iv, size_t ivLen,
+error_t gcmDecrypt(GcmContext *context, const uint8_t *iv, size_t ivLen,
    const uint8_t *a, size_t aLen, const uint8_t *c, uint8_t *p, size_t length, const uint8_t *t, size_t tLen);
 
-void gcmMul(uint8_t *x, const uint8_t *y);
+void gcmMul(GcmContext *context, uint8_t *x);
 void gcmXorBlock(uint8_t *a, const uint8_t *b, const uint8_t *c, size_t n);
-void gcmShiftBlock(uint8_t *a);
 void gcmIncCounter(uint8_t *a);
 
 #endif
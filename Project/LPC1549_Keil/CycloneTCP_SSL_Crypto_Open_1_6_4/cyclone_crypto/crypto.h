@@ -210,6 +210,20 @@
    #error ARIA_SUPPORT parameter is not valid
 #endif
 
+//ChaCha support
+#ifndef CHACHA_SUPPORT
+   #define CHACHA_SUPPORT ENABLED
+#elif (CHACHA_SUPPORT != ENABLED && CHACHA_SUPPORT != DISABLED)
+   #error CHACHA_SUPPORT parameter is not valid
+#endif
+
+//Poly1305 support
+#ifndef POLY1305_SUPPORT
+   #define POLY1305_SUPPORT ENABLED
+#elif (POLY1305_SUPPORT != ENABLED && POLY1305_SUPPORT != DISABLED)
+   #error POLY1305_SUPPORT parameter is not valid
+#endif
+
 //ECB mode support
 #ifndef ECB_SUPPORT
    #define ECB_SUPPORT ENABLED
@@ -259,6 +273,15 @@
    #error GCM_SUPPORT parameter is not valid
 #endif
 
+//ChaCha20Poly1305 support
+#ifndef CHACHA20_POLY1305_SUPPORT
+   #define CHACHA20_POLY1305_SUPPORT ENABLED
+#elif (CHACHA20_POLY1305_SUPPORT != ENABLED && CHACHA20_POLY1305_SUPPORT != DISABLED)
+   #error CHACHA20_POLY1305_SUPPORT parameter is not valid
+#elif (CHACHA20_POLY1305_SUPPORT == ENABLED && (CHACHA_SUPPORT == DISABLED || POLY1305_SUPPORT == DISABLED))
+   #error CHACHA20_POLY1305_SUPPORT requires CHACHA_SUPPORT and POLY1305_SUPPORT
+#endif
+
 //Maximum context size (hash functions)
 #if (SHA512_SUPPORT == ENABLED)
    #define MAX_HASH_CONTEXT_SIZE sizeof(Sha512Context)
@@ -391,7 +414,8 @@ typedef enum
    CIPHER_MODE_OFB    = 4,
    CIPHER_MODE_CTR    = 5,
    CIPHER_MODE_CCM    = 6,
-   CIPHER_MODE_GCM    = 7
+   CIPHER_MODE_GCM    = 7,
+   CIPHER_MODE_CHACHA20_POLY1305 = 8
 } CipherMode;
 
 
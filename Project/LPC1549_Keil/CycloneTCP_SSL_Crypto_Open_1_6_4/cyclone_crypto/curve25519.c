@@ -0,0 +1,488 @@
+/**
+ * @file curve25519.c
+ * @brief Curve25519 field arithmetic
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCrypto Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * Elements of GF(2^255 - 19) are stored in radix 2^25.5, that is as ten
+ * signed 32-bit limbs alternately holding 26 and 25 bits. Limb products fit
+ * in 64-bit accumulators without intermediate carries, which suits 32-bit
+ * cores with a single-cycle multiplier. None of the routines below branch
+ * on secret data
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL CRYPTO_TRACE_LEVEL
+
+//Dependencies
+#include <string.h>
+#include "crypto.h"
+#include "curve25519.h"
+#include "debug.h"
+
+//Check crypto library configuration
+#if (CURVE25519_SUPPORT == ENABLED)
+
+//Number of bits held by the specified limb
+#define CURVE25519_LIMB_WIDTH(i) (((i) & 1) ? 25 : 26)
+
+
+/**
+ * @brief Carry propagation
+ *
+ * Each accumulator is rounded to the nearest multiple of its radix so that
+ * the resulting limbs are signed values no larger than 2^25 (even limbs) or
+ * 2^24 (odd limbs) in magnitude. The carry out of the top limb is folded
+ * back into the bottom one since 2^255 = 19 mod p
+ *
+ * @param[out] r Resulting field element
+ * @param[in] t Array of ten 64-bit accumulators
+ **/
+
+static void curve25519Carry(int32_t *r, int64_t *t)
+{
+   uint_t i;
+   uint_t w;
+   int64_t c;
+
+   //Propagate carries from the least significant limb upwards
+   for(i = 0; i < CURVE25519_LIMB_COUNT; i++)
+   {
+      //Get the width of the current limb
+      w = CURVE25519_LIMB_WIDTH(i);
+      //Round to the nearest multiple of 2^w
+      c = (t[i] + ((int64_t) 1 << (w - 1))) >> w;
+      t[i] -= c * ((int64_t) 1 << w);
+
+      //Propagate the carry to the next limb
+      if(i < (CURVE25519_LIMB_COUNT - 1))
+         t[i + 1] += c;
+      else
+         t[0] += 19 * c;
+   }
+
+   //The bottom limb may have grown again
+   c = (t[0] + ((int64_t) 1 << 25)) >> 26;
+   t[0] -= c * ((int64_t) 1 << 26);
+   t[1] += c;
+
+   //Copy the resulting limbs
+   for(i = 0; i < CURVE25519_LIMB_COUNT; i++)
+      r[i] = (int32_t) t[i];
+}
+
+
+/**
+ * @brief Set field element to a small integer
+ * @param[out] r Field element
+ * @param[in] a Integer value such as 0 <= A < 2^25
+ **/
+
+void curve25519SetInt(int32_t *r, int32_t a)
+{
+   //Clear the upper limbs
+   memset(r + 1, 0, (CURVE25519_LIMB_COUNT - 1) * sizeof(int32_t));
+   //Set the value of the lower limb
+   r[0] = a;
+}
+
+
+/**
+ * @brief Copy a field element
+ * @param[out] r Destination field element
+ * @param[in] a Source field element
+ **/
+
+void curve25519Copy(int32_t *r, const int32_t *a)
+{
+   //Copy all the limbs
+   memcpy(r, a, CURVE25519_LIMB_COUNT * sizeof(int32_t));
+}
+
+
+/**
+ * @brief Modular addition
+ *
+ * No carry is propagated. The limbs of the operands must not be larger
+ * than the output of curve25519Carry()
+ *
+ * @param[out] r Resulting value R = (A + B) mod p
+ * @param[in] a First operand
+ * @param[in] b Second operand
+ **/
+
+void curve25519Add(int32_t *r, const int32_t *a, const int32_t *b)
+{
+   uint_t i;
+
+   //Limb-wise addition
+   for(i = 0; i < CURVE25519_LIMB_COUNT; i++)
+      r[i] = a[i] + b[i];
+}
+
+
+/**
+ * @brief Modular subtraction
+ *
+ * No carry is propagated. The limbs of the operands must not be larger
+ * than the output of curve25519Carry()
+ *
+ * @param[out] r Resulting value R = (A - B) mod p
+ * @param[in] a First operand
+ * @param[in] b Second operand
+ **/
+
+void curve25519Sub(int32_t *r, const int32_t *a, const int32_t *b)
+{
+   uint_t i;
+
+   //Limb-wise subtraction
+   for(i = 0; i < CURVE25519_LIMB_COUNT; i++)
+      r[i] = a[i] - b[i];
+}
+
+
+/**
+ * @brief Modular multiplication
+ *
+ * The operands may be the sum or the difference of two carried field
+ * elements. When both limb indices are odd, the weight of the product
+ * exceeds the weight of the destination limb by a factor of two
+ *
+ * @param[out] r Resulting value R = (A * B) mod p
+ * @param[in] a First operand
+ * @param[in] b Second operand
+ **/
+
+void curve25519Mul(int32_t *r, const int32_t *a, const int32_t *b)
+{
+   uint_t i;
+   uint_t j;
+   int32_t u;
+   int32_t v;
+   int32_t b19[CURVE25519_LIMB_COUNT];
+   int64_t t[CURVE25519_LIMB_COUNT];
+
+   //Products whose weight is 2^255 or more are reduced using 2^255 = 19
+   for(i = 0; i < CURVE25519_LIMB_COUNT; i++)
+      b19[i] = 19 * b[i];
+
+   //Clear accumulators
+   memset(t, 0, sizeof(t));
+
+   //Schoolbook multiplication with on-the-fly reduction
+   for(i = 0; i < CURVE25519_LIMB_COUNT; i++)
+   {
+      //Double the odd limbs of A when multiplied by odd limbs of B
+      u = (i & 1) ? 2 * a[i] : a[i];
+
+      //Accumulate the products
+      for(j = 0; j < CURVE25519_LIMB_COUNT; j++)
+      {
+         //Select the relevant multiplier
+         v = (j & 1) ? u : a[i];
+
+         //Check the weight of the product
+         if((i + j) < CURVE25519_LIMB_COUNT)
+            t[i + j] += (int64_t) v * b[j];
+         else
+            t[i + j - CURVE25519_LIMB_COUNT] += (int64_t) v * b19[j];
+      }
+   }
+
+   //Propagate carries
+   curve25519Carry(r, t);
+}
+
+
+/**
+ * @brief Multiplication by a small integer
+ * @param[out] r Resulting value R = (A * B) mod p
+ * @param[in] a Field element
+ * @param[in] b Integer such as 0 <= B < 2^17
+ **/
+
+void curve25519MulInt(int32_t *r, const int32_t *a, int32_t b)
+{
+   uint_t i;
+   int64_t t[CURVE25519_LIMB_COUNT];
+
+   //Multiply each limb
+   for(i = 0; i < CURVE25519_LIMB_COUNT; i++)
+      t[i] = (int64_t) a[i] * b;
+
+   //Propagate carries
+   curve25519Carry(r, t);
+}
+
+
+/**
+ * @brief Modular squaring
+ *
+ * Cross products are computed once and doubled, which saves 45 of the 100
+ * limb multiplications performed by curve25519Mul()
+ *
+ * @param[out] r Resulting value R = (A ^ 2) mod p
+ * @param[in] a Field element
+ **/
+
+void curve25519Sqr(int32_t *r, const int32_t *a)
+{
+   uint_t i;
+   uint_t j;
+   int32_t u;
+   int32_t a2[CURVE25519_LIMB_COUNT];
+   int32_t a19[CURVE25519_LIMB_COUNT];
+   int64_t t[CURVE25519_LIMB_COUNT];
+
+   //Precompute the doubled and reduced limbs
+   for(i = 0; i < CURVE25519_LIMB_COUNT; i++)
+   {
+      a2[i] = 2 * a[i];
+      a19[i] = 19 * a[i];
+   }
+
+   //Clear accumulators
+   memset(t, 0, sizeof(t));
+
+   //Accumulate the products
+   for(i = 0; i < CURVE25519_LIMB_COUNT; i++)
+   {
+      //Square term (odd limbs carry twice the weight of the destination)
+      u = (i & 1) ? a2[i] : a[i];
+
+      if((2 * i) < CURVE25519_LIMB_COUNT)
+         t[2 * i] += (int64_t) u * a[i];
+      else
+         t[2 * i - CURVE25519_LIMB_COUNT] += (int64_t) u * a19[i];
+
+      //Cross terms are doubled
+      u = (i & 1) ? 2 * a2[i] : a2[i];
+
+      for(j = i + 1; j < CURVE25519_LIMB_COUNT; j++)
+      {
+         //Check the weight of the product
+         if((i + j) < CURVE25519_LIMB_COUNT)
+            t[i + j] += (int64_t) ((j & 1) ? u : a2[i]) * a[j];
+         else
+            t[i + j - CURVE25519_LIMB_COUNT] += (int64_t) ((j & 1) ? u : a2[i]) * a19[j];
+      }
+   }
+
+   //Propagate carries
+   curve25519Carry(r, t);
+}
+
+
+/**
+ * @brief Raise a field element to the 2^n power
+ * @param[out] r Resulting value R = (A ^ (2^n)) mod p
+ * @param[in] a Field element
+ * @param[in] n Number of successive squarings (n >= 1)
+ **/
+
+void curve25519Pwr2(int32_t *r, const int32_t *a, uint_t n)
+{
+   uint_t i;
+
+   //Square the input value
+   curve25519Sqr(r, a);
+
+   //Square the result n - 1 more times
+   for(i = 1; i < n; i++)
+      curve25519Sqr(r, r);
+}
+
+
+/**
+ * @brief Modular inversion
+ *
+ * The inverse is computed as A^(p - 2) mod p using a fixed addition chain
+ * of 254 squarings and 11 multiplications
+ *
+ * @param[out] r Resulting value R = A^-1 mod p
+ * @param[in] a Field element
+ **/
+
+void curve25519Inv(int32_t *r, const int32_t *a)
+{
+   int32_t t0[CURVE25519_LIMB_COUNT];
+   int32_t t1[CURVE25519_LIMB_COUNT];
+   int32_t t2[CURVE25519_LIMB_COUNT];
+   int32_t t3[CURVE25519_LIMB_COUNT];
+
+   //Compute A^11
+   curve25519Sqr(t0, a);
+   curve25519Pwr2(t1, t0, 2);
+   curve25519Mul(t1, a, t1);
+   curve25519Mul(t0, t0, t1);
+   //Compute A^(2^5 - 1)
+   curve25519Sqr(t2, t0);
+   curve25519Mul(t1, t1, t2);
+   //Compute A^(2^10 - 1)
+   curve25519Pwr2(t2, t1, 5);
+   curve25519Mul(t1, t2, t1);
+   //Compute A^(2^20 - 1)
+   curve25519Pwr2(t2, t1, 10);
+   curve25519Mul(t2, t2, t1);
+   //Compute A^(2^40 - 1)
+   curve25519Pwr2(t3, t2, 20);
+   curve25519Mul(t2, t3, t2);
+   //Compute A^(2^50 - 1)
+   curve25519Pwr2(t2, t2, 10);
+   curve25519Mul(t1, t2, t1);
+   //Compute A^(2^100 - 1)
+   curve25519Pwr2(t2, t1, 50);
+   curve25519Mul(t2, t2, t1);
+   //Compute A^(2^200 - 1)
+   curve25519Pwr2(t3, t2, 100);
+   curve25519Mul(t2, t3, t2);
+   //Compute A^(2^250 - 1)
+   curve25519Pwr2(t2, t2, 50);
+   curve25519Mul(t1, t2, t1);
+   //Compute A^(2^255 - 21)
+   curve25519Pwr2(t1, t1, 5);
+   curve25519Mul(r, t1, t0);
+}
+
+
+/**
+ * @brief Conditional swap
+ * @param[in,out] a First field element
+ * @param[in,out] b Second field element
+ * @param[in] c Swap A and B if C is 1, leave them unchanged if C is 0
+ **/
+
+void curve25519Swap(int32_t *a, int32_t *b, uint32_t c)
+{
+   uint_t i;
+   uint32_t mask;
+   uint32_t t;
+
+   //Build a mask from the condition without branching
+   mask = ~(c - 1);
+
+   //Swap the limbs under the mask
+   for(i = 0; i < CURVE25519_LIMB_COUNT; i++)
+   {
+      t = mask & ((uint32_t) a[i] ^ (uint32_t) b[i]);
+      a[i] = (int32_t) ((uint32_t) a[i] ^ t);
+      b[i] = (int32_t) ((uint32_t) b[i] ^ t);
+   }
+}
+
+
+/**
+ * @brief Decode a field element
+ *
+ * The most significant bit of the final byte is masked, as required by
+ * RFC 7748. Non-canonical values in the range p to 2^255 - 1 are accepted
+ *
+ * @param[out] r Field element
+ * @param[in] data Little-endian octet string (32 bytes)
+ **/
+
+void curve25519Import(int32_t *r, const uint8_t *data)
+{
+   uint_t i;
+   uint_t n;
+   uint_t w;
+
+   //Split the 255-bit value into limbs
+   for(n = 0, i = 0; i < CURVE25519_LIMB_COUNT; i++)
+   {
+      //Get the width of the current limb
+      w = CURVE25519_LIMB_WIDTH(i);
+      //Extract the relevant bits
+      r[i] = (LOAD32LE(data + n / 8) >> (n % 8)) & ((1UL << w) - 1);
+      //Offset of the next limb
+      n += w;
+   }
+}
+
+
+/**
+ * @brief Encode a field element
+ * @param[out] data Little-endian octet string (32 bytes)
+ * @param[in] a Field element (output of a multiplication or a squaring)
+ **/
+
+void curve25519Export(uint8_t *data, const int32_t *a)
+{
+   uint_t i;
+   uint_t j;
+   uint_t n;
+   uint_t w;
+   int32_t q;
+   int32_t c;
+   int32_t t[CURVE25519_LIMB_COUNT];
+   uint64_t acc;
+
+   //Compute the quotient Q = floor(A / p), which is either 0 or 1
+   q = (19 * a[9] + ((int32_t) 1 << 24)) >> 25;
+
+   for(i = 0; i < CURVE25519_LIMB_COUNT; i++)
+      q = (a[i] + q) >> CURVE25519_LIMB_WIDTH(i);
+
+   //Compute A + 19 * Q. Subtracting Q * 2^255 is implicit
+   curve25519Copy(t, a);
+   t[0] += 19 * q;
+
+   //Propagate carries so that every limb becomes non-negative
+   for(i = 0; i < CURVE25519_LIMB_COUNT; i++)
+   {
+      //Get the width of the current limb
+      w = CURVE25519_LIMB_WIDTH(i);
+      //Extract the carry
+      c = t[i] >> w;
+      t[i] -= c * ((int32_t) 1 << w);
+
+      //The carry out of the top limb is discarded
+      if(i < (CURVE25519_LIMB_COUNT - 1))
+         t[i + 1] += c;
+   }
+
+   //Pack the limbs into a 255-bit little-endian value
+   for(acc = 0, n = 0, j = 0, i = 0; i < CURVE25519_LIMB_COUNT; i++)
+   {
+      //Append the current limb
+      acc |= (uint64_t) t[i] << n;
+      n += CURVE25519_LIMB_WIDTH(i);
+
+      //Flush complete bytes
+      while(n >= 8)
+      {
+         data[j++] = (uint8_t) acc;
+         acc >>= 8;
+         n -= 8;
+      }
+   }
+
+   //Write the last 7 bits
+   data[j] = (uint8_t) acc;
+}
+
+#endif
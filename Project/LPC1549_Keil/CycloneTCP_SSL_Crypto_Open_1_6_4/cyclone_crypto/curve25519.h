@@ -0,0 +1,63 @@
+/**
+ * @file curve25519.h
+ * @brief Curve25519 field arithmetic
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCrypto Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+#ifndef _CURVE25519_H
+#define _CURVE25519_H
+
+//Dependencies
+#include "crypto.h"
+
+//Curve25519 support
+#ifndef CURVE25519_SUPPORT
+   #define CURVE25519_SUPPORT DISABLED
+#elif (CURVE25519_SUPPORT != ENABLED && CURVE25519_SUPPORT != DISABLED)
+   #error CURVE25519_SUPPORT parameter is not valid
+#endif
+
+//Number of limbs used to represent a field element
+#define CURVE25519_LIMB_COUNT 10
+//Length of an encoded field element, in bytes
+#define CURVE25519_BYTE_LENGTH 32
+
+
+//Curve25519 field arithmetic
+void curve25519SetInt(int32_t *r, int32_t a);
+void curve25519Copy(int32_t *r, const int32_t *a);
+void curve25519Add(int32_t *r, const int32_t *a, const int32_t *b);
+void curve25519Sub(int32_t *r, const int32_t *a, const int32_t *b);
+void curve25519Mul(int32_t *r, const int32_t *a, const int32_t *b);
+void curve25519MulInt(int32_t *r, const int32_t *a, int32_t b);
+void curve25519Sqr(int32_t *r, const int32_t *a);
+void curve25519Pwr2(int32_t *r, const int32_t *a, uint_t n);
+void curve25519Inv(int32_t *r, const int32_t *a);
+void curve25519Swap(int32_t *a, int32_t *b, uint32_t c);
+
+void curve25519Import(int32_t *r, const uint8_t *data);
+void curve25519Export(uint8_t *data, const int32_t *a);
+
+#endif
@@ -52,6 +52,10 @@ void dhInit(DhContext *context)
    //Initialize Diffie-Hellman parameters
    mpiInit(&context->params.p);
    mpiInit(&context->params.g);
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Temporary integers are allocated from the heap by default
+   context->params.arena = NULL;
+#endif
    //Initialize private and public values
    mpiInit(&context->xa);
    mpiInit(&context->ya);
@@ -89,6 +93,7 @@ error_t dhGenerateKeyPair(DhContext *context,
 {
    error_t error;
    uint_t k;
+   MpiMontContext mont;
 
    //Debug message
    TRACE_DEBUG("Generating Diffie-Hellman key pair...\r\n");
@@ -116,11 +121,27 @@ error_t dhGenerateKeyPair(DhContext *context,
    TRACE_DEBUG("  Private value:\r\n");
    TRACE_DEBUG_MPI("    ", &context->xa);
 
+   //Initialize Montgomery context
+   mpiMontInitArena(&mont, context->params.arena);
+   //Load the prime modulus
+   error = mpiMontSetModulus(&mont, &context->params.p);
+
    //Calculate the corresponding public value (ya = g ^ xa mod p)
-   error = mpiExpMod(&context->ya, &context->params.g, &context->xa, &context->params.p);
+   if(!error)
+      error = mpiMontExpMod(&mont, &context->ya, &context->params.g, &context->xa);
+   //The modulus is not suitable for fixed-width Montgomery arithmetic?
+   else if(error == ERROR_INVALID_PARAMETER)
+      error = mpiExpMod(&context->ya, &context->params.g, &context->xa, &context->params.p);
+
+   //Release Montgomery context
+   mpiMontFree(&mont);
    //Any error to report?
    if(error) return error;
 
+   //Report the peak arena usage
+   MPI_ARENA_TRACE("DH key pair generation", mpiGetBitLength(&context->params.p),
+      context->params.arena);
+
    //Debug message
    TRACE_DEBUG("  Public value:\r\n");
    TRACE_DEBUG_MPI("    ", &context->ya);
@@ -148,7 +169,7 @@ error_t dhCheckPublicKey(DhParameters *params, const Mpi *publicKey)
    Mpi a;
 
    //Initialize multiple precision integer
-   mpiInit(&a);
+   mpiInitArena(&a, params->arena);
    //Precompute p - 1
    error = mpiSubInt(&a, &params->p, 1);
 
@@ -184,6 +205,7 @@ error_t dhComputeSharedSecret(DhContext *context,
    error_t error;
    size_t k;
    Mpi z;
+   MpiMontContext mont;
 
    //Debug message
    TRACE_DEBUG("Computing Diffie-Hellman shared secret...\r\n");
@@ -196,20 +218,36 @@ error_t dhComputeSharedSecret(DhContext *context,
       return ERROR_INVALID_LENGTH;
 
    //The multiple precision integer must be initialized before it can be used
-   mpiInit(&z);
+   mpiInitArena(&z, context->params.arena);
 
    //Start of exception handling block
    do
    {
+      //Initialize Montgomery context
+      mpiMontInitArena(&mont, context->params.arena);
+      //Load the prime modulus
+      error = mpiMontSetModulus(&mont, &context->params.p);
+
       //Calculate the shared secret key (k = yb ^ xa mod p)
-      error = mpiExpMod(&z, &context->yb, &context->xa, &context->params.p);
+      if(!error)
+         error = mpiMontExpMod(&mont, &z, &context->yb, &context->xa);
+      //The modulus is not suitable for fixed-width Montgomery arithmetic?
+      else if(error == ERROR_INVALID_PARAMETER)
+         error = mpiExpMod(&z, &context->yb, &context->xa, &context->params.p);
+
+      //Release Montgomery context
+      mpiMontFree(&mont);
       //Any error to report?
-      if(error) return error;
+      if(error) break;
+
+      //Report the peak arena usage
+      MPI_ARENA_TRACE("DH shared secret computation", mpiGetBitLength(&context->params.p),
+         context->params.arena);
 
       //Convert the resulting integer to an octet string
       error = mpiWriteRaw(&z, output, k);
       //Conversion failed?
-      if(error) return error;
+      if(error) break;
 
       //Length of the resulting shared secret
       *outputLength = k;
@@ -221,7 +259,8 @@ error_t dhComputeSharedSecret(DhContext *context,
       //End of exception handling block
    } while(0);
 
-   //Release previously allocated resources
+   //Release previously allocated resources (errors must leave the exception
+   //handling block with a break rather than a return, or z would be leaked)
    mpiFree(&z);
    //Return status code
    return error;
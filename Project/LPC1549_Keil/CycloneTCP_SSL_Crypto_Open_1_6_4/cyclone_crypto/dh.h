@@ -42,6 +42,9 @@ typedef struct
 {
    Mpi p; ///<Prime modulus
    Mpi g; ///<Generator
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArena *arena; ///<Arena for temporary integers
+#endif
 } DhParameters;
 
 
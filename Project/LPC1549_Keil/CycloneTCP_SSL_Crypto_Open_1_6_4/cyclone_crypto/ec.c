@@ -33,11 +33,17 @@
 #include <stdlib.h>
 #include "crypto.h"
 #include "ec.h"
+#include "ec_p256.h"
 #include "debug.h"
 
 //EC Public Key OID (1.2.840.10045.2.1)
 const uint8_t EC_PUBLIC_KEY_OID[7] = {0x2A, 0x86, 0x48, 0xCE, 0x3D, 0x02, 0x01};
 
+#if (EC_STATS_SUPPORT == ENABLED)
+   //Point operation statistics
+   EcStats ecStats;
+#endif
+
 
 /**
  * @brief Initialize EC domain parameters
@@ -49,6 +55,12 @@ void ecInitDomainParameters(EcDomainParameters *params)
    //Initialize structure
    params->type = EC_CURVE_TYPE_NONE;
    params->mod = NULL;
+   params->comb = NULL;
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Temporary integers are allocated from the heap by default
+   params->arena = NULL;
+#endif
 
    //Initialize EC domain parameters
    mpiInit(&params->p);
@@ -110,6 +122,8 @@ error_t ecLoadDomainParameters(EcDomainParameters *params, const EcCurveInfo *cu
 
    //Fast modular reduction
    params->mod = curveInfo->mod;
+   //Fixed-base comb table
+   params->comb = curveInfo->comb;
 
    //Debug message
    TRACE_DEBUG("  p:\r\n");
@@ -145,6 +159,25 @@ void ecInit(EcPoint *r)
 }
 
 
+#if (MPI_ARENA_SUPPORT == ENABLED)
+
+/**
+ * @brief Initialize elliptic curve point backed by an arena
+ * @param[in,out] r Pointer to the EC point to be initialized
+ * @param[in] arena Memory arena (NULL to use the heap)
+ **/
+
+void ecInitArena(EcPoint *r, MpiArena *arena)
+{
+   //Initialize structure
+   mpiInitArena(&r->x, arena);
+   mpiInitArena(&r->y, arena);
+   mpiInitArena(&r->z, arena);
+}
+
+#endif
+
+
 /**
  * @brief Release an elliptic curve point
  * @param[in,out] r Pointer to the EC point to initialize to free
@@ -306,8 +339,8 @@ error_t ecAffinify(const EcDomainParameters *params, EcPoint *r, const EcPoint *
       return ERROR_INVALID_PARAMETER;
 
    //Initialize multiple precision integers
-   mpiInit(&a);
-   mpiInit(&b);
+   mpiInitArena(&a, params->arena);
+   mpiInitArena(&b, params->arena);
 
    //Compute a = 1/Sz mod p
    MPI_CHECK(mpiInvMod(&a, &s->z, &params->p));
@@ -347,8 +380,8 @@ bool_t ecIsPointAffine(const EcDomainParameters *params, const EcPoint *s)
    Mpi t2;
 
    //Initialize multiple precision integers
-   mpiInit(&t1);
-   mpiInit(&t2);
+   mpiInitArena(&t1, params->arena);
+   mpiInitArena(&t2, params->arena);
 
    //Compute t1 = (Sx^3 + a * Sx + b) mod p
    EC_CHECK(ecSqrMod(params, &t1, &s->x));
@@ -391,12 +424,15 @@ error_t ecDouble(const EcDomainParameters *params, EcPoint *r, const EcPoint *s)
    Mpi t4;
    Mpi t5;
 
+   //Update statistics
+   EC_STATS_INC_COUNTER(ecStats.doubleCount);
+
    //Initialize multiple precision integers
-   mpiInit(&t1);
-   mpiInit(&t2);
-   mpiInit(&t3);
-   mpiInit(&t4);
-   mpiInit(&t5);
+   mpiInitArena(&t1, params->arena);
+   mpiInitArena(&t2, params->arena);
+   mpiInitArena(&t3, params->arena);
+   mpiInitArena(&t4, params->arena);
+   mpiInitArena(&t5, params->arena);
 
    //Set t1 = Sx
    MPI_CHECK(mpiCopy(&t1, &s->x));
@@ -524,14 +560,17 @@ error_t ecAdd(const EcDomainParameters *params, EcPoint *r, const EcPoint *s, co
    Mpi t6;
    Mpi t7;
 
+   //Update statistics
+   EC_STATS_INC_COUNTER(ecStats.addCount);
+
    //Initialize multiple precision integers
-   mpiInit(&t1);
-   mpiInit(&t2);
-   mpiInit(&t3);
-   mpiInit(&t4);
-   mpiInit(&t5);
-   mpiInit(&t6);
-   mpiInit(&t7);
+   mpiInitArena(&t1, params->arena);
+   mpiInitArena(&t2, params->arena);
+   mpiInitArena(&t3, params->arena);
+   mpiInitArena(&t4, params->arena);
+   mpiInitArena(&t5, params->arena);
+   mpiInitArena(&t6, params->arena);
+   mpiInitArena(&t7, params->arena);
 
    //Set t1 = Sx
    MPI_CHECK(mpiCopy(&t1, &s->x));
@@ -700,8 +739,18 @@ error_t ecFullAdd(const EcDomainParameters *params, EcPoint *r, const EcPoint *s
       //Check whether R == (0, 0, 0)
       if(!mpiCompInt(&r->x, 0) && !mpiCompInt(&r->y, 0) && !mpiCompInt(&r->z, 0))
       {
-         //Compute R = 2 * S
-         EC_CHECK(ecDouble(params, r, s));
+         //S and T are the same point. Double whichever operand has not
+         //been overwritten by the result
+         if(r == s)
+         {
+            //Compute R = 2 * T
+            EC_CHECK(ecDouble(params, r, t));
+         }
+         else
+         {
+            //Compute R = 2 * S
+            EC_CHECK(ecDouble(params, r, s));
+         }
       }
    }
 
@@ -726,7 +775,7 @@ error_t ecFullSub(const EcDomainParameters *params, EcPoint *r, const EcPoint *s
    EcPoint u;
 
    //Initialize EC point
-   ecInit(&u);
+   ecInitArena(&u, params->arena);
 
    //Set Ux = Tx and Uz = Tz
    MPI_CHECK(mpiCopy(&u.x, &t->x));
@@ -748,6 +797,12 @@ end:
 
 /**
  * @brief Scalar multiplication
+ *
+ * The scalar is recoded in width-w non-adjacent form, so that a point
+ * addition is needed only every w + 1 doublings on average. The odd
+ * multiples S, 3.S, ..., (2^(w-1) - 1).S are precomputed and kept in
+ * Jacobian coordinates
+ *
  * @param[in] params EC domain parameters
  * @param[out] r Resulting point R = d.S
  * @param[in] d An integer d such as 0 <= d < p
@@ -758,11 +813,28 @@ end:
 error_t ecMult(const EcDomainParameters *params, EcPoint *r, const Mpi *d, const EcPoint *s)
 {
    error_t error;
-   uint_t i;
+   int_t i;
+   int_t k;
+   uint_t n;
+   int8_t *naf;
    Mpi h;
+   EcPoint t[EC_WNAF_TABLE_SIZE];
+
+#if (EC_P256_SUPPORT == ENABLED)
+   //Use the dedicated P-256 implementation when possible
+   if(P256_CURVE_MATCH(params) && mpiGetBitLength(d) <= 256)
+      return p256Mult(params, r, d, s);
+#endif
 
    //Initialize multiple precision integer
-   mpiInit(&h);
+   mpiInitArena(&h, params->arena);
+
+   //Initialize EC points
+   for(i = 0; i < EC_WNAF_TABLE_SIZE; i++)
+      ecInitArena(&t[i], params->arena);
+
+   //Digits of the wNAF representation
+   naf = NULL;
 
    //Check whether d == 0
    if(!mpiCompInt(d, 0))
@@ -793,63 +865,277 @@ error_t ecMult(const EcDomainParameters *params, EcPoint *r, const Mpi *d, const
       //Check whether Sz != 1
       if(mpiCompInt(&s->z, 1))
       {
-         //Normalize S
-         EC_CHECK(ecAffinify(params, r, s));
-         EC_CHECK(ecProjectify(params, r, r));
+         //Normalize S so that additions of T(0) use mixed coordinates
+         EC_CHECK(ecAffinify(params, &t[0], s));
+         EC_CHECK(ecProjectify(params, &t[0], &t[0]));
       }
       else
       {
-         //Set R = S
-         MPI_CHECK(mpiCopy(&r->x, &s->x));
-         MPI_CHECK(mpiCopy(&r->y, &s->y));
-         MPI_CHECK(mpiCopy(&r->z, &s->z));
+         //Set T(0) = S
+         EC_CHECK(ecCopy(&t[0], s));
       }
 
-//Left-to-right binary method
-#if 0
-      for(i = mpiGetBitLength(d) - 1; i >= 1; i--)
+#if (EC_WNAF_TABLE_SIZE > 1)
+      //Compute R = 2.S
+      EC_CHECK(ecDouble(params, r, &t[0]));
+
+      //Precompute the odd multiples T(i) = (2i + 1).S
+      for(i = 1; i < EC_WNAF_TABLE_SIZE; i++)
       {
-         //Point doubling
-         EC_CHECK(ecDouble(params, r, r));
+         EC_CHECK(ecFullAdd(params, &t[i], &t[i - 1], r));
+      }
+#endif
+
+      //The wNAF representation is at most one digit longer than d
+      n = mpiGetBitLength(d) + 1;
+
+      //Allocate a memory buffer to hold the digits
+      naf = osAllocMem(n);
+      //Failed to allocate memory?
+      if(naf == NULL)
+      {
+         //Report an error
+         error = ERROR_OUT_OF_MEMORY;
+         goto end;
+      }
 
-         if(mpiGetBitValue(d, i - 1))
+      //Set h = d
+      MPI_CHECK(mpiCopy(&h, d));
+
+      //Compute the wNAF representation of d
+      for(n = 0; mpiCompInt(&h, 0) > 0; n++)
+      {
+         //Odd value?
+         if(mpiIsOdd(&h))
          {
-            //Compute R = R + S
-            EC_CHECK(ecFullAdd(params, r, r, s));
+            //Compute k = h mods 2^w
+            k = h.data[0] & ((1 << EC_WNAF_WIDTH) - 1);
+
+            //The digit must lie in the range -2^(w-1) < k < 2^(w-1)
+            if(k >= (1 << (EC_WNAF_WIDTH - 1)))
+               k -= (1 << EC_WNAF_WIDTH);
+
+            //Compute h = h - k
+            MPI_CHECK(mpiSubInt(&h, &h, k));
          }
+         else
+         {
+            //Zero digit
+            k = 0;
+         }
+
+         //Save the current digit
+         naf[n] = (int8_t) k;
+
+         //Compute h = h / 2
+         MPI_CHECK(mpiShiftRight(&h, 1));
       }
-//Fast left-to-right binary method
-#else
-      //Precompute h = 3 * d
-      MPI_CHECK(mpiAdd(&h, d, d));
-      MPI_CHECK(mpiAdd(&h, &h, d));
-
-      //Scalar multiplication
-      for(i = mpiGetBitLength(&h) - 2; i >= 1; i--)
+
+      //The most significant digit is always positive
+      k = naf[n - 1];
+
+      //Set R = T((k - 1) / 2)
+      EC_CHECK(ecCopy(r, &t[(k - 1) / 2]));
+
+      //Left-to-right scalar multiplication
+      for(i = n - 2; i >= 0; i--)
       {
          //Point doubling
          EC_CHECK(ecDouble(params, r, r));
 
-         //Check whether h(i) == 1 and k(i) == 0
-         if(mpiGetBitValue(&h, i) && !mpiGetBitValue(d, i))
+         //Retrieve the current digit
+         k = naf[i];
+
+         //Check whether the digit is positive
+         if(k > 0)
          {
-            //Compute R = R + S
-            EC_CHECK(ecFullAdd(params, r, r, s));
+            //Compute R = R + T((k - 1) / 2)
+            EC_CHECK(ecFullAdd(params, r, r, &t[(k - 1) / 2]));
          }
-         //Check whether h(i) == 0 and k(i) == 1
-         else if(!mpiGetBitValue(&h, i) && mpiGetBitValue(d, i))
+         //Check whether the digit is negative
+         else if(k < 0)
          {
-            //Compute R = R - S
-            EC_CHECK(ecFullSub(params, r, r, s));
+            //Compute R = R - T((-k - 1) / 2)
+            EC_CHECK(ecFullSub(params, r, r, &t[(-k - 1) / 2]));
          }
       }
-#endif
    }
 
 end:
    //Release multiple precision integer
    mpiFree(&h);
 
+   //Release EC points
+   for(i = 0; i < EC_WNAF_TABLE_SIZE; i++)
+      ecFree(&t[i]);
+
+   //Release the wNAF representation
+   if(naf != NULL)
+      osFreeMem(naf);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Scalar multiplication (Montgomery ladder)
+ *
+ * The ladder performs one point addition and one point doubling per bit,
+ * regardless of the value of the bit, and always processes as many bits
+ * as the order of the base point. This makes the sequence of curve
+ * operations independent of the secret scalar
+ *
+ * @param[in] params EC domain parameters
+ * @param[out] r Resulting point R = d.S
+ * @param[in] d An integer d such as 0 <= d < q
+ * @param[in] s EC point
+ * @return Error code
+ **/
+
+error_t ecMultLadder(const EcDomainParameters *params, EcPoint *r, const Mpi *d, const EcPoint *s)
+{
+   error_t error;
+   int_t i;
+   EcPoint r0;
+   EcPoint r1;
+
+#if (EC_P256_SUPPORT == ENABLED)
+   //Use the dedicated P-256 implementation when possible
+   if(P256_CURVE_MATCH(params) && mpiGetBitLength(d) <= 256)
+      return p256Mult(params, r, d, s);
+#endif
+
+   //Initialize EC points
+   ecInitArena(&r0, params->arena);
+   ecInitArena(&r1, params->arena);
+
+   //Set R0 = (1, 1, 0)
+   MPI_CHECK(mpiSetValue(&r0.x, 1));
+   MPI_CHECK(mpiSetValue(&r0.y, 1));
+   MPI_CHECK(mpiSetValue(&r0.z, 0));
+
+   //Set R1 = S
+   EC_CHECK(ecCopy(&r1, s));
+
+   //Process the scalar from the most significant bit
+   i = MAX(mpiGetBitLength(d), mpiGetBitLength(&params->q)) - 1;
+
+   //Montgomery ladder
+   for(; i >= 0; i--)
+   {
+      //The invariant R1 - R0 = S is maintained throughout the loop
+      if(mpiGetBitValue(d, i))
+      {
+         //Compute R0 = R0 + R1 and R1 = 2.R1
+         EC_CHECK(ecFullAdd(params, &r0, &r0, &r1));
+         EC_CHECK(ecDouble(params, &r1, &r1));
+      }
+      else
+      {
+         //Compute R1 = R0 + R1 and R0 = 2.R0
+         EC_CHECK(ecFullAdd(params, &r1, &r0, &r1));
+         EC_CHECK(ecDouble(params, &r0, &r0));
+      }
+   }
+
+   //Set R = R0
+   EC_CHECK(ecCopy(r, &r0));
+
+end:
+   //Release EC points
+   ecFree(&r0);
+   ecFree(&r1);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Scalar multiplication of the base point
+ *
+ * When a comb table is available for the curve, the fixed-base comb
+ * method processes W bits of the scalar per point doubling. Otherwise,
+ * the computation is delegated to ecMult()
+ *
+ * @param[in] params EC domain parameters
+ * @param[out] r Resulting point R = d.G
+ * @param[in] d An integer d such as 0 <= d < q
+ * @return Error code
+ **/
+
+error_t ecMultBase(const EcDomainParameters *params, EcPoint *r, const Mpi *d)
+{
+   error_t error;
+   int_t i;
+   uint_t j;
+   uint_t k;
+   uint_t n;
+   size_t pLen;
+   const uint8_t *entry;
+   EcPoint t;
+
+#if (EC_P256_SUPPORT == ENABLED)
+   //Use the dedicated P-256 implementation when possible
+   if(P256_CURVE_MATCH(params) && mpiGetBitLength(d) <= 256)
+      return p256MultBase(params, r, d);
+#endif
+
+   //No comb table is available for the current curve?
+   if(params->comb == NULL)
+      return ecMult(params, r, d, &params->g);
+
+   //Spacing between the teeth of the comb
+   n = (mpiGetBitLength(&params->q) + EC_COMB_WIDTH - 1) / EC_COMB_WIDTH;
+
+   //The scalar must not be larger than the comb
+   if(mpiGetBitLength(d) > (n * EC_COMB_WIDTH))
+      return ecMult(params, r, d, &params->g);
+
+   //Get the length in octets of the prime
+   pLen = mpiGetByteLength(&params->p);
+
+   //Initialize EC point
+   ecInitArena(&t, params->arena);
+
+   //Points of the comb table are stored in affine coordinates
+   MPI_CHECK(mpiSetValue(&t.z, 1));
+
+   //Set R = (1, 1, 0)
+   MPI_CHECK(mpiSetValue(&r->x, 1));
+   MPI_CHECK(mpiSetValue(&r->y, 1));
+   MPI_CHECK(mpiSetValue(&r->z, 0));
+
+   //Fixed-base comb method
+   for(i = n - 1; i >= 0; i--)
+   {
+      //Point doubling
+      EC_CHECK(ecDouble(params, r, r));
+
+      //Gather the bits d(i), d(i + n), ..., d(i + (W - 1) * n)
+      for(k = 0, j = 0; j < EC_COMB_WIDTH; j++)
+         k |= mpiGetBitValue(d, i + j * n) << j;
+
+      //Any bit set?
+      if(k != 0)
+      {
+         //Point to the relevant entry of the comb table
+         entry = params->comb + (k - 1) * pLen * 2;
+
+         //Load the precomputed point T(k)
+         MPI_CHECK(mpiReadRaw(&t.x, entry, pLen));
+         MPI_CHECK(mpiReadRaw(&t.y, entry + pLen, pLen));
+
+         //Compute R = R + T(k)
+         EC_CHECK(ecFullAdd(params, r, r, &t));
+      }
+   }
+
+end:
+   //Release EC point
+   ecFree(&t);
+
    //Return status code
    return error;
 }
@@ -904,9 +1190,16 @@ error_t ecTwinMult(const EcDomainParameters *params, EcPoint *r,
    EcPoint spt;
    EcPoint smt;
 
+#if (EC_P256_SUPPORT == ENABLED)
+   //Use the dedicated P-256 implementation when possible
+   if(P256_CURVE_MATCH(params) && mpiGetBitLength(d0) <= 256 &&
+      mpiGetBitLength(d1) <= 256)
+      return p256TwinMult(params, r, d0, s, d1, t);
+#endif
+
    //Initialize EC points
-   ecInit(&spt);
-   ecInit(&smt);
+   ecInitArena(&spt, params->arena);
+   ecInitArena(&smt, params->arena);
 
    //Precompute SpT = S + T
    EC_CHECK(ecFullAdd(params, &spt, s, t));
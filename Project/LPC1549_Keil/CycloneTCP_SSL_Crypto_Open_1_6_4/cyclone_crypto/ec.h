@@ -33,9 +33,33 @@
 #include "crypto.h"
 #include "ec_curves.h"
 
+//Window width for wNAF scalar multiplication
+#ifndef EC_WNAF_WIDTH
+   #define EC_WNAF_WIDTH 4
+#elif (EC_WNAF_WIDTH < 2 || EC_WNAF_WIDTH > 6)
+   #error EC_WNAF_WIDTH parameter is not valid
+#endif
+
+//Number of precomputed odd multiples
+#define EC_WNAF_TABLE_SIZE (1 << (EC_WNAF_WIDTH - 2))
+
+//Point operation statistics (for benchmarking purpose)
+#ifndef EC_STATS_SUPPORT
+   #define EC_STATS_SUPPORT DISABLED
+#elif (EC_STATS_SUPPORT != ENABLED && EC_STATS_SUPPORT != DISABLED)
+   #error EC_STATS_SUPPORT parameter is not valid
+#endif
+
 //Error code checking
 #define EC_CHECK(f) if((error = f) != NO_ERROR) goto end
 
+//Increment a point operation counter
+#if (EC_STATS_SUPPORT == ENABLED)
+   #define EC_STATS_INC_COUNTER(name) ((name)++)
+#else
+   #define EC_STATS_INC_COUNTER(name) ((void) 0)
+#endif
+
 
 /**
  * @brief Elliptic curve point
@@ -62,12 +86,32 @@ typedef struct
    EcPoint g;         ///<Base point G
    Mpi q;             ///<Order of the point G
    EcFastModAlgo mod; ///<Fast modular reduction
+   const uint8_t *comb; ///<Fixed-base comb table for G
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArena *arena;     ///<Arena for temporary integers
+#endif
 } EcDomainParameters;
 
 
+
+/**
+ * @brief Point operation statistics
+ **/
+
+typedef struct
+{
+   uint32_t doubleCount; ///<Number of point doublings
+   uint32_t addCount;    ///<Number of point additions
+} EcStats;
+
+
 //EC related constants
 extern const uint8_t EC_PUBLIC_KEY_OID[7];
 
+#if (EC_STATS_SUPPORT == ENABLED)
+   extern EcStats ecStats;
+#endif
+
 //EC related functions
 void ecInitDomainParameters(EcDomainParameters *params);
 void ecFreeDomainParameters(EcDomainParameters *params);
@@ -75,6 +119,13 @@ void ecFreeDomainParameters(EcDomainParameters *params);
 error_t ecLoadDomainParameters(EcDomainParameters *params, const EcCurveInfo *curveInfo);
 
 void ecInit(EcPoint *r);
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   void ecInitArena(EcPoint *r, MpiArena *arena);
+#else
+   #define ecInitArena(r, arena) ecInit(r)
+#endif
+
 void ecFree(EcPoint *r);
 
 error_t ecCopy(EcPoint *r, const EcPoint *s);
@@ -97,6 +148,8 @@ error_t ecFullAdd(const EcDomainParameters *params, EcPoint *r, const EcPoint *s
 error_t ecFullSub(const EcDomainParameters *params, EcPoint *r, const EcPoint *s, const EcPoint *t);
 
 error_t ecMult(const EcDomainParameters *params, EcPoint *r, const Mpi *d, const EcPoint *s);
+error_t ecMultLadder(const EcDomainParameters *params, EcPoint *r, const Mpi *d, const EcPoint *s);
+error_t ecMultBase(const EcDomainParameters *params, EcPoint *r, const Mpi *d);
 
 error_t ecTwinMult(const EcDomainParameters *params, EcPoint *r,
    const Mpi *d0, const EcPoint *s, const Mpi *d1, const EcPoint *t);
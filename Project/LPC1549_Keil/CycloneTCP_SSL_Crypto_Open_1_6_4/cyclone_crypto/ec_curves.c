@@ -121,6 +121,8 @@ const EcCurveInfo secp112r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
+   NULL,
+   //Fixed-base comb table
    NULL
 };
 
@@ -159,6 +161,8 @@ const EcCurveInfo secp112r2Curve =
    //Cofactor
    4,
    //Fast modular reduction
+   NULL,
+   //Fixed-base comb table
    NULL
 };
 
@@ -197,7 +201,9 @@ const EcCurveInfo secp128r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp128r1Mod
+   secp128r1Mod,
+   //Fixed-base comb table
+   NULL
 };
 
 
@@ -235,7 +241,9 @@ const EcCurveInfo secp128r2Curve =
    //Cofactor
    4,
    //Fast modular reduction
-   secp128r2Mod
+   secp128r2Mod,
+   //Fixed-base comb table
+   NULL
 };
 
 
@@ -279,7 +287,9 @@ const EcCurveInfo secp160k1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp160k1Mod
+   secp160k1Mod,
+   //Fixed-base comb table
+   NULL
 };
 
 
@@ -323,7 +333,9 @@ const EcCurveInfo secp160r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp160r1Mod
+   secp160r1Mod,
+   //Fixed-base comb table
+   NULL
 };
 
 
@@ -367,7 +379,9 @@ const EcCurveInfo secp160r2Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp160r2Mod
+   secp160r2Mod,
+   //Fixed-base comb table
+   NULL
 };
 
 
@@ -411,7 +425,9 @@ const EcCurveInfo secp192k1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp192k1Mod
+   secp192k1Mod,
+   //Fixed-base comb table
+   NULL
 };
 
 
@@ -455,7 +471,9 @@ const EcCurveInfo secp192r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp192r1Mod
+   secp192r1Mod,
+   //Fixed-base comb table
+   NULL
 };
 
 
@@ -499,7 +517,9 @@ const EcCurveInfo secp224k1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp224k1Mod
+   secp224k1Mod,
+   //Fixed-base comb table
+   NULL
 };
 
 
@@ -543,7 +563,9 @@ const EcCurveInfo secp224r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp224r1Mod
+   secp224r1Mod,
+   //Fixed-base comb table
+   NULL
 };
 
 
@@ -587,10 +609,184 @@ const EcCurveInfo secp256k1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp256k1Mod
+   secp256k1Mod,
+   //Fixed-base comb table
+   NULL
 };
 
 
+#if (EC_COMB_SUPPORT == ENABLED)
+
+/**
+ * @brief secp256r1 comb table
+ *
+ * T(i) = i(0).G + i(1).2^d.G + ... + i(W-1).2^((W-1)d).G, where i(j) is the
+ * j-th bit of i and d = ceil(n / W). Each point is stored in affine
+ * coordinates as the concatenation of x and y
+ **/
+
+static const uint8_t secp256r1Comb[EC_COMB_TABLE_SIZE * 64] =
+{
+   //T(1)
+   0x6B, 0x17, 0xD1, 0xF2, 0xE1, 0x2C, 0x42, 0x47, 0xF8, 0xBC, 0xE6, 0xE5, 0x63, 0xA4, 0x40, 0xF2,
+   0x77, 0x03, 0x7D, 0x81, 0x2D, 0xEB, 0x33, 0xA0, 0xF4, 0xA1, 0x39, 0x45, 0xD8, 0x98, 0xC2, 0x96,
+   0x4F, 0xE3, 0x42, 0xE2, 0xFE, 0x1A, 0x7F, 0x9B, 0x8E, 0xE7, 0xEB, 0x4A, 0x7C, 0x0F, 0x9E, 0x16,
+   0x2B, 0xCE, 0x33, 0x57, 0x6B, 0x31, 0x5E, 0xCE, 0xCB, 0xB6, 0x40, 0x68, 0x37, 0xBF, 0x51, 0xF5,
+   //T(2)
+   0x54, 0xCC, 0xC9, 0x41, 0x50, 0x26, 0xD7, 0x3F, 0x20, 0xA8, 0x45, 0xB7, 0x2A, 0x58, 0xE5, 0xB1,
+   0x8B, 0xD2, 0x7F, 0x19, 0x85, 0x42, 0xA0, 0xBE, 0xEE, 0xA6, 0xBC, 0x92, 0x07, 0x1E, 0x5C, 0x83,
+   0x1C, 0x43, 0x3F, 0x45, 0xB4, 0x51, 0x45, 0x32, 0x3A, 0x8F, 0x87, 0x15, 0xDA, 0xD2, 0xBF, 0x22,
+   0x92, 0x9E, 0x0B, 0xCC, 0x5D, 0x8E, 0xE4, 0x96, 0xCF, 0xD0, 0x8E, 0xF7, 0x14, 0x09, 0x16, 0xA1,
+   //T(3)
+   0x3C, 0xFA, 0x0F, 0x87, 0x29, 0x7B, 0xED, 0x02, 0xDF, 0xCC, 0x23, 0x58, 0xF9, 0x4C, 0x9D, 0x1D,
+   0x59, 0x3A, 0x09, 0xA0, 0x3A, 0x23, 0xC6, 0xAB, 0xF7, 0xD2, 0x4B, 0xB7, 0x04, 0xBA, 0xC8, 0x70,
+   0xE4, 0xE3, 0x76, 0x94, 0x70, 0xBE, 0x12, 0xC6, 0xA7, 0x58, 0xAA, 0x80, 0x83, 0x09, 0xAF, 0x9B,
+   0x62, 0x12, 0x1C, 0x0D, 0x02, 0x48, 0xA8, 0xAF, 0xCE, 0x98, 0xA3, 0x0B, 0x40, 0xF2, 0x69, 0x40,
+   //T(4)
+   0x7E, 0xF2, 0xEE, 0x3C, 0x5C, 0x79, 0x2A, 0x0C, 0x0F, 0xEF, 0x63, 0x35, 0x22, 0x4D, 0x94, 0x28,
+   0xA7, 0xD2, 0xC9, 0x8F, 0x67, 0x43, 0x33, 0x3E, 0xC7, 0x39, 0xA5, 0xEA, 0x3E, 0xCC, 0xA7, 0xE0,
+   0xAF, 0xB6, 0x86, 0x27, 0x30, 0xAC, 0xC0, 0x11, 0xA4, 0xF6, 0x7F, 0x51, 0xD5, 0xE6, 0x09, 0xDB,
+   0x81, 0xB2, 0x14, 0x50, 0xDF, 0xBD, 0x3D, 0x20, 0x30, 0x2B, 0x22, 0xDD, 0x55, 0x2A, 0xC0, 0x94,
+   //T(5)
+   0xD6, 0x69, 0x03, 0x37, 0x6D, 0xF0, 0xFD, 0x5E, 0x28, 0xFE, 0x9A, 0x4F, 0x25, 0x4C, 0x54, 0x91,
+   0xF6, 0xD7, 0x7C, 0x27, 0x08, 0x8B, 0x86, 0xDB, 0xDD, 0x37, 0xE3, 0xFF, 0x86, 0xEF, 0x7D, 0x7D,
+   0x20, 0xE2, 0xA5, 0x3C, 0xE6, 0xD1, 0x3D, 0x22, 0xA1, 0x3E, 0x95, 0x78, 0xDF, 0x07, 0x41, 0x67,
+   0xF3, 0xD1, 0xA7, 0xAF, 0x9E, 0x43, 0x73, 0xF9, 0x9F, 0xF0, 0x49, 0x92, 0xAD, 0xDA, 0xD5, 0x96,
+   //T(6)
+   0xB6, 0x66, 0xFA, 0xC5, 0xB7, 0x7E, 0x46, 0xE9, 0x27, 0x62, 0x03, 0xC2, 0x12, 0xF0, 0x1E, 0x9E,
+   0xA4, 0x24, 0xEC, 0x2D, 0xBE, 0x3C, 0x72, 0x65, 0xD7, 0xB8, 0x6A, 0xEE, 0xB0, 0x87, 0x96, 0x05,
+   0x38, 0xAA, 0xA3, 0x80, 0x90, 0x24, 0x69, 0x04, 0xEB, 0x5A, 0xBC, 0x19, 0xEE, 0x3D, 0xE5, 0xA9,
+   0xEF, 0x46, 0xA4, 0x4A, 0x72, 0x6C, 0xD8, 0xB6, 0xF4, 0x31, 0xBB, 0x1A, 0x3B, 0xF0, 0xC5, 0x2D,
+   //T(7)
+   0x62, 0x1C, 0x75, 0xD1, 0x02, 0xEA, 0xDB, 0x2E, 0xDB, 0x82, 0xB3, 0xEA, 0x54, 0x49, 0x20, 0xA4,
+   0xC3, 0x02, 0xF8, 0xF4, 0x96, 0xBE, 0xA2, 0x5A, 0xAE, 0xBF, 0xD7, 0x35, 0x52, 0x5D, 0x6A, 0xBF,
+   0xD7, 0xC4, 0xA4, 0xFE, 0xB4, 0xFA, 0x64, 0x9D, 0x4F, 0xDA, 0xC9, 0x6F, 0x52, 0x2D, 0x7F, 0x70,
+   0x22, 0x5D, 0x03, 0xD8, 0x57, 0xC4, 0x6D, 0x63, 0x89, 0x39, 0xDC, 0x4C, 0x9E, 0xF4, 0x85, 0xF0,
+   //T(8)
+   0x0D, 0x2B, 0xF2, 0x8B, 0xA7, 0xC2, 0xA5, 0x1A, 0x90, 0xF5, 0x73, 0xA8, 0x25, 0x89, 0xF1, 0x8E,
+   0x07, 0xE5, 0x0A, 0xB0, 0x17, 0x86, 0xDF, 0x70, 0x9C, 0x76, 0x2E, 0xF1, 0x94, 0x3E, 0x83, 0x2A,
+   0x0C, 0xAC, 0x3F, 0x43, 0x13, 0xBD, 0x00, 0xAC, 0x70, 0x87, 0xA1, 0x0A, 0x94, 0xB4, 0xE7, 0xED,
+   0x27, 0xEC, 0x9D, 0xB9, 0x60, 0x55, 0x14, 0x46, 0x48, 0x26, 0x3A, 0xF1, 0x5B, 0x20, 0xD3, 0x7C,
+   //T(9)
+   0x00, 0xDC, 0x46, 0xE7, 0xC9, 0x9A, 0x73, 0x9D, 0x9F, 0x05, 0xF9, 0x4A, 0x8C, 0x26, 0x7D, 0x88,
+   0xF7, 0x65, 0x99, 0x58, 0xED, 0xD9, 0x58, 0x3F, 0x8B, 0xC6, 0x59, 0xAA, 0xC0, 0xB9, 0x37, 0x2A,
+   0x03, 0x12, 0xA5, 0x57, 0x45, 0x79, 0x34, 0x24, 0x40, 0xD1, 0xE3, 0xAB, 0x52, 0x28, 0xC1, 0x11,
+   0xB5, 0xEB, 0x20, 0x2D, 0x81, 0x56, 0xBF, 0x6A, 0x4A, 0xF5, 0x0A, 0x00, 0xDF, 0x55, 0xD0, 0xF2,
+   //T(10)
+   0x3C, 0x51, 0x0C, 0xE2, 0x88, 0x2A, 0x78, 0x92, 0x86, 0x7C, 0x55, 0x80, 0x08, 0xDC, 0xD7, 0xAB,
+   0xC8, 0xA8, 0x20, 0xBD, 0x1C, 0x75, 0x22, 0xC0, 0x9D, 0x90, 0xCD, 0xA8, 0x9E, 0x64, 0x86, 0xE0,
+   0xD3, 0x5E, 0x62, 0x0F, 0x5A, 0xCF, 0x05, 0x3F, 0xC3, 0xA7, 0xFC, 0x08, 0x5B, 0xA9, 0x97, 0xB0,
+   0x33, 0x39, 0x27, 0x76, 0xED, 0xA4, 0xE0, 0x46, 0x0E, 0x28, 0x33, 0x34, 0x64, 0x6D, 0x54, 0xC6,
+   //T(11)
+   0x3C, 0x53, 0xE2, 0x90, 0x15, 0xB0, 0xA1, 0xE5, 0x76, 0x34, 0x7A, 0x52, 0x84, 0xE3, 0x2E, 0x59,
+   0x05, 0xE3, 0xF2, 0x23, 0x0D, 0x8C, 0x01, 0x3D, 0x8D, 0x96, 0x92, 0xF7, 0x7E, 0xB8, 0xCF, 0xEE,
+   0xD3, 0x0E, 0x7C, 0xDA, 0x14, 0x0E, 0xFE, 0xB3, 0x11, 0xA9, 0xF0, 0x72, 0x9A, 0x08, 0x69, 0x3F,
+   0x1B, 0x9F, 0x1B, 0xD1, 0x00, 0xD2, 0x35, 0x91, 0x53, 0x8B, 0x7D, 0xA5, 0xFA, 0xE7, 0x98, 0xD4,
+   //T(12)
+   0x02, 0xFD, 0x7B, 0x73, 0x29, 0xC2, 0x02, 0x4D, 0x39, 0xF9, 0xFF, 0x69, 0xB9, 0x6B, 0x99, 0x11,
+   0xBF, 0xED, 0x14, 0xFE, 0xDA, 0xD2, 0x10, 0xD5, 0x81, 0xDE, 0xC9, 0x26, 0x4D, 0xD6, 0xC0, 0x04,
+   0x42, 0xEB, 0xD3, 0xCB, 0x59, 0x92, 0x7D, 0xF3, 0x00, 0xF3, 0x4A, 0xDD, 0xC7, 0x79, 0x78, 0x31,
+   0xB6, 0x82, 0xB9, 0x99, 0x0C, 0x23, 0x63, 0x11, 0x50, 0xCF, 0xCE, 0xB8, 0x71, 0x5D, 0x29, 0xFC,
+   //T(13)
+   0xED, 0x84, 0xBB, 0x42, 0x5F, 0xE3, 0x9A, 0xAD, 0xFD, 0x42, 0x6D, 0x94, 0x2D, 0xF2, 0x32, 0xCF,
+   0x13, 0xD7, 0x2B, 0x7A, 0x3F, 0x7F, 0xBE, 0x90, 0x6D, 0xFC, 0xF7, 0x87, 0xF8, 0xE8, 0xF6, 0x83,
+   0xA3, 0x23, 0x34, 0x55, 0x58, 0x3C, 0x33, 0xF2, 0x0C, 0xF8, 0x3B, 0x61, 0x97, 0xA1, 0xD7, 0x03,
+   0x67, 0xDD, 0x0A, 0x8E, 0x35, 0x54, 0x30, 0xE3, 0x02, 0x3E, 0x67, 0xA1, 0x73, 0x29, 0x95, 0xFC,
+   //T(14)
+   0x9E, 0x98, 0x89, 0xBC, 0xD4, 0x49, 0x24, 0x2D, 0x67, 0x45, 0xFF, 0x87, 0x70, 0x09, 0xB9, 0x58,
+   0xFB, 0x50, 0x08, 0x82, 0x00, 0xCF, 0xA6, 0x17, 0x27, 0x01, 0x4A, 0xB4, 0x68, 0x14, 0x29, 0x04,
+   0xD9, 0xBA, 0x5B, 0x68, 0x7E, 0x79, 0xB3, 0xA2, 0x94, 0xC0, 0xD2, 0x4B, 0x29, 0x2E, 0x6A, 0xA0,
+   0x00, 0x85, 0x51, 0x56, 0x13, 0x8E, 0x99, 0xE2, 0x03, 0x5B, 0x61, 0x3B, 0x57, 0x56, 0x16, 0xC8,
+   //T(15)
+   0x95, 0xE1, 0x84, 0x52, 0x66, 0x38, 0x2A, 0xDA, 0xB3, 0x1D, 0x23, 0x53, 0x1B, 0x4D, 0x0D, 0x1F,
+   0x50, 0xCC, 0x51, 0xC1, 0x8A, 0x4E, 0xEE, 0x61, 0xCE, 0xBB, 0xBC, 0x7B, 0x5F, 0x16, 0x5D, 0x99,
+   0x68, 0xD6, 0x8C, 0x8F, 0x6B, 0x0F, 0xB8, 0xF3, 0x3E, 0xAA, 0x82, 0x89, 0x1F, 0x4F, 0xA1, 0x2F,
+   0xA0, 0xA2, 0xA9, 0x6E, 0x41, 0x42, 0xFF, 0x0F, 0xAC, 0xAD, 0x4F, 0x81, 0x0A, 0x83, 0x9B, 0x5B,
+   //T(16)
+   0x55, 0xD5, 0x39, 0x8D, 0x16, 0x66, 0x43, 0x2B, 0x55, 0x75, 0x82, 0xC9, 0x9A, 0xD5, 0x34, 0x58,
+   0x01, 0x01, 0xFB, 0x06, 0xA0, 0x50, 0xE6, 0x2C, 0x32, 0x0F, 0x09, 0xC3, 0x83, 0x9B, 0xB8, 0x5F,
+   0x57, 0x6E, 0x22, 0x90, 0x49, 0xFF, 0x8E, 0x2D, 0x05, 0x9C, 0x6A, 0x9E, 0x8E, 0xBA, 0xA7, 0x2A,
+   0xD9, 0x0D, 0x6A, 0x7F, 0x18, 0x33, 0xD9, 0xE1, 0xF7, 0xF6, 0x31, 0x18, 0x4F, 0xED, 0x93, 0x6F,
+   //T(17)
+   0x54, 0xE2, 0x44, 0xD5, 0x10, 0x1E, 0x5D, 0xE4, 0x9D, 0x3D, 0xC3, 0x34, 0x6B, 0xEC, 0xCB, 0xB9,
+   0xE8, 0x0F, 0x26, 0xBD, 0x8D, 0x0F, 0x4F, 0x65, 0x93, 0x11, 0xA2, 0x69, 0x51, 0xBB, 0xB3, 0xF1,
+   0xD6, 0xBB, 0xEC, 0x0E, 0xEC, 0x10, 0x6E, 0xB6, 0x19, 0xBD, 0x41, 0x07, 0x35, 0xDF, 0x9C, 0x25,
+   0x43, 0x34, 0xFB, 0xC0, 0x58, 0xC2, 0xE3, 0xB7, 0xB3, 0xAD, 0x4C, 0x6E, 0xF1, 0xB1, 0x9E, 0x28,
+   //T(18)
+   0x44, 0x37, 0x37, 0xCD, 0x3C, 0x00, 0x73, 0x6B, 0xF1, 0xC0, 0x5D, 0x98, 0x4A, 0x8C, 0xB4, 0x6E,
+   0x12, 0x83, 0x9B, 0x95, 0xF1, 0x79, 0x32, 0x7B, 0x78, 0x82, 0x51, 0xC7, 0xE5, 0x04, 0x6D, 0xC5,
+   0x83, 0x71, 0x9D, 0xD7, 0xE6, 0xFE, 0x7A, 0xF5, 0xC5, 0x6E, 0xB8, 0x0A, 0xF4, 0x2C, 0x23, 0xE8,
+   0x79, 0x74, 0x89, 0xDE, 0x08, 0x17, 0xBD, 0xD9, 0xA7, 0x60, 0xA4, 0x56, 0x12, 0xCD, 0x8F, 0xE5,
+   //T(19)
+   0xEE, 0x08, 0x16, 0xA3, 0xD4, 0xD0, 0x21, 0xB6, 0x10, 0xB3, 0x7E, 0xCD, 0x77, 0x1E, 0x46, 0x88,
+   0xAE, 0xA3, 0xC9, 0xE0, 0xB9, 0xB5, 0x29, 0x0B, 0xE8, 0x88, 0x1A, 0x83, 0x3F, 0xEF, 0xCF, 0xC8,
+   0xC4, 0xA4, 0x38, 0xE3, 0xAD, 0x90, 0x06, 0xE1, 0x3A, 0x5F, 0xDF, 0x82, 0xDB, 0x49, 0x01, 0x9F,
+   0x48, 0x91, 0x5D, 0xCF, 0xC1, 0x05, 0xF2, 0xD1, 0x8E, 0x99, 0x29, 0xBF, 0xB3, 0xA8, 0xCA, 0xA1,
+   //T(20)
+   0xDB, 0x96, 0xBB, 0x0C, 0x78, 0x53, 0xA9, 0x37, 0x30, 0x1B, 0xA1, 0xB2, 0x32, 0xAC, 0xF1, 0x05,
+   0xD7, 0x42, 0x0C, 0x18, 0xD9, 0x1E, 0xCB, 0x2E, 0x5D, 0xB9, 0x62, 0x0F, 0x87, 0xDE, 0x4B, 0x29,
+   0xB3, 0x25, 0x07, 0x4E, 0x7A, 0x13, 0x22, 0x2C, 0x3F, 0xBE, 0xE4, 0xD3, 0xB9, 0xDA, 0x17, 0x17,
+   0xAB, 0x80, 0xCE, 0xF0, 0x64, 0x85, 0x2A, 0x1D, 0xD8, 0x4B, 0xFE, 0xF6, 0xC3, 0x59, 0xAC, 0x34,
+   //T(21)
+   0x86, 0x99, 0xDD, 0x31, 0xE0, 0x9C, 0xB9, 0xF0, 0x55, 0x27, 0x88, 0xAC, 0xCB, 0xD2, 0x1E, 0x33,
+   0xCA, 0x9F, 0x7A, 0x1D, 0xAE, 0xD0, 0x35, 0xBE, 0x5D, 0x6D, 0xC5, 0x03, 0xE8, 0x3A, 0xD2, 0xC9,
+   0x16, 0xE6, 0x54, 0x84, 0xE9, 0x28, 0x59, 0xB7, 0x24, 0x19, 0x99, 0x08, 0xC7, 0x2C, 0x78, 0xC1,
+   0x4C, 0xB2, 0x0E, 0x96, 0xB8, 0x2A, 0x5A, 0xF9, 0x38, 0x58, 0x41, 0x96, 0x32, 0x9B, 0xF9, 0x61,
+   //T(22)
+   0xEE, 0xC0, 0xB9, 0x75, 0x2C, 0xC6, 0x72, 0x14, 0x4A, 0x75, 0x99, 0x82, 0x16, 0xC1, 0xDA, 0x96,
+   0x6C, 0x89, 0x71, 0x23, 0x00, 0x31, 0xDB, 0xB4, 0x6A, 0x20, 0x1C, 0x4B, 0x05, 0x2F, 0xDE, 0x29,
+   0xE0, 0x2A, 0xF7, 0x70, 0xF7, 0xF1, 0xD2, 0x83, 0x78, 0x9D, 0x66, 0x4B, 0xF9, 0x66, 0xF3, 0x29,
+   0x36, 0x7F, 0xB6, 0x6A, 0x84, 0x39, 0xF6, 0xBA, 0xB9, 0x08, 0xB9, 0xF1, 0x81, 0x2C, 0x86, 0x4E,
+   //T(23)
+   0x18, 0x6C, 0x7F, 0x79, 0x3D, 0xF3, 0x24, 0x5E, 0xC9, 0xB9, 0x7D, 0x37, 0x4B, 0x60, 0x0B, 0x83,
+   0x5F, 0x0B, 0x46, 0xD5, 0xE9, 0x9D, 0x5C, 0x7C, 0xA2, 0x0A, 0x2C, 0x70, 0xDB, 0x30, 0x38, 0xDD,
+   0x9C, 0x42, 0x8D, 0xB8, 0x9A, 0xB5, 0x89, 0x13, 0x81, 0x39, 0xB3, 0x6A, 0x8D, 0x2E, 0xA7, 0x97,
+   0x92, 0x49, 0x89, 0x7F, 0x91, 0xE2, 0xD8, 0xED, 0x2A, 0xF7, 0x24, 0x60, 0x4F, 0x1C, 0xE5, 0x7F,
+   //T(24)
+   0xEE, 0x22, 0x80, 0xF4, 0x4E, 0x33, 0xA6, 0x5D, 0x7A, 0xFC, 0xCC, 0x8A, 0x29, 0x5B, 0x57, 0xD2,
+   0xDC, 0xBA, 0xB6, 0x50, 0x1B, 0x6B, 0x97, 0x30, 0xB4, 0xA1, 0x96, 0xFB, 0x64, 0x71, 0xAA, 0xA0,
+   0xCE, 0x46, 0xEC, 0x91, 0xA6, 0xA1, 0xEB, 0x84, 0x0D, 0x59, 0x8F, 0x06, 0xED, 0x5F, 0xBB, 0xD2,
+   0x4E, 0x98, 0xA9, 0x8D, 0x82, 0x60, 0x4F, 0x6B, 0xC4, 0x7A, 0x08, 0x03, 0x89, 0x0F, 0xCD, 0x12,
+   //T(25)
+   0xC6, 0x2E, 0x15, 0x5C, 0x58, 0xA5, 0xF2, 0x63, 0x5B, 0xC5, 0x34, 0x1E, 0x27, 0x1A, 0x93, 0xF1,
+   0x5F, 0x72, 0xCC, 0x22, 0x59, 0x5E, 0x65, 0x47, 0x1F, 0x1E, 0x4F, 0x3F, 0x4B, 0xE6, 0x45, 0x8D,
+   0xFF, 0x9F, 0x23, 0x22, 0x18, 0x26, 0x7E, 0x4E, 0xD3, 0x3A, 0x76, 0x57, 0xEE, 0xAA, 0x4D, 0x04,
+   0x67, 0xE1, 0xF7, 0xDC, 0x7E, 0x36, 0xA6, 0xAD, 0x5F, 0x6F, 0x84, 0x5A, 0x58, 0xBA, 0x7F, 0xF4,
+   //T(26)
+   0xA0, 0x31, 0x8A, 0x5F, 0x32, 0xF6, 0xE5, 0x14, 0xA0, 0xE8, 0xF0, 0xA7, 0x0B, 0xAB, 0xA2, 0x9A,
+   0xC7, 0x87, 0x6F, 0xB6, 0x36, 0x96, 0xB4, 0x37, 0xD3, 0x69, 0xF1, 0x1F, 0x4A, 0x53, 0x78, 0x9F,
+   0xF3, 0x20, 0xB8, 0xFC, 0xF0, 0xEE, 0xBB, 0x3A, 0xFD, 0x08, 0x90, 0x3F, 0x09, 0xA3, 0x25, 0xAA,
+   0x41, 0x8C, 0x50, 0x7C, 0x36, 0x2E, 0xEB, 0xB1, 0x5C, 0x4A, 0x43, 0xD1, 0x11, 0x77, 0x5A, 0x08,
+   //T(27)
+   0x5E, 0x67, 0x7D, 0x0C, 0x95, 0x9C, 0x44, 0xFA, 0xA4, 0x48, 0x69, 0x16, 0xF4, 0x64, 0x6F, 0x9F,
+   0x40, 0x30, 0xEC, 0xC3, 0xBB, 0x90, 0x02, 0xD8, 0xE3, 0x3F, 0x02, 0x55, 0xC7, 0x64, 0x4C, 0x1D,
+   0x44, 0x9F, 0x0C, 0xE6, 0x31, 0x00, 0xD3, 0x1E, 0xE3, 0x3D, 0x0B, 0xD5, 0x02, 0x99, 0x3A, 0xEA,
+   0x5D, 0x93, 0xA8, 0x6F, 0x62, 0x48, 0xF9, 0x1F, 0xE2, 0xE7, 0xD7, 0xD0, 0xD8, 0x8B, 0x91, 0x44,
+   //T(28)
+   0x8C, 0x56, 0x88, 0x74, 0x5A, 0x79, 0x41, 0xE4, 0x90, 0x11, 0x09, 0x1D, 0x30, 0x67, 0x79, 0x1F,
+   0x34, 0xCA, 0x92, 0x3B, 0xA6, 0xD0, 0xAF, 0xC7, 0x3F, 0xCD, 0x92, 0x5A, 0x73, 0xCF, 0x26, 0x78,
+   0xFB, 0x3A, 0x48, 0xB1, 0x5B, 0xAD, 0x14, 0xD2, 0xF2, 0xDD, 0xB6, 0x93, 0xE8, 0x8C, 0x64, 0x20,
+   0x77, 0x44, 0x31, 0x6B, 0x59, 0x5C, 0x51, 0xF4, 0x34, 0xD3, 0x71, 0x80, 0xFC, 0x33, 0x98, 0x00,
+   //T(29)
+   0xE4, 0xDA, 0x88, 0xE9, 0x93, 0xD0, 0xCB, 0x92, 0x2A, 0x84, 0x94, 0x71, 0xA5, 0x91, 0xF8, 0x53,
+   0x68, 0xC0, 0xCD, 0x44, 0x31, 0x27, 0x35, 0x4C, 0x52, 0xDF, 0x15, 0x88, 0xFD, 0xAA, 0xB2, 0x56,
+   0xF7, 0xFA, 0x4D, 0x15, 0x10, 0x06, 0x2E, 0x80, 0x97, 0xFC, 0x50, 0xDE, 0xD0, 0xF3, 0xBC, 0x51,
+   0x60, 0xFE, 0x2A, 0x36, 0x26, 0x37, 0x07, 0xBA, 0x6D, 0x1E, 0xA3, 0x5D, 0x16, 0x39, 0xC6, 0x24,
+   //T(30)
+   0x4B, 0x59, 0x25, 0x3A, 0xF9, 0xC1, 0x3D, 0xE7, 0xB5, 0x8A, 0x60, 0x71, 0xE6, 0x39, 0xEC, 0x09,
+   0xB6, 0xC9, 0x35, 0xFB, 0x3F, 0xEA, 0xA2, 0x72, 0xC4, 0x29, 0xA1, 0x13, 0x02, 0x4C, 0x16, 0x8D,
+   0xAA, 0x03, 0x07, 0xBF, 0x7F, 0xA7, 0x9C, 0x93, 0xE8, 0x5D, 0x78, 0x20, 0x01, 0xF1, 0x85, 0xF5,
+   0xF0, 0x06, 0x4C, 0x12, 0x50, 0x72, 0x3F, 0xE2, 0x6D, 0x2D, 0x68, 0xF2, 0xFB, 0xFB, 0x89, 0x55,
+   //T(31)
+   0x82, 0x5F, 0x01, 0x94, 0x8E, 0x83, 0x1D, 0x5B, 0x76, 0xC4, 0xC1, 0x80, 0x42, 0x86, 0xFB, 0x42,
+   0x1A, 0x25, 0x30, 0xB0, 0x5A, 0x00, 0x16, 0x9C, 0x2E, 0x75, 0xA2, 0x66, 0x5B, 0x69, 0x65, 0x27,
+   0x43, 0x58, 0x72, 0xFE, 0xBC, 0x72, 0x3A, 0x17, 0x61, 0x79, 0x4C, 0x4F, 0x24, 0x11, 0x11, 0x50,
+   0x10, 0x6F, 0x9B, 0xC4, 0xCE, 0x5B, 0x10, 0x6A, 0xDB, 0xF0, 0xA1, 0x1F, 0xEF, 0x70, 0x37, 0x39
+};
+
+#endif
+
+
 /**
  * @brief secp256r1 elliptic curve
  **/
@@ -631,9 +827,249 @@ const EcCurveInfo secp256r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp256r1Mod
+   secp256r1Mod,
+   //Fixed-base comb table
+#if (EC_COMB_SUPPORT == ENABLED)
+   secp256r1Comb
+#else
+   NULL
+#endif
+};
+
+
+#if (EC_COMB_SUPPORT == ENABLED)
+
+/**
+ * @brief secp384r1 comb table
+ *
+ * T(i) = i(0).G + i(1).2^d.G + ... + i(W-1).2^((W-1)d).G, where i(j) is the
+ * j-th bit of i and d = ceil(n / W). Each point is stored in affine
+ * coordinates as the concatenation of x and y
+ **/
+
+static const uint8_t secp384r1Comb[EC_COMB_TABLE_SIZE * 96] =
+{
+   //T(1)
+   0xAA, 0x87, 0xCA, 0x22, 0xBE, 0x8B, 0x05, 0x37, 0x8E, 0xB1, 0xC7, 0x1E, 0xF3, 0x20, 0xAD, 0x74,
+   0x6E, 0x1D, 0x3B, 0x62, 0x8B, 0xA7, 0x9B, 0x98, 0x59, 0xF7, 0x41, 0xE0, 0x82, 0x54, 0x2A, 0x38,
+   0x55, 0x02, 0xF2, 0x5D, 0xBF, 0x55, 0x29, 0x6C, 0x3A, 0x54, 0x5E, 0x38, 0x72, 0x76, 0x0A, 0xB7,
+   0x36, 0x17, 0xDE, 0x4A, 0x96, 0x26, 0x2C, 0x6F, 0x5D, 0x9E, 0x98, 0xBF, 0x92, 0x92, 0xDC, 0x29,
+   0xF8, 0xF4, 0x1D, 0xBD, 0x28, 0x9A, 0x14, 0x7C, 0xE9, 0xDA, 0x31, 0x13, 0xB5, 0xF0, 0xB8, 0xC0,
+   0x0A, 0x60, 0xB1, 0xCE, 0x1D, 0x7E, 0x81, 0x9D, 0x7A, 0x43, 0x1D, 0x7C, 0x90, 0xEA, 0x0E, 0x5F,
+   //T(2)
+   0xFD, 0xFF, 0x5D, 0x78, 0xE5, 0x2E, 0x83, 0xA1, 0xB2, 0x12, 0x87, 0x65, 0x41, 0x5B, 0x43, 0x93,
+   0x6A, 0xD5, 0x64, 0x35, 0x05, 0xF1, 0xDB, 0xE9, 0xE8, 0xE8, 0xA3, 0x14, 0x68, 0x5C, 0xB4, 0x9E,
+   0x8B, 0xB2, 0x6B, 0x1F, 0x0B, 0xAF, 0xF6, 0x7E, 0x21, 0x4A, 0x55, 0x41, 0x57, 0x4A, 0x2D, 0x7A,
+   0x4D, 0xB0, 0xBC, 0x42, 0x78, 0x57, 0xAA, 0x4C, 0x13, 0xF5, 0xD4, 0x1F, 0xF1, 0x0B, 0x94, 0x4A,
+   0x00, 0x37, 0x7F, 0x99, 0x59, 0x63, 0xC9, 0x51, 0xEF, 0x01, 0xA9, 0xD8, 0xDD, 0x2D, 0x7E, 0xC4,
+   0xDC, 0xC7, 0x2E, 0x10, 0xD4, 0xD3, 0x91, 0xB8, 0xE7, 0x15, 0xE9, 0x76, 0x97, 0x8E, 0x2B, 0x11,
+   //T(3)
+   0x5E, 0x54, 0xD9, 0x53, 0x0F, 0xDD, 0x80, 0x4E, 0x49, 0x2E, 0xCE, 0xBD, 0x3E, 0xEE, 0x91, 0x5B,
+   0x0A, 0x9B, 0x91, 0xBD, 0x21, 0xAD, 0x80, 0x66, 0xA9, 0xD5, 0xE3, 0x99, 0xEA, 0xAC, 0x94, 0x20,
+   0x82, 0x44, 0x13, 0x2B, 0x85, 0x47, 0xE6, 0xB6, 0x4D, 0xF6, 0x24, 0xDB, 0x8E, 0x8C, 0xF6, 0xBD,
+   0x4A, 0x3D, 0x77, 0x63, 0x4B, 0xA2, 0x4B, 0xC0, 0xB5, 0xE5, 0x34, 0xAC, 0x0E, 0x81, 0x31, 0xD0,
+   0x50, 0x09, 0xA4, 0xB4, 0x95, 0x82, 0x1B, 0x09, 0x6F, 0x98, 0xB3, 0x52, 0x89, 0xA6, 0x6C, 0x33,
+   0xF6, 0x6D, 0x71, 0x25, 0x42, 0x72, 0x7F, 0xD7, 0x44, 0x28, 0x8C, 0x00, 0xCC, 0x5A, 0x43, 0xB2,
+   //T(4)
+   0x29, 0x13, 0xD4, 0xEB, 0x34, 0xCB, 0x8F, 0xA1, 0xCD, 0x95, 0x8F, 0x85, 0x7F, 0x52, 0xC6, 0xE5,
+   0x0E, 0x63, 0xF4, 0x60, 0x50, 0xFE, 0xAF, 0x12, 0xCF, 0x1D, 0xF4, 0xFD, 0xC3, 0x0B, 0xD6, 0x59,
+   0x6C, 0xC2, 0x8A, 0x6C, 0xCA, 0x52, 0xB0, 0x96, 0xD4, 0x90, 0xB0, 0x21, 0xE0, 0xBD, 0xE8, 0xC2,
+   0x04, 0x7B, 0x88, 0x5F, 0x5A, 0x14, 0xFF, 0xB1, 0xA5, 0xCC, 0xE5, 0xA0, 0x77, 0x65, 0xA1, 0x32,
+   0x27, 0x85, 0x5D, 0x53, 0x76, 0x03, 0xFD, 0x5F, 0x2D, 0x48, 0x72, 0x2E, 0xB3, 0xBB, 0x7D, 0xA7,
+   0xB4, 0x7F, 0x86, 0x3A, 0xB1, 0xA8, 0x74, 0xD8, 0xCB, 0xF9, 0x87, 0xE9, 0xB0, 0x83, 0xDC, 0xB0,
+   //T(5)
+   0xD2, 0x3B, 0x74, 0x6B, 0x6A, 0xA7, 0x12, 0x94, 0xD9, 0x62, 0x04, 0xE4, 0xB7, 0xFD, 0x66, 0x64,
+   0x27, 0x4E, 0x62, 0x60, 0x4B, 0x04, 0x73, 0x85, 0xD5, 0x0A, 0x0A, 0xC4, 0x1F, 0x2C, 0xCD, 0x66,
+   0x66, 0x00, 0x4E, 0xC3, 0xD2, 0x6C, 0x55, 0xB2, 0x33, 0x11, 0xEC, 0x54, 0x93, 0x16, 0x94, 0xD6,
+   0xE2, 0xF2, 0xCD, 0xA7, 0x01, 0x69, 0x07, 0x6A, 0x5F, 0x34, 0x8F, 0x1D, 0x09, 0xA7, 0x1B, 0xA8,
+   0x27, 0x86, 0xBD, 0x19, 0xB8, 0x9D, 0x30, 0x90, 0xC5, 0xBE, 0x10, 0x1D, 0xAA, 0x3A, 0xEC, 0x73,
+   0x47, 0x70, 0x9B, 0x8E, 0xBE, 0x78, 0x08, 0x47, 0x9A, 0x72, 0x31, 0xA7, 0x46, 0xB6, 0x4A, 0xDD,
+   //T(6)
+   0xE9, 0xFB, 0x6A, 0x4D, 0xF5, 0xD9, 0x3F, 0x24, 0x0F, 0xD7, 0xFC, 0x38, 0xE6, 0x72, 0xC5, 0x79,
+   0x50, 0x35, 0x97, 0x55, 0xAD, 0xBA, 0x73, 0x24, 0xE7, 0xEA, 0x29, 0xA0, 0xB6, 0xF8, 0xC0, 0x73,
+   0xCC, 0x58, 0x95, 0x14, 0xA5, 0x26, 0xF3, 0xF5, 0x0D, 0xB6, 0x99, 0xE4, 0x12, 0xD2, 0x56, 0xE1,
+   0x52, 0xAD, 0x7C, 0x38, 0xE5, 0x12, 0x10, 0xF9, 0xEA, 0xB7, 0x0F, 0xFA, 0xD1, 0x71, 0x10, 0x4B,
+   0x6F, 0x54, 0x24, 0xA9, 0x66, 0xF0, 0xCD, 0x5A, 0x6C, 0x24, 0xC0, 0x94, 0xDB, 0xDB, 0xAE, 0x3D,
+   0x6E, 0x71, 0x07, 0xBD, 0x1D, 0xE0, 0x52, 0xBE, 0x91, 0x03, 0xB7, 0x78, 0x91, 0x0A, 0x0F, 0xB5,
+   //T(7)
+   0xB7, 0x69, 0xB0, 0xBE, 0xDA, 0x1C, 0x16, 0x69, 0xD0, 0x47, 0x2D, 0xD3, 0xD0, 0x94, 0xB6, 0xA7,
+   0x5F, 0xC1, 0x13, 0xE8, 0xDC, 0x50, 0x39, 0x3C, 0xD6, 0xBE, 0xAE, 0xB6, 0xC8, 0x1E, 0xE1, 0x26,
+   0xF0, 0x4B, 0xA2, 0x46, 0xF8, 0xEE, 0x3F, 0x37, 0x70, 0xCB, 0x8A, 0x4C, 0x1A, 0x46, 0x5E, 0xE0,
+   0x4F, 0xE5, 0x42, 0xB9, 0xEB, 0xAA, 0xD0, 0xA2, 0x81, 0xD5, 0x1B, 0x7F, 0xD4, 0x15, 0xE1, 0xCA,
+   0xA2, 0x41, 0x59, 0x11, 0x8B, 0x36, 0xD6, 0x01, 0xB9, 0xC0, 0x4F, 0x16, 0x28, 0x45, 0x69, 0xC0,
+   0xDE, 0x0A, 0xED, 0x5E, 0x96, 0xBE, 0xEE, 0xC6, 0x77, 0x24, 0x81, 0xFA, 0x41, 0x57, 0xBC, 0xA1,
+   //T(8)
+   0xA8, 0xEB, 0x21, 0x14, 0x00, 0x42, 0x41, 0xBD, 0x8B, 0x5D, 0x42, 0x09, 0x8A, 0xE7, 0xD5, 0x8B,
+   0xC3, 0x5A, 0x94, 0xE6, 0xAC, 0x1B, 0x02, 0xF4, 0xCB, 0x53, 0x83, 0x03, 0xFA, 0xAC, 0x37, 0x5A,
+   0xBD, 0x50, 0x59, 0xC9, 0x03, 0x6A, 0xFB, 0x3B, 0xCB, 0x61, 0x01, 0x82, 0xA9, 0x3C, 0x10, 0xA7,
+   0xAB, 0xB6, 0x0C, 0xE6, 0x10, 0x55, 0x29, 0xBA, 0x2C, 0x43, 0x82, 0xFF, 0xA2, 0x67, 0x5D, 0x24,
+   0x89, 0xB1, 0x8A, 0xED, 0x0E, 0xA7, 0x7D, 0x12, 0x0A, 0xDA, 0xE8, 0xA9, 0xFA, 0xB6, 0xBE, 0x4D,
+   0xC6, 0xD2, 0xBC, 0xDF, 0x31, 0x30, 0x6B, 0x48, 0xAA, 0x3C, 0x55, 0x4A, 0x26, 0x2F, 0xAC, 0x2C,
+   //T(9)
+   0xA4, 0x1C, 0xEB, 0x96, 0x5B, 0x46, 0x96, 0x0B, 0x59, 0xBD, 0xB6, 0x61, 0x79, 0xA8, 0xB5, 0xAB,
+   0x22, 0xBB, 0x9F, 0x3B, 0x4D, 0xE7, 0xB0, 0xB3, 0x5F, 0xDC, 0x0C, 0x0F, 0xBA, 0x53, 0x28, 0xE9,
+   0x4E, 0xE4, 0x99, 0x86, 0xC5, 0x8B, 0x99, 0x9A, 0x7F, 0xFA, 0xF7, 0x18, 0xED, 0xF8, 0xC9, 0x96,
+   0xC6, 0xE9, 0x4C, 0xF8, 0x10, 0xE2, 0x83, 0x46, 0x78, 0x5C, 0xB6, 0x25, 0xE5, 0xEF, 0xAA, 0xD0,
+   0x2C, 0xFE, 0x48, 0x4D, 0x82, 0xED, 0xFF, 0x44, 0x98, 0x51, 0x59, 0xD4, 0x72, 0x5E, 0x98, 0x1D,
+   0x16, 0x82, 0xF9, 0x77, 0x55, 0x46, 0x57, 0x5D, 0xF9, 0x5F, 0xD8, 0x96, 0x67, 0x3F, 0x56, 0x5B,
+   //T(10)
+   0xC7, 0xFA, 0x78, 0x69, 0xEA, 0xC6, 0x99, 0x87, 0x9B, 0xEF, 0xB7, 0x95, 0xA1, 0x5A, 0xF7, 0xC1,
+   0x90, 0x7E, 0x97, 0xBA, 0xA5, 0x06, 0xB0, 0x1A, 0xDF, 0x36, 0x3E, 0x09, 0x4A, 0xB1, 0xFB, 0x6E,
+   0xD8, 0x50, 0x30, 0x95, 0x62, 0xA7, 0x6A, 0x5B, 0xCF, 0xA7, 0x8F, 0xCC, 0xE7, 0x9F, 0xC9, 0x53,
+   0x9D, 0x43, 0x4D, 0xBE, 0x0A, 0x61, 0xCD, 0xF5, 0x87, 0x51, 0x9B, 0x7F, 0x43, 0xFC, 0x91, 0xF8,
+   0x30, 0x6C, 0x84, 0x70, 0xF8, 0x7F, 0x92, 0x62, 0xB3, 0x7C, 0xC3, 0x65, 0xAE, 0xE8, 0x0F, 0xB9,
+   0xB0, 0x91, 0x7D, 0x3B, 0x2E, 0x6D, 0x0F, 0xB8, 0xDE, 0x4D, 0x11, 0xB2, 0x1C, 0x40, 0x4F, 0xE9,
+   //T(11)
+   0x81, 0xC0, 0x2C, 0x3E, 0xDA, 0x05, 0xDE, 0x0C, 0xC7, 0x78, 0xEF, 0x62, 0x87, 0xF8, 0x1D, 0xB5,
+   0xC8, 0xA1, 0x65, 0x64, 0xCE, 0xD4, 0x2A, 0xB2, 0xA1, 0x34, 0x4A, 0xD0, 0x16, 0x4A, 0x20, 0xF6,
+   0x60, 0xFD, 0x2C, 0xEB, 0xAC, 0x82, 0x0A, 0x90, 0x49, 0xBF, 0x60, 0x9F, 0xB3, 0x31, 0x39, 0xE7,
+   0x1C, 0xE0, 0x02, 0x8A, 0x4C, 0x3E, 0xF2, 0xD3, 0x0C, 0x34, 0x52, 0x97, 0x69, 0xCB, 0x4B, 0x1D,
+   0x46, 0xA2, 0xA1, 0x2D, 0xC4, 0x2F, 0x9A, 0x8E, 0x9D, 0xDA, 0xD4, 0x13, 0xA9, 0xCE, 0x29, 0x2C,
+   0x8B, 0xF3, 0x10, 0xB1, 0x90, 0xE3, 0x13, 0x40, 0x92, 0x4D, 0x0E, 0x64, 0xC1, 0x7D, 0x28, 0xB9,
+   //T(12)
+   0xA7, 0x20, 0x8E, 0x9D, 0xA9, 0xCE, 0xA0, 0xC5, 0x64, 0x4E, 0x97, 0xB7, 0x5F, 0x27, 0xC6, 0x4A,
+   0xB1, 0x8E, 0x9E, 0x73, 0x53, 0x74, 0x0E, 0xC9, 0x8B, 0x61, 0x36, 0xDD, 0x22, 0x5A, 0x3D, 0xD1,
+   0xCD, 0xC5, 0x35, 0x30, 0xDE, 0x8D, 0x21, 0x45, 0x7B, 0x2E, 0xA2, 0x37, 0x44, 0x84, 0x24, 0x9F,
+   0x65, 0xBE, 0x9E, 0x50, 0x33, 0x5D, 0x77, 0xB6, 0x74, 0xA9, 0x5C, 0x5B, 0x2C, 0xB2, 0xEC, 0x36,
+   0xAE, 0x71, 0x93, 0x73, 0x11, 0xCF, 0x7C, 0x4B, 0xBC, 0xC8, 0x71, 0x31, 0x1F, 0x06, 0x8F, 0xB5,
+   0x1D, 0xEB, 0xA7, 0xF3, 0x57, 0xC5, 0xF0, 0x37, 0x6B, 0xB5, 0x44, 0xBD, 0xA4, 0x8B, 0x98, 0xEC,
+   //T(13)
+   0x71, 0x43, 0x98, 0xBB, 0x65, 0x79, 0xD2, 0x48, 0xF6, 0x96, 0xC7, 0x56, 0xB9, 0x78, 0xFA, 0x06,
+   0x5C, 0x01, 0xA2, 0xBE, 0xF7, 0x21, 0x59, 0x66, 0x71, 0x71, 0xC0, 0x38, 0xAD, 0x2A, 0xD1, 0x61,
+   0xED, 0xD5, 0xF9, 0x53, 0x51, 0xD1, 0x44, 0xA0, 0xF9, 0xA6, 0xE7, 0xF2, 0xB2, 0x31, 0x91, 0x68,
+   0x65, 0x45, 0xAA, 0x51, 0xA4, 0xB5, 0xD7, 0xB8, 0x87, 0x01, 0xF6, 0x45, 0xE1, 0x7F, 0x04, 0x76,
+   0x54, 0xAC, 0x28, 0xC5, 0x90, 0xCD, 0x77, 0x84, 0x7F, 0x0C, 0x9F, 0x34, 0xD6, 0xEE, 0x93, 0x7E,
+   0x81, 0x8B, 0x42, 0xB4, 0xFF, 0x0C, 0x18, 0x46, 0x4A, 0xDE, 0x57, 0x06, 0xAB, 0x1F, 0xB3, 0x25,
+   //T(14)
+   0xF4, 0xB3, 0x5B, 0x77, 0xCC, 0x28, 0x1C, 0x52, 0xC7, 0x47, 0xF8, 0x5F, 0xBE, 0xB9, 0xF7, 0xAF,
+   0x40, 0x37, 0x1D, 0xC1, 0x76, 0x54, 0xC2, 0x63, 0xAA, 0xE4, 0x6B, 0x81, 0x46, 0x44, 0xDB, 0xC4,
+   0xDF, 0x31, 0x2F, 0x51, 0x9C, 0xB0, 0x64, 0x73, 0x88, 0x0F, 0x88, 0x0F, 0x77, 0x52, 0x26, 0xD6,
+   0x33, 0xE1, 0x39, 0xEF, 0xF0, 0x74, 0x14, 0xD3, 0x04, 0x7B, 0xBC, 0xF0, 0x12, 0x03, 0x28, 0xCE,
+   0xD2, 0xD8, 0x6E, 0x75, 0xE1, 0xB6, 0x36, 0x5E, 0x28, 0xCF, 0x7B, 0xC3, 0xFD, 0x21, 0x2D, 0x3F,
+   0x51, 0x53, 0x7C, 0xA3, 0xFB, 0xF5, 0x43, 0x3B, 0x28, 0xEC, 0x4A, 0xC0, 0x8C, 0x15, 0xE2, 0x75,
+   //T(15)
+   0xA4, 0x9B, 0x60, 0x2C, 0x54, 0xDB, 0xFC, 0x48, 0xD6, 0x95, 0x8C, 0x1E, 0x60, 0x96, 0x9A, 0x97,
+   0xC6, 0x2D, 0xF6, 0x37, 0x4D, 0x83, 0xE1, 0x1C, 0x6B, 0xE0, 0x8D, 0x5D, 0x1B, 0x50, 0x76, 0xC2,
+   0xCB, 0x53, 0x57, 0xBA, 0x53, 0x82, 0xED, 0x59, 0xE2, 0xA2, 0xF4, 0xFC, 0xCB, 0x38, 0xE8, 0x6D,
+   0x7E, 0x1D, 0x2F, 0x2E, 0xB5, 0xCF, 0x54, 0xD1, 0x9F, 0x5E, 0x1F, 0xE2, 0x17, 0xA8, 0x18, 0xF2,
+   0xB8, 0xE8, 0xCA, 0x59, 0xA7, 0x5F, 0x00, 0x46, 0x0A, 0xDC, 0xD9, 0x52, 0x00, 0x64, 0x4D, 0x20,
+   0xB4, 0xBC, 0x64, 0xC9, 0xAA, 0x21, 0x17, 0x19, 0xFB, 0x97, 0xD2, 0xEE, 0x51, 0x91, 0x4B, 0xCA,
+   //T(16)
+   0x5B, 0x4E, 0x8B, 0x1D, 0x9E, 0x9B, 0xF4, 0xD9, 0x14, 0x70, 0x15, 0x9C, 0x99, 0x3D, 0x3A, 0x02,
+   0xB1, 0x32, 0x28, 0xB1, 0xE8, 0xA1, 0xA2, 0xA3, 0xDB, 0x6A, 0x4D, 0x39, 0x8F, 0x15, 0x46, 0xBE,
+   0x7A, 0xD2, 0xA6, 0x0B, 0xFF, 0x70, 0x03, 0xC6, 0x39, 0x92, 0xD2, 0xA1, 0x31, 0xE7, 0x62, 0x20,
+   0xC3, 0x74, 0x20, 0x94, 0xD5, 0x47, 0x6D, 0x33, 0xBB, 0x84, 0x4D, 0xF2, 0x22, 0xC7, 0x46, 0x09,
+   0x87, 0x27, 0x08, 0x8A, 0x37, 0xA9, 0xB5, 0x79, 0xF6, 0x50, 0x28, 0x5A, 0xC8, 0xA2, 0x26, 0x5B,
+   0xE0, 0x78, 0x1A, 0x9D, 0x3D, 0xF1, 0xDF, 0xE2, 0x6F, 0xCB, 0x85, 0xE9, 0x0C, 0xD0, 0x01, 0xD1,
+   //T(17)
+   0xAA, 0x0E, 0x19, 0xAA, 0x44, 0xB8, 0xBF, 0x68, 0x7D, 0x81, 0xF6, 0x8F, 0xDA, 0xF8, 0xAA, 0x6C,
+   0xA8, 0x78, 0x2B, 0x8E, 0xBA, 0x44, 0x07, 0x54, 0xCE, 0x25, 0x4C, 0xFD, 0x85, 0x3C, 0xB4, 0x59,
+   0x51, 0x30, 0xBD, 0xE7, 0xB6, 0xB9, 0x0F, 0x17, 0x79, 0xFE, 0x24, 0x65, 0x1E, 0x06, 0x01, 0x65,
+   0x65, 0xDB, 0x0B, 0x8A, 0xCB, 0x3C, 0x35, 0xA3, 0xC4, 0x75, 0x07, 0x53, 0x15, 0x4E, 0xC8, 0x95,
+   0xD9, 0x86, 0xB3, 0x57, 0xCA, 0x81, 0x49, 0x8E, 0x7A, 0x28, 0x2A, 0x2A, 0x13, 0x1C, 0x05, 0x0D,
+   0x8F, 0x1B, 0x7D, 0x25, 0x4E, 0x9F, 0xEA, 0x80, 0x6E, 0x3E, 0xE9, 0x6F, 0x26, 0x64, 0xA4, 0x87,
+   //T(18)
+   0x39, 0x6B, 0x35, 0xA9, 0x3D, 0x0A, 0x9F, 0x44, 0xB3, 0x27, 0x63, 0x8E, 0xCC, 0xA3, 0xB2, 0x89,
+   0xB9, 0x21, 0x10, 0xA3, 0xFF, 0x3C, 0x56, 0xCE, 0xD8, 0x72, 0x72, 0xF9, 0x46, 0x15, 0xCE, 0x5F,
+   0xBF, 0x57, 0x77, 0xFA, 0x91, 0xAE, 0xE2, 0x66, 0x4A, 0xC9, 0x0B, 0x15, 0xCE, 0x94, 0x99, 0xEB,
+   0xCC, 0xD5, 0xDF, 0x68, 0x02, 0x14, 0x60, 0xCA, 0x16, 0xDD, 0x93, 0xB9, 0xA5, 0xB4, 0xCD, 0x7A,
+   0xA3, 0xC2, 0x09, 0x77, 0x07, 0x1D, 0xDE, 0x46, 0xD7, 0xE2, 0x21, 0xED, 0xB8, 0x43, 0xCD, 0xE9,
+   0x44, 0x24, 0x2D, 0x55, 0x3F, 0x9A, 0xA0, 0x0A, 0x0D, 0xAD, 0x55, 0x14, 0x8A, 0xD6, 0x19, 0xEF,
+   //T(19)
+   0x5B, 0x64, 0x78, 0xB4, 0xC8, 0x2A, 0x64, 0xC1, 0xDA, 0xBB, 0x89, 0x57, 0x88, 0x49, 0x2C, 0xB7,
+   0x2D, 0x31, 0x79, 0x5F, 0x7F, 0x08, 0xEB, 0xA2, 0xC0, 0xFE, 0x28, 0xDE, 0x6B, 0xA2, 0xD1, 0x3C,
+   0xE9, 0x17, 0xB3, 0x1C, 0x39, 0x4F, 0xE4, 0x27, 0x1D, 0x21, 0x12, 0x8B, 0x6A, 0x57, 0x0F, 0x04,
+   0x0A, 0xE3, 0x33, 0x7F, 0x7E, 0x9C, 0xC1, 0x5B, 0x70, 0x93, 0x12, 0x4C, 0x7B, 0x50, 0xF8, 0x18,
+   0xAC, 0xBB, 0x2D, 0xDC, 0xAE, 0x07, 0xE0, 0xE5, 0xB3, 0x8D, 0x3C, 0x11, 0x95, 0x03, 0x33, 0x67,
+   0x55, 0x29, 0x92, 0xD1, 0x21, 0x7D, 0x14, 0xF8, 0x5D, 0x14, 0xF5, 0x18, 0xCD, 0x43, 0x0E, 0x4C,
+   //T(20)
+   0xDD, 0x79, 0x09, 0x87, 0xD9, 0x3C, 0x74, 0xA3, 0xDE, 0xA8, 0xF2, 0x3F, 0x89, 0xE6, 0x6C, 0x63,
+   0xFB, 0x43, 0x53, 0x79, 0xD2, 0x99, 0xBC, 0x0D, 0x8D, 0x18, 0xAB, 0x7D, 0x7C, 0x63, 0x27, 0x79,
+   0x4F, 0xEB, 0x24, 0x6B, 0x20, 0xE8, 0x3E, 0x0D, 0x50, 0x5F, 0x49, 0xBA, 0x42, 0x8E, 0x55, 0x00,
+   0xAB, 0xAD, 0x13, 0x76, 0x41, 0xE3, 0x68, 0x69, 0x4F, 0x46, 0x5F, 0x5F, 0x45, 0x69, 0xD2, 0xD3,
+   0x52, 0xD2, 0x57, 0x5D, 0x10, 0x53, 0x93, 0xD3, 0x4E, 0x1B, 0xB7, 0x5C, 0x80, 0xC8, 0x4B, 0x38,
+   0xFF, 0x4C, 0xAA, 0x4A, 0x67, 0x7F, 0x98, 0x49, 0xA9, 0xAC, 0x8F, 0x10, 0x4B, 0x79, 0xAD, 0xF6,
+   //T(21)
+   0x8C, 0x90, 0x10, 0xD0, 0xDF, 0x18, 0x22, 0xB5, 0x26, 0xDB, 0x96, 0xAF, 0xFD, 0x1F, 0x7C, 0x82,
+   0x73, 0xC3, 0x0B, 0xF5, 0x28, 0x57, 0xA9, 0xD5, 0x45, 0xE5, 0xB4, 0x81, 0x91, 0xAE, 0xA8, 0xC6,
+   0x53, 0x31, 0x6E, 0xD1, 0x08, 0xE1, 0x14, 0xAE, 0xB8, 0x56, 0x67, 0x46, 0xEB, 0x3F, 0x72, 0xED,
+   0xA4, 0x4A, 0xD9, 0x79, 0xD6, 0x10, 0xB6, 0x6B, 0xD9, 0x36, 0x5C, 0xD7, 0x07, 0x0A, 0x6E, 0x08,
+   0x66, 0x48, 0x33, 0xBC, 0x1B, 0x71, 0xB3, 0xBD, 0x12, 0x98, 0xB7, 0x38, 0x34, 0xCD, 0x1B, 0xDD,
+   0xA3, 0xA4, 0x8C, 0x9F, 0x6A, 0x02, 0xC7, 0xCD, 0x24, 0x66, 0x24, 0xAB, 0x20, 0x42, 0x8D, 0x3D,
+   //T(22)
+   0x15, 0xC3, 0x1C, 0xD6, 0x4F, 0x1D, 0x07, 0x04, 0xD5, 0xB1, 0x7C, 0xEC, 0x23, 0x5C, 0x94, 0xE5,
+   0xF9, 0x0D, 0xAD, 0x22, 0x85, 0x06, 0x37, 0x0B, 0x65, 0x07, 0xBB, 0xC3, 0x4F, 0xF2, 0x22, 0xD2,
+   0x58, 0x83, 0xB4, 0xBE, 0xC9, 0x19, 0x6D, 0x36, 0xCC, 0x17, 0x4E, 0xB1, 0xA6, 0x69, 0x0F, 0xC0,
+   0x92, 0x50, 0x4A, 0xAD, 0xB5, 0x7A, 0x14, 0xDD, 0x64, 0xB1, 0xD3, 0xAA, 0x92, 0x77, 0xF0, 0x31,
+   0x1C, 0xB6, 0xAA, 0xDE, 0x53, 0xFF, 0x8F, 0x7F, 0xFB, 0x14, 0xB0, 0xB9, 0x68, 0xC5, 0xD5, 0x26,
+   0x30, 0xCA, 0x92, 0x41, 0x23, 0x63, 0x21, 0x98, 0xA4, 0x5E, 0x13, 0xE0, 0x83, 0x69, 0x2E, 0x96,
+   //T(23)
+   0x79, 0xBA, 0xEF, 0xE3, 0xEA, 0x9D, 0x8E, 0xEB, 0x64, 0x46, 0x57, 0xCD, 0x24, 0xDB, 0xDA, 0xCC,
+   0x38, 0x6C, 0xAB, 0x94, 0xD3, 0x43, 0x27, 0x43, 0xC6, 0x32, 0xEF, 0x51, 0x67, 0xE3, 0x31, 0xA8,
+   0xAB, 0xA6, 0x0A, 0x2B, 0xBC, 0x1B, 0x08, 0x86, 0xA6, 0x51, 0xA2, 0x49, 0x6F, 0x82, 0x4A, 0x23,
+   0xC3, 0x3E, 0x94, 0x2E, 0xC0, 0x7A, 0xB9, 0x81, 0x86, 0x11, 0x6D, 0x31, 0xFD, 0x91, 0xB7, 0x33,
+   0x54, 0x37, 0x6A, 0xE2, 0x43, 0xB9, 0x48, 0x72, 0xCC, 0x7C, 0x46, 0x8D, 0xC6, 0x25, 0xD4, 0x7F,
+   0xC7, 0x2C, 0x67, 0xD5, 0xB5, 0x55, 0x25, 0x50, 0xCE, 0x10, 0x0B, 0x59, 0x7C, 0x00, 0x22, 0xA9,
+   //T(24)
+   0x05, 0xE6, 0xB0, 0xA8, 0x4B, 0x8A, 0x03, 0xBA, 0xE9, 0x82, 0x5A, 0xAC, 0xE6, 0x3B, 0x58, 0x1E,
+   0x9F, 0x03, 0xA5, 0x29, 0xB6, 0x83, 0xD1, 0xDB, 0x91, 0x87, 0xE8, 0xD4, 0xAA, 0x71, 0xBE, 0x85,
+   0x4B, 0x2E, 0x65, 0x11, 0xEF, 0x64, 0x93, 0x6E, 0x7E, 0x01, 0x81, 0xB9, 0xC1, 0xA9, 0x0C, 0x5B,
+   0xCC, 0x81, 0x3D, 0x19, 0x80, 0x45, 0x30, 0x61, 0xA1, 0x52, 0x69, 0x0C, 0x3B, 0x95, 0x07, 0x70,
+   0x6E, 0x6A, 0x60, 0x97, 0xA6, 0x45, 0xCA, 0x8F, 0x1E, 0x7B, 0x1E, 0x07, 0x97, 0x87, 0xC6, 0xAE,
+   0x2D, 0xDA, 0x27, 0xD3, 0x7C, 0xCA, 0xDF, 0x9D, 0x61, 0x90, 0x7C, 0x78, 0xF3, 0x93, 0x86, 0x36,
+   //T(25)
+   0xB2, 0xA0, 0xC4, 0x49, 0x37, 0x39, 0x3D, 0x29, 0x17, 0x7D, 0x47, 0xC6, 0xBC, 0xB0, 0x48, 0x38,
+   0xDE, 0x1F, 0x97, 0x1D, 0xE7, 0xE9, 0x5F, 0x9A, 0x09, 0x2B, 0x80, 0x73, 0xCF, 0x05, 0x44, 0x0B,
+   0x3A, 0x34, 0x55, 0x64, 0xA4, 0x1D, 0xAC, 0x8D, 0x50, 0x26, 0xD3, 0xE0, 0xDC, 0x9B, 0xB5, 0x65,
+   0x59, 0x7F, 0xC7, 0xF4, 0xA1, 0x4C, 0xE4, 0xD5, 0x59, 0xC1, 0x78, 0xBA, 0x98, 0xC7, 0x09, 0x0F,
+   0x4E, 0xD2, 0x21, 0x26, 0x09, 0x1B, 0xC6, 0x64, 0xEE, 0x98, 0xB7, 0x85, 0xBC, 0x55, 0xA5, 0x1B,
+   0x31, 0xE3, 0x7B, 0x98, 0x6A, 0x4E, 0x52, 0x6E, 0x00, 0x22, 0x4C, 0x3D, 0xE7, 0x73, 0x40, 0xCD,
+   //T(26)
+   0x5A, 0xEE, 0xDC, 0xB5, 0xFA, 0x0C, 0xB4, 0x8F, 0x72, 0x81, 0x72, 0x77, 0xEB, 0x51, 0xAB, 0x60,
+   0xDA, 0x07, 0xA3, 0x03, 0x2A, 0xF3, 0xBF, 0xB2, 0x87, 0x03, 0xE4, 0xAF, 0x93, 0x9A, 0x89, 0xD1,
+   0x91, 0x95, 0xAC, 0xAF, 0x49, 0x10, 0x6B, 0x56, 0x0D, 0xE0, 0xAE, 0xD2, 0xA6, 0x23, 0x86, 0x2F,
+   0xB0, 0x5F, 0xF5, 0x72, 0x0A, 0xFB, 0xA9, 0x1C, 0x6B, 0xEF, 0xAF, 0x87, 0xE1, 0x16, 0x40, 0xB5,
+   0x4F, 0xEC, 0x85, 0xD9, 0xC4, 0xA4, 0xEF, 0x51, 0x10, 0xD3, 0xAB, 0xFF, 0xDC, 0xB7, 0xB7, 0xF6,
+   0x09, 0x15, 0x7D, 0x8F, 0xA6, 0x28, 0x4E, 0x47, 0x43, 0xE2, 0x41, 0x39, 0x6A, 0x38, 0x6D, 0xA2,
+   //T(27)
+   0x11, 0x0A, 0xB6, 0xA9, 0x94, 0xF5, 0x57, 0x1C, 0xCD, 0x87, 0x18, 0x03, 0xAF, 0x89, 0x51, 0x73,
+   0xF0, 0x71, 0x4D, 0x17, 0x10, 0xAF, 0x67, 0x4E, 0xF1, 0x84, 0x1C, 0x28, 0xDF, 0xC7, 0x6F, 0x75,
+   0x23, 0x22, 0x59, 0x2A, 0x60, 0x82, 0xA9, 0xF9, 0x00, 0xF3, 0x05, 0xD9, 0xFE, 0xDF, 0x31, 0x1D,
+   0x1A, 0x08, 0x25, 0xB1, 0xC6, 0x7B, 0xBA, 0xA3, 0xC2, 0xA7, 0xA2, 0xCB, 0x3F, 0xFF, 0xC9, 0xCD,
+   0x19, 0xE5, 0x16, 0x1E, 0x3A, 0x31, 0xC9, 0x61, 0xBB, 0xE9, 0x18, 0xBA, 0xB6, 0xB4, 0xAC, 0x39,
+   0xCB, 0x6E, 0xB5, 0x94, 0xA2, 0xFE, 0x7A, 0x5F, 0x5A, 0xA3, 0xB4, 0x21, 0x22, 0xD4, 0xD1, 0x24,
+   //T(28)
+   0x1D, 0x74, 0x81, 0xE4, 0xD2, 0xE5, 0xD9, 0x15, 0xAC, 0x94, 0x9A, 0xA9, 0xF7, 0xE0, 0xC9, 0x3D,
+   0xF1, 0x37, 0xA4, 0x9C, 0xF7, 0x9A, 0xEC, 0x92, 0xEE, 0x92, 0x0D, 0x22, 0xA7, 0xCE, 0x55, 0x7B,
+   0x1C, 0x06, 0xEE, 0xBC, 0xE0, 0x5D, 0xA9, 0x27, 0x28, 0x3C, 0x90, 0x73, 0xA0, 0x2D, 0x4B, 0xB0,
+   0xD1, 0xB5, 0x96, 0x0E, 0x27, 0xEF, 0xAC, 0x4C, 0xD3, 0x35, 0x12, 0x6C, 0x4C, 0x11, 0x0C, 0x19,
+   0x2B, 0x4E, 0xCB, 0x07, 0xA5, 0xDC, 0x40, 0x90, 0xF2, 0x09, 0x6E, 0x10, 0x1B, 0xDB, 0x11, 0xF5,
+   0x02, 0x45, 0x97, 0x58, 0x12, 0x81, 0x45, 0xFD, 0xAA, 0x5A, 0x82, 0x28, 0x5C, 0xBE, 0x77, 0xD3,
+   //T(29)
+   0xDF, 0xA7, 0x4F, 0xE2, 0x20, 0x2D, 0x88, 0x33, 0x40, 0xAB, 0x25, 0xD0, 0x51, 0x34, 0x97, 0xC6,
+   0x7C, 0x06, 0x0A, 0x89, 0x27, 0x90, 0x43, 0x9D, 0x5B, 0x64, 0x89, 0x9F, 0xF6, 0xB3, 0x09, 0x7E,
+   0x08, 0x99, 0xBA, 0xAD, 0xAD, 0xC4, 0xC8, 0x38, 0x3D, 0x41, 0x00, 0xE8, 0x77, 0xE9, 0x30, 0xE1,
+   0x6D, 0xA5, 0x90, 0xD6, 0x0C, 0x8D, 0x49, 0x31, 0xE8, 0xC5, 0x5C, 0xC6, 0x31, 0x95, 0x6F, 0x2B,
+   0x47, 0xC8, 0x30, 0x1C, 0x5D, 0xA9, 0xF7, 0xC2, 0x38, 0xD0, 0xD5, 0x13, 0x56, 0xA7, 0x8F, 0x16,
+   0xE7, 0x57, 0x10, 0x7A, 0xE0, 0xB8, 0xE8, 0x8E, 0x68, 0x9C, 0xCE, 0xC5, 0x24, 0x66, 0xF9, 0x5B,
+   //T(30)
+   0x36, 0xC1, 0xAC, 0x6A, 0x5D, 0x0D, 0x21, 0x5D, 0xF0, 0x60, 0x26, 0x25, 0x74, 0xDB, 0x0E, 0x01,
+   0x7D, 0x7F, 0x61, 0xCD, 0xC9, 0x8A, 0x97, 0xE8, 0xC6, 0x21, 0x14, 0x52, 0x6C, 0x78, 0x2F, 0x3C,
+   0xC0, 0x13, 0x2D, 0x35, 0x2A, 0xFE, 0xDD, 0xA2, 0xFF, 0xEF, 0xF2, 0x53, 0x37, 0x4E, 0x27, 0x72,
+   0x0B, 0xC1, 0x10, 0xFA, 0x0F, 0x73, 0xDF, 0xE9, 0x75, 0x8A, 0xE5, 0x5F, 0xFB, 0xC8, 0x28, 0x54,
+   0x90, 0x66, 0xAF, 0xE4, 0x65, 0x6A, 0x1F, 0x61, 0x6D, 0x87, 0xFC, 0xED, 0x03, 0x4D, 0x07, 0xD8,
+   0x8D, 0xDE, 0xEC, 0x0B, 0xC2, 0xC1, 0x74, 0x08, 0x88, 0xCB, 0xE3, 0xCF, 0x59, 0xA5, 0x79, 0xDE,
+   //T(31)
+   0x25, 0xE2, 0x09, 0xC5, 0x9D, 0xA9, 0x12, 0x1C, 0x15, 0x79, 0x81, 0x46, 0x91, 0xDB, 0xE6, 0x68,
+   0xE8, 0xC6, 0x63, 0xC5, 0xCB, 0x12, 0x99, 0xC9, 0xFD, 0xA0, 0x47, 0xEB, 0x72, 0x49, 0x57, 0x66,
+   0x31, 0xB9, 0x2B, 0x91, 0x7F, 0xA0, 0x18, 0x80, 0x96, 0xED, 0xF5, 0x0F, 0x67, 0x9A, 0x2A, 0xBA,
+   0x55, 0x32, 0x00, 0xB9, 0xDA, 0x09, 0xFB, 0x6A, 0xDA, 0x53, 0xB0, 0x69, 0xFE, 0x5D, 0x66, 0x97,
+   0x6C, 0x27, 0x90, 0x54, 0x6E, 0x6C, 0xE7, 0x44, 0x96, 0x05, 0x2F, 0x28, 0xE9, 0x10, 0x31, 0x89,
+   0x63, 0x66, 0xE8, 0xF3, 0xD8, 0x2A, 0xDB, 0x97, 0x9A, 0xD0, 0x33, 0xA2, 0xF6, 0x9B, 0x64, 0xDA
 };
 
+#endif
+
 
 /**
  * @brief secp384r1 elliptic curve
@@ -681,7 +1117,13 @@ const EcCurveInfo secp384r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp384r1Mod
+   secp384r1Mod,
+   //Fixed-base comb table
+#if (EC_COMB_SUPPORT == ENABLED)
+   secp384r1Comb
+#else
+   NULL
+#endif
 };
 
 
@@ -743,7 +1185,9 @@ const EcCurveInfo secp521r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp521r1Mod
+   secp521r1Mod,
+   //Fixed-base comb table
+   NULL
 };
 
 
@@ -787,6 +1231,8 @@ const EcCurveInfo brainpoolP160r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
+   NULL,
+   //Fixed-base comb table
    NULL
 };
 
@@ -831,6 +1277,8 @@ const EcCurveInfo brainpoolP192r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
+   NULL,
+   //Fixed-base comb table
    NULL
 };
 
@@ -875,6 +1323,8 @@ const EcCurveInfo brainpoolP224r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
+   NULL,
+   //Fixed-base comb table
    NULL
 };
 
@@ -919,6 +1369,8 @@ const EcCurveInfo brainpoolP256r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
+   NULL,
+   //Fixed-base comb table
    NULL
 };
 
@@ -969,6 +1421,8 @@ const EcCurveInfo brainpoolP320r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
+   NULL,
+   //Fixed-base comb table
    NULL
 };
 
@@ -1019,6 +1473,8 @@ const EcCurveInfo brainpoolP384r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
+   NULL,
+   //Fixed-base comb table
    NULL
 };
 
@@ -1075,6 +1531,8 @@ const EcCurveInfo brainpoolP512r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
+   NULL,
+   //Fixed-base comb table
    NULL
 };
 
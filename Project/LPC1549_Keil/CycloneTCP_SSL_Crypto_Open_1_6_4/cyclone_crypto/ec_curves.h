@@ -33,6 +33,18 @@
 #include "crypto.h"
 #include "mpi.h"
 
+//Fixed-base comb tables for the base point G
+#ifndef EC_COMB_SUPPORT
+   #define EC_COMB_SUPPORT ENABLED
+#elif (EC_COMB_SUPPORT != ENABLED && EC_COMB_SUPPORT != DISABLED)
+   #error EC_COMB_SUPPORT parameter is not valid
+#endif
+
+//Width of the precomputed comb tables
+#define EC_COMB_WIDTH 5
+//Number of points in a comb table
+#define EC_COMB_TABLE_SIZE ((1 << EC_COMB_WIDTH) - 1)
+
 //SECG curves
 #define SECP112R1_CURVE (&secp112r1Curve)
 #define SECP112R2_CURVE (&secp112r2Curve)
@@ -108,6 +120,7 @@ typedef struct
    size_t qLen;          ///<Length of q
    uint32_t h;           ///<Cofactor h
    EcFastModAlgo mod;    ///<Fast modular reduction
+   const uint8_t *comb;  ///<Fixed-base comb table for G (optional)
 } EcCurveInfo;
 
 
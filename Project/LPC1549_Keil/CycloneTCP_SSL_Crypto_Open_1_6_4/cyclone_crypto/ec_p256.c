@@ -0,0 +1,847 @@
+/**
+ * @file ec_p256.c
+ * @brief Dedicated NIST P-256 arithmetic
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCrypto Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * Field elements are stored as eight 32-bit limbs (least significant limb
+ * first) in the Montgomery domain, with R = 2^256. Field operations do not
+ * branch on their operands and always return fully reduced values. Points
+ * are kept in Jacobian coordinates
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL CRYPTO_TRACE_LEVEL
+
+//Dependencies
+#include <string.h>
+#include "crypto.h"
+#include "ec.h"
+#include "ec_p256.h"
+#include "debug.h"
+
+//Check crypto library configuration
+#if (EC_P256_SUPPORT == ENABLED)
+
+//Prime modulus p = 2^256 - 2^224 + 2^192 + 2^96 - 1
+static const uint32_t p256p[8] =
+{
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000,
+   0x00000000, 0x00000000, 0x00000001, 0xFFFFFFFF
+};
+
+//R mod p (Montgomery representation of 1)
+static const uint32_t p256One[8] =
+{
+   0x00000001, 0x00000000, 0x00000000, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFE, 0x00000000
+};
+
+//R^2 mod p
+static const uint32_t p256R2[8] =
+{
+   0x00000003, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFB,
+   0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFD, 0x00000004
+};
+
+
+/**
+ * @brief Modular addition
+ * @param[out] r Resulting value R = (A + B) mod p
+ * @param[in] a An integer such as 0 <= A < p
+ * @param[in] b An integer such as 0 <= B < p
+ **/
+
+void p256Add(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+   uint_t i;
+   uint32_t c;
+   uint32_t m;
+   uint64_t x;
+   uint32_t t[8];
+   uint32_t u[8];
+
+   //Compute T = A + B
+   for(c = 0, i = 0; i < 8; i++)
+   {
+      x = (uint64_t) a[i] + b[i] + c;
+      t[i] = (uint32_t) x;
+      c = (uint32_t) (x >> 32);
+   }
+
+   //Compute U = T - p
+   for(m = 0, i = 0; i < 8; i++)
+   {
+      x = (uint64_t) t[i] - p256p[i] - m;
+      u[i] = (uint32_t) x;
+      m = (uint32_t) (x >> 32) & 1;
+   }
+
+   //Keep T if and only if the sum did not overflow and U is negative
+   p256Select(r, u, t, (c ^ 1) & m);
+}
+
+
+/**
+ * @brief Modular subtraction
+ * @param[out] r Resulting value R = (A - B) mod p
+ * @param[in] a An integer such as 0 <= A < p
+ * @param[in] b An integer such as 0 <= B < p
+ **/
+
+void p256Sub(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+   uint_t i;
+   uint32_t c;
+   uint32_t m;
+   uint64_t x;
+   uint32_t t[8];
+   uint32_t u[8];
+
+   //Compute T = A - B
+   for(m = 0, i = 0; i < 8; i++)
+   {
+      x = (uint64_t) a[i] - b[i] - m;
+      t[i] = (uint32_t) x;
+      m = (uint32_t) (x >> 32) & 1;
+   }
+
+   //Compute U = T + p
+   for(c = 0, i = 0; i < 8; i++)
+   {
+      x = (uint64_t) t[i] + p256p[i] + c;
+      u[i] = (uint32_t) x;
+      c = (uint32_t) (x >> 32);
+   }
+
+   //Keep U if and only if the subtraction borrowed
+   p256Select(r, t, u, m);
+}
+
+
+/**
+ * @brief Montgomery multiplication (CIOS method)
+ *
+ * Since p = -1 mod 2^32, the Montgomery constant -1/p mod 2^32 is equal
+ * to 1 and the quotient digit is simply the low limb of the accumulator
+ *
+ * @param[out] r Resulting value R = A * B / 2^256 mod p
+ * @param[in] a An integer such as 0 <= A < p
+ * @param[in] b An integer such as 0 <= B < p
+ **/
+
+void p256Mul(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+   uint_t i;
+   uint_t j;
+   uint32_t c;
+   uint32_t m;
+   uint64_t x;
+   uint32_t t[10];
+   uint32_t u[8];
+
+   //Let T = 0
+   memset(t, 0, sizeof(t));
+
+   //Coarsely integrated operand scanning
+   for(i = 0; i < 8; i++)
+   {
+      //Compute T = T + A * B[i]
+      for(c = 0, j = 0; j < 8; j++)
+      {
+         x = (uint64_t) a[j] * b[i] + t[j] + c;
+         t[j] = (uint32_t) x;
+         c = (uint32_t) (x >> 32);
+      }
+
+      x = (uint64_t) t[8] + c;
+      t[8] = (uint32_t) x;
+      t[9] = (uint32_t) (x >> 32);
+
+      //Compute T = (T + T[0] * p) / 2^32
+      m = t[0];
+      x = (uint64_t) m * p256p[0] + t[0];
+      c = (uint32_t) (x >> 32);
+
+      for(j = 1; j < 8; j++)
+      {
+         x = (uint64_t) m * p256p[j] + t[j] + c;
+         t[j - 1] = (uint32_t) x;
+         c = (uint32_t) (x >> 32);
+      }
+
+      x = (uint64_t) t[8] + c;
+      t[7] = (uint32_t) x;
+      t[8] = t[9] + (uint32_t) (x >> 32);
+   }
+
+   //Compute U = T - p
+   for(m = 0, i = 0; i < 8; i++)
+   {
+      x = (uint64_t) t[i] - p256p[i] - m;
+      u[i] = (uint32_t) x;
+      m = (uint32_t) (x >> 32) & 1;
+   }
+
+   //Keep T if and only if T < p
+   p256Select(r, u, t, (t[8] == 0) & m);
+}
+
+
+/**
+ * @brief Montgomery squaring
+ * @param[out] r Resulting value R = A^2 / 2^256 mod p
+ * @param[in] a An integer such as 0 <= A < p
+ **/
+
+void p256Sqr(uint32_t *r, const uint32_t *a)
+{
+   p256Mul(r, a, a);
+}
+
+
+/**
+ * @brief Modular inversion
+ *
+ * The inverse is computed as A^(p - 2) using a fixed sequence of
+ * squarings and multiplications, which only depends on the public
+ * modulus
+ *
+ * @param[out] r Resulting value R = A^-1 mod p (Montgomery domain)
+ * @param[in] a An integer such as 0 < A < p (Montgomery domain)
+ **/
+
+void p256Inv(uint32_t *r, const uint32_t *a)
+{
+   int_t i;
+   uint32_t e;
+   uint32_t t[8];
+
+   //Let T = 1
+   memcpy(t, p256One, 32);
+
+   //Left-to-right exponentiation
+   for(i = 255; i >= 0; i--)
+   {
+      //Get the current bit of the exponent p - 2
+      e = (i < 32) ? (p256p[0] - 2) : p256p[i / 32];
+
+      //Compute T = T^2
+      p256Sqr(t, t);
+
+      //Compute T = T * A
+      if((e >> (i % 32)) & 1)
+         p256Mul(t, t, a);
+   }
+
+   //Copy the result
+   memcpy(r, t, 32);
+}
+
+
+/**
+ * @brief Test whether a field element is zero
+ * @param[in] a An integer such as 0 <= A < p
+ * @return 1 if A is zero, else 0
+ **/
+
+uint32_t p256IsZero(const uint32_t *a)
+{
+   uint_t i;
+   uint32_t m;
+
+   //Accumulate all the limbs
+   for(m = 0, i = 0; i < 8; i++)
+      m |= a[i];
+
+   //Return 1 if all limbs are zero
+   return ((m | (~m + 1)) >> 31) ^ 1;
+}
+
+
+/**
+ * @brief Constant-time selection
+ * @param[out] r Resulting value R = C ? B : A
+ * @param[in] a First operand
+ * @param[in] b Second operand
+ * @param[in] c Selector (0 or 1)
+ **/
+
+void p256Select(uint32_t *r, const uint32_t *a, const uint32_t *b, uint32_t c)
+{
+   uint_t i;
+   uint32_t m;
+
+   //Build a mask from the selector
+   m = ~c + 1;
+
+   //Select the relevant operand
+   for(i = 0; i < 8; i++)
+      r[i] = (a[i] & ~m) | (b[i] & m);
+}
+
+
+/**
+ * @brief Point doubling
+ * @param[out] r Resulting point R = 2S
+ * @param[in] s Point S
+ **/
+
+void p256Double(P256Point *r, const P256Point *s)
+{
+   uint32_t alpha[8];
+   uint32_t beta[8];
+   uint32_t gamma[8];
+   uint32_t delta[8];
+   uint32_t t1[8];
+   uint32_t t2[8];
+
+   //Update statistics
+   EC_STATS_INC_COUNTER(ecStats.doubleCount);
+
+   //Compute delta = Sz^2 and gamma = Sy^2
+   p256Sqr(delta, s->z);
+   p256Sqr(gamma, s->y);
+   //Compute beta = Sx * gamma
+   p256Mul(beta, s->x, gamma);
+
+   //Compute alpha = 3 * (Sx - delta) * (Sx + delta)
+   p256Sub(t1, s->x, delta);
+   p256Add(t2, s->x, delta);
+   p256Mul(alpha, t1, t2);
+   p256Add(t1, alpha, alpha);
+   p256Add(alpha, alpha, t1);
+
+   //Compute Rz = (Sy + Sz)^2 - gamma - delta
+   p256Add(t1, s->y, s->z);
+   p256Sqr(t1, t1);
+   p256Sub(t1, t1, gamma);
+   p256Sub(r->z, t1, delta);
+
+   //Compute Rx = alpha^2 - 8 * beta
+   p256Add(beta, beta, beta);
+   p256Add(beta, beta, beta);
+   p256Sqr(t1, alpha);
+   p256Add(t2, beta, beta);
+   p256Sub(r->x, t1, t2);
+
+   //Compute Ry = alpha * (4 * beta - Rx) - 8 * gamma^2
+   p256Sub(t1, beta, r->x);
+   p256Mul(t1, alpha, t1);
+   p256Sqr(t2, gamma);
+   p256Add(t2, t2, t2);
+   p256Add(t2, t2, t2);
+   p256Add(t2, t2, t2);
+   p256Sub(r->y, t1, t2);
+}
+
+
+/**
+ * @brief Point addition
+ *
+ * The point at infinity is handled without branching. When S and T are
+ * the same point, the computation is delegated to p256Double()
+ *
+ * @param[out] r Resulting point R = S + T
+ * @param[in] s First operand
+ * @param[in] t Second operand
+ **/
+
+void p256FullAdd(P256Point *r, const P256Point *s, const P256Point *t)
+{
+   uint32_t sInf;
+   uint32_t tInf;
+   uint32_t z1z1[8];
+   uint32_t z2z2[8];
+   uint32_t u1[8];
+   uint32_t u2[8];
+   uint32_t s1[8];
+   uint32_t s2[8];
+   uint32_t h[8];
+   uint32_t i[8];
+   uint32_t j[8];
+   uint32_t v[8];
+   P256Point u;
+
+   //Check whether S or T is the point at infinity
+   sInf = p256IsZero(s->z);
+   tInf = p256IsZero(t->z);
+
+   //Compute U1 = Sx * Tz^2 and U2 = Tx * Sz^2
+   p256Sqr(z1z1, s->z);
+   p256Sqr(z2z2, t->z);
+   p256Mul(u1, s->x, z2z2);
+   p256Mul(u2, t->x, z1z1);
+
+   //Compute S1 = Sy * Tz^3 and S2 = Ty * Sz^3
+   p256Mul(s1, s->y, t->z);
+   p256Mul(s1, s1, z2z2);
+   p256Mul(s2, t->y, s->z);
+   p256Mul(s2, s2, z1z1);
+
+   //Compute H = U2 - U1 and rr = 2 * (S2 - S1)
+   p256Sub(h, u2, u1);
+   p256Sub(s2, s2, s1);
+   p256Add(s2, s2, s2);
+
+   //S and T are the same finite point?
+   if(p256IsZero(h) & p256IsZero(s2) & (sInf ^ 1) & (tInf ^ 1))
+   {
+      //Compute R = 2S
+      p256Double(r, s);
+      return;
+   }
+
+   //Update statistics
+   EC_STATS_INC_COUNTER(ecStats.addCount);
+
+   //Compute I = (2 * H)^2 and J = H * I
+   p256Add(i, h, h);
+   p256Sqr(i, i);
+   p256Mul(j, h, i);
+   //Compute V = U1 * I
+   p256Mul(v, u1, i);
+
+   //Compute Ux = rr^2 - J - 2 * V
+   p256Sqr(u.x, s2);
+   p256Sub(u.x, u.x, j);
+   p256Sub(u.x, u.x, v);
+   p256Sub(u.x, u.x, v);
+
+   //Compute Uy = rr * (V - Ux) - 2 * S1 * J
+   p256Sub(v, v, u.x);
+   p256Mul(v, s2, v);
+   p256Mul(s1, s1, j);
+   p256Add(s1, s1, s1);
+   p256Sub(u.y, v, s1);
+
+   //Compute Uz = ((Sz + Tz)^2 - Z1Z1 - Z2Z2) * H
+   p256Add(u.z, s->z, t->z);
+   p256Sqr(u.z, u.z);
+   p256Sub(u.z, u.z, z1z1);
+   p256Sub(u.z, u.z, z2z2);
+   p256Mul(u.z, u.z, h);
+
+   //If S is the point at infinity, then R = T
+   p256Select(u.x, u.x, t->x, sInf);
+   p256Select(u.y, u.y, t->y, sInf);
+   p256Select(u.z, u.z, t->z, sInf);
+
+   //If T is the point at infinity, then R = S
+   p256Select(r->x, u.x, s->x, tInf);
+   p256Select(r->y, u.y, s->y, tInf);
+   p256Select(r->z, u.z, s->z, tInf);
+}
+
+
+/**
+ * @brief Convert an integer to the Montgomery domain
+ * @param[in] params EC domain parameters
+ * @param[out] r Field element in the Montgomery domain
+ * @param[in] a Multiple precision integer
+ * @return Error code
+ **/
+
+error_t p256Import(const EcDomainParameters *params, uint32_t *r, const Mpi *a)
+{
+   error_t error;
+   Mpi t;
+
+   //Initialize multiple precision integer
+   mpiInitArena(&t, params->arena);
+
+   //Make sure the integer is reduced modulo p
+   if(a->sign < 0 || mpiComp(a, &params->p) >= 0)
+   {
+      MPI_CHECK(mpiMod(&t, a, &params->p));
+      a = &t;
+   }
+
+   //Copy the limbs
+   memset(r, 0, 32);
+   memcpy(r, a->data, MIN(a->size, 8) * MPI_INT_SIZE);
+
+   //Convert to the Montgomery domain
+   p256Mul(r, r, p256R2);
+
+end:
+   //Release multiple precision integer
+   mpiFree(&t);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Convert an EC point to the Montgomery domain
+ * @param[in] params EC domain parameters
+ * @param[out] r P-256 point
+ * @param[in] s EC point (Jacobian coordinates)
+ * @return Error code
+ **/
+
+error_t p256ImportPoint(const EcDomainParameters *params, P256Point *r, const EcPoint *s)
+{
+   error_t error;
+
+   //Convert each coordinate
+   error = p256Import(params, r->x, &s->x);
+
+   if(!error)
+      error = p256Import(params, r->y, &s->y);
+
+   if(!error)
+      error = p256Import(params, r->z, &s->z);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Convert a P-256 point to affine coordinates
+ * @param[out] r EC point (Rz = 1, or R = (1, 1, 0) at infinity)
+ * @param[in] s P-256 point
+ * @return Error code
+ **/
+
+error_t p256ExportPoint(EcPoint *r, const P256Point *s)
+{
+   error_t error;
+   uint32_t a[8];
+   uint32_t b[8];
+   uint32_t one[8];
+
+   //Point at infinity?
+   if(p256IsZero(s->z))
+   {
+      //Set R = (1, 1, 0)
+      MPI_CHECK(mpiSetValue(&r->x, 1));
+      MPI_CHECK(mpiSetValue(&r->y, 1));
+      MPI_CHECK(mpiSetValue(&r->z, 0));
+   }
+   else
+   {
+      //Make sure the coordinates are large enough
+      MPI_CHECK(mpiGrow(&r->x, 32 / MPI_INT_SIZE));
+      MPI_CHECK(mpiGrow(&r->y, 32 / MPI_INT_SIZE));
+
+      //Integer 1, used to leave the Montgomery domain
+      memset(one, 0, 32);
+      one[0] = 1;
+
+      //Compute a = 1 / Sz^2 and b = 1 / Sz^3
+      p256Inv(b, s->z);
+      p256Sqr(a, b);
+      p256Mul(b, a, b);
+
+      //Compute Rx = Sx / Sz^2
+      p256Mul(a, s->x, a);
+      p256Mul(a, a, one);
+      memset(r->x.data, 0, r->x.size * MPI_INT_SIZE);
+      memcpy(r->x.data, a, 32);
+      r->x.sign = 1;
+
+      //Compute Ry = Sy / Sz^3
+      p256Mul(b, s->y, b);
+      p256Mul(b, b, one);
+      memset(r->y.data, 0, r->y.size * MPI_INT_SIZE);
+      memcpy(r->y.data, b, 32);
+      r->y.sign = 1;
+
+      //Set Rz = 1
+      MPI_CHECK(mpiSetValue(&r->z, 1));
+   }
+
+end:
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Scalar multiplication
+ *
+ * Fixed 4-bit window method. All 256 bits of the scalar are processed and
+ * the precomputed multiples are read with a constant-time table scan
+ *
+ * @param[in] params EC domain parameters
+ * @param[out] r Resulting point R = d.S
+ * @param[in] d An integer d such as 0 <= d < 2^256
+ * @param[in] s EC point
+ * @return Error code
+ **/
+
+error_t p256Mult(const EcDomainParameters *params, EcPoint *r, const Mpi *d, const EcPoint *s)
+{
+   error_t error;
+   int_t i;
+   uint_t j;
+   uint32_t k;
+   uint32_t m;
+   uint32_t e[8];
+   P256Point *t;
+   P256Point u;
+
+   //The scalar must not exceed 256 bits
+   if(mpiGetBitLength(d) > 256 || d->sign < 0)
+      return ERROR_INVALID_PARAMETER;
+
+   //Allocate a memory buffer to hold the precomputed multiples
+   t = osAllocMem(P256_TABLE_SIZE * sizeof(P256Point));
+   //Failed to allocate memory?
+   if(t == NULL)
+      return ERROR_OUT_OF_MEMORY;
+
+   //Copy the limbs of the scalar
+   memset(e, 0, 32);
+   memcpy(e, d->data, MIN(d->size, 8) * MPI_INT_SIZE);
+
+   //T(0) is the point at infinity
+   memcpy(t[0].x, p256One, 32);
+   memcpy(t[0].y, p256One, 32);
+   memset(t[0].z, 0, 32);
+
+   //T(1) = S
+   EC_CHECK(p256ImportPoint(params, &t[1], s));
+
+   //Precompute T(i) = i.S
+   for(i = 2; i < P256_TABLE_SIZE; i++)
+   {
+      if(i % 2)
+         p256FullAdd(&t[i], &t[i - 1], &t[1]);
+      else
+         p256Double(&t[i], &t[i / 2]);
+   }
+
+   //Let R = (1, 1, 0)
+   memcpy(u.x, p256One, 32);
+   memcpy(u.y, p256One, 32);
+   memset(u.z, 0, 32);
+
+   //Process the scalar from the most significant window
+   for(i = 256 - P256_WINDOW_SIZE; i >= 0; i -= P256_WINDOW_SIZE)
+   {
+      P256Point v;
+
+      //Compute R = 2^w.R
+      for(j = 0; j < P256_WINDOW_SIZE; j++)
+         p256Double(&u, &u);
+
+      //Extract the current window
+      k = (e[i / 32] >> (i % 32)) & (P256_TABLE_SIZE - 1);
+
+      //Read T(k) without revealing k through the memory access pattern
+      v = t[0];
+
+      for(j = 1; j < P256_TABLE_SIZE; j++)
+      {
+         //Set m = 1 if j == k, else m = 0
+         m = ((j ^ k) | (~(j ^ k) + 1)) >> 31;
+         m ^= 1;
+
+         p256Select(v.x, v.x, t[j].x, m);
+         p256Select(v.y, v.y, t[j].y, m);
+         p256Select(v.z, v.z, t[j].z, m);
+      }
+
+      //Compute R = R + T(k)
+      p256FullAdd(&u, &u, &v);
+   }
+
+   //Convert the result to affine coordinates
+   EC_CHECK(p256ExportPoint(r, &u));
+
+end:
+   //Erase the precomputed multiples and the scalar
+   memset(t, 0, P256_TABLE_SIZE * sizeof(P256Point));
+   memset(e, 0, 32);
+   //Release the memory buffer
+   osFreeMem(t);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Scalar multiplication of the base point
+ *
+ * Fixed-base comb method using the table attached to the domain parameters.
+ * Every entry of the table is scanned at each step
+ *
+ * @param[in] params EC domain parameters
+ * @param[out] r Resulting point R = d.G
+ * @param[in] d An integer d such as 0 <= d < q
+ * @return Error code
+ **/
+
+error_t p256MultBase(const EcDomainParameters *params, EcPoint *r, const Mpi *d)
+{
+   error_t error;
+   int_t i;
+   uint_t j;
+   uint_t k;
+   uint_t n;
+   uint32_t m;
+   uint_t b;
+   uint8_t buffer[64];
+   P256Point u;
+   P256Point v;
+
+   //No comb table available?
+   if(params->comb == NULL)
+      return p256Mult(params, r, d, &params->g);
+
+   //Spacing between the teeth of the comb
+   n = (256 + EC_COMB_WIDTH - 1) / EC_COMB_WIDTH;
+
+   //The scalar must not be larger than the comb
+   if(mpiGetBitLength(d) > (n * EC_COMB_WIDTH) || d->sign < 0)
+      return p256Mult(params, r, d, &params->g);
+
+   //Let R = (1, 1, 0)
+   memcpy(u.x, p256One, 32);
+   memcpy(u.y, p256One, 32);
+   memset(u.z, 0, 32);
+
+   //Fixed-base comb method
+   for(i = n - 1; i >= 0; i--)
+   {
+      //Point doubling
+      p256Double(&u, &u);
+
+      //Gather the bits d(i), d(i + n), ..., d(i + (W - 1) * n)
+      for(k = 0, j = 0; j < EC_COMB_WIDTH; j++)
+         k |= mpiGetBitValue(d, i + j * n) << j;
+
+      //Read the entry T(k) with a full scan of the table
+      memset(buffer, 0, 64);
+
+      for(j = 1; j <= EC_COMB_TABLE_SIZE; j++)
+      {
+         //Set m = 0xFF if j == k, else m = 0
+         m = ((j ^ k) | (~(j ^ k) + 1)) >> 31;
+         m = (m ^ 1) * 0xFF;
+
+         for(b = 0; b < 64; b++)
+            buffer[b] |= params->comb[(j - 1) * 64 + b] & m;
+      }
+
+      //Load the affine coordinates of T(k)
+      for(j = 0; j < 8; j++)
+      {
+         v.x[j] = LOAD32BE(buffer + 28 - j * 4);
+         v.y[j] = LOAD32BE(buffer + 60 - j * 4);
+      }
+
+      //Convert them to the Montgomery domain
+      p256Mul(v.x, v.x, p256R2);
+      p256Mul(v.y, v.y, p256R2);
+
+      //T(0) is the point at infinity
+      memset(v.z, 0, 32);
+      p256Select(v.z, v.z, p256One, k != 0);
+
+      //Compute R = R + T(k)
+      p256FullAdd(&u, &u, &v);
+   }
+
+   //Erase the last table entry
+   memset(buffer, 0, 64);
+
+   //Convert the result to affine coordinates
+   error = p256ExportPoint(r, &u);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Twin multiplication
+ *
+ * Shamir's trick. This function is intended for signature verification,
+ * where both scalars are public, and does not run in constant time
+ *
+ * @param[in] params EC domain parameters
+ * @param[out] r Resulting point R = d0.S + d1.T
+ * @param[in] d0 An integer d such as 0 <= d0 < 2^256
+ * @param[in] s EC point
+ * @param[in] d1 An integer d such as 0 <= d1 < 2^256
+ * @param[in] t EC point
+ * @return Error code
+ **/
+
+error_t p256TwinMult(const EcDomainParameters *params, EcPoint *r,
+   const Mpi *d0, const EcPoint *s, const Mpi *d1, const EcPoint *t)
+{
+   error_t error;
+   int_t i;
+   uint_t k;
+   P256Point u;
+   P256Point v[3];
+
+   //The scalars must not exceed 256 bits
+   if(mpiGetBitLength(d0) > 256 || mpiGetBitLength(d1) > 256)
+      return ERROR_INVALID_PARAMETER;
+   if(d0->sign < 0 || d1->sign < 0)
+      return ERROR_INVALID_PARAMETER;
+
+   //Precompute S, T and S + T
+   EC_CHECK(p256ImportPoint(params, &v[0], s));
+   EC_CHECK(p256ImportPoint(params, &v[1], t));
+   p256FullAdd(&v[2], &v[0], &v[1]);
+
+   //Let R = (1, 1, 0)
+   memcpy(u.x, p256One, 32);
+   memcpy(u.y, p256One, 32);
+   memset(u.z, 0, 32);
+
+   //Joint left-to-right binary method
+   for(i = MAX(mpiGetBitLength(d0), mpiGetBitLength(d1)) - 1; i >= 0; i--)
+   {
+      //Point doubling
+      p256Double(&u, &u);
+
+      //Get the current bits of d0 and d1
+      k = mpiGetBitValue(d0, i) | (mpiGetBitValue(d1, i) << 1);
+
+      //Compute R = R + S, R + T or R + S + T
+      if(k != 0)
+         p256FullAdd(&u, &u, &v[k - 1]);
+   }
+
+   //Convert the result to affine coordinates
+   EC_CHECK(p256ExportPoint(r, &u));
+
+end:
+   //Return status code
+   return error;
+}
+
+#endif
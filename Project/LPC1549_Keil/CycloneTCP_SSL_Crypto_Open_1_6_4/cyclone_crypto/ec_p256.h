@@ -0,0 +1,88 @@
+/**
+ * @file ec_p256.h
+ * @brief Dedicated NIST P-256 arithmetic
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCrypto Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+#ifndef _EC_P256_H
+#define _EC_P256_H
+
+//Dependencies
+#include "crypto.h"
+#include "ec.h"
+
+//Dedicated P-256 arithmetic
+#ifndef EC_P256_SUPPORT
+   #define EC_P256_SUPPORT ENABLED
+#elif (EC_P256_SUPPORT != ENABLED && EC_P256_SUPPORT != DISABLED)
+   #error EC_P256_SUPPORT parameter is not valid
+#endif
+
+//Window size for P-256 scalar multiplication
+#define P256_WINDOW_SIZE 4
+//Number of precomputed multiples
+#define P256_TABLE_SIZE (1 << P256_WINDOW_SIZE)
+
+//Check whether the EC domain parameters designate the P-256 curve
+#define P256_CURVE_MATCH(params) ((params)->mod == secp256r1Mod)
+
+
+/**
+ * @brief P-256 point (Jacobian coordinates, Montgomery domain)
+ **/
+
+typedef struct
+{
+   uint32_t x[8]; ///<x-coordinate
+   uint32_t y[8]; ///<y-coordinate
+   uint32_t z[8]; ///<z-coordinate
+} P256Point;
+
+
+//P-256 field arithmetic
+void p256Add(uint32_t *r, const uint32_t *a, const uint32_t *b);
+void p256Sub(uint32_t *r, const uint32_t *a, const uint32_t *b);
+void p256Mul(uint32_t *r, const uint32_t *a, const uint32_t *b);
+void p256Sqr(uint32_t *r, const uint32_t *a);
+void p256Inv(uint32_t *r, const uint32_t *a);
+uint32_t p256IsZero(const uint32_t *a);
+void p256Select(uint32_t *r, const uint32_t *a, const uint32_t *b, uint32_t c);
+
+//P-256 group arithmetic
+void p256Double(P256Point *r, const P256Point *s);
+void p256FullAdd(P256Point *r, const P256Point *s, const P256Point *t);
+
+error_t p256Import(const EcDomainParameters *params, uint32_t *r, const Mpi *a);
+error_t p256ImportPoint(const EcDomainParameters *params, P256Point *r, const EcPoint *s);
+error_t p256ExportPoint(EcPoint *r, const P256Point *s);
+
+//P-256 scalar multiplication
+error_t p256Mult(const EcDomainParameters *params, EcPoint *r, const Mpi *d, const EcPoint *s);
+error_t p256MultBase(const EcDomainParameters *params, EcPoint *r, const Mpi *d);
+
+error_t p256TwinMult(const EcDomainParameters *params, EcPoint *r,
+   const Mpi *d0, const EcPoint *s, const Mpi *d1, const EcPoint *t);
+
+#endif
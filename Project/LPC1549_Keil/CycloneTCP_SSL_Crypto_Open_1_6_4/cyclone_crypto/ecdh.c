@@ -100,7 +100,7 @@ error_t ecdhGenerateKeyPair(EcdhContext *context,
    TRACE_DEBUG_MPI("    ", &context->da);
 
    //Compute Qa = da.G
-   EC_CHECK(ecMult(&context->params, &context->qa, &context->da, &context->params.g));
+   EC_CHECK(ecMultBase(&context->params, &context->qa, &context->da));
    EC_CHECK(ecAffinify(&context->params, &context->qa, &context->qa));
 
    //Debug message
@@ -109,6 +109,10 @@ error_t ecdhGenerateKeyPair(EcdhContext *context,
    TRACE_DEBUG("  Public key Y:\r\n");
    TRACE_DEBUG_MPI("    ", &context->qa.y);
 
+   //Report the peak arena usage
+   MPI_ARENA_TRACE("ECDH key pair generation", mpiGetBitLength(&context->params.p),
+      context->params.arena);
+
 end:
    //Return status code
    return error;
@@ -173,11 +177,15 @@ error_t ecdhComputeSharedSecret(EcdhContext *context,
       return ERROR_INVALID_LENGTH;
 
    //Initialize EC points
-   ecInit(&z);
+   ecInitArena(&z, context->params.arena);
 
    //Compute Z = da.Qb
    EC_CHECK(ecProjectify(&context->params, &context->qb, &context->qb));
+#if (ECDH_LADDER_SUPPORT == ENABLED)
+   EC_CHECK(ecMultLadder(&context->params, &z, &context->da, &context->qb));
+#else
    EC_CHECK(ecMult(&context->params, &z, &context->da, &context->qb));
+#endif
    EC_CHECK(ecAffinify(&context->params, &z, &z));
 
    //Convert the x-coordinate of Z to an octet string
@@ -194,6 +202,10 @@ end:
    //Release EC points
    ecFree(&z);
 
+   //Report the peak arena usage
+   MPI_ARENA_TRACE("ECDH shared secret computation", mpiGetBitLength(&context->params.p),
+      context->params.arena);
+
    //Return status code
    return error;
 }
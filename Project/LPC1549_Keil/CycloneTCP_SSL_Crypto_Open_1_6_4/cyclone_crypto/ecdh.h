@@ -33,6 +33,13 @@
 #include "crypto.h"
 #include "ec.h"
 
+//Montgomery ladder for shared secret computation
+#ifndef ECDH_LADDER_SUPPORT
+   #define ECDH_LADDER_SUPPORT DISABLED
+#elif (ECDH_LADDER_SUPPORT != ENABLED && ECDH_LADDER_SUPPORT != DISABLED)
+   #error ECDH_LADDER_SUPPORT parameter is not valid
+#endif
+
 
 /**
  * @brief ECDH context
@@ -246,10 +246,10 @@ error_t ecdsaGenerateSignature(const EcDomainParameters *params,
    TRACE_DEBUG_ARRAY("    ", digest, digestLength);
 
    //Initialize multiple precision integers
-   mpiInit(&k);
-   mpiInit(&z);
+   mpiInitArena(&k, params->arena);
+   mpiInitArena(&z, params->arena);
    //Initialize EC point
-   ecInit(&r1);
+   ecInitArena(&r1, params->arena);
 
    //Let N be the bit length of q
    n = mpiGetBitLength(&params->q);
@@ -282,7 +282,7 @@ error_t ecdsaGenerateSignature(const EcDomainParameters *params,
    TRACE_DEBUG_MPI("    ", &z);
 
    //Compute R1 = (x1, y1) = k.G
-   EC_CHECK(ecMult(params, &r1, &k, &params->g));
+   EC_CHECK(ecMultBase(params, &r1, &k));
    EC_CHECK(ecAffinify(params, &r1, &r1));
 
    //Debug message
@@ -316,6 +316,9 @@ end:
    //Release EC point
    ecFree(&r1);
 
+   //Report the peak arena usage
+   MPI_ARENA_TRACE("ECDSA signature generation", mpiGetBitLength(&params->p), params->arena);
+
    //Clean up side effects if necessary
    if(error)
    {
@@ -377,14 +380,14 @@ error_t ecdsaVerifySignature(const EcDomainParameters *params, const EcPoint *pu
       return ERROR_INVALID_SIGNATURE;
 
    //Initialize multiple precision integers
-   mpiInit(&w);
-   mpiInit(&z);
-   mpiInit(&u1);
-   mpiInit(&u2);
-   mpiInit(&v);
+   mpiInitArena(&w, params->arena);
+   mpiInitArena(&z, params->arena);
+   mpiInitArena(&u1, params->arena);
+   mpiInitArena(&u2, params->arena);
+   mpiInitArena(&v, params->arena);
    //Initialize EC points
-   ecInit(&v0);
-   ecInit(&v1);
+   ecInitArena(&v0, params->arena);
+   ecInitArena(&v1, params->arena);
 
    //Let N be the bit length of q
    n = mpiGetBitLength(&params->q);
@@ -440,6 +443,9 @@ end:
    ecFree(&v0);
    ecFree(&v1);
 
+   //Report the peak arena usage
+   MPI_ARENA_TRACE("ECDSA signature verification", mpiGetBitLength(&params->p), params->arena);
+
    //Return status code
    return error;
 }
@@ -48,8 +48,85 @@ void mpiInit(Mpi *r)
    r->sign = 1;
    r->size = 0;
    r->data = NULL;
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Storage is taken from the heap
+   r->arena = NULL;
+#endif
+}
+
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+
+/**
+ * @brief Initialize a multiple precision integer backed by an arena
+ * @param[in,out] r Pointer to the multiple precision integer to be initialized
+ * @param[in] arena Memory arena (NULL to use the heap)
+ **/
+
+void mpiInitArena(Mpi *r, MpiArena *arena)
+{
+   //Initialize structure
+   mpiInit(r);
+   //Attach the integer to the arena
+   r->arena = arena;
+}
+
+
+/**
+ * @brief Initialize a memory arena
+ * @param[out] arena Pointer to the memory arena
+ * @param[in] buffer Scratch memory region
+ * @param[in] size Size of the region, in bytes
+ **/
+
+void mpiArenaInit(MpiArena *arena, void *buffer, size_t size)
+{
+   //Save the scratch memory region
+   arena->buffer = buffer;
+   arena->size = size / MPI_INT_SIZE;
+
+   //The arena is initially empty
+   arena->pos = 0;
+   arena->peak = 0;
+   arena->overflows = 0;
+}
+
+
+/**
+ * @brief Release all the blocks of a memory arena at once
+ *
+ * The integers attached to the arena must no longer be in use when this
+ * function is called. Peak usage and overflow statistics are cleared too
+ *
+ * @param[in] arena Pointer to the memory arena
+ **/
+
+void mpiArenaReset(MpiArena *arena)
+{
+   //Erase the used part of the arena
+   memset(arena->buffer, 0, arena->peak * MPI_INT_SIZE);
+
+   //Release all blocks
+   arena->pos = 0;
+   arena->peak = 0;
+   arena->overflows = 0;
+}
+
+
+/**
+ * @brief Get the peak usage of a memory arena
+ * @param[in] arena Pointer to the memory arena
+ * @return Highest number of bytes in use since the last reset
+ **/
+
+size_t mpiArenaGetPeakUsage(const MpiArena *arena)
+{
+   return arena->peak * MPI_INT_SIZE;
 }
 
+#endif
+
 
 /**
  * @brief Release a multiple precision integer
@@ -63,7 +140,25 @@ void mpiFree(Mpi *r)
    {
       //Erase contents before releasing memory
       memset(r->data, 0, r->size * MPI_INT_SIZE);
-      osFreeMem(r->data);
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+      //Block taken from an arena?
+      if(r->arena != NULL && r->data >= r->arena->buffer &&
+         r->data < (r->arena->buffer + r->arena->size))
+      {
+         //Mark the block as free
+         r->data[r->size] |= 1;
+
+         //Reclaim the free blocks that lie at the top of the arena
+         while(r->arena->pos > 0 && (r->arena->buffer[r->arena->pos - 1] & 1))
+            r->arena->pos -= (r->arena->buffer[r->arena->pos - 1] >> 1) + 1;
+      }
+      else
+#endif
+      {
+         //Release heap memory
+         osFreeMem(r->data);
+      }
    }
 
    //Set size to zero
@@ -82,6 +177,9 @@ void mpiFree(Mpi *r)
 error_t mpiGrow(Mpi *r, uint_t size)
 {
    uint_t *data;
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArena *arena;
+#endif
 
    //Ensure the parameter is valid
    size = MAX(size, 1);
@@ -90,8 +188,59 @@ error_t mpiGrow(Mpi *r, uint_t size)
    if(r->size >= size)
       return NO_ERROR;
 
-   //Allocate a memory buffer
-   data = osAllocMem(size * MPI_INT_SIZE);
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Integer attached to an arena?
+   if(r->arena != NULL)
+   {
+      //Point to the arena
+      arena = r->arena;
+
+      //A block at the top of the arena can be extended in place
+      if(r->size > 0 && (r->data + r->size + 1) == (arena->buffer + arena->pos) &&
+         (arena->pos + size - r->size) <= arena->size)
+      {
+         //Clear the additional words (this overwrites the old trailer)
+         memset(r->data + r->size, 0, (size - r->size) * MPI_INT_SIZE);
+         //Write the new trailer
+         r->data[size] = size << 1;
+
+         //Update the allocation offset
+         arena->pos += size - r->size;
+         arena->peak = MAX(arena->peak, arena->pos);
+
+         //Update the size of the multiple precision integer
+         r->size = size;
+
+         //Successful operation
+         return NO_ERROR;
+      }
+
+      //Enough room left in the arena?
+      if((arena->pos + size + 1) <= arena->size)
+      {
+         //Allocate a new block, followed by its trailer
+         data = arena->buffer + arena->pos;
+         data[size] = size << 1;
+
+         //Update the allocation offset
+         arena->pos += size + 1;
+         arena->peak = MAX(arena->peak, arena->pos);
+      }
+      else
+      {
+         //The arena is exhausted, fall back to the heap
+         data = osAllocMem(size * MPI_INT_SIZE);
+         //Keep track of the event
+         arena->overflows++;
+      }
+   }
+   else
+#endif
+   {
+      //Allocate a memory buffer
+      data = osAllocMem(size * MPI_INT_SIZE);
+   }
+
    //Failed to allocate memory?
    if(!data) return ERROR_OUT_OF_MEMORY;
 
@@ -104,7 +253,7 @@ error_t mpiGrow(Mpi *r, uint_t size)
       //Copy original data
       memcpy(data, r->data, r->size * MPI_INT_SIZE);
       //Free previously allocated memory
-      osFreeMem(r->data);
+      mpiFree(r);
    }
 
    //Update the size of the multiple precision integer
@@ -1398,6 +1547,7 @@ error_t mpiExpMod(Mpi *r, const Mpi *a, const Mpi *e, const Mpi *p)
    Mpi c2;
    Mpi t;
    Mpi s[8];
+   MpiMontContext context;
 
    //Initialize multiple precision integers
    mpiInit(&b);
@@ -1468,6 +1618,22 @@ error_t mpiExpMod(Mpi *r, const Mpi *a, const Mpi *e, const Mpi *p)
          }
       }
    }
+   //Fixed-width Montgomery arithmetic?
+   else if(mpiGetBitLength(p) <= MPI_MONT_MAX_BITS)
+   {
+      //Initialize Montgomery context
+      mpiMontInit(&context);
+
+      //Load the modulus
+      error = mpiMontSetModulus(&context, p);
+
+      //Perform modular exponentiation
+      if(!error)
+         error = mpiMontExpMod(&context, r, a, e);
+
+      //Release Montgomery context
+      mpiMontFree(&context);
+   }
    else
    {
       //Compute the smaller C = (2^32)^k such as C > P
@@ -1562,6 +1728,433 @@ end:
 }
 
 
+/**
+ * @brief Initialize a Montgomery context
+ * @param[in] context Pointer to the Montgomery context to initialize
+ **/
+
+void mpiMontInit(MpiMontContext *context)
+{
+   //Clear the Montgomery context
+   memset(context, 0, sizeof(MpiMontContext));
+}
+
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+
+/**
+ * @brief Initialize a Montgomery context backed by an arena
+ * @param[out] context Pointer to the Montgomery context
+ * @param[in] arena Memory arena (NULL to use the heap)
+ **/
+
+void mpiMontInitArena(MpiMontContext *context, MpiArena *arena)
+{
+   //Clear the Montgomery context
+   memset(context, 0, sizeof(MpiMontContext));
+   //The memory block will be taken from the arena
+   context->block.arena = arena;
+}
+
+#endif
+
+
+/**
+ * @brief Load the modulus into a Montgomery context
+ *
+ * The context holds a copy of the modulus, the constant R^2 mod P and
+ * all the scratch space needed by mpiMontExpMod(), so that no memory
+ * allocation takes place during the exponentiation itself
+ *
+ * @param[in] context Pointer to the Montgomery context
+ * @param[in] p Odd modulus P
+ * @return Error code
+ **/
+
+error_t mpiMontSetModulus(MpiMontContext *context, const Mpi *p)
+{
+   //R^2 mod P is computed on the fly
+   return mpiMontSetModulusR2(context, p, NULL);
+}
+
+
+/**
+ * @brief Load the modulus and a precomputed R^2 mod P into a Montgomery context
+ *
+ * Computing R^2 mod P requires a full-length division, which is the most
+ * expensive part of the setup. Callers that use the same modulus many
+ * times (long-lived RSA keys for instance) can compute this constant once
+ * with mpiMontComputeR2() and supply it here
+ *
+ * @param[in] context Pointer to the Montgomery context
+ * @param[in] p Odd modulus P
+ * @param[in] r2 Precomputed value R^2 mod P (if NULL or empty, the value
+ *   is computed on the fly)
+ * @return Error code
+ **/
+
+error_t mpiMontSetModulusR2(MpiMontContext *context, const Mpi *p, const Mpi *r2)
+{
+   error_t error;
+   uint_t i;
+   uint_t k;
+   uint_t m;
+   Mpi t;
+
+   //Montgomery arithmetic requires a positive odd modulus
+   if(mpiCompInt(p, 1) <= 0 || mpiIsEven(p))
+      return ERROR_INVALID_PARAMETER;
+
+   //Get the length of the modulus, in words
+   k = mpiGetLength(p);
+
+   //The modulus must not exceed the maximum supported size
+   if(k > (MPI_MONT_MAX_BITS / (MPI_INT_SIZE * 8)))
+      return ERROR_INVALID_PARAMETER;
+
+   //The precomputed value must be reduced modulo P
+   if(r2 != NULL && r2->size && (r2->sign < 0 || mpiComp(r2, p) >= 0))
+      return ERROR_INVALID_PARAMETER;
+
+   //The memory block can be reused when the new modulus has the same length
+   if(context->block.data != NULL && context->k != k)
+      mpiMontFree(context);
+
+   //Allocate a single memory block that holds P, R^2 mod P, the accumulator,
+   //an auxiliary operand, the CIOS scratch space and the precomputed powers
+   //(the block is taken from the arena the context is attached to, if any)
+   error = mpiGrow(&context->block, (5 + MPI_MONT_TABLE_SIZE) * k + 2);
+   //Failed to allocate memory?
+   if(error) return error;
+
+   //Save the length of the modulus
+   context->k = k;
+
+   //Split the memory block
+   context->p = context->block.data;
+   context->r2 = context->p + k;
+   context->a = context->r2 + k;
+   context->b = context->a + k;
+   context->t = context->b + k;
+   context->s = context->t + k + 2;
+
+   //Save the modulus
+   memcpy(context->p, p->data, k * MPI_INT_SIZE);
+
+   //The modulus can also be accessed as a multiple precision integer
+   context->modulus.sign = 1;
+   context->modulus.size = k;
+   context->modulus.data = context->p;
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   context->modulus.arena = NULL;
+#endif
+
+   //Use Newton's method to compute the inverse of P[0] mod 2^32
+   for(m = 2 - p->data[0], i = 0; i < 4; i++)
+      m = m * (2 - m * p->data[0]);
+
+   //Precompute -1/P[0] mod 2^32
+   context->m = ~m + 1;
+
+   //Initialize multiple precision integer
+   mpiInitArena(&t, context->block.arena);
+
+   //R^2 mod P not supplied by the caller?
+   if(r2 == NULL || !r2->size)
+   {
+      //Compute R^2 mod P
+      MPI_CHECK(mpiMontComputeR2(&t, p));
+      r2 = &t;
+   }
+
+   //Save the resulting value
+   memset(context->r2, 0, k * MPI_INT_SIZE);
+   memcpy(context->r2, r2->data, MIN(r2->size, k) * MPI_INT_SIZE);
+
+end:
+   //Release multiple precision integer
+   mpiFree(&t);
+
+   //Any error to report?
+   if(error)
+      mpiMontFree(context);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Compute the Montgomery constant R^2 mod P
+ * @param[out] r Resulting integer R^2 mod P, with R = 2^(32 * k)
+ * @param[in] p Odd modulus P of length k words
+ * @return Error code
+ **/
+
+error_t mpiMontComputeR2(Mpi *r, const Mpi *p)
+{
+   error_t error;
+   uint_t k;
+
+   //Get the length of the modulus, in words
+   k = mpiGetLength(p);
+
+   //Compute R^2 mod P
+   MPI_CHECK(mpiSetValue(r, 1));
+   MPI_CHECK(mpiShiftLeft(r, 2 * k * (MPI_INT_SIZE * 8)));
+   MPI_CHECK(mpiMod(r, r, p));
+
+end:
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Release a Montgomery context
+ * @param[in] context Pointer to the Montgomery context
+ **/
+
+void mpiMontFree(MpiMontContext *context)
+{
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArena *arena;
+
+   //Save the arena the context is attached to
+   arena = context->block.arena;
+#endif
+
+   //Release the memory block (its contents are erased first, since the
+   //precomputed powers may hold sensitive data)
+   mpiFree(&context->block);
+
+   //Clear the Montgomery context
+   memset(context, 0, sizeof(MpiMontContext));
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //The context can be reused with the same arena
+   context->block.arena = arena;
+#endif
+}
+
+
+/**
+ * @brief Modular exponentiation using a Montgomery context
+ * @param[in] context Pointer to the Montgomery context
+ * @param[out] r Resulting integer R = A ^ E mod P
+ * @param[in] a Base A
+ * @param[in] e Exponent E
+ * @return Error code
+ **/
+
+error_t mpiMontExpMod(MpiMontContext *context, Mpi *r, const Mpi *a, const Mpi *e)
+{
+   error_t error;
+   int_t i;
+   int_t j;
+   int_t n;
+   uint_t d;
+   uint_t k;
+   uint_t u;
+   uint_t *s;
+   Mpi b;
+
+   //Make sure the Montgomery context is valid
+   if(context->block.data == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Get the length of the modulus, in words
+   k = context->k;
+   //Point to the table of precomputed powers
+   s = context->s;
+
+   //Initialize multiple precision integer
+   mpiInit(&b);
+
+   //Make sure the output integer is large enough
+   MPI_CHECK(mpiGrow(r, k));
+
+   //Reduce A modulo P if necessary
+   if(a->sign < 0 || mpiComp(a, &context->modulus) >= 0)
+   {
+      MPI_CHECK(mpiMod(&b, a, &context->modulus));
+      a = &b;
+   }
+
+   //Very small exponents are often selected with low Hamming weight.
+   //The sliding window mechanism should be disabled in that case
+   d = (mpiGetBitLength(e) <= 32) ? 1 : MPI_MONT_WINDOW_SIZE;
+
+   //Let A = A mod P (as k words)
+   memset(context->a, 0, k * MPI_INT_SIZE);
+   memcpy(context->a, a->data, MIN(a->size, k) * MPI_INT_SIZE);
+
+   //Let S[0] = A * R mod P
+   mpiMontMul(context, s, context->a, context->r2);
+
+   //Let B = A^2 * R mod P
+   mpiMontMul(context, context->b, s, s);
+
+   //Precompute S[i] = A^(2 * i + 1) * R mod P
+   for(i = 1; i < (1 << (d - 1)); i++)
+   {
+      mpiMontMul(context, s + i * k, s + (i - 1) * k, context->b);
+   }
+
+   //Let B = 1
+   memset(context->b, 0, k * MPI_INT_SIZE);
+   context->b[0] = 1;
+
+   //Let A = R mod P
+   mpiMontMul(context, context->a, context->r2, context->b);
+
+   //The exponent is processed in a left-to-right fashion
+   i = mpiGetBitLength(e) - 1;
+
+   //Perform sliding window exponentiation
+   while(i >= 0)
+   {
+      //The sliding window exponentiation algorithm decomposes E
+      //into zero and nonzero windows
+      if(!mpiGetBitValue(e, i))
+      {
+         //Compute A = A^2 * R^-1 mod P
+         mpiMontMul(context, context->a, context->a, context->a);
+         //Next bit to be processed
+         i--;
+      }
+      else
+      {
+         //Find the longest window
+         n = MAX(i - (int_t) d + 1, 0);
+
+         //The least significant bit of the window must be equal to 1
+         while(!mpiGetBitValue(e, n)) n++;
+
+         //The algorithm processes more than one bit per iteration
+         for(u = 0, j = i; j >= n; j--)
+         {
+            //Compute A = A^2 * R^-1 mod P
+            mpiMontMul(context, context->a, context->a, context->a);
+            //Compute the relevant index to be used in the precomputed table
+            u = (u << 1) | mpiGetBitValue(e, j);
+         }
+
+         //Compute A = A * S[u/2] * R^-1 mod P
+         mpiMontMul(context, context->a, context->a, s + (u >> 1) * k);
+         //Next bit to be processed
+         i = n - 1;
+      }
+   }
+
+   //Compute R = A * R^-1 mod P
+   mpiMontMul(context, context->a, context->a, context->b);
+
+   //Copy the result
+   memset(r->data, 0, r->size * MPI_INT_SIZE);
+   memcpy(r->data, context->a, k * MPI_INT_SIZE);
+   r->sign = 1;
+
+end:
+   //Release multiple precision integer
+   mpiFree(&b);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Montgomery multiplication (CIOS method)
+ *
+ * Operands are k-word little-endian arrays, where k is the length of the
+ * modulus. The result may overlap either operand
+ *
+ * @param[in] context Pointer to the Montgomery context
+ * @param[out] r Resulting value R = A * B * 2^(-32 * k) mod P
+ * @param[in] a First operand A such as 0 <= A < P
+ * @param[in] b Second operand B such as 0 <= B < P
+ **/
+
+void mpiMontMul(MpiMontContext *context, uint_t *r, const uint_t *a, const uint_t *b)
+{
+   uint_t i;
+   uint_t j;
+   uint_t k;
+   uint_t q;
+   uint32_t c;
+   uint64_t x;
+   uint_t *p;
+   uint_t *t;
+
+   //Get the length of the modulus, in words
+   k = context->k;
+   //Point to the modulus and to the scratch buffer
+   p = context->p;
+   t = context->t;
+
+   //Let T = 0
+   memset(t, 0, (k + 2) * MPI_INT_SIZE);
+
+   //Coarsely integrated operand scanning
+   for(i = 0; i < k; i++)
+   {
+      //Compute T = T + A * B[i]
+      for(c = 0, j = 0; j < k; j++)
+      {
+         x = (uint64_t) a[j] * b[i] + t[j] + c;
+         t[j] = (uint32_t) x;
+         c = (uint32_t) (x >> 32);
+      }
+
+      x = (uint64_t) t[k] + c;
+      t[k] = (uint32_t) x;
+      t[k + 1] = (uint32_t) (x >> 32);
+
+      //Compute q = T[0] * m mod 2^32
+      q = t[0] * context->m;
+
+      //Compute T = (T + q * P) / 2^32
+      x = (uint64_t) q * p[0] + t[0];
+      c = (uint32_t) (x >> 32);
+
+      for(j = 1; j < k; j++)
+      {
+         x = (uint64_t) q * p[j] + t[j] + c;
+         t[j - 1] = (uint32_t) x;
+         c = (uint32_t) (x >> 32);
+      }
+
+      x = (uint64_t) t[k] + c;
+      t[k - 1] = (uint32_t) x;
+      t[k] = t[k + 1] + (uint32_t) (x >> 32);
+   }
+
+   //Check whether T >= P
+   if(t[k] == 0)
+   {
+      for(i = k; i > 0 && t[i - 1] == p[i - 1]; i--);
+
+      //T < P?
+      if(i > 0 && t[i - 1] < p[i - 1])
+      {
+         //Copy the result
+         memcpy(r, t, k * MPI_INT_SIZE);
+         //We are done
+         return;
+      }
+   }
+
+   //A final subtraction is required
+   for(c = 0, j = 0; j < k; j++)
+   {
+      x = (uint64_t) t[j] - p[j] - c;
+      r[j] = (uint32_t) x;
+      c = (uint32_t) (x >> 32) & 1;
+   }
+}
+
+
 /**
  * @brief Montgomery multiplication
  * @param[out] r Resulting integer R = A * B / 2^k mod P
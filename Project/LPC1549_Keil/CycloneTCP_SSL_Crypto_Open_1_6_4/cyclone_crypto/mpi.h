@@ -40,6 +40,30 @@
    #error MPI_ASM_SUPPORT parameter is not valid
 #endif
 
+//Per-operation memory arenas
+#ifndef MPI_ARENA_SUPPORT
+   #define MPI_ARENA_SUPPORT DISABLED
+#elif (MPI_ARENA_SUPPORT != ENABLED && MPI_ARENA_SUPPORT != DISABLED)
+   #error MPI_ARENA_SUPPORT parameter is not valid
+#endif
+
+//Maximum size of the modulus for fixed-width Montgomery arithmetic (in bits)
+#ifndef MPI_MONT_MAX_BITS
+   #define MPI_MONT_MAX_BITS 4096
+#elif (MPI_MONT_MAX_BITS < 32)
+   #error MPI_MONT_MAX_BITS parameter is not valid
+#endif
+
+//Window size for Montgomery exponentiation
+#ifndef MPI_MONT_WINDOW_SIZE
+   #define MPI_MONT_WINDOW_SIZE 5
+#elif (MPI_MONT_WINDOW_SIZE < 1 || MPI_MONT_WINDOW_SIZE > 6)
+   #error MPI_MONT_WINDOW_SIZE parameter is not valid
+#endif
+
+//Number of precomputed odd powers
+#define MPI_MONT_TABLE_SIZE (1 << (MPI_MONT_WINDOW_SIZE - 1))
+
 //Size of the sub data type
 #define MPI_INT_SIZE sizeof(uint_t)
 
@@ -51,6 +75,25 @@
 #define mpiIsOdd(a) mpiGetBitValue(a, 0)
 
 
+/**
+ * @brief Memory arena
+ *
+ * Integers attached to an arena take their storage from a caller-supplied
+ * region using a bump allocator. Each block is followed by a trailer word
+ * holding its size, so that released blocks can be reclaimed as soon as
+ * they reach the top of the arena
+ **/
+
+typedef struct
+{
+   uint_t *buffer;   ///<Scratch memory region
+   size_t size;      ///<Size of the region, in words
+   size_t pos;       ///<Current allocation offset, in words
+   size_t peak;      ///<Highest allocation offset since the last reset
+   uint_t overflows; ///<Allocations that fell back to the heap
+} MpiArena;
+
+
 /**
  * @brief Arbitrary precision integer
  **/
@@ -60,13 +103,56 @@ typedef struct
    int_t sign;
    uint_t size;
    uint_t *data;
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArena *arena;
+#endif
 } Mpi;
 
 
+/**
+ * @brief Montgomery context
+ **/
+
+typedef struct
+{
+   uint_t k;       ///<Length of the modulus, in words
+   uint_t m;       ///<-1/P[0] mod 2^32
+   Mpi modulus;    ///<Modulus P (points to the internal copy)
+   uint_t *p;      ///<Modulus P
+   uint_t *r2;     ///<R^2 mod P
+   uint_t *a;      ///<Accumulator
+   uint_t *b;      ///<Auxiliary operand
+   uint_t *t;      ///<Scratch space for Montgomery multiplication
+   uint_t *s;      ///<Precomputed odd powers
+   Mpi block;      ///<Memory block holding all the above arrays
+} MpiMontContext;
+
+
 //MPI related functions
 void mpiInit(Mpi *r);
 void mpiFree(Mpi *r);
 
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   void mpiInitArena(Mpi *r, MpiArena *arena);
+   void mpiArenaInit(MpiArena *arena, void *buffer, size_t size);
+   void mpiArenaReset(MpiArena *arena);
+   size_t mpiArenaGetPeakUsage(const MpiArena *arena);
+#else
+   #define mpiInitArena(r, arena) mpiInit(r)
+#endif
+
+//Report the peak arena usage of a public-key operation
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   #define MPI_ARENA_TRACE(algo, bits, arena) do { \
+      if((arena) != NULL) { \
+         TRACE_DEBUG("%s (%u bits): arena peak usage = %" PRIuSIZE " bytes, %u heap fallbacks\r\n", \
+            algo, bits, mpiArenaGetPeakUsage(arena), (arena)->overflows); \
+      } \
+   } while(0)
+#else
+   #define MPI_ARENA_TRACE(algo, bits, arena) do {} while(0)
+#endif
+
 error_t mpiGrow(Mpi *r, uint_t size);
 
 uint_t mpiGetLength(const Mpi *a);
@@ -116,6 +202,21 @@ error_t mpiExpMod(Mpi *r, const Mpi *a, const Mpi *e, const Mpi *p);
 error_t mpiMontgomeryMul(Mpi *r, const Mpi *a, const Mpi *b, uint_t k, const Mpi *p, Mpi *t);
 error_t mpiMontgomeryRed(Mpi *r, const Mpi *a, uint_t k, const Mpi *p, Mpi *t);
 
+void mpiMontInit(MpiMontContext *context);
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   void mpiMontInitArena(MpiMontContext *context, MpiArena *arena);
+#else
+   #define mpiMontInitArena(context, arena) mpiMontInit(context)
+#endif
+
+error_t mpiMontSetModulus(MpiMontContext *context, const Mpi *p);
+error_t mpiMontSetModulusR2(MpiMontContext *context, const Mpi *p, const Mpi *r2);
+error_t mpiMontComputeR2(Mpi *r, const Mpi *p);
+void mpiMontFree(MpiMontContext *context);
+error_t mpiMontExpMod(MpiMontContext *context, Mpi *r, const Mpi *a, const Mpi *e);
+void mpiMontMul(MpiMontContext *context, uint_t *r, const uint_t *a, const uint_t *b);
+
 void mpiMulAccCore(uint_t *r, const uint_t *a, int_t m, const uint_t b);
 
 void mpiDump(FILE *stream, const char_t *prepend, const Mpi *a);
@@ -452,6 +452,12 @@ error_t pemReadRsaPrivateKey(const char_t *input, size_t length, RsaPrivateKey *
       TRACE_DEBUG("  Coefficient:\r\n");
       TRACE_DEBUG_MPI("    ", &key->qinv);
 
+      //Precompute the Montgomery constants used by the private key
+      //operation, so that they are not computed again for every signature
+      error = rsaPrecomputePrivateKey(key);
+      //Any error to report?
+      if(error) break;
+
       //End of exception handling block
    } while(0);
 
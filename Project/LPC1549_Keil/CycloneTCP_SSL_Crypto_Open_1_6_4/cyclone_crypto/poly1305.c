@@ -0,0 +1,325 @@
+/**
+ * @file poly1305.c
+ * @brief Poly1305 message-authentication code
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCrypto Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * Poly1305 is a one-time authenticator designed by D. J. Bernstein. The
+ * accumulator and the key are split into five 26-bit limbs so that each
+ * block only requires 32x32-bit multiplications with 64-bit results.
+ * Refer to RFC 7539 for more details
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL CRYPTO_TRACE_LEVEL
+
+//Dependencies
+#include <string.h>
+#include "crypto.h"
+#include "poly1305.h"
+
+//Check crypto library configuration
+#if (POLY1305_SUPPORT == ENABLED)
+
+
+/**
+ * @brief Initialize Poly1305 message-authentication code computation
+ * @param[in] context Pointer to the Poly1305 context to initialize
+ * @param[in] key One-time key (32 bytes)
+ **/
+
+void poly1305Init(Poly1305Context *context, const uint8_t *key)
+{
+   //The first half of the key is clamped and split into 26-bit limbs
+   context->r[0] = LOAD32LE(key) & 0x03FFFFFF;
+   context->r[1] = (LOAD32LE(key + 3) >> 2) & 0x03FFFF03;
+   context->r[2] = (LOAD32LE(key + 6) >> 4) & 0x03FFC0FF;
+   context->r[3] = (LOAD32LE(key + 9) >> 6) & 0x03F03FFF;
+   context->r[4] = (LOAD32LE(key + 12) >> 8) & 0x000FFFFF;
+
+   //The second half of the key is added to the accumulator at the end
+   context->s[0] = LOAD32LE(key + 16);
+   context->s[1] = LOAD32LE(key + 20);
+   context->s[2] = LOAD32LE(key + 24);
+   context->s[3] = LOAD32LE(key + 28);
+
+   //Clear the accumulator
+   context->h[0] = 0;
+   context->h[1] = 0;
+   context->h[2] = 0;
+   context->h[3] = 0;
+   context->h[4] = 0;
+
+   //The buffer is empty
+   context->size = 0;
+}
+
+
+/**
+ * @brief Update Poly1305 message-authentication code computation
+ * @param[in] context Pointer to the Poly1305 context
+ * @param[in] data Pointer to the input message
+ * @param[in] length Length of the input message
+ **/
+
+void poly1305Update(Poly1305Context *context, const void *data, size_t length)
+{
+   size_t n;
+   const uint8_t *p;
+
+   //Point to the input message
+   p = (const uint8_t *) data;
+
+   //Complete the pending partial block first
+   if(context->size > 0)
+   {
+      //Number of bytes needed to fill the buffer
+      n = MIN(length, POLY1305_BLOCK_SIZE - context->size);
+
+      //Copy the data to the buffer
+      memcpy(context->buffer + context->size, p, n);
+
+      //Update the number of bytes in the buffer
+      context->size += n;
+      //Advance the data pointer
+      p += n;
+      //Remaining bytes to process
+      length -= n;
+
+      //Process the buffer once it is full
+      if(context->size == POLY1305_BLOCK_SIZE)
+      {
+         poly1305ProcessBlocks(context, context->buffer, POLY1305_BLOCK_SIZE, 1UL << 24);
+         context->size = 0;
+      }
+   }
+
+   //Process as many full blocks as possible directly from the input
+   n = length - (length % POLY1305_BLOCK_SIZE);
+
+   //Any full block to process?
+   if(n > 0)
+   {
+      poly1305ProcessBlocks(context, p, n, 1UL << 24);
+      p += n;
+      length -= n;
+   }
+
+   //Save the remaining bytes for later
+   if(length > 0)
+   {
+      memcpy(context->buffer + context->size, p, length);
+      context->size += length;
+   }
+}
+
+
+/**
+ * @brief Finish Poly1305 message-authentication code computation
+ * @param[in] context Pointer to the Poly1305 context
+ * @param[out] tag Calculated tag (16 bytes)
+ **/
+
+void poly1305Final(Poly1305Context *context, uint8_t *tag)
+{
+   uint32_t c;
+   uint32_t mask;
+   uint32_t g[5];
+   uint32_t *h;
+   uint64_t f;
+
+   //Point to the accumulator
+   h = context->h;
+
+   //Process the last partial block, if any
+   if(context->size > 0)
+   {
+      //The final block is padded with a single 1 bit followed by zeroes
+      context->buffer[context->size++] = 0x01;
+      memset(context->buffer + context->size, 0, POLY1305_BLOCK_SIZE - context->size);
+
+      //The padding bit replaces the implicit high bit
+      poly1305ProcessBlocks(context, context->buffer, POLY1305_BLOCK_SIZE, 0);
+   }
+
+   //Fully carry the accumulator
+   c = h[1] >> 26;
+   h[1] &= 0x03FFFFFF;
+   h[2] += c;
+   c = h[2] >> 26;
+   h[2] &= 0x03FFFFFF;
+   h[3] += c;
+   c = h[3] >> 26;
+   h[3] &= 0x03FFFFFF;
+   h[4] += c;
+   c = h[4] >> 26;
+   h[4] &= 0x03FFFFFF;
+   h[0] += c * 5;
+   c = h[0] >> 26;
+   h[0] &= 0x03FFFFFF;
+   h[1] += c;
+
+   //Compute h + -p = h - (2^130 - 5)
+   g[0] = h[0] + 5;
+   c = g[0] >> 26;
+   g[0] &= 0x03FFFFFF;
+   g[1] = h[1] + c;
+   c = g[1] >> 26;
+   g[1] &= 0x03FFFFFF;
+   g[2] = h[2] + c;
+   c = g[2] >> 26;
+   g[2] &= 0x03FFFFFF;
+   g[3] = h[3] + c;
+   c = g[3] >> 26;
+   g[3] &= 0x03FFFFFF;
+   g[4] = h[4] + c - (1UL << 26);
+
+   //Select h if h < p, or h - p if h >= p, in constant time
+   mask = (g[4] >> 31) - 1;
+   g[0] &= mask;
+   g[1] &= mask;
+   g[2] &= mask;
+   g[3] &= mask;
+   g[4] &= mask;
+   mask = ~mask;
+   h[0] = (h[0] & mask) | g[0];
+   h[1] = (h[1] & mask) | g[1];
+   h[2] = (h[2] & mask) | g[2];
+   h[3] = (h[3] & mask) | g[3];
+   h[4] = (h[4] & mask) | g[4];
+
+   //Convert the accumulator to 32-bit words
+   h[0] = h[0] | (h[1] << 26);
+   h[1] = (h[1] >> 6) | (h[2] << 20);
+   h[2] = (h[2] >> 12) | (h[3] << 14);
+   h[3] = (h[3] >> 18) | (h[4] << 8);
+
+   //Add the second half of the key (mod 2^128)
+   f = (uint64_t) h[0] + context->s[0];
+   STORE32LE((uint32_t) f, tag);
+   f = (uint64_t) h[1] + context->s[1] + (f >> 32);
+   STORE32LE((uint32_t) f, tag + 4);
+   f = (uint64_t) h[2] + context->s[2] + (f >> 32);
+   STORE32LE((uint32_t) f, tag + 8);
+   f = (uint64_t) h[3] + context->s[3] + (f >> 32);
+   STORE32LE((uint32_t) f, tag + 12);
+
+   //Clear the context, which holds the one-time key
+   memset(context, 0, sizeof(Poly1305Context));
+}
+
+
+/**
+ * @brief Process full 16-byte blocks
+ * @param[in] context Pointer to the Poly1305 context
+ * @param[in] data Pointer to the blocks
+ * @param[in] length Number of bytes to process (multiple of 16)
+ * @param[in] hibit Bit 128 of each block (set for full message blocks)
+ **/
+
+void poly1305ProcessBlocks(Poly1305Context *context,
+   const uint8_t *data, size_t length, uint32_t hibit)
+{
+   uint32_t c;
+   uint32_t r0, r1, r2, r3, r4;
+   uint32_t s1, s2, s3, s4;
+   uint32_t h0, h1, h2, h3, h4;
+   uint64_t d0, d1, d2, d3, d4;
+
+   //Load the key and the accumulator
+   r0 = context->r[0];
+   r1 = context->r[1];
+   r2 = context->r[2];
+   r3 = context->r[3];
+   r4 = context->r[4];
+   h0 = context->h[0];
+   h1 = context->h[1];
+   h2 = context->h[2];
+   h3 = context->h[3];
+   h4 = context->h[4];
+
+   //Reduction modulo 2^130 - 5 folds the upper limbs back multiplied by 5
+   s1 = r1 * 5;
+   s2 = r2 * 5;
+   s3 = r3 * 5;
+   s4 = r4 * 5;
+
+   //Process each block
+   while(length >= POLY1305_BLOCK_SIZE)
+   {
+      //h += m
+      h0 += LOAD32LE(data) & 0x03FFFFFF;
+      h1 += (LOAD32LE(data + 3) >> 2) & 0x03FFFFFF;
+      h2 += (LOAD32LE(data + 6) >> 4) & 0x03FFFFFF;
+      h3 += (LOAD32LE(data + 9) >> 6) & 0x03FFFFFF;
+      h4 += (LOAD32LE(data + 12) >> 8) | hibit;
+
+      //h *= r
+      d0 = (uint64_t) h0 * r0 + (uint64_t) h1 * s4 + (uint64_t) h2 * s3 +
+         (uint64_t) h3 * s2 + (uint64_t) h4 * s1;
+      d1 = (uint64_t) h0 * r1 + (uint64_t) h1 * r0 + (uint64_t) h2 * s4 +
+         (uint64_t) h3 * s3 + (uint64_t) h4 * s2;
+      d2 = (uint64_t) h0 * r2 + (uint64_t) h1 * r1 + (uint64_t) h2 * r0 +
+         (uint64_t) h3 * s4 + (uint64_t) h4 * s3;
+      d3 = (uint64_t) h0 * r3 + (uint64_t) h1 * r2 + (uint64_t) h2 * r1 +
+         (uint64_t) h3 * r0 + (uint64_t) h4 * s4;
+      d4 = (uint64_t) h0 * r4 + (uint64_t) h1 * r3 + (uint64_t) h2 * r2 +
+         (uint64_t) h3 * r1 + (uint64_t) h4 * r0;
+
+      //Partial reduction modulo 2^130 - 5
+      c = (uint32_t) (d0 >> 26);
+      h0 = (uint32_t) d0 & 0x03FFFFFF;
+      d1 += c;
+      c = (uint32_t) (d1 >> 26);
+      h1 = (uint32_t) d1 & 0x03FFFFFF;
+      d2 += c;
+      c = (uint32_t) (d2 >> 26);
+      h2 = (uint32_t) d2 & 0x03FFFFFF;
+      d3 += c;
+      c = (uint32_t) (d3 >> 26);
+      h3 = (uint32_t) d3 & 0x03FFFFFF;
+      d4 += c;
+      c = (uint32_t) (d4 >> 26);
+      h4 = (uint32_t) d4 & 0x03FFFFFF;
+      h0 += c * 5;
+      c = h0 >> 26;
+      h0 &= 0x03FFFFFF;
+      h1 += c;
+
+      //Next block
+      data += POLY1305_BLOCK_SIZE;
+      length -= POLY1305_BLOCK_SIZE;
+   }
+
+   //Save the accumulator
+   context->h[0] = h0;
+   context->h[1] = h1;
+   context->h[2] = h2;
+   context->h[3] = h3;
+   context->h[4] = h4;
+}
+
+#endif
@@ -0,0 +1,63 @@
+/**
+ * @file poly1305.h
+ * @brief Poly1305 message-authentication code
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCrypto Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+#ifndef _POLY1305_H
+#define _POLY1305_H
+
+//Dependencies
+#include "crypto.h"
+
+//Poly1305 related constants
+#define POLY1305_KEY_SIZE 32
+#define POLY1305_BLOCK_SIZE 16
+#define POLY1305_TAG_SIZE 16
+
+
+/**
+ * @brief Poly1305 context
+ **/
+
+typedef struct
+{
+   uint32_t r[5];                        ///<Clamped first half of the key (26-bit limbs)
+   uint32_t s[4];                        ///<Second half of the key
+   uint32_t h[5];                        ///<Accumulator (26-bit limbs)
+   uint8_t buffer[POLY1305_BLOCK_SIZE];  ///<Pending partial block
+   size_t size;                          ///<Number of bytes in the buffer
+} Poly1305Context;
+
+
+//Poly1305 related functions
+void poly1305Init(Poly1305Context *context, const uint8_t *key);
+void poly1305Update(Poly1305Context *context, const void *data, size_t length);
+void poly1305Final(Poly1305Context *context, uint8_t *tag);
+
+void poly1305ProcessBlocks(Poly1305Context *context,
+   const uint8_t *data, size_t length, uint32_t hibit);
+
+#endif
@@ -70,6 +70,12 @@ void rsaInitPublicKey(RsaPublicKey *key)
    //Initialize multiple precision integers
    mpiInit(&key->n);
    mpiInit(&key->e);
+   mpiInit(&key->nr2);
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Temporary integers are allocated from the heap by default
+   key->arena = NULL;
+#endif
 }
 
 
@@ -83,6 +89,7 @@ void rsaFreePublicKey(RsaPublicKey *key)
    //Free multiple precision integers
    mpiFree(&key->n);
    mpiFree(&key->e);
+   mpiFree(&key->nr2);
 }
 
 
@@ -102,6 +109,14 @@ void rsaInitPrivateKey(RsaPrivateKey *key)
    mpiInit(&key->dp);
    mpiInit(&key->dq);
    mpiInit(&key->qinv);
+   mpiInit(&key->nr2);
+   mpiInit(&key->pr2);
+   mpiInit(&key->qr2);
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Temporary integers are allocated from the heap by default
+   key->arena = NULL;
+#endif
 }
 
 
@@ -121,6 +136,120 @@ void rsaFreePrivateKey(RsaPrivateKey *key)
    mpiFree(&key->dp);
    mpiFree(&key->dq);
    mpiFree(&key->qinv);
+   mpiFree(&key->nr2);
+   mpiFree(&key->pr2);
+   mpiFree(&key->qr2);
+}
+
+
+/**
+ * @brief Modular exponentiation
+ *
+ * Fixed-width Montgomery arithmetic is used whenever possible. Moduli that
+ * it cannot handle (larger than MPI_MONT_MAX_BITS or even) fall back to
+ * mpiExpMod()
+ *
+ * @param[in] context Montgomery context used to perform the computation
+ * @param[out] r Resulting integer R = A ^ E mod P
+ * @param[in] a Base A
+ * @param[in] e Exponent E
+ * @param[in] p Modulus P
+ * @param[in] r2 Cached value R^2 mod P (may be empty)
+ * @return Error code
+ **/
+
+static error_t rsaExpMod(MpiMontContext *context, Mpi *r, const Mpi *a,
+   const Mpi *e, const Mpi *p, const Mpi *r2)
+{
+   error_t error;
+
+   //Load the modulus, together with the cached R^2 mod P if available
+   error = mpiMontSetModulusR2(context, p, r2);
+
+   //Perform modular exponentiation
+   if(!error)
+      error = mpiMontExpMod(context, r, a, e);
+   //The modulus is not suitable for fixed-width Montgomery arithmetic?
+   else if(error == ERROR_INVALID_PARAMETER)
+      error = mpiExpMod(r, a, e, p);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Precompute the Montgomery constant for a given modulus
+ * @param[out] r2 Resulting value R^2 mod P
+ * @param[in] p Modulus
+ * @return Error code
+ **/
+
+static error_t rsaPrecomputeMontConstant(Mpi *r2, const Mpi *p)
+{
+   //Montgomery arithmetic is only used with positive odd moduli. The
+   //constant is left empty otherwise and is computed on the fly
+   if(mpiCompInt(p, 1) <= 0 || mpiIsEven(p))
+      return mpiSetValue(r2, 0);
+
+   //Compute R^2 mod P
+   return mpiMontComputeR2(r2, p);
+}
+
+
+/**
+ * @brief Precompute the Montgomery constants of a RSA public key
+ *
+ * The value R^2 mod n is cached in the key so that subsequent public key
+ * operations skip the corresponding division. The constant must be
+ * computed again whenever the modulus is modified
+ *
+ * @param[in,out] key Pointer to the RSA public key
+ * @return Error code
+ **/
+
+error_t rsaPrecomputePublicKey(RsaPublicKey *key)
+{
+   //Precompute R^2 mod n
+   return rsaPrecomputeMontConstant(&key->nr2, &key->n);
+}
+
+
+/**
+ * @brief Precompute the Montgomery constants of a RSA private key
+ *
+ * When the CRT parameters are available, the values R^2 mod p and R^2 mod q
+ * are cached in the key. Otherwise R^2 mod n is cached. The constants must
+ * be computed again whenever the key is modified. They only pay off when
+ * the key is used several times: the TLS layer parses the PEM private key
+ * on every handshake, so each constant is computed once per handshake,
+ * exactly as without caching
+ *
+ * @param[in,out] key Pointer to the RSA private key
+ * @return Error code
+ **/
+
+error_t rsaPrecomputePrivateKey(RsaPrivateKey *key)
+{
+   error_t error;
+
+   //Use the Chinese remainder algorithm?
+   if(key->n.size && key->p.size && key->q.size &&
+      key->dp.size && key->dq.size && key->qinv.size)
+   {
+      //Precompute R^2 mod p and R^2 mod q
+      MPI_CHECK(rsaPrecomputeMontConstant(&key->pr2, &key->p));
+      MPI_CHECK(rsaPrecomputeMontConstant(&key->qr2, &key->q));
+   }
+   else
+   {
+      //Precompute R^2 mod n
+      MPI_CHECK(rsaPrecomputeMontConstant(&key->nr2, &key->n));
+   }
+
+end:
+   //Return status code
+   return error;
 }
 
 
@@ -138,6 +267,9 @@ void rsaFreePrivateKey(RsaPrivateKey *key)
 
 error_t rsaep(const RsaPublicKey *key, const Mpi *m, Mpi *c)
 {
+   error_t error;
+   MpiMontContext context;
+
    //Ensure the RSA public key is valid
    if(!key->n.size || !key->e.size)
       return ERROR_INVALID_PARAMETER;
@@ -146,8 +278,17 @@ error_t rsaep(const RsaPublicKey *key, const Mpi *m, Mpi *c)
    if(mpiCompInt(m, 0) < 0 || mpiComp(m, &key->n) >= 0)
       return ERROR_OUT_OF_RANGE;
 
+   //Initialize Montgomery context
+   mpiMontInitArena(&context, key->arena);
+
    //Perform modular exponentiation (c = m ^ e mod n)
-   return mpiExpMod(c, m, &key->e, &key->n);
+   error = rsaExpMod(&context, c, m, &key->e, &key->n, &key->nr2);
+
+   //Release Montgomery context
+   mpiMontFree(&context);
+
+   //Return status code
+   return error;
 }
 
 
@@ -169,24 +310,28 @@ error_t rsadp(const RsaPrivateKey *key, const Mpi *c, Mpi *m)
    Mpi m1;
    Mpi m2;
    Mpi h;
+   MpiMontContext context;
 
    //The ciphertext representative c shall be between 0 and n - 1
    if(mpiCompInt(c, 0) < 0 || mpiComp(c, &key->n) >= 0)
       return ERROR_OUT_OF_RANGE;
 
    //Initialize multiple-precision integers
-   mpiInit(&m1);
-   mpiInit(&m2);
-   mpiInit(&h);
+   mpiInitArena(&m1, key->arena);
+   mpiInitArena(&m2, key->arena);
+   mpiInitArena(&h, key->arena);
+
+   //Initialize Montgomery context
+   mpiMontInitArena(&context, key->arena);
 
    //Use the Chinese remainder algorithm?
    if(key->n.size && key->p.size && key->q.size &&
       key->dp.size && key->dq.size && key->qinv.size)
    {
       //Compute m1 = c ^ dP mod p
-      MPI_CHECK(mpiExpMod(&m1, c, &key->dp, &key->p));
+      MPI_CHECK(rsaExpMod(&context, &m1, c, &key->dp, &key->p, &key->pr2));
       //Compute m2 = c ^ dQ mod q
-      MPI_CHECK(mpiExpMod(&m2, c, &key->dq, &key->q));
+      MPI_CHECK(rsaExpMod(&context, &m2, c, &key->dq, &key->q, &key->qr2));
       //Let h = (m1 - m2) * qInv mod p
       MPI_CHECK(mpiSub(&h, &m1, &m2));
       MPI_CHECK(mpiMulMod(&h, &h, &key->qinv, &key->p));
@@ -198,7 +343,7 @@ error_t rsadp(const RsaPrivateKey *key, const Mpi *c, Mpi *m)
    else if(key->n.size && key->d.size)
    {
       //Let m = c ^ d mod n
-      error = mpiExpMod(m, c, &key->d, &key->n);
+      MPI_CHECK(rsaExpMod(&context, m, c, &key->d, &key->n, &key->nr2));
    }
    //Invalid parameters?
    else
@@ -213,6 +358,12 @@ end:
    mpiFree(&m2);
    mpiFree(&h);
 
+   //Release Montgomery context
+   mpiMontFree(&context);
+
+   //Report the peak arena usage
+   MPI_ARENA_TRACE("RSA private operation", mpiGetBitLength(&key->n), key->arena);
+
    //Return status code
    return error;
 }
@@ -300,8 +451,8 @@ error_t rsaesPkcs1v15Encrypt(const PrngAlgo *prngAlgo, void *prngContext, const
    TRACE_DEBUG_ARRAY("    ", message, messageLength);
 
    //Initialize multiple-precision integers
-   mpiInit(&m);
-   mpiInit(&c);
+   mpiInitArena(&m, key->arena);
+   mpiInitArena(&c, key->arena);
 
    //Get the length in octets of the modulus n
    k = mpiGetByteLength(&key->n);
@@ -441,8 +592,8 @@ error_t rsaesPkcs1v15Decrypt(const RsaPrivateKey *key, const uint8_t *ciphertext
    TRACE_DEBUG_ARRAY("    ", ciphertext, ciphertextLength);
 
    //Initialize multiple-precision integers
-   mpiInit(&c);
-   mpiInit(&m);
+   mpiInitArena(&c, key->arena);
+   mpiInitArena(&m, key->arena);
 
    //Get the length in octets of the modulus n
    k = mpiGetByteLength(&key->n);
@@ -576,8 +727,8 @@ error_t rsassaPkcs1v15Sign(const RsaPrivateKey *key, const HashAlgo *hash,
    TRACE_DEBUG_ARRAY("    ", digest, hash->digestSize);
 
    //Initialize multiple-precision integers
-   mpiInit(&m);
-   mpiInit(&s);
+   mpiInitArena(&m, key->arena);
+   mpiInitArena(&s, key->arena);
 
    //Get the length in octets of the modulus n
    k = mpiGetByteLength(&key->n);
@@ -669,8 +820,8 @@ error_t rsassaPkcs1v15Verify(const RsaPublicKey *key, const HashAlgo *hash,
    TRACE_DEBUG_ARRAY("    ", signature, signatureLength);
 
    //Initialize multiple-precision integers
-   mpiInit(&s);
-   mpiInit(&m);
+   mpiInitArena(&s, key->arena);
+   mpiInitArena(&m, key->arena);
 
    //Get the length in octets of the modulus n
    k = mpiGetByteLength(&key->n);
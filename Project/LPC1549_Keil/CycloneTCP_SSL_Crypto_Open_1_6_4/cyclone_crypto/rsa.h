@@ -40,8 +40,12 @@
 
 typedef struct
 {
-   Mpi n; ///<Modulus
-   Mpi e; ///<Public exponent
+   Mpi n;   ///<Modulus
+   Mpi e;   ///<Public exponent
+   Mpi nr2; ///<Montgomery constant R^2 mod n (optional)
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArena *arena; ///<Arena for temporary integers
+#endif
 } RsaPublicKey;
 
 
@@ -59,6 +63,12 @@ typedef struct
    Mpi dp;   ///<First factor's CRT exponent
    Mpi dq;   ///<second factor's CRT exponent
    Mpi qinv; ///<CRT coefficient
+   Mpi nr2;  ///<Montgomery constant R^2 mod n (optional)
+   Mpi pr2;  ///<Montgomery constant R^2 mod p (optional)
+   Mpi qr2;  ///<Montgomery constant R^2 mod q (optional)
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArena *arena; ///<Arena for temporary integers
+#endif
 } RsaPrivateKey;
 
 
@@ -77,6 +87,9 @@ void rsaFreePublicKey(RsaPublicKey *key);
 void rsaInitPrivateKey(RsaPrivateKey *key);
 void rsaFreePrivateKey(RsaPrivateKey *key);
 
+error_t rsaPrecomputePublicKey(RsaPublicKey *key);
+error_t rsaPrecomputePrivateKey(RsaPrivateKey *key);
+
 error_t rsaep(const RsaPublicKey *key, const Mpi *m, Mpi *c);
 error_t rsadp(const RsaPrivateKey *key, const Mpi *c, Mpi *m);
 
@@ -0,0 +1,214 @@
+/**
+ * @file x25519.c
+ * @brief X25519 function (RFC 7748)
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCrypto Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * X25519 performs scalar multiplication on the Montgomery form of Curve25519
+ * using only x-coordinates. The Montgomery ladder processes every bit of the
+ * scalar with the same sequence of field operations and conditional swaps,
+ * hence the computation runs in constant time. Refer to RFC 7748 for more
+ * details
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL CRYPTO_TRACE_LEVEL
+
+//Dependencies
+#include <string.h>
+#include "crypto.h"
+#include "curve25519.h"
+#include "x25519.h"
+#include "debug.h"
+
+//Check crypto library configuration
+#if (CURVE25519_SUPPORT == ENABLED)
+
+//Base point (u = 9)
+static const uint8_t x25519BasePoint[X25519_KEY_LENGTH] = {9};
+
+
+/**
+ * @brief X25519 function (scalar multiplication on Curve25519)
+ * @param[out] r Output u-coordinate (32 bytes)
+ * @param[in] k Input scalar (32 bytes)
+ * @param[in] u Input u-coordinate (32 bytes)
+ * @return Error code
+ **/
+
+error_t x25519(uint8_t *r, const uint8_t *k, const uint8_t *u)
+{
+   int_t i;
+   uint32_t b;
+   uint32_t swap;
+   uint8_t kc[X25519_KEY_LENGTH];
+   int32_t x1[CURVE25519_LIMB_COUNT];
+   int32_t x2[CURVE25519_LIMB_COUNT];
+   int32_t z2[CURVE25519_LIMB_COUNT];
+   int32_t x3[CURVE25519_LIMB_COUNT];
+   int32_t z3[CURVE25519_LIMB_COUNT];
+   int32_t t0[CURVE25519_LIMB_COUNT];
+   int32_t t1[CURVE25519_LIMB_COUNT];
+
+   //Check parameters
+   if(r == NULL || k == NULL || u == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Clamp the scalar (see RFC 7748, section 5)
+   memcpy(kc, k, X25519_KEY_LENGTH);
+   kc[0] &= 0xF8;
+   kc[31] &= 0x7F;
+   kc[31] |= 0x40;
+
+   //Decode the u-coordinate
+   curve25519Import(x1, u);
+
+   //Initialize the ladder with (x2 : z2) = (1 : 0) and (x3 : z3) = (u : 1)
+   curve25519SetInt(x2, 1);
+   curve25519SetInt(z2, 0);
+   curve25519Copy(x3, x1);
+   curve25519SetInt(z3, 1);
+
+   //Montgomery ladder
+   for(swap = 0, i = 254; i >= 0; i--)
+   {
+      //Current bit of the scalar
+      b = (kc[i / 8] >> (i % 8)) & 1;
+
+      //Conditionally swap the two points
+      swap ^= b;
+      curve25519Swap(x2, x3, swap);
+      curve25519Swap(z2, z3, swap);
+      swap = b;
+
+      //Compute D * A and C * B
+      curve25519Sub(t0, x3, z3);
+      curve25519Sub(t1, x2, z2);
+      curve25519Add(x2, x2, z2);
+      curve25519Add(z2, x3, z3);
+      curve25519Mul(z3, t0, x2);
+      curve25519Mul(z2, z2, t1);
+      //Compute AA and BB
+      curve25519Sqr(t0, t1);
+      curve25519Sqr(t1, x2);
+      //Compute x3 = (DA + CB)^2 and z3 = x1 * (DA - CB)^2
+      curve25519Add(x3, z3, z2);
+      curve25519Sub(z2, z3, z2);
+      curve25519Sqr(x3, x3);
+      curve25519Sqr(z2, z2);
+      curve25519Mul(z3, x1, z2);
+      //Compute x2 = AA * BB
+      curve25519Mul(x2, t1, t0);
+      //Compute E = AA - BB and z2 = E * (BB + (a24 + 1) * E)
+      curve25519Sub(t1, t1, t0);
+      curve25519MulInt(z2, t1, 121666);
+      curve25519Add(z2, z2, t0);
+      curve25519Mul(z2, z2, t1);
+   }
+
+   //Final conditional swap
+   curve25519Swap(x2, x3, swap);
+   curve25519Swap(z2, z3, swap);
+
+   //Convert to affine coordinates (u = x2 / z2)
+   curve25519Inv(z2, z2);
+   curve25519Mul(x2, x2, z2);
+   //Encode the resulting u-coordinate
+   curve25519Export(r, x2);
+
+   //Erase the clamped scalar
+   memset(kc, 0, X25519_KEY_LENGTH);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief X25519 key pair generation
+ * @param[in] prngAlgo PRNG algorithm
+ * @param[in] prngContext Pointer to the PRNG context
+ * @param[out] privateKey Random private key (32 bytes)
+ * @param[out] publicKey Corresponding public key (32 bytes)
+ * @return Error code
+ **/
+
+error_t x25519GenerateKeyPair(const PrngAlgo *prngAlgo, void *prngContext,
+   uint8_t *privateKey, uint8_t *publicKey)
+{
+   error_t error;
+
+   //Debug message
+   TRACE_DEBUG("Generating X25519 key pair...\r\n");
+
+   //The private key is a random 32-byte string
+   error = prngAlgo->read(prngContext, privateKey, X25519_KEY_LENGTH);
+   //Any error to report?
+   if(error) return error;
+
+   //Compute the public key by multiplying the base point
+   return x25519(publicKey, privateKey, x25519BasePoint);
+}
+
+
+/**
+ * @brief Compute X25519 shared secret
+ * @param[in] privateKey One's own private key (32 bytes)
+ * @param[in] peerPublicKey Peer's public key (32 bytes)
+ * @param[out] output Shared secret (32 bytes)
+ * @return Error code
+ **/
+
+error_t x25519ComputeSharedSecret(const uint8_t *privateKey,
+   const uint8_t *peerPublicKey, uint8_t *output)
+{
+   error_t error;
+   uint_t i;
+   uint8_t mask;
+
+   //Debug message
+   TRACE_DEBUG("Computing X25519 shared secret...\r\n");
+
+   //Multiply the peer's public key by one's own private key
+   error = x25519(output, privateKey, peerPublicKey);
+   //Any error to report?
+   if(error) return error;
+
+   //Check whether the result is the all-zero value, without branching
+   //on the individual bytes
+   for(mask = 0, i = 0; i < X25519_KEY_LENGTH; i++)
+      mask |= output[i];
+
+   //A low-order public key yields an all-zero shared secret, which must
+   //be rejected (see RFC 7748, section 6.1)
+   if(mask == 0)
+      return ERROR_ILLEGAL_PARAMETER;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+#endif
@@ -0,0 +1,49 @@
+/**
+ * @file x25519.h
+ * @brief X25519 function (RFC 7748)
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCrypto Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+#ifndef _X25519_H
+#define _X25519_H
+
+//Dependencies
+#include "crypto.h"
+#include "curve25519.h"
+
+//Length of X25519 private and public keys, in bytes
+#define X25519_KEY_LENGTH 32
+
+
+//X25519 related functions
+error_t x25519(uint8_t *r, const uint8_t *k, const uint8_t *u);
+
+error_t x25519GenerateKeyPair(const PrngAlgo *prngAlgo, void *prngContext,
+   uint8_t *privateKey, uint8_t *publicKey);
+
+error_t x25519ComputeSharedSecret(const uint8_t *privateKey,
+   const uint8_t *peerPublicKey, uint8_t *output);
+
+#endif
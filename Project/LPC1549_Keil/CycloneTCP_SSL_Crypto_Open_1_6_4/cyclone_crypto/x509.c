@@ -1747,8 +1747,8 @@ error_t x509ReadRsaPublicKey(const X509CertificateInfo *certInfo, RsaPublicKey *
    TRACE_DEBUG("  Public exponent:\r\n");
    TRACE_DEBUG_MPI("    ", &key->e);
 
-   //Successful processing
-   return NO_ERROR;
+   //Precompute the Montgomery constant used by the public key operation
+   return rsaPrecomputePublicKey(key);
 }
 
 
@@ -258,6 +258,38 @@ error_t tlsSetCache(TlsContext *context, TlsCache *cache)
 }
 
 
+/**
+ * @brief Set session ticket encryption context
+ *
+ * When a ticket encryption context is set, the server issues session
+ * tickets to the clients that support them and resumes sessions from
+ * the tickets they present, without storing any per-client state. The
+ * same context can be shared among several TLS contexts
+ *
+ * @param[in] context Pointer to the TLS context
+ * @param[in] ticketContext Keys used to protect session tickets
+ * @return Error code
+ **/
+
+error_t tlsSetTicketContext(TlsContext *context, TlsTicketContext *ticketContext)
+{
+#if (TLS_TICKET_SUPPORT == ENABLED)
+   //Check parameters
+   if(context == NULL || ticketContext == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //The keys will be used to issue and decrypt session tickets
+   context->ticketContext = ticketContext;
+
+   //Successful processing
+   return NO_ERROR;
+#else
+   //Session tickets are not supported
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
 /**
  * @brief Set client authentication mode
  * @param[in] context Pointer to the TLS context
@@ -360,6 +392,11 @@ error_t tlsSetTrustedCaList(TlsContext *context, const char_t *trustedCaList, si
 
 /**
  * @brief Import a certificate and the corresponding private key
+ *
+ * Only references to the PEM data are saved. The private key is parsed
+ * whenever it is needed during the handshake, and hence once per
+ * connection, since each connection uses its own TLS context
+ *
  * @param[in] context Pointer to the TLS context
  * @param[in] certChain Certificate chain (PEM format)
  * @param[in] certChainLength Total length of the certificate chain
@@ -773,6 +810,11 @@ void tlsFree(TlsContext *context)
    //Release server name
    osFreeMem(context->serverName);
 
+#if (TLS_TICKET_SUPPORT == ENABLED)
+   //Release session ticket
+   osFreeMem(context->ticket);
+#endif
+
    //Free Diffie-Hellman context
    dhFree(&context->dhContext);
    //Free ECDH context
@@ -815,6 +857,24 @@ void tlsFree(TlsContext *context)
       osFreeMem(context->readCipherContext);
    }
 
+#if (TLS_GCM_CIPHER_SUPPORT == ENABLED)
+   //Release the write GCM context
+   if(context->writeGcmContext)
+   {
+      //Clear context contents, then release memory
+      memset(context->writeGcmContext, 0, sizeof(GcmContext));
+      osFreeMem(context->writeGcmContext);
+   }
+
+   //Release the read GCM context
+   if(context->readGcmContext)
+   {
+      //Clear context contents, then release memory
+      memset(context->readGcmContext, 0, sizeof(GcmContext));
+      osFreeMem(context->readGcmContext);
+   }
+#endif
+
    //Clear the TLS context before freeing memory
    memset(context, 0, sizeof(TlsContext));
    osFreeMem(context);
@@ -823,6 +883,11 @@ void tlsFree(TlsContext *context)
 
 /**
  * @brief Save TLS session
+ *
+ * The session structure must be cleared before it is used for the first
+ * time. When the session holds a ticket, the memory allocated to store it
+ * is released by tlsFreeSession()
+ *
  * @param[in] context Pointer to the TLS context
  * @param[out] session Buffer where to store the current session parameters
  * @return Error code
@@ -835,9 +900,19 @@ error_t tlsSaveSession(const TlsContext *context, TlsSession *session)
       return ERROR_INVALID_PARAMETER;
 
    //Invalid session parameters?
-   if(!context->sessionIdLength || !context->cipherSuite)
+   if(!context->cipherSuite)
       return ERROR_FAILURE;
 
+#if (TLS_TICKET_SUPPORT == ENABLED)
+   //A session can be resumed using either a session ID or a ticket
+   if(!context->sessionIdLength && !context->ticketLength)
+      return ERROR_FAILURE;
+#else
+   //A session ID is required to resume the session
+   if(!context->sessionIdLength)
+      return ERROR_FAILURE;
+#endif
+
    //Save session identifier
    memcpy(session->id, context->sessionId, context->sessionIdLength);
    session->idLength = context->sessionIdLength;
@@ -852,6 +927,27 @@ error_t tlsSaveSession(const TlsContext *context, TlsSession *session)
    //Save master secret
    memcpy(session->masterSecret, context->masterSecret, 48);
 
+#if (TLS_TICKET_SUPPORT == ENABLED)
+   //Release the ticket previously saved, if any
+   osFreeMem(session->ticket);
+   session->ticket = NULL;
+   session->ticketLength = 0;
+
+   //Only clients store session tickets
+   if(context->ticketLength > 0)
+   {
+      //Allocate a memory block to hold the ticket
+      session->ticket = osAllocMem(context->ticketLength);
+      //Failed to allocate memory?
+      if(session->ticket == NULL)
+         return ERROR_OUT_OF_MEMORY;
+
+      //Save session ticket
+      memcpy(session->ticket, context->ticket, context->ticketLength);
+      session->ticketLength = context->ticketLength;
+   }
+#endif
+
    //Successful processing
    return NO_ERROR;
 }
@@ -881,8 +977,50 @@ error_t tlsRestoreSession(TlsContext *context, const TlsSession *session)
    //Restore master secret
    memcpy(context->masterSecret, session->masterSecret, 48);
 
+#if (TLS_TICKET_SUPPORT == ENABLED)
+   //Release the current ticket, if any
+   osFreeMem(context->ticket);
+   context->ticket = NULL;
+   context->ticketLength = 0;
+
+   //Restore session ticket, if any
+   if(session->ticketLength > 0)
+   {
+      //Allocate a memory block to hold the ticket
+      context->ticket = osAllocMem(session->ticketLength);
+      //Failed to allocate memory?
+      if(context->ticket == NULL)
+         return ERROR_OUT_OF_MEMORY;
+
+      //Copy session ticket
+      memcpy(context->ticket, session->ticket, session->ticketLength);
+      context->ticketLength = session->ticketLength;
+   }
+#endif
+
    //Successful processing
    return NO_ERROR;
 }
 
+
+/**
+ * @brief Release the resources held by a TLS session
+ * @param[in] session Pointer to the session
+ **/
+
+void tlsFreeSession(TlsSession *session)
+{
+   //Invalid session?
+   if(session == NULL)
+      return;
+
+#if (TLS_TICKET_SUPPORT == ENABLED)
+   //Release session ticket
+   osFreeMem(session->ticket);
+#endif
+
+   //Clear the session parameters
+   memset(session, 0, sizeof(TlsSession));
+}
+
 #endif
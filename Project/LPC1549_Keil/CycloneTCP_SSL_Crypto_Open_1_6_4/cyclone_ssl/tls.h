@@ -34,11 +34,13 @@
 #include "crypto.h"
 #include "tls_config.h"
 #include "hmac.h"
+#include "cipher_mode_gcm.h"
 #include "rsa.h"
 #include "dsa.h"
 #include "ecdsa.h"
 #include "dh.h"
 #include "ecdh.h"
+#include "x25519.h"
 
 //TLS version numbers
 #define SSL_VERSION_3_0 0x0300
@@ -102,6 +104,38 @@
    #error TLS_SESSION_CACHE_LIFETIME parameter is not valid
 #endif
 
+//Session ticket mechanism (RFC 5077)
+#ifndef TLS_TICKET_SUPPORT
+   #define TLS_TICKET_SUPPORT DISABLED
+#elif (TLS_TICKET_SUPPORT != ENABLED && TLS_TICKET_SUPPORT != DISABLED)
+   #error TLS_TICKET_SUPPORT parameter is not valid
+#elif (TLS_TICKET_SUPPORT == ENABLED && TLS_SESSION_RESUME_SUPPORT == DISABLED)
+   #error TLS_TICKET_SUPPORT requires TLS_SESSION_RESUME_SUPPORT
+#elif (TLS_TICKET_SUPPORT == ENABLED && (AES_SUPPORT == DISABLED || GCM_SUPPORT == DISABLED))
+   #error TLS_TICKET_SUPPORT requires AES_SUPPORT and GCM_SUPPORT
+#endif
+
+//Lifetime of session tickets
+#ifndef TLS_TICKET_LIFETIME
+   #define TLS_TICKET_LIFETIME 3600000
+#elif (TLS_TICKET_LIFETIME < 1000)
+   #error TLS_TICKET_LIFETIME parameter is not valid
+#endif
+
+//Lifetime of the keys used to protect session tickets
+#ifndef TLS_TICKET_KEY_LIFETIME
+   #define TLS_TICKET_KEY_LIFETIME 43200000
+#elif (TLS_TICKET_KEY_LIFETIME < TLS_TICKET_LIFETIME)
+   #error TLS_TICKET_KEY_LIFETIME parameter is not valid
+#endif
+
+//Maximum size of session tickets
+#ifndef TLS_MAX_TICKET_SIZE
+   #define TLS_MAX_TICKET_SIZE 256
+#elif (TLS_MAX_TICKET_SIZE < 128 || TLS_MAX_TICKET_SIZE > 65535)
+   #error TLS_MAX_TICKET_SIZE parameter is not valid
+#endif
+
 //SNI (Server Name Indication) extension
 #ifndef TLS_SNI_SUPPORT
    #define TLS_SNI_SUPPORT ENABLED
@@ -221,6 +255,13 @@
    #error TLS_GCM_CIPHER_SUPPORT parameter is not valid
 #endif
 
+//ChaCha20Poly1305 AEAD support
+#ifndef TLS_CHACHA20_POLY1305_SUPPORT
+   #define TLS_CHACHA20_POLY1305_SUPPORT ENABLED
+#elif (TLS_CHACHA20_POLY1305_SUPPORT != ENABLED && TLS_CHACHA20_POLY1305_SUPPORT != DISABLED)
+   #error TLS_CHACHA20_POLY1305_SUPPORT parameter is not valid
+#endif
+
 //RC4 cipher support
 #ifndef TLS_RC4_SUPPORT
    #define TLS_RC4_SUPPORT ENABLED
@@ -417,6 +458,15 @@
    #error TLS_BRAINPOOLP512R1_SUPPORT parameter is not valid
 #endif
 
+//X25519 key exchange support
+#ifndef TLS_X25519_SUPPORT
+   #define TLS_X25519_SUPPORT DISABLED
+#elif (TLS_X25519_SUPPORT != ENABLED && TLS_X25519_SUPPORT != DISABLED)
+   #error TLS_X25519_SUPPORT parameter is not valid
+#elif (TLS_X25519_SUPPORT == ENABLED && CURVE25519_SUPPORT == DISABLED)
+   #error TLS_X25519_SUPPORT requires CURVE25519_SUPPORT
+#endif
+
 //Maximum record length
 #ifndef TLS_MAX_RECORD_LENGTH
    #define TLS_MAX_RECORD_LENGTH 16384
@@ -737,6 +787,7 @@ typedef enum
    TLS_EC_CURVE_BRAINPOOLP256R1          = 26,    //RFC 7027
    TLS_EC_CURVE_BRAINPOOLP384R1          = 27,    //RFC 7027
    TLS_EC_CURVE_BRAINPOOLP512R1          = 28,    //RFC 7027
+   TLS_EC_CURVE_X25519                   = 29,    //RFC 8422
    TLS_EC_CURVE_ARBITRARY_EXPLICIT_PRIME = 65281, //RFC 4492
    TLS_EC_CURVE_ARBITRARY_EXPLICIT_CHAR2 = 65282  //RFC 4492
 } TlsEcNamedCurve;
@@ -784,11 +835,12 @@ typedef enum
    TLS_STATE_CERTIFICATE_VERIFY        = 9,
    TLS_STATE_CLIENT_CHANGE_CIPHER_SPEC = 10,
    TLS_STATE_CLIENT_FINISHED           = 11,
-   TLS_STATE_SERVER_CHANGE_CIPHER_SPEC = 12,
-   TLS_STATE_SERVER_FINISHED           = 13,
-   TLS_STATE_APPLICATION_DATA          = 14,
-   TLS_STATE_CLOSED                    = 15,
-   TLS_STATE_FATAL_ERROR               = 16
+   TLS_STATE_NEW_SESSION_TICKET        = 12,
+   TLS_STATE_SERVER_CHANGE_CIPHER_SPEC = 13,
+   TLS_STATE_SERVER_FINISHED           = 14,
+   TLS_STATE_APPLICATION_DATA          = 15,
+   TLS_STATE_CLOSED                    = 16,
+   TLS_STATE_FATAL_ERROR               = 17
 } TlsState;
 
 
@@ -1109,6 +1161,20 @@ typedef __start_packed struct
 } __end_packed TlsFinished;
 
 
+/**
+ * @brief NewSessionTicket message
+ **/
+
+typedef __start_packed struct
+{
+   uint8_t msgType;             //0
+   uint8_t length[3];           //1-3
+   uint32_t ticketLifetimeHint; //4-7
+   uint16_t ticketLength;       //8-9
+   uint8_t ticket[];            //10
+} __end_packed TlsNewSessionTicket;
+
+
 /**
  * @brief ChangeCipherSpec message
  **/
@@ -1177,21 +1243,70 @@ typedef struct
    uint16_t cipherSuite;      ///<Cipher suite identifier
    uint8_t compressionMethod; ///<Compression method
    uint8_t masterSecret[48];  ///<Master secret
+#if (TLS_TICKET_SUPPORT == ENABLED)
+   uint8_t *ticket;           ///<Session ticket (client only, allocated on demand)
+   size_t ticketLength;       ///<Length of the session ticket
+#endif
 } TlsSession;
 
 
+/**
+ * @brief Session cache entry
+ **/
+
+typedef struct
+{
+   TlsSession session; ///<Session parameters
+   uint_t prev;        ///<Previous entry in the LRU list
+   uint_t next;        ///<Next entry in the LRU list
+} TlsCacheEntry;
+
+
 /**
  * @brief Session cache
  **/
 
 typedef struct
 {
-   OsMutex mutex;         ///<Mutex preventing simultaneous access to the cache
-   uint_t size;           ///<Maximum number of entries
-   TlsSession sessions[]; ///<Cache entries
+   OsMutex mutex;           ///<Mutex preventing simultaneous access to the cache
+   uint_t size;             ///<Maximum number of entries
+   uint_t indexSize;        ///<Number of slots in the hash index (power of two)
+   uint_t *index;           ///<Hash index (open addressing, linear probing)
+   uint_t head;             ///<Most recently used entry
+   uint_t tail;             ///<Least recently used entry
+   TlsCacheEntry entries[]; ///<Cache entries
 } TlsCache;
 
 
+/**
+ * @brief Key used to protect session tickets
+ **/
+
+typedef struct
+{
+   bool_t valid;        ///<This flag tells whether the key is usable
+   systime_t timestamp; ///<Time at which the key was generated
+   uint8_t name[16];    ///<Key name carried in the clear in each ticket
+   uint8_t key[16];     ///<AES-128 key
+} TlsTicketKey;
+
+
+/**
+ * @brief Session ticket encryption context
+ *
+ * Tickets are issued under the current key. The previous key is
+ * kept after a rotation so that the tickets it protects can still
+ * be decrypted until they expire
+ *
+ **/
+
+typedef struct
+{
+   OsMutex mutex;          ///<Mutex preventing simultaneous access to the keys
+   TlsTicketKey keys[2];   ///<Current key, followed by the previous one
+} TlsTicketContext;
+
+
 /**
  * @brief Certificate descriptor
  **/
@@ -1232,6 +1347,10 @@ typedef struct
 
    DhContext dhContext;                     ///<Diffie-Hellman context
    EcdhContext ecdhContext;                 ///<ECDH context
+#if (TLS_X25519_SUPPORT == ENABLED)
+   uint8_t x25519PrivateKey[X25519_KEY_LENGTH]; ///<One's own X25519 private key
+   uint8_t x25519PeerKey[X25519_KEY_LENGTH];    ///<Peer's X25519 public key
+#endif
 
    TlsCertDesc certs[TLS_MAX_CERTIFICATES]; //End entity certificates
    uint_t numCerts;                         //Number of certificates available
@@ -1251,6 +1370,13 @@ typedef struct
    uint8_t sessionId[32];                   ///<Session identifier
    size_t sessionIdLength;                  ///<Length of the session identifier
 
+#if (TLS_TICKET_SUPPORT == ENABLED)
+   TlsTicketContext *ticketContext;         ///<Keys used to protect session tickets (server)
+   uint8_t *ticket;                         ///<Session ticket (client, allocated on demand)
+   size_t ticketLength;                     ///<Length of the session ticket
+   bool_t newSessionTicket;                 ///<A NewSessionTicket message is part of the handshake
+#endif
+
    bool_t resume;                           ///<This flag tells whether the connection is established by resuming a session
    uint16_t clientVersion;                  ///<Latest version supported by the client
    uint16_t version;                        ///<Negotiated TLS version
@@ -1286,6 +1412,10 @@ typedef struct
 
    void *writeCipherContext;                ///<Bulk cipher context for write operations
    void *readCipherContext;                 ///<Bulk cipher context for read operations
+#if (TLS_GCM_CIPHER_SUPPORT == ENABLED)
+   GcmContext *writeGcmContext;             ///<GCM context for write operations
+   GcmContext *readGcmContext;              ///<GCM context for read operations
+#endif
    HmacContext hmacContext;                 ///<HMAC context
 
    uint8_t *txBuffer;                       ///<TX buffer
@@ -1332,6 +1462,7 @@ error_t tlsSetConnectionEnd(TlsContext *context, TlsConnectionEnd entity);
 error_t tlsSetPrng(TlsContext *context, const PrngAlgo *prngAlgo, void *prngContext);
 error_t tlsSetServerName(TlsContext *context, const char_t *serverName);
 error_t tlsSetCache(TlsContext *context, TlsCache *cache);
+error_t tlsSetTicketContext(TlsContext *context, TlsTicketContext *ticketContext);
 error_t tlsSetClientAuthMode(TlsContext *context, TlsClientAuthMode mode);
 error_t tlsSetCipherSuites(TlsContext *context, const uint16_t *cipherSuites, uint_t length);
 error_t tlsSetDhParameters(TlsContext *context, const char_t *params, size_t length);
@@ -1348,8 +1479,12 @@ void tlsFree(TlsContext *context);
 
 error_t tlsSaveSession(const TlsContext *context, TlsSession *session);
 error_t tlsRestoreSession(TlsContext *context, const TlsSession *session);
+void tlsFreeSession(TlsSession *session);
 
 TlsCache *tlsInitCache(uint_t size);
 void tlsFreeCache(TlsCache *cache);
 
+TlsTicketContext *tlsInitTicketContext(void);
+void tlsFreeTicketContext(TlsTicketContext *ticketContext);
+
 #endif
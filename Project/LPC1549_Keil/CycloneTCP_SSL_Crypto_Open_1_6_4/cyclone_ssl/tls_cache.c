@@ -41,21 +41,31 @@
 
 /**
  * @brief Session cache initialization
+ *
+ * The cache entries are linked together in LRU order and indexed by a hash
+ * table keyed on the session ID. Unused entries are kept at the tail of
+ * the LRU list so that they are reused before any valid session is evicted
+ *
  * @param[in] size Maximum number of cache entries
  * @return Handle referencing the fully initialized session cache
  **/
 
 TlsCache *tlsInitCache(uint_t size)
 {
+   uint_t i;
+   uint_t indexSize;
    size_t n;
    TlsCache *cache;
 
    //Make sure the parameter is acceptable
-   if(size < 1)
+   if(size < 1 || size > (TLS_CACHE_NULL_INDEX / 4))
       return NULL;
 
+   //The hash index is kept at most half full to keep probe sequences short
+   for(indexSize = 2; indexSize < (2 * size); indexSize <<= 1);
+
    //Size of the memory required
-   n = sizeof(TlsCache) + size * sizeof(TlsSession);
+   n = sizeof(TlsCache) + size * sizeof(TlsCacheEntry) + indexSize * sizeof(uint_t);
 
    //Allocate a memory buffer to hold the session cache
    cache = osAllocMem(n);
@@ -77,6 +87,25 @@ TlsCache *tlsInitCache(uint_t size)
    //Save the maximum number of cache entries
    cache->size = size;
 
+   //The hash index immediately follows the cache entries
+   cache->index = (uint_t *) (cache->entries + size);
+   cache->indexSize = indexSize;
+
+   //Mark all the slots of the hash index as empty
+   for(i = 0; i < indexSize; i++)
+      cache->index[i] = TLS_CACHE_NULL_INDEX;
+
+   //Link all the entries together
+   for(i = 0; i < size; i++)
+   {
+      cache->entries[i].prev = (i > 0) ? (i - 1) : TLS_CACHE_NULL_INDEX;
+      cache->entries[i].next = (i < (size - 1)) ? (i + 1) : TLS_CACHE_NULL_INDEX;
+   }
+
+   //Initialize the LRU list
+   cache->head = 0;
+   cache->tail = size - 1;
+
    //Return a pointer to the newly created cache
    return cache;
 }
@@ -84,6 +113,10 @@ TlsCache *tlsInitCache(uint_t size)
 
 /**
  * @brief Search the session cache for a given session ID
+ *
+ * Only the matching entry is checked for expiry. The entry becomes the
+ * most recently used one when a valid session is found
+ *
  * @param[in] cache Pointer to the session cache
  * @param[in] id Expected session ID
  * @param[in] length Length of the session ID
@@ -93,66 +126,63 @@ TlsCache *tlsInitCache(uint_t size)
 
 TlsSession *tlsFindCache(TlsCache *cache, const uint8_t *id, size_t length)
 {
-   uint_t i;
-   systime_t time;
+   uint_t slot;
+   uint_t entry;
    TlsSession *session;
 
    //Check whether session caching is supported
    if(cache == NULL)
       return NULL;
    //Ensure the session ID is valid
-   if(id == NULL || length == 0)
+   if(id == NULL || length == 0 || length > 32)
       return NULL;
 
-   //Get current time
-   time = osGetSystemTime();
-
    //Acquire exclusive access to the session cache
    osAcquireMutex(&cache->mutex);
 
-   //Flush expired entries
-   for(i = 0; i < cache->size; i++)
+   //Search the hash index for the specified session ID
+   slot = tlsCacheLookup(cache, id, length);
+
+   //Matching entry found?
+   if(slot != TLS_CACHE_NULL_INDEX)
    {
-      //Point to the current entry
-      session = &cache->sessions[i];
+      //Point to the corresponding entry
+      entry = cache->index[slot];
+      session = &cache->entries[entry].session;
 
-      //Skip unused entries
-      if(session->idLength)
+      //Outdated entry?
+      if((osGetSystemTime() - session->timestamp) >= TLS_SESSION_CACHE_LIFETIME)
       {
-         //Outdated entry?
-         if((time - session->timestamp) >= TLS_SESSION_CACHE_LIFETIME)
-         {
-            //This session is no more valid and should be removed from the cache
-            memset(session, 0, sizeof(TlsSession));
-         }
+         //This session is no more valid and should be removed from the cache
+         tlsCacheRemoveEntry(cache, slot);
+         session = NULL;
       }
-   }
-
-   //Search the cache for the specified session ID
-   for(i = 0; i < cache->size; i++)
-   {
-      //Point to the current entry
-      session = &cache->sessions[i];
-
-      //Check whether the current identifier matches the specified session ID
-      if(session->idLength == length && !memcmp(session->id, id, length))
+      else
       {
-         //Release exclusive access to the session cache
-         osReleaseMutex(&cache->mutex);
-         //Return session parameters
-         return session;
+         //Move the entry to the head of the LRU list
+         tlsCacheUnlink(cache, entry);
+         tlsCacheAddToHead(cache, entry);
       }
    }
+   else
+   {
+      //No matching entry in session cache
+      session = NULL;
+   }
 
    //Release exclusive access to the session cache
    osReleaseMutex(&cache->mutex);
-   //No matching entry in session cache
-   return NULL;
+   //Return session parameters
+   return session;
 }
 
 
 /**
  * @brief Save current session in cache
+ *
+ * The session is stored in the least recently used entry, which is either
+ * an unused entry or the oldest valid session
+ *
  * @param[in] context TLS context
  * @return Error code
  **/
@@ -160,10 +190,9 @@ TlsSession *tlsFindCache(TlsCache *cache, const uint8_t *id, size_t length)
 error_t tlsSaveToCache(TlsContext *context)
 {
    error_t error;
-   uint_t i;
-   TlsSession *session;
-   TlsSession *firstFreeEntry;
-   TlsSession *oldestEntry;
+   uint_t slot;
+   uint_t entry;
+   TlsCache *cache;
 
    //Check parameters
    if(context == NULL)
@@ -175,56 +204,54 @@ error_t tlsSaveToCache(TlsContext *context)
    if(context->sessionIdLength == 0)
       return NO_ERROR;
 
+   //Point to the session cache
+   cache = context->cache;
+
    //Acquire exclusive access to the session cache
-   osAcquireMutex(&context->cache->mutex);
+   osAcquireMutex(&cache->mutex);
 
-   //Keep track of the first free entry
-   firstFreeEntry = NULL;
-   //Keep track of the oldest entry
-   oldestEntry = NULL;
+   //Search the hash index for the specified session ID
+   slot = tlsCacheLookup(cache, context->sessionId, context->sessionIdLength);
 
-   //Search the cache for the specified session ID
-   for(i = 0; i < context->cache->size; i++)
+   //If the session ID already exists, we are done
+   if(slot == TLS_CACHE_NULL_INDEX)
    {
-      //Point to the current entry
-      session = &context->cache->sessions[i];
+      //Reuse the least recently used entry
+      entry = cache->tail;
 
-      //If the session ID already exists, we are done
-      if(session->idLength == context->sessionIdLength &&
-         !memcmp(session->id, context->sessionId, session->idLength))
+      //Evict the session currently stored in this entry, if any
+      if(cache->entries[entry].session.idLength)
       {
-         //Do not write to session cache
-         firstFreeEntry = NULL;
-         oldestEntry = NULL;
-         //Exit immediately
-         break;
-      }
+         //Retrieve the corresponding slot of the hash index
+         slot = tlsCacheLookup(cache, cache->entries[entry].session.id,
+            cache->entries[entry].session.idLength);
 
-      //Check whether current entry is free
-      if(!session->idLength)
-      {
-         //Keep track of the first free entry
-         if(!firstFreeEntry)
-            firstFreeEntry = session;
+         //Drop the session
+         tlsCacheRemoveEntry(cache, slot);
       }
-      else
+
+      //Save session parameters
+      error = tlsSaveSession(context, &cache->entries[entry].session);
+
+      //Check status code
+      if(!error)
       {
-         //Keep track of the oldest entry in the table
-         if(!oldestEntry || timeCompare(session->timestamp, oldestEntry->timestamp) < 0)
-            oldestEntry = session;
+         //Add the session to the hash index
+         tlsCacheAddIndex(cache, entry);
+
+         //Move the entry to the head of the LRU list
+         tlsCacheUnlink(cache, entry);
+         tlsCacheAddToHead(cache, entry);
       }
    }
-
-   //Add current session to cache if necessary
-   if(firstFreeEntry != NULL)
-      error = tlsSaveSession(context, firstFreeEntry);
-   else if(oldestEntry != NULL)
-      error = tlsSaveSession(context, oldestEntry);
    else
+   {
+      //Do not write to session cache
       error = NO_ERROR;
+   }
 
    //Release exclusive access to the session cache
-   osReleaseMutex(&context->cache->mutex);
+   osReleaseMutex(&cache->mutex);
    //Return status code
    return error;
 }
@@ -238,8 +265,8 @@ error_t tlsSaveToCache(TlsContext *context)
 
 error_t tlsRemoveFromCache(TlsContext *context)
 {
-   uint_t i;
-   TlsSession *session;
+   uint_t slot;
+   TlsCache *cache;
 
    //Check parameters
    if(context == NULL)
@@ -252,26 +279,21 @@ error_t tlsRemoveFromCache(TlsContext *context)
    if(context->sessionIdLength == 0)
       return NO_ERROR;
 
+   //Point to the session cache
+   cache = context->cache;
+
    //Acquire exclusive access to the session cache
-   osAcquireMutex(&context->cache->mutex);
+   osAcquireMutex(&cache->mutex);
 
-   //Search the cache for the specified session ID
-   for(i = 0; i < context->cache->size; i++)
-   {
-      //Point to the current entry
-      session = &context->cache->sessions[i];
+   //Search the hash index for the specified session ID
+   slot = tlsCacheLookup(cache, context->sessionId, context->sessionIdLength);
 
-      //Check whether the current identifier matches the specified session ID
-      if(session->idLength == context->sessionIdLength &&
-         !memcmp(session->id, context->sessionId, session->idLength))
-      {
-         //Drop current entry
-         memset(session, 0, sizeof(TlsSession));
-      }
-   }
+   //Drop the matching entry, if any
+   if(slot != TLS_CACHE_NULL_INDEX)
+      tlsCacheRemoveEntry(cache, slot);
 
    //Release exclusive access to the session cache
-   osReleaseMutex(&context->cache->mutex);
+   osReleaseMutex(&cache->mutex);
    //Successful processing
    return NO_ERROR;
 }
@@ -294,11 +316,253 @@ void tlsFreeCache(TlsCache *cache)
    osDeleteMutex(&cache->mutex);
 
    //Compute the number of bytes allocated for the session cache
-   n = sizeof(TlsCache) + cache->size * sizeof(TlsSession);
+   n = sizeof(TlsCache) + cache->size * sizeof(TlsCacheEntry) +
+      cache->indexSize * sizeof(uint_t);
 
    //Clear the session cache before freeing memory
    memset(cache, 0, n);
    osFreeMem(cache);
 }
 
+
+/**
+ * @brief Hash function used to index the session cache (FNV-1a)
+ * @param[in] id Session ID
+ * @param[in] length Length of the session ID
+ * @return Hash value
+ **/
+
+uint_t tlsCacheHash(const uint8_t *id, size_t length)
+{
+   size_t i;
+   uint32_t h;
+
+   //Offset basis
+   h = 2166136261UL;
+
+   //Process each byte of the session ID
+   for(i = 0; i < length; i++)
+   {
+      h ^= id[i];
+      h *= 16777619UL;
+   }
+
+   //Return the resulting hash value
+   return h;
+}
+
+
+/**
+ * @brief Search the hash index for a given session ID
+ * @param[in] cache Pointer to the session cache
+ * @param[in] id Session ID
+ * @param[in] length Length of the session ID
+ * @return Slot of the hash index that references the matching entry,
+ *   or TLS_CACHE_NULL_INDEX if the session ID could not be found
+ **/
+
+uint_t tlsCacheLookup(TlsCache *cache, const uint8_t *id, size_t length)
+{
+   uint_t slot;
+   uint_t mask;
+   TlsSession *session;
+
+   //The size of the hash index is a power of two
+   mask = cache->indexSize - 1;
+   //Compute the home slot of the session ID
+   slot = tlsCacheHash(id, length) & mask;
+
+   //Linear probing stops at the first empty slot
+   while(cache->index[slot] != TLS_CACHE_NULL_INDEX)
+   {
+      //Point to the entry referenced by the current slot
+      session = &cache->entries[cache->index[slot]].session;
+
+      //Check whether the current identifier matches the specified session ID
+      if(session->idLength == length && !memcmp(session->id, id, length))
+         return slot;
+
+      //Probe the next slot
+      slot = (slot + 1) & mask;
+   }
+
+   //No matching entry in the hash index
+   return TLS_CACHE_NULL_INDEX;
+}
+
+
+/**
+ * @brief Add a cache entry to the hash index
+ * @param[in] cache Pointer to the session cache
+ * @param[in] entry Index of the entry to be added
+ **/
+
+void tlsCacheAddIndex(TlsCache *cache, uint_t entry)
+{
+   uint_t slot;
+   uint_t mask;
+   TlsSession *session;
+
+   //Point to the session
+   session = &cache->entries[entry].session;
+
+   //The size of the hash index is a power of two
+   mask = cache->indexSize - 1;
+   //Compute the home slot of the session ID
+   slot = tlsCacheHash(session->id, session->idLength) & mask;
+
+   //The index is never more than half full, so a free slot is always found
+   while(cache->index[slot] != TLS_CACHE_NULL_INDEX)
+      slot = (slot + 1) & mask;
+
+   //Reference the entry
+   cache->index[slot] = entry;
+}
+
+
+/**
+ * @brief Remove a slot from the hash index
+ *
+ * Subsequent entries of the probe sequence are shifted backward so
+ * that no tombstone is needed (refer to Knuth, algorithm 6.4R)
+ *
+ * @param[in] cache Pointer to the session cache
+ * @param[in] slot Slot to be freed
+ **/
+
+void tlsCacheRemoveIndex(TlsCache *cache, uint_t slot)
+{
+   uint_t i;
+   uint_t home;
+   uint_t mask;
+   TlsSession *session;
+
+   //The size of the hash index is a power of two
+   mask = cache->indexSize - 1;
+
+   //Free the slot
+   cache->index[slot] = TLS_CACHE_NULL_INDEX;
+
+   //Walk through the rest of the probe sequence
+   for(i = (slot + 1) & mask; cache->index[i] != TLS_CACHE_NULL_INDEX; i = (i + 1) & mask)
+   {
+      //Point to the entry referenced by the current slot
+      session = &cache->entries[cache->index[i]].session;
+      //Compute the home slot of its session ID
+      home = tlsCacheHash(session->id, session->idLength) & mask;
+
+      //The entry must be moved if the freed slot lies cyclically
+      //between its home slot and its current slot
+      if(((i - home) & mask) >= ((i - slot) & mask))
+      {
+         //Move the entry to the freed slot
+         cache->index[slot] = cache->index[i];
+         cache->index[i] = TLS_CACHE_NULL_INDEX;
+         //The current slot is now free
+         slot = i;
+      }
+   }
+}
+
+
+/**
+ * @brief Drop the session referenced by a slot of the hash index
+ * @param[in] cache Pointer to the session cache
+ * @param[in] slot Slot referencing the entry to be dropped
+ **/
+
+void tlsCacheRemoveEntry(TlsCache *cache, uint_t slot)
+{
+   uint_t entry;
+
+   //Retrieve the entry referenced by the slot
+   entry = cache->index[slot];
+
+   //Remove the entry from the hash index
+   tlsCacheRemoveIndex(cache, slot);
+   //Clear session parameters
+   memset(&cache->entries[entry].session, 0, sizeof(TlsSession));
+
+   //Unused entries are reused first
+   tlsCacheUnlink(cache, entry);
+   tlsCacheAddToTail(cache, entry);
+}
+
+
+/**
+ * @brief Remove an entry from the LRU list
+ * @param[in] cache Pointer to the session cache
+ * @param[in] entry Index of the entry to be removed
+ **/
+
+void tlsCacheUnlink(TlsCache *cache, uint_t entry)
+{
+   TlsCacheEntry *p;
+
+   //Point to the entry
+   p = &cache->entries[entry];
+
+   //Update the previous entry
+   if(p->prev != TLS_CACHE_NULL_INDEX)
+      cache->entries[p->prev].next = p->next;
+   else
+      cache->head = p->next;
+
+   //Update the next entry
+   if(p->next != TLS_CACHE_NULL_INDEX)
+      cache->entries[p->next].prev = p->prev;
+   else
+      cache->tail = p->prev;
+
+   //The entry is no more linked
+   p->prev = TLS_CACHE_NULL_INDEX;
+   p->next = TLS_CACHE_NULL_INDEX;
+}
+
+
+/**
+ * @brief Insert an entry at the head of the LRU list
+ * @param[in] cache Pointer to the session cache
+ * @param[in] entry Index of the entry to be inserted
+ **/
+
+void tlsCacheAddToHead(TlsCache *cache, uint_t entry)
+{
+   //Link the entry before the current head
+   cache->entries[entry].prev = TLS_CACHE_NULL_INDEX;
+   cache->entries[entry].next = cache->head;
+
+   //Update the LRU list
+   if(cache->head != TLS_CACHE_NULL_INDEX)
+      cache->entries[cache->head].prev = entry;
+   else
+      cache->tail = entry;
+
+   //The entry is now the most recently used one
+   cache->head = entry;
+}
+
+
+/**
+ * @brief Insert an entry at the tail of the LRU list
+ * @param[in] cache Pointer to the session cache
+ * @param[in] entry Index of the entry to be inserted
+ **/
+
+void tlsCacheAddToTail(TlsCache *cache, uint_t entry)
+{
+   //Link the entry after the current tail
+   cache->entries[entry].prev = cache->tail;
+   cache->entries[entry].next = TLS_CACHE_NULL_INDEX;
+
+   //Update the LRU list
+   if(cache->tail != TLS_CACHE_NULL_INDEX)
+      cache->entries[cache->tail].next = entry;
+   else
+      cache->head = entry;
+
+   //The entry is now the least recently used one
+   cache->tail = entry;
+}
+
 #endif
@@ -32,6 +32,9 @@
 //Dependencies
 #include "tls.h"
 
+//Special value used to mark empty index slots and list ends
+#define TLS_CACHE_NULL_INDEX ((uint_t) -1)
+
 //Session cache management
 TlsCache *tlsInitCache(uint_t size);
 TlsSession *tlsFindCache(TlsCache *cache, const uint8_t *id, size_t length);
@@ -39,4 +42,14 @@ error_t tlsSaveToCache(TlsContext *context);
 error_t tlsRemoveFromCache(TlsContext *context);
 void tlsFreeCache(TlsCache *cache);
 
+uint_t tlsCacheHash(const uint8_t *id, size_t length);
+uint_t tlsCacheLookup(TlsCache *cache, const uint8_t *id, size_t length);
+void tlsCacheAddIndex(TlsCache *cache, uint_t entry);
+void tlsCacheRemoveIndex(TlsCache *cache, uint_t slot);
+void tlsCacheRemoveEntry(TlsCache *cache, uint_t slot);
+
+void tlsCacheUnlink(TlsCache *cache, uint_t entry);
+void tlsCacheAddToHead(TlsCache *cache, uint_t entry);
+void tlsCacheAddToTail(TlsCache *cache, uint_t entry);
+
 #endif
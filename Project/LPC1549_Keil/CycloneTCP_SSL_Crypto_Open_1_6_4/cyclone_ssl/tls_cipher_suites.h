@@ -126,7 +126,7 @@ typedef enum
    TLS_DHE_RSA_WITH_ARIA_256_CBC_SHA384          = 0xC045, //RFC 6209
    TLS_DHE_RSA_WITH_ARIA_128_GCM_SHA256          = 0xC052, //RFC 6209
    TLS_DHE_RSA_WITH_ARIA_256_GCM_SHA384          = 0xC053, //RFC 6209
-   TLS_DHE_RSA_WITH_CHACHA20_POLY1305_SHA256     = 0xCC15, //RFC draft
+   TLS_DHE_RSA_WITH_CHACHA20_POLY1305_SHA256     = 0xCCAA, //RFC 7905
 
    TLS_DH_DSS_EXPORT_WITH_DES40_CBC_SHA          = 0x000B, //RFC 2246
    TLS_DH_DSS_WITH_DES_CBC_SHA                   = 0x000C, //RFC 2246
@@ -228,7 +228,7 @@ typedef enum
    TLS_ECDHE_RSA_WITH_ARIA_256_CBC_SHA384        = 0xC04D, //RFC 6209
    TLS_ECDHE_RSA_WITH_ARIA_128_GCM_SHA256        = 0xC060, //RFC 6209
    TLS_ECDHE_RSA_WITH_ARIA_256_GCM_SHA384        = 0xC061, //RFC 6209
-   TLS_ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256   = 0xCC13, //RFC draft
+   TLS_ECDHE_RSA_WITH_CHACHA20_POLY1305_SHA256   = 0xCCA8, //RFC 7905
 
    TLS_ECDH_ECDSA_WITH_NULL_SHA                  = 0xC001, //RFC 4492
    TLS_ECDH_ECDSA_WITH_RC4_128_SHA               = 0xC002, //RFC 4492
@@ -265,7 +265,7 @@ typedef enum
    TLS_ECDHE_ECDSA_WITH_ARIA_256_CBC_SHA384      = 0xC049, //RFC 6209
    TLS_ECDHE_ECDSA_WITH_ARIA_128_GCM_SHA256      = 0xC05C, //RFC 6209
    TLS_ECDHE_ECDSA_WITH_ARIA_256_GCM_SHA384      = 0xC05D, //RFC 6209
-   TLS_ECDHE_ECDSA_WITH_CHACHA20_POLY1305_SHA256 = 0xCC14, //RFC draft
+   TLS_ECDHE_ECDSA_WITH_CHACHA20_POLY1305_SHA256 = 0xCCA9, //RFC 7905
 
    TLS_ECDH_ANON_WITH_NULL_SHA                   = 0xC015, //RFC 4492
    TLS_ECDH_ANON_WITH_RC4_128_SHA                = 0xC016, //RFC 4492
@@ -125,6 +125,7 @@ error_t tlsClientHandshake(TlsContext *context)
       case TLS_STATE_SERVER_KEY_EXCHANGE:
       case TLS_STATE_CERTIFICATE_REQUEST:
       case TLS_STATE_SERVER_HELLO_DONE:
+      case TLS_STATE_NEW_SESSION_TICKET:
       case TLS_STATE_SERVER_CHANGE_CIPHER_SPEC:
       case TLS_STATE_SERVER_FINISHED:
          //Parse incoming handshake message
@@ -222,6 +223,14 @@ error_t tlsParseServerMessage(TlsContext *context)
          //end of the ServerHello and associated messages
          error = tlsParseServerHelloDone(context, message, length);
          break;
+#if (TLS_TICKET_SUPPORT == ENABLED)
+      //NewSessionTicket message received?
+      case TLS_TYPE_NEW_SESSION_TICKET:
+         //The server sends this message during the handshake, before the
+         //ChangeCipherSpec message, to provide a new session ticket
+         error = tlsParseNewSessionTicket(context, message, length);
+         break;
+#endif
       //Finished message received?
       case TLS_TYPE_FINISHED:
          //A Finished message is always sent immediately after a changeCipherSpec
@@ -317,6 +326,22 @@ error_t tlsSendClientHello(TlsContext *context)
    message->clientVersion = HTONS(TLS_MAX_VERSION);
    message->random = context->clientRandom;
 
+#if (TLS_TICKET_SUPPORT == ENABLED)
+   //When presenting a ticket, the client generates a session ID so that it
+   //can tell whether the server accepted the ticket (refer to RFC 5077,
+   //section 3.4)
+   if(context->ticketLength > 0 && context->sessionIdLength == 0)
+   {
+      //Generate a random session ID
+      error = context->prngAlgo->read(context->prngContext, context->sessionId, 32);
+      //Any error to report?
+      if(error) return error;
+
+      //Session ID is limited to 32 bytes
+      context->sessionIdLength = 32;
+   }
+#endif
+
 #if (TLS_SESSION_RESUME_SUPPORT == ENABLED)
    //The SessionID value identifies a session the client wishes
    //to reuse for this connection
@@ -481,6 +506,10 @@ error_t tlsSendClientHello(TlsContext *context)
       //Items in the list are ordered according to client's preferences
       n = 0;
 
+#if (TLS_X25519_SUPPORT == ENABLED)
+      //X25519 is the cheapest option and is therefore listed first
+      ellipticCurveList->value[n++] = HTONS(TLS_EC_CURVE_X25519);
+#endif
 #if (TLS_SECP160K1_SUPPORT == ENABLED)
       //Support for secp160k1 elliptic curve
       ellipticCurveList->value[n++] = HTONS(TLS_EC_CURVE_SECP160K1);
@@ -708,6 +737,36 @@ error_t tlsSendClientHello(TlsContext *context)
    }
 #endif
 
+#if (TLS_TICKET_SUPPORT == ENABLED)
+   //The client indicates that it supports session tickets by including the
+   //SessionTicket extension. The extension holds the ticket of the session
+   //the client wishes to resume, if any
+   {
+      TlsExtension *extension;
+
+      //Add the SessionTicket extension
+      extension = (TlsExtension *) p;
+      //Type of the extension
+      extension->type = HTONS(TLS_EXT_SESSION_TICKET);
+
+      //Copy the session ticket
+      n = context->ticketLength;
+      memcpy(extension->value, context->ticket, n);
+      //Fix the length of the extension
+      extension->length = htons(n);
+
+      //Compute the length, in bytes, of the SessionTicket extension
+      n += sizeof(TlsExtension);
+      //Fix the length of the extension list
+      extensionList->length += n;
+
+      //Point to the next field
+      p += n;
+      //Total length of the message
+      length += n;
+   }
+#endif
+
    //Check whether the extension list is empty
    if(extensionList->length > 0)
    {
@@ -851,22 +910,40 @@ error_t tlsSendClientKeyExchange(TlsContext *context)
       context->keyExchMethod == TLS_KEY_EXCH_ECDHE_ECDSA ||
       context->keyExchMethod == TLS_KEY_EXCH_ECDH_ANON)
    {
-      //Generate an ephemeral key pair
-      error = ecdhGenerateKeyPair(&context->ecdhContext, context->prngAlgo, context->prngContext);
-      //Any error to report?
-      if(error) return error;
+#if (TLS_X25519_SUPPORT == ENABLED)
+      //X25519 key exchange?
+      if(context->namedCurve == TLS_EC_CURVE_X25519)
+      {
+         //Generate an ephemeral key pair and encode the client's public key
+         error = tlsWriteX25519PublicKey(context, message->exchangeKeys, &length);
+         //Any error to report?
+         if(error) return error;
 
-      //Encode the client's public key to an opaque vector
-      error = tlsWriteEcPoint(&context->ecdhContext.params,
-         &context->ecdhContext.qa, message->exchangeKeys, &length);
-      //Any error to report?
-      if(error) return error;
+         //Calculate the premaster secret
+         error = tlsComputeX25519PremasterSecret(context);
+         //Any error to report?
+         if(error) return error;
+      }
+      else
+#endif
+      {
+         //Generate an ephemeral key pair
+         error = ecdhGenerateKeyPair(&context->ecdhContext, context->prngAlgo, context->prngContext);
+         //Any error to report?
+         if(error) return error;
 
-      //Calculate the negotiated key Z
-      error = ecdhComputeSharedSecret(&context->ecdhContext, context->premasterSecret,
-         sizeof(context->premasterSecret), &context->premasterSecretLength);
-      //Any error to report?
-      if(error) return error;
+         //Encode the client's public key to an opaque vector
+         error = tlsWriteEcPoint(&context->ecdhContext.params,
+            &context->ecdhContext.qa, message->exchangeKeys, &length);
+         //Any error to report?
+         if(error) return error;
+
+         //Calculate the negotiated key Z
+         error = ecdhComputeSharedSecret(&context->ecdhContext, context->premasterSecret,
+            sizeof(context->premasterSecret), &context->premasterSecretLength);
+         //Any error to report?
+         if(error) return error;
+      }
    }
    else
 #endif
@@ -1332,6 +1409,15 @@ error_t tlsParseServerHello(TlsContext *context, const TlsServerHello *message,
    //Remaining bytes to process
    n -= sizeof(TlsCompressionMethod);
 
+#if (TLS_TICKET_SUPPORT == ENABLED)
+   //The server includes an empty SessionTicket extension when it
+   //intends to send a NewSessionTicket message
+   if(tlsGetExtension(p, n, TLS_EXT_SESSION_TICKET) != NULL)
+      context->newSessionTicket = TRUE;
+   else
+      context->newSessionTicket = FALSE;
+#endif
+
    //Server version
    TRACE_INFO("  serverVersion = 0x%04" PRIX16 " (%s)\r\n", ntohs(message->serverVersion),
       tlsGetVersionName(ntohs(message->serverVersion)));
@@ -1372,6 +1458,11 @@ error_t tlsParseServerHello(TlsContext *context, const TlsServerHello *message,
    {
       //Perform a full handshake
       context->resume = FALSE;
+
+#if (TLS_TICKET_SUPPORT == ENABLED)
+      //The server rejected the ticket, if any
+      context->ticketLength = 0;
+#endif
    }
 
    //Save server random value
@@ -1413,6 +1504,12 @@ error_t tlsParseServerHello(TlsContext *context, const TlsServerHello *message,
       //Unable to generate key material?
       if(error) return error;
 
+#if (TLS_TICKET_SUPPORT == ENABLED)
+      //The server may issue a new ticket before its ChangeCipherSpec message
+      if(context->newSessionTicket)
+         context->state = TLS_STATE_NEW_SESSION_TICKET;
+      else
+#endif
       //At this point, both client and server must send ChangeCipherSpec
       //messages and proceed directly to Finished messages
       context->state = TLS_STATE_SERVER_CHANGE_CIPHER_SPEC;
@@ -1561,49 +1658,68 @@ error_t tlsParseServerKeyExchange(TlsContext *context, const TlsServerKeyExchang
       //Remaining bytes to process
       length -= sizeof(curveType);
 
+      //Malformed ServerKeyExchange message?
+      if(length < sizeof(namedCurve))
+         return ERROR_DECODING_FAILED;
+
       //Get elliptic curve identifier
       namedCurve = LOAD16BE(p);
-
-      //Retrieve the corresponding EC domain parameters
-      curveInfo = tlsGetCurveInfo(namedCurve);
-      //Make sure the specified elliptic curve is supported
-      if(curveInfo == NULL)
-         return ERROR_ILLEGAL_PARAMETER;
-
-      //Load EC domain parameters
-      error = ecLoadDomainParameters(&context->ecdhContext.params, curveInfo);
-      //Any error to report?
-      if(error) return error;
+      //Save the named curve selected by the server
+      context->namedCurve = namedCurve;
 
       //Advance data pointer
       p += sizeof(namedCurve);
       //Remaining bytes to process
       length -= sizeof(namedCurve);
 
-      //Read server's public key
-      error = tlsReadEcPoint(&context->ecdhContext.params,
-         &context->ecdhContext.qb, p, length, &n);
-      //Any error to report?
-      if(error) return error;
+#if (TLS_X25519_SUPPORT == ENABLED)
+      //X25519 key exchange?
+      if(namedCurve == TLS_EC_CURVE_X25519)
+      {
+         //Read server's public key
+         error = tlsReadX25519PublicKey(context, p, length, &n);
+         //Any error to report?
+         if(error) return error;
+      }
+      else
+#endif
+      {
+         //Retrieve the corresponding EC domain parameters
+         curveInfo = tlsGetCurveInfo(namedCurve);
+         //Make sure the specified elliptic curve is supported
+         if(curveInfo == NULL)
+            return ERROR_ILLEGAL_PARAMETER;
+
+         //Load EC domain parameters
+         error = ecLoadDomainParameters(&context->ecdhContext.params, curveInfo);
+         //Any error to report?
+         if(error) return error;
+
+         //Read server's public key
+         error = tlsReadEcPoint(&context->ecdhContext.params,
+            &context->ecdhContext.qb, p, length, &n);
+         //Any error to report?
+         if(error) return error;
+
+         //Verify peer's public key
+         error = ecdhCheckPublicKey(&context->ecdhContext.params, &context->ecdhContext.qb);
+         //Invalid public key?
+         if(error) return error;
+
+         //Debug message
+         TRACE_DEBUG("  Server public key X:\r\n");
+         TRACE_DEBUG_MPI("    ", &context->ecdhContext.qb.x);
+         TRACE_DEBUG("  Server public key Y:\r\n");
+         TRACE_DEBUG_MPI("    ", &context->ecdhContext.qb.y);
+      }
 
       //Advance data pointer
       p += n;
       //Remaining bytes to process
       length -= n;
 
-      //Verify peer's public key
-      error = ecdhCheckPublicKey(&context->ecdhContext.params, &context->ecdhContext.qb);
-      //Invalid public key?
-      if(error) return error;
-
       //Save the length of the server's ECDH parameters
       n = p - message->params;
-
-      //Debug message
-      TRACE_DEBUG("  Server public key X:\r\n");
-      TRACE_DEBUG_MPI("    ", &context->ecdhContext.qb.x);
-      TRACE_DEBUG("  Server public key Y:\r\n");
-      TRACE_DEBUG_MPI("    ", &context->ecdhContext.qb.y);
    }
    else
 #endif
@@ -2017,4 +2133,77 @@ error_t tlsParseServerHelloDone(TlsContext *context, const TlsServerHelloDone *m
    return NO_ERROR;
 }
 
+
+#if (TLS_TICKET_SUPPORT == ENABLED)
+
+/**
+ * @brief Parse NewSessionTicket message
+ *
+ * This message is sent by the server during the handshake, before the
+ * ChangeCipherSpec message. The client saves the ticket along with the
+ * session so that it can present it when resuming the session
+ *
+ * @param[in] context Pointer to the TLS context
+ * @param[in] message Incoming NewSessionTicket message to parse
+ * @param[in] length Message length
+ * @return Error code
+ **/
+
+error_t tlsParseNewSessionTicket(TlsContext *context, const TlsNewSessionTicket *message, size_t length)
+{
+   size_t n;
+
+   //Debug message
+   TRACE_INFO("NewSessionTicket message received (%" PRIuSIZE " bytes)...\r\n", length);
+   TRACE_DEBUG_ARRAY("  ", message, length);
+
+   //Check the length of the NewSessionTicket message
+   if(length < sizeof(TlsNewSessionTicket))
+      return ERROR_DECODING_FAILED;
+
+   //Check current state
+   if(context->state != TLS_STATE_NEW_SESSION_TICKET)
+      return ERROR_UNEXPECTED_MESSAGE;
+
+   //Retrieve the length of the ticket
+   n = ntohs(message->ticketLength);
+
+   //Malformed NewSessionTicket message?
+   if(length != (sizeof(TlsNewSessionTicket) + n))
+      return ERROR_DECODING_FAILED;
+
+   //Release the previous ticket, if any
+   osFreeMem(context->ticket);
+   context->ticket = NULL;
+   context->ticketLength = 0;
+
+   //The ticket is opaque to the client. A zero-length ticket means the
+   //server did not issue any ticket. Tickets that are too large or that
+   //cannot be stored are discarded and a full handshake will be performed
+   //next time
+   if(n > 0 && n <= TLS_MAX_TICKET_SIZE)
+   {
+      //Allocate a memory block to hold the ticket
+      context->ticket = osAllocMem(n);
+
+      //Successful memory allocation?
+      if(context->ticket != NULL)
+      {
+         //Save the ticket
+         memcpy(context->ticket, message->ticket, n);
+         context->ticketLength = n;
+      }
+   }
+
+   //Update the hash value with the incoming handshake message
+   tlsUpdateHandshakeHash(context, message, length);
+
+   //Prepare to receive a ChangeCipherSpec message...
+   context->state = TLS_STATE_SERVER_CHANGE_CIPHER_SPEC;
+   //Successful processing
+   return NO_ERROR;
+}
+
+#endif
+
 #endif
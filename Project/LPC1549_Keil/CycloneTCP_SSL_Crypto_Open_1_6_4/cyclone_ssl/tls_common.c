@@ -237,6 +237,24 @@ error_t tlsSendChangeCipherSpec(TlsContext *context)
    //Initialization failed?
    if(error) return error;
 
+#if (TLS_GCM_CIPHER_SUPPORT == ENABLED)
+   //GCM cipher mode?
+   if(context->cipherMode == CIPHER_MODE_GCM)
+   {
+      //Allocate a memory buffer to hold the GCM context
+      context->writeGcmContext = osAllocMem(sizeof(GcmContext));
+      //Failed to allocate memory?
+      if(!context->writeGcmContext) return ERROR_OUT_OF_MEMORY;
+
+      //The table of multiples of the hash subkey is computed once
+      //and reused for all the subsequent records
+      error = gcmInit(context->writeGcmContext, context->cipherAlgo,
+         context->writeCipherContext);
+      //Any error to report?
+      if(error) return error;
+   }
+#endif
+
    //Inform the record layer that subsequent records will be protected
    //under the newly negotiated encryption algorithm
    context->changeCipherSpecSent = TRUE;
@@ -302,6 +320,10 @@ error_t tlsSendFinished(TlsContext *context)
       //Use abbreviated or full handshake?
       if(context->resume)
          context->state = TLS_STATE_APPLICATION_DATA;
+#if (TLS_TICKET_SUPPORT == ENABLED)
+      else if(context->newSessionTicket)
+         context->state = TLS_STATE_NEW_SESSION_TICKET;
+#endif
       else
          context->state = TLS_STATE_SERVER_CHANGE_CIPHER_SPEC;
    }
@@ -792,6 +814,24 @@ error_t tlsParseChangeCipherSpec(TlsContext *context, const TlsChangeCipherSpec
    //Any error to report?
    if(error) return error;
 
+#if (TLS_GCM_CIPHER_SUPPORT == ENABLED)
+   //GCM cipher mode?
+   if(context->cipherMode == CIPHER_MODE_GCM)
+   {
+      //Allocate a memory buffer to hold the GCM context
+      context->readGcmContext = osAllocMem(sizeof(GcmContext));
+      //Failed to allocate memory?
+      if(!context->readGcmContext) return ERROR_OUT_OF_MEMORY;
+
+      //The table of multiples of the hash subkey is computed once
+      //and reused for all the subsequent records
+      error = gcmInit(context->readGcmContext, context->cipherAlgo,
+         context->readCipherContext);
+      //Any error to report?
+      if(error) return error;
+   }
+#endif
+
    //Inform the record layer that subsequent records will be protected
    //under the newly negotiated encryption algorithm
    context->changeCipherSpecReceived = TRUE;
@@ -875,6 +915,10 @@ error_t tlsParseFinished(TlsContext *context, const TlsFinished *message, size_t
       //Use abbreviated or full handshake?
       if(context->resume)
          context->state = TLS_STATE_APPLICATION_DATA;
+#if (TLS_TICKET_SUPPORT == ENABLED)
+      else if(context->newSessionTicket)
+         context->state = TLS_STATE_NEW_SESSION_TICKET;
+#endif
       else
          context->state = TLS_STATE_SERVER_CHANGE_CIPHER_SPEC;
    }
@@ -42,10 +42,11 @@
  * @param[in] context Pointer to the TLS context
  * @param[in] data Buffer containing the data to be written
  * @param[in] length Total number of bytes to be transmitted
+ * @param[in] flags Set of flags that influences the behavior of this function
  * @return Error code
  **/
 
-error_t tlsIoWrite(TlsContext *context, const void *data, size_t length)
+error_t tlsIoWrite(TlsContext *context, const void *data, size_t length, uint_t flags)
 {
 #if (TLS_BSD_SOCKET_SUPPORT == ENABLED)
    //Send the specified number of bytes
@@ -59,7 +60,7 @@ error_t tlsIoWrite(TlsContext *context, const void *data, size_t length)
    error_t error;
 
    //Send the specified number of bytes
-   error = socketSend(context->socket, data, length, NULL, 0);
+   error = socketSend(context->socket, data, length, NULL, flags);
    //Any error to report?
    if(error) return ERROR_WRITE_FAILED;
 
@@ -51,8 +51,15 @@
    #endif
 #endif
 
+//The TLS_IO_FLAG_DELAY flag indicates that more data will follow
+#if (TLS_BSD_SOCKET_SUPPORT == ENABLED)
+   #define TLS_IO_FLAG_DELAY 0
+#else
+   #define TLS_IO_FLAG_DELAY SOCKET_FLAG_DELAY
+#endif
+
 //I/O abstraction layer
-error_t tlsIoWrite(TlsContext *context, const void *data, size_t length);
+error_t tlsIoWrite(TlsContext *context, const void *data, size_t length, uint_t flags);
 error_t tlsIoRead(TlsContext *context, void *data, size_t length);
 
 #endif
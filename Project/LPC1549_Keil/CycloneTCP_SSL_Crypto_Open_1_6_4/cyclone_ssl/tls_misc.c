@@ -394,6 +394,16 @@ error_t tlsSelectNamedCurve(TlsContext *context,
       //one of those present in the list
       for(i = 0; i < n; i++)
       {
+#if (TLS_X25519_SUPPORT == ENABLED)
+         //X25519 is not described by EC domain parameters
+         if(ntohs(curveList->value[i]) == TLS_EC_CURVE_X25519)
+         {
+            //Save the named curve
+            context->namedCurve = TLS_EC_CURVE_X25519;
+            //We are done
+            break;
+         }
+#endif
          //Acceptable elliptic curve found?
          if(tlsGetCurveInfo(ntohs(curveList->value[i])) != NULL)
          {
@@ -848,6 +858,103 @@ error_t tlsReadEcPoint(const EcDomainParameters *params,
 }
 
 
+#if (TLS_X25519_SUPPORT == ENABLED)
+
+/**
+ * @brief Generate an ephemeral X25519 key pair and encode the public key
+ * @param[in] context Pointer to the TLS context
+ * @param[out] data Buffer where to store the opaque vector
+ * @param[out] length Total number of bytes that have been written
+ * @return Error code
+ **/
+
+error_t tlsWriteX25519PublicKey(TlsContext *context, uint8_t *data, size_t *length)
+{
+   error_t error;
+
+   //Generate an ephemeral key pair
+   error = x25519GenerateKeyPair(context->prngAlgo, context->prngContext,
+      context->x25519PrivateKey, data + 1);
+   //Any error to report?
+   if(error) return error;
+
+   //Debug message
+   TRACE_DEBUG("  X25519 public key:\r\n");
+   TRACE_DEBUG_ARRAY("    ", data + 1, X25519_KEY_LENGTH);
+
+   //The public key is preceded by a length field
+   data[0] = X25519_KEY_LENGTH;
+
+   //Return the total number of bytes that have been written
+   *length = X25519_KEY_LENGTH + 1;
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Read peer's X25519 public key from an opaque vector
+ * @param[in] context Pointer to the TLS context
+ * @param[in] data Buffer where to read the opaque vector
+ * @param[in] size Total number of bytes available in the buffer
+ * @param[out] length Total number of bytes that have been read
+ * @return Error code
+ **/
+
+error_t tlsReadX25519PublicKey(TlsContext *context,
+   const uint8_t *data, size_t size, size_t *length)
+{
+   //Buffer underrun?
+   if(size < 1)
+      return ERROR_DECODING_FAILED;
+
+   //X25519 public keys are always 32 bytes long (RFC 8422, section 5.11)
+   if(data[0] != X25519_KEY_LENGTH || size < (X25519_KEY_LENGTH + 1))
+      return ERROR_DECODING_FAILED;
+
+   //Save peer's public key
+   memcpy(context->x25519PeerKey, data + 1, X25519_KEY_LENGTH);
+
+   //Debug message
+   TRACE_DEBUG("  Peer X25519 public key:\r\n");
+   TRACE_DEBUG_ARRAY("    ", context->x25519PeerKey, X25519_KEY_LENGTH);
+
+   //Return the total number of bytes that have been read
+   *length = X25519_KEY_LENGTH + 1;
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Compute the premaster secret from X25519 keys
+ * @param[in] context Pointer to the TLS context
+ * @return Error code
+ **/
+
+error_t tlsComputeX25519PremasterSecret(TlsContext *context)
+{
+   error_t error;
+
+   //The premaster secret is the 32-byte output of the X25519 function.
+   //An all-zero value must be rejected (RFC 8422, section 5.11)
+   error = x25519ComputeSharedSecret(context->x25519PrivateKey,
+      context->x25519PeerKey, context->premasterSecret);
+
+   //Save the length of the premaster secret
+   if(!error)
+      context->premasterSecretLength = X25519_KEY_LENGTH;
+
+   //The ephemeral private key is no longer needed
+   memset(context->x25519PrivateKey, 0, X25519_KEY_LENGTH);
+
+   //Return status code
+   return error;
+}
+
+#endif
+
+
 /**
  * @brief Generate RSA signature (SSL 3.0, TLS 1.0 and TLS 1.1)
  * @param[in] key Signer's RSA private key
@@ -63,6 +63,13 @@ error_t tlsWriteEcPoint(const EcDomainParameters *params,
 error_t tlsReadEcPoint(const EcDomainParameters *params,
    EcPoint *a, const uint8_t *data, size_t size, size_t *length);
 
+error_t tlsWriteX25519PublicKey(TlsContext *context, uint8_t *data, size_t *length);
+
+error_t tlsReadX25519PublicKey(TlsContext *context,
+   const uint8_t *data, size_t size, size_t *length);
+
+error_t tlsComputeX25519PremasterSecret(TlsContext *context);
+
 error_t tlsGenerateRsaSignature(const RsaPrivateKey *key,
    const uint8_t *digest, uint8_t *signature, size_t *signatureLength);
 
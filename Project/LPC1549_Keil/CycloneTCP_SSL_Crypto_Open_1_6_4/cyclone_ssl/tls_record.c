@@ -40,6 +40,7 @@
 #include "cipher_mode_cbc.h"
 #include "cipher_mode_ccm.h"
 #include "cipher_mode_gcm.h"
+#include "chacha20_poly1305.h"
 #include "debug.h"
 
 //Check SSL library configuration
@@ -424,78 +425,15 @@ error_t tlsWriteRecord(TlsContext *context,
          }
          else
 #endif
-#if (TLS_CCM_CIPHER_SUPPORT == ENABLED || TLS_GCM_CIPHER_SUPPORT == ENABLED)
+#if (TLS_CCM_CIPHER_SUPPORT == ENABLED || TLS_GCM_CIPHER_SUPPORT == ENABLED || \
+   TLS_CHACHA20_POLY1305_SUPPORT == ENABLED)
          //AEAD cipher?
          if(context->cipherMode == CIPHER_MODE_CCM ||
-            context->cipherMode == CIPHER_MODE_GCM)
+            context->cipherMode == CIPHER_MODE_GCM ||
+            context->cipherMode == CIPHER_MODE_CHACHA20_POLY1305)
          {
-            uint8_t *data;
-            uint8_t *tag;
-            size_t nonceLength;
-            uint8_t nonce[12];
-            uint8_t a[13];
-
-            //Determine the total length of the nonce
-            nonceLength = context->fixedIvLength + context->recordIvLength;
-            //The salt is the implicit part of the nonce and is not sent in the packet
-            memcpy(nonce, context->writeIv, context->fixedIvLength);
-
-            //The explicit part of the nonce is chosen by the sender
-            error = context->prngAlgo->read(context->prngContext,
-               nonce + context->fixedIvLength, context->recordIvLength);
-            //Any error to report?
-            if(error) return error;
-
-            //Make room for the explicit nonce at the beginning of the record
-            memmove(record->data + context->recordIvLength, record->data, length);
-            //The explicit part of the nonce is carried in each TLS record
-            memcpy(record->data, nonce + context->fixedIvLength, context->recordIvLength);
-
-            //Additional data to be authenticated
-            memcpy(a, context->writeSeqNum, sizeof(TlsSequenceNumber));
-            memcpy(a + sizeof(TlsSequenceNumber), record, sizeof(TlsRecord));
-
-            //Plaintext data
-            data = record->data + context->recordIvLength;
-            //Buffer where to store the authentication tag
-            tag = data + length;
-
-#if (TLS_CCM_CIPHER_SUPPORT == ENABLED)
-            //CCM cipher mode?
-            if(context->cipherMode == CIPHER_MODE_CCM)
-            {
-               //Authenticated encryption using CCM
-               error = ccmEncrypt(context->cipherAlgo, context->writeCipherContext,
-                  nonce, nonceLength, a, 13, data, data, length, tag, context->authTagLength);
-            }
-            else
-#endif
-#if (TLS_GCM_CIPHER_SUPPORT == ENABLED)
-            //GCM cipher mode?
-            if(context->cipherMode == CIPHER_MODE_GCM)
-            {
-               //Authenticated encryption using GCM
-               error = gcmEncrypt(context->cipherAlgo, context->writeCipherContext,
-                  nonce, nonceLength, a, 13, data, data, length, tag, context->authTagLength);
-            }
-            else
-#endif
-            //Invalid cipher mode?
-            {
-               //The specified cipher mode is not supported
-               error = ERROR_UNSUPPORTED_CIPHER_MODE;
-            }
-
-            //Failed to encrypt data?
-            if(error) return error;
-
-            //Compute the length of the resulting message
-            length += context->recordIvLength + context->authTagLength;
-            //Fix length field
-            record->length = htons(length);
-
-            //Increment sequence number
-            tlsIncSequenceNumber(context->writeSeqNum);
+            //The record is encrypted in place and sent in several pieces
+            return tlsWriteAeadRecord(context, record, length);
          }
          else
 #endif
@@ -514,7 +452,7 @@ error_t tlsWriteRecord(TlsContext *context,
    //Compute the length of the complete TLS record
    length += sizeof(TlsRecord);
    //Send TLS record
-   return tlsIoWrite(context, record, length);
+   return tlsIoWrite(context, record, length, 0);
 }
 
 
@@ -555,23 +493,42 @@ error_t tlsReadRecord(TlsContext *context, uint8_t *data,
          return ERROR_VERSION_NOT_SUPPORTED;
    }
 
-   //Convert the length field to host byte order
-   n = ntohs(record.length);
+#if (TLS_CCM_CIPHER_SUPPORT == ENABLED || TLS_GCM_CIPHER_SUPPORT == ENABLED || \
+   TLS_CHACHA20_POLY1305_SUPPORT == ENABLED)
+   //Record payload protected by an AEAD cipher?
+   if(context->changeCipherSpecReceived && context->cipherAlgo != NULL &&
+      (context->cipherMode == CIPHER_MODE_CCM || context->cipherMode == CIPHER_MODE_GCM ||
+      context->cipherMode == CIPHER_MODE_CHACHA20_POLY1305))
+   {
+      //The nonce, the ciphertext and the authentication tag are read
+      //separately, and the ciphertext is decrypted in place
+      error = tlsReadAeadRecord(context, &record, data, size, &n);
+      //Any error to report?
+      if(error) return error;
+   }
+   else
+#endif
+   {
+      //Convert the length field to host byte order
+      n = ntohs(record.length);
 
-   //Make sure that the buffer is large enough to hold the entire record
-   if(n > size)
-      return ERROR_RECORD_OVERFLOW;
+      //Make sure that the buffer is large enough to hold the entire record
+      if(n > size)
+         return ERROR_RECORD_OVERFLOW;
 
-   //Read record contents
-   error = tlsIoRead(context, data, n);
-   //Any error to report?
-   if(error) return error;
+      //Read record contents
+      error = tlsIoRead(context, data, n);
+      //Any error to report?
+      if(error) return error;
+   }
 
-   //Record payload is protected?
+   //Record payload protected by a stream or a CBC block cipher?
    if(context->changeCipherSpecReceived)
    {
       //Decrypt record if necessary
-      if(context->cipherAlgo)
+      if(context->cipherAlgo != NULL && context->cipherMode != CIPHER_MODE_CCM &&
+         context->cipherMode != CIPHER_MODE_GCM &&
+         context->cipherMode != CIPHER_MODE_CHACHA20_POLY1305)
       {
          //Debug message
          TRACE_DEBUG("Encrypted record (%" PRIuSIZE " bytes):\r\n", n);
@@ -648,83 +605,6 @@ error_t tlsReadRecord(TlsContext *context, uint8_t *data,
             TRACE_DEBUG_ARRAY("  ", data, n);
          }
          else
-#endif
-#if (TLS_CCM_CIPHER_SUPPORT == ENABLED || TLS_GCM_CIPHER_SUPPORT == ENABLED)
-         //AEAD cipher?
-         if(context->cipherMode == CIPHER_MODE_CCM ||
-            context->cipherMode == CIPHER_MODE_GCM)
-         {
-            uint8_t *ciphertext;
-            uint8_t *tag;
-            size_t nonceLength;
-            uint8_t nonce[12];
-            uint8_t a[13];
-
-            //Make sure the message length is acceptable
-            if(n < (context->recordIvLength + context->authTagLength))
-               return ERROR_DECODING_FAILED;
-
-            //Determine the total length of the nonce
-            nonceLength = context->fixedIvLength + context->recordIvLength;
-            //The salt is the implicit part of the nonce and is not sent in the packet
-            memcpy(nonce, context->readIv, context->fixedIvLength);
-            //The explicit part of the nonce is chosen by the sender
-            memcpy(nonce + context->fixedIvLength, data, context->recordIvLength);
-
-            //Calculate the length of the ciphertext
-            n -= context->recordIvLength + context->authTagLength;
-            //Fix the length field of the TLS record
-            record.length = htons(n);
-
-            //Additional data to be authenticated
-            memcpy(a, context->readSeqNum, sizeof(TlsSequenceNumber));
-            memcpy(a + sizeof(TlsSequenceNumber), &record, sizeof(TlsRecord));
-
-            //Ciphertext data
-            ciphertext = data + context->recordIvLength;
-            //Authentication tag
-            tag = ciphertext + n;
-
-#if (TLS_CCM_CIPHER_SUPPORT == ENABLED)
-            //CCM cipher mode?
-            if(context->cipherMode == CIPHER_MODE_CCM)
-            {
-               //Decryption and verification (using CCM)
-               error = ccmDecrypt(context->cipherAlgo, context->readCipherContext, nonce,
-                  nonceLength, a, 13, ciphertext, ciphertext, n, tag, context->authTagLength);
-            }
-            else
-#endif
-#if (TLS_GCM_CIPHER_SUPPORT == ENABLED)
-            //GCM cipher mode?
-            if(context->cipherMode == CIPHER_MODE_GCM)
-            {
-               //Decryption and verification (using GCM)
-               error = gcmDecrypt(context->cipherAlgo, context->readCipherContext, nonce,
-                  nonceLength, a, 13, ciphertext, ciphertext, n, tag, context->authTagLength);
-            }
-            else
-#endif
-            //Invalid cipher mode?
-            {
-               //The specified cipher mode is not supported
-               error = ERROR_UNSUPPORTED_CIPHER_MODE;
-            }
-
-            //Wrong authentication tag?
-            if(error) return ERROR_BAD_RECORD_MAC;
-
-            //Discard the explicit part of the nonce
-            memmove(data, data + context->recordIvLength, n);
-
-            //Debug message
-            TRACE_DEBUG("Decrypted record (%" PRIuSIZE " bytes):\r\n", n);
-            TRACE_DEBUG_ARRAY("  ", data, n);
-
-            //Increment sequence number
-            tlsIncSequenceNumber(context->readSeqNum);
-         }
-         else
 #endif
          //Invalid cipher mode?
          {
@@ -802,6 +682,330 @@ error_t tlsReadRecord(TlsContext *context, uint8_t *data,
 }
 
 
+#if (TLS_CCM_CIPHER_SUPPORT == ENABLED || TLS_GCM_CIPHER_SUPPORT == ENABLED || \
+   TLS_CHACHA20_POLY1305_SUPPORT == ENABLED)
+
+/**
+ * @brief Encrypt and send a TLS record protected by an AEAD cipher
+ *
+ * The plaintext is encrypted in place. The record header, the explicit
+ * part of the nonce, the ciphertext and the authentication tag are then
+ * handed to the socket as separate pieces, so that the record contents
+ * do not have to be shifted to make room for the nonce
+ *
+ * @param[in] context Pointer to the TLS context
+ * @param[in] record Pointer to the TLS record
+ * @param[in] length Length of the plaintext
+ * @return Error code
+ **/
+
+error_t tlsWriteAeadRecord(TlsContext *context,
+   TlsRecord *record, size_t length)
+{
+   error_t error;
+   size_t nonceLength;
+   uint8_t nonce[12];
+   uint8_t a[13];
+   uint8_t tag[16];
+#if (TLS_CHACHA20_POLY1305_SUPPORT == ENABLED)
+   size_t i;
+#endif
+#if (TLS_CCM_CIPHER_SUPPORT == ENABLED)
+   CcmContext ccmContext;
+#endif
+
+   //Determine the total length of the nonce
+   nonceLength = context->fixedIvLength + context->recordIvLength;
+   //The salt is the implicit part of the nonce and is not sent in the packet
+   memcpy(nonce, context->writeIv, context->fixedIvLength);
+
+#if (TLS_CHACHA20_POLY1305_SUPPORT == ENABLED)
+   //ChaCha20Poly1305 cipher mode?
+   if(context->cipherMode == CIPHER_MODE_CHACHA20_POLY1305)
+   {
+      //The nonce is entirely implicit. The sequence number, padded on the
+      //left with zeroes, is XORed with the IV (refer to RFC 7905, section 2)
+      for(i = 0; i < sizeof(TlsSequenceNumber); i++)
+         nonce[4 + i] ^= context->writeSeqNum[i];
+   }
+   else
+#endif
+   {
+      //The explicit part of the nonce is chosen by the sender
+      error = context->prngAlgo->read(context->prngContext,
+         nonce + context->fixedIvLength, context->recordIvLength);
+      //Any error to report?
+      if(error) return error;
+   }
+
+   //Additional data to be authenticated
+   memcpy(a, context->writeSeqNum, sizeof(TlsSequenceNumber));
+   memcpy(a + sizeof(TlsSequenceNumber), record, sizeof(TlsRecord));
+
+#if (TLS_CCM_CIPHER_SUPPORT == ENABLED)
+   //CCM cipher mode?
+   if(context->cipherMode == CIPHER_MODE_CCM)
+   {
+      //Initialize CCM context
+      error = ccmInit(&ccmContext, context->cipherAlgo, context->writeCipherContext);
+
+      //Process the nonce and the additional data
+      if(!error)
+      {
+         error = ccmStart(&ccmContext, nonce, nonceLength, a, 13,
+            length, context->authTagLength);
+      }
+
+      //Encrypt the record contents in place
+      if(!error)
+         error = ccmEncryptUpdate(&ccmContext, record->data, record->data, length);
+
+      //Compute the authentication tag
+      if(!error)
+         error = ccmEncryptFinal(&ccmContext, tag);
+   }
+   else
+#endif
+#if (TLS_GCM_CIPHER_SUPPORT == ENABLED)
+   //GCM cipher mode?
+   if(context->cipherMode == CIPHER_MODE_GCM)
+   {
+      //Process the nonce and the additional data
+      error = gcmStart(context->writeGcmContext, nonce, nonceLength, a, 13);
+
+      //Check status code
+      if(!error)
+      {
+         //Encrypt the record contents in place
+         gcmEncryptUpdate(context->writeGcmContext, record->data, record->data, length);
+         //Compute the authentication tag
+         error = gcmEncryptFinal(context->writeGcmContext, tag, context->authTagLength);
+      }
+   }
+   else
+#endif
+#if (TLS_CHACHA20_POLY1305_SUPPORT == ENABLED)
+   //ChaCha20Poly1305 cipher mode?
+   if(context->cipherMode == CIPHER_MODE_CHACHA20_POLY1305)
+   {
+      //Encrypt the record contents in place and compute the tag
+      error = chacha20Poly1305Encrypt(context->writeEncKey, context->encKeyLength,
+         nonce, nonceLength, a, 13, record->data, record->data, length,
+         tag, context->authTagLength);
+   }
+   else
+#endif
+   //Invalid cipher mode?
+   {
+      //The specified cipher mode is not supported
+      error = ERROR_UNSUPPORTED_CIPHER_MODE;
+   }
+
+   //Failed to encrypt data?
+   if(error) return error;
+
+   //Fix length field
+   record->length = htons(length + context->recordIvLength + context->authTagLength);
+
+   //Increment sequence number
+   tlsIncSequenceNumber(context->writeSeqNum);
+
+   //Debug message
+   TRACE_DEBUG("Encrypted record (%" PRIuSIZE " bytes):\r\n", length);
+   TRACE_DEBUG_ARRAY("  ", record->data, length);
+
+   //Send the record header
+   error = tlsIoWrite(context, record, sizeof(TlsRecord), TLS_IO_FLAG_DELAY);
+   //Any error to report?
+   if(error) return error;
+
+   //The explicit part of the nonce, if any, is carried in each TLS record
+   if(context->recordIvLength > 0)
+   {
+      //Send the explicit part of the nonce
+      error = tlsIoWrite(context, nonce + context->fixedIvLength,
+         context->recordIvLength, TLS_IO_FLAG_DELAY);
+      //Any error to report?
+      if(error) return error;
+   }
+
+   //Send the ciphertext
+   error = tlsIoWrite(context, record->data, length, TLS_IO_FLAG_DELAY);
+   //Any error to report?
+   if(error) return error;
+
+   //The authentication tag completes the record
+   return tlsIoWrite(context, tag, context->authTagLength, 0);
+}
+
+
+/**
+ * @brief Receive and decrypt a TLS record protected by an AEAD cipher
+ *
+ * The explicit part of the nonce and the authentication tag are read
+ * separately, so that the ciphertext lands at the beginning of the
+ * buffer and is decrypted in place
+ *
+ * @param[in] context Pointer to the TLS context
+ * @param[in,out] record Header of the TLS record
+ * @param[out] data Buffer where to store the record data
+ * @param[in] size Maximum acceptable size for the incoming record
+ * @param[out] length Actual length of the record data
+ * @return Error code
+ **/
+
+error_t tlsReadAeadRecord(TlsContext *context, TlsRecord *record,
+   uint8_t *data, size_t size, size_t *length)
+{
+   error_t error;
+   size_t n;
+   size_t nonceLength;
+   uint8_t nonce[12];
+   uint8_t a[13];
+   uint8_t tag[16];
+#if (TLS_CHACHA20_POLY1305_SUPPORT == ENABLED)
+   size_t i;
+#endif
+#if (TLS_CCM_CIPHER_SUPPORT == ENABLED)
+   CcmContext ccmContext;
+#endif
+
+   //Convert the length field to host byte order
+   n = ntohs(record->length);
+
+   //Make sure the message length is acceptable
+   if(n < (context->recordIvLength + context->authTagLength))
+      return ERROR_DECODING_FAILED;
+
+   //Calculate the length of the ciphertext
+   n -= context->recordIvLength + context->authTagLength;
+
+   //Make sure that the buffer is large enough to hold the ciphertext
+   if(n > size)
+      return ERROR_RECORD_OVERFLOW;
+
+   //Determine the total length of the nonce
+   nonceLength = context->fixedIvLength + context->recordIvLength;
+   //The salt is the implicit part of the nonce and is not sent in the packet
+   memcpy(nonce, context->readIv, context->fixedIvLength);
+
+#if (TLS_CHACHA20_POLY1305_SUPPORT == ENABLED)
+   //ChaCha20Poly1305 cipher mode?
+   if(context->cipherMode == CIPHER_MODE_CHACHA20_POLY1305)
+   {
+      //The nonce is entirely implicit. The sequence number, padded on the
+      //left with zeroes, is XORed with the IV (refer to RFC 7905, section 2)
+      for(i = 0; i < sizeof(TlsSequenceNumber); i++)
+         nonce[4 + i] ^= context->readSeqNum[i];
+   }
+   else
+#endif
+   {
+      //The explicit part of the nonce is chosen by the sender
+      error = tlsIoRead(context, nonce + context->fixedIvLength, context->recordIvLength);
+      //Any error to report?
+      if(error) return error;
+   }
+
+   //Read the ciphertext
+   error = tlsIoRead(context, data, n);
+   //Any error to report?
+   if(error) return error;
+
+   //Read the authentication tag
+   error = tlsIoRead(context, tag, context->authTagLength);
+   //Any error to report?
+   if(error) return error;
+
+   //Debug message
+   TRACE_DEBUG("Encrypted record (%" PRIuSIZE " bytes):\r\n", n);
+   TRACE_DEBUG_ARRAY("  ", data, n);
+
+   //Fix the length field of the TLS record
+   record->length = htons(n);
+
+   //Additional data to be authenticated
+   memcpy(a, context->readSeqNum, sizeof(TlsSequenceNumber));
+   memcpy(a + sizeof(TlsSequenceNumber), record, sizeof(TlsRecord));
+
+#if (TLS_CCM_CIPHER_SUPPORT == ENABLED)
+   //CCM cipher mode?
+   if(context->cipherMode == CIPHER_MODE_CCM)
+   {
+      //Initialize CCM context
+      error = ccmInit(&ccmContext, context->cipherAlgo, context->readCipherContext);
+
+      //Process the nonce and the additional data
+      if(!error)
+      {
+         error = ccmStart(&ccmContext, nonce, nonceLength, a, 13,
+            n, context->authTagLength);
+      }
+
+      //Decrypt the record contents in place
+      if(!error)
+         error = ccmDecryptUpdate(&ccmContext, data, data, n);
+
+      //Verify the authentication tag
+      if(!error)
+         error = ccmDecryptFinal(&ccmContext, tag);
+   }
+   else
+#endif
+#if (TLS_GCM_CIPHER_SUPPORT == ENABLED)
+   //GCM cipher mode?
+   if(context->cipherMode == CIPHER_MODE_GCM)
+   {
+      //Process the nonce and the additional data
+      error = gcmStart(context->readGcmContext, nonce, nonceLength, a, 13);
+
+      //Check status code
+      if(!error)
+      {
+         //Decrypt the record contents in place
+         gcmDecryptUpdate(context->readGcmContext, data, data, n);
+         //Verify the authentication tag
+         error = gcmDecryptFinal(context->readGcmContext, tag, context->authTagLength);
+      }
+   }
+   else
+#endif
+#if (TLS_CHACHA20_POLY1305_SUPPORT == ENABLED)
+   //ChaCha20Poly1305 cipher mode?
+   if(context->cipherMode == CIPHER_MODE_CHACHA20_POLY1305)
+   {
+      //Decrypt the record contents in place and verify the tag
+      error = chacha20Poly1305Decrypt(context->readEncKey, context->encKeyLength,
+         nonce, nonceLength, a, 13, data, data, n, tag, context->authTagLength);
+   }
+   else
+#endif
+   //Invalid cipher mode?
+   {
+      //The specified cipher mode is not supported
+      error = ERROR_UNSUPPORTED_CIPHER_MODE;
+   }
+
+   //Wrong authentication tag?
+   if(error) return ERROR_BAD_RECORD_MAC;
+
+   //Debug message
+   TRACE_DEBUG("Decrypted record (%" PRIuSIZE " bytes):\r\n", n);
+   TRACE_DEBUG_ARRAY("  ", data, n);
+
+   //Increment sequence number
+   tlsIncSequenceNumber(context->readSeqNum);
+
+   //Actual length of the record data
+   *length = n;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+#endif
+
+
 /**
  * @brief Increment sequence number
  * @param[in] seqNum Sequence number to increment
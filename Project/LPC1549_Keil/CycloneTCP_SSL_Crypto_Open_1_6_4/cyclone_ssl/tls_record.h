@@ -45,6 +45,12 @@ error_t tlsWriteRecord(TlsContext *context,
 error_t tlsReadRecord(TlsContext *context, uint8_t *data,
    size_t size, size_t *length, TlsContentType *contentType);
 
+error_t tlsWriteAeadRecord(TlsContext *context,
+   TlsRecord *record, size_t length);
+
+error_t tlsReadAeadRecord(TlsContext *context, TlsRecord *record,
+   uint8_t *data, size_t size, size_t *length);
+
 void tlsIncSequenceNumber(TlsSequenceNumber seqNum);
 
 #endif
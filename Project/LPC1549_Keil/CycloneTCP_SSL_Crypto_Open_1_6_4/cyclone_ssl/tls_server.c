@@ -43,6 +43,7 @@
 #include "tls_common.h"
 #include "tls_record.h"
 #include "tls_cache.h"
+#include "tls_ticket.h"
 #include "tls_misc.h"
 #include "x509.h"
 #include "pem.h"
@@ -111,6 +112,14 @@ error_t tlsServerHandshake(TlsContext *context)
          //end of the ServerHello and associated messages
          error = tlsSendServerHelloDone(context);
          break;
+#if (TLS_TICKET_SUPPORT == ENABLED)
+      //Send NewSessionTicket message?
+      case TLS_STATE_NEW_SESSION_TICKET:
+         //The NewSessionTicket message is sent by the server during the
+         //handshake, before the ChangeCipherSpec message
+         error = tlsSendNewSessionTicket(context);
+         break;
+#endif
       //Send ChangeCipherSpec message?
       case TLS_STATE_SERVER_CHANGE_CIPHER_SPEC:
          //The ChangeCipherSpec message is sent by the server and to notify the
@@ -403,6 +412,30 @@ error_t tlsSendServerHello(TlsContext *context)
    }
 #endif
 
+#if (TLS_TICKET_SUPPORT == ENABLED)
+   //The server uses a zero-length SessionTicket extension to indicate to
+   //the client that it will send a new ticket using NewSessionTicket
+   if(context->newSessionTicket)
+   {
+      TlsExtension *extension;
+
+      //Add the SessionTicket extension
+      extension = (TlsExtension *) p;
+      //Type of the extension
+      extension->type = HTONS(TLS_EXT_SESSION_TICKET);
+      //The extension data is empty
+      extension->length = HTONS(0);
+
+      //Fix the length of the extension list
+      extensionList->length += sizeof(TlsExtension);
+
+      //Point to the next field
+      p += sizeof(TlsExtension);
+      //Total length of the message
+      length += sizeof(TlsExtension);
+   }
+#endif
+
    //Check whether the extension list is empty
    if(extensionList->length > 0)
    {
@@ -433,6 +466,12 @@ error_t tlsSendServerHello(TlsContext *context)
       //Unable to generate key material?
       if(error) return error;
 
+#if (TLS_TICKET_SUPPORT == ENABLED)
+      //A new ticket may be issued before the ChangeCipherSpec message
+      if(context->newSessionTicket)
+         context->state = TLS_STATE_NEW_SESSION_TICKET;
+      else
+#endif
       //At this point, both client and server must send ChangeCipherSpec
       //messages and proceed directly to Finished messages
       context->state = TLS_STATE_SERVER_CHANGE_CIPHER_SPEC;
@@ -541,28 +580,6 @@ error_t tlsSendServerKeyExchange(TlsContext *context)
       //Format message header
       message->msgType = TLS_TYPE_SERVER_KEY_EXCHANGE;
 
-      //Retrieve the elliptic curve to be used
-      curveInfo = tlsGetCurveInfo(context->namedCurve);
-      //Any error to report?
-      if(curveInfo == NULL)
-         return ERROR_FAILURE;
-
-      //Load EC domain parameters
-      error = ecLoadDomainParameters(&context->ecdhContext.params, curveInfo);
-      //Failed to load parameters
-      if(error) return error;
-
-      //Generate an ephemeral key pair
-      error = ecdhGenerateKeyPair(&context->ecdhContext, context->prngAlgo, context->prngContext);
-      //Any error to report?
-      if(error) return error;
-
-      //Debug message
-      TRACE_DEBUG("  Server public key X:\r\n");
-      TRACE_DEBUG_MPI("    ", &context->ecdhContext.qa.x);
-      TRACE_DEBUG("  Server public key Y:\r\n");
-      TRACE_DEBUG_MPI("    ", &context->ecdhContext.qa.y);
-
       //Point to the server's key exchange parameters
       p = message->params;
 
@@ -582,11 +599,46 @@ error_t tlsSendServerKeyExchange(TlsContext *context)
       //Adjust byte counter
       length += sizeof(uint16_t);
 
-      //Write server's public key
-      error = tlsWriteEcPoint(&context->ecdhContext.params,
-         &context->ecdhContext.qa, p, &n);
-      //Any error to report?
-      if(error) return error;
+#if (TLS_X25519_SUPPORT == ENABLED)
+      //X25519 key exchange?
+      if(context->namedCurve == TLS_EC_CURVE_X25519)
+      {
+         //Generate an ephemeral key pair and write server's public key
+         error = tlsWriteX25519PublicKey(context, p, &n);
+         //Any error to report?
+         if(error) return error;
+      }
+      else
+#endif
+      {
+         //Retrieve the elliptic curve to be used
+         curveInfo = tlsGetCurveInfo(context->namedCurve);
+         //Any error to report?
+         if(curveInfo == NULL)
+            return ERROR_FAILURE;
+
+         //Load EC domain parameters
+         error = ecLoadDomainParameters(&context->ecdhContext.params, curveInfo);
+         //Failed to load parameters
+         if(error) return error;
+
+         //Generate an ephemeral key pair
+         error = ecdhGenerateKeyPair(&context->ecdhContext, context->prngAlgo, context->prngContext);
+         //Any error to report?
+         if(error) return error;
+
+         //Debug message
+         TRACE_DEBUG("  Server public key X:\r\n");
+         TRACE_DEBUG_MPI("    ", &context->ecdhContext.qa.x);
+         TRACE_DEBUG("  Server public key Y:\r\n");
+         TRACE_DEBUG_MPI("    ", &context->ecdhContext.qa.y);
+
+         //Write server's public key
+         error = tlsWriteEcPoint(&context->ecdhContext.params,
+            &context->ecdhContext.qa, p, &n);
+         //Any error to report?
+         if(error) return error;
+      }
 
       //Advance data pointer
       p +=n;
@@ -1223,6 +1275,74 @@ error_t tlsSendServerHelloDone(TlsContext *context)
 }
 
 
+#if (TLS_TICKET_SUPPORT == ENABLED)
+
+/**
+ * @brief Send NewSessionTicket message
+ *
+ * This message is sent by the server during the handshake, before the
+ * ChangeCipherSpec message, when the client has sent a SessionTicket
+ * extension. It carries the session state encrypted under a key known
+ * only to the server
+ *
+ * @param[in] context Pointer to the TLS context
+ * @return Error code
+ **/
+
+error_t tlsSendNewSessionTicket(TlsContext *context)
+{
+   error_t error;
+   size_t n;
+   size_t length;
+   TlsNewSessionTicket *message;
+
+   //Point to the NewSessionTicket message
+   message = (TlsNewSessionTicket *) (context->txBuffer + sizeof(TlsRecord));
+   //Format message header
+   message->msgType = TLS_TYPE_NEW_SESSION_TICKET;
+
+   //The lifetime hint is expressed in seconds
+   message->ticketLifetimeHint = HTONL(TLS_TICKET_LIFETIME / 1000);
+
+   //Encrypt the session state
+   error = tlsEncryptTicket(context, message->ticket, &n);
+
+   //If the server cannot issue a ticket after having included the
+   //SessionTicket extension, it must send a zero-length ticket
+   if(error)
+   {
+      //Debug message
+      TRACE_WARNING("Failed to issue session ticket!\r\n");
+      //Send an empty ticket
+      n = 0;
+   }
+
+   //Length of the ticket
+   message->ticketLength = htons(n);
+   //Length of the complete handshake message
+   length = sizeof(TlsNewSessionTicket) + n;
+
+   //Fix the length field
+   STORE24BE(length - sizeof(TlsHandshake), message->length);
+
+   //Debug message
+   TRACE_INFO("Sending NewSessionTicket message (%" PRIuSIZE " bytes)...\r\n", length);
+   TRACE_DEBUG_ARRAY("  ", message, length);
+
+   //Send handshake message
+   error = tlsWriteProtocolData(context, length, TLS_TYPE_HANDSHAKE);
+   //Failed to send TLS record?
+   if(error) return error;
+
+   //Prepare to send a ChangeCipherSpec message...
+   context->state = TLS_STATE_SERVER_CHANGE_CIPHER_SPEC;
+   //Successful processing
+   return NO_ERROR;
+}
+
+#endif
+
+
 /**
  * @brief Parse ClientHello message
  *
@@ -1253,6 +1373,9 @@ error_t tlsParseClientHello(TlsContext *context, const TlsClientHello *message,
    const TlsExtension *extension;
    const TlsSignHashAlgos *supportedSignAlgos;
    const TlsEllipticCurveList *curveList;
+#if (TLS_TICKET_SUPPORT == ENABLED)
+   const TlsExtension *ticketExtension;
+#endif
 
    //Debug message
    TRACE_INFO("ClientHello message received (%" PRIuSIZE " bytes)...\r\n", length);
@@ -1391,6 +1514,19 @@ error_t tlsParseClientHello(TlsContext *context, const TlsClientHello *message,
       supportedSignAlgos = NULL;
    }
 
+#if (TLS_TICKET_SUPPORT == ENABLED)
+   //Parse the list of extensions offered by the client
+   ticketExtension = tlsGetExtension(p, n, TLS_EXT_SESSION_TICKET);
+
+   //A client that supports session tickets sends the SessionTicket
+   //extension, empty or holding a ticket. The server issues a new
+   //ticket only if session tickets are enabled
+   if(ticketExtension != NULL && context->ticketContext != NULL)
+      context->newSessionTicket = TRUE;
+   else
+      context->newSessionTicket = FALSE;
+#endif
+
    //Get the version the client wishes to use during this session
    context->clientVersion = ntohs(message->clientVersion);
 
@@ -1405,6 +1541,21 @@ error_t tlsParseClientHello(TlsContext *context, const TlsClientHello *message,
    context->clientRandom = message->random;
 
 #if (TLS_SESSION_RESUME_SUPPORT == ENABLED)
+#if (TLS_TICKET_SUPPORT == ENABLED)
+   //Check whether the client presented a valid session ticket
+   if(context->newSessionTicket && !tlsDecryptTicket(context,
+      ticketExtension->value, ntohs(ticketExtension->length)))
+   {
+      //If the server accepts the ticket and the session ID is not empty,
+      //then it must respond with the same session ID
+      memcpy(context->sessionId, message->sessionId, message->sessionIdLength);
+      context->sessionIdLength = message->sessionIdLength;
+
+      //Perform abbreviated handshake without any server-side state
+      context->resume = TRUE;
+   }
+   else
+#endif
    //Check whether session caching is supported
    if(context->cache != NULL)
    {
@@ -1750,23 +1901,41 @@ error_t tlsParseClientKeyExchange(TlsContext *context, const TlsClientKeyExchang
       context->keyExchMethod == TLS_KEY_EXCH_ECDHE_ECDSA ||
       context->keyExchMethod == TLS_KEY_EXCH_ECDH_ANON)
    {
-      //Decode client's public key
-      error = tlsReadEcPoint(&context->ecdhContext.params, &context->ecdhContext.qb, p, length, &n);
-      //Any error to report?
-      if(error) return error;
+#if (TLS_X25519_SUPPORT == ENABLED)
+      //X25519 key exchange?
+      if(context->namedCurve == TLS_EC_CURVE_X25519)
+      {
+         //Decode client's public key
+         error = tlsReadX25519PublicKey(context, p, length, &n);
+         //Any error to report?
+         if(error) return error;
 
-      //Verify client's public key and make sure that it is on the same
-      //elliptic curve as the server's ECDH key
-      error = ecdhCheckPublicKey(&context->ecdhContext.params, &context->ecdhContext.qb);
-      //Weak public value?
-      if(error) return error;
+         //Calculate the premaster secret
+         error = tlsComputeX25519PremasterSecret(context);
+         //Any error to report?
+         if(error) return error;
+      }
+      else
+#endif
+      {
+         //Decode client's public key
+         error = tlsReadEcPoint(&context->ecdhContext.params, &context->ecdhContext.qb, p, length, &n);
+         //Any error to report?
+         if(error) return error;
 
-      //Calculate the shared secret Z. Leading zeros found in this octet
-      //string must not be truncated (see RFC 4492, section 5.10)
-      error = ecdhComputeSharedSecret(&context->ecdhContext, context->premasterSecret,
-         sizeof(context->premasterSecret), &context->premasterSecretLength);
-      //Any error to report?
-      if(error) return error;
+         //Verify client's public key and make sure that it is on the same
+         //elliptic curve as the server's ECDH key
+         error = ecdhCheckPublicKey(&context->ecdhContext.params, &context->ecdhContext.qb);
+         //Weak public value?
+         if(error) return error;
+
+         //Calculate the shared secret Z. Leading zeros found in this octet
+         //string must not be truncated (see RFC 4492, section 5.10)
+         error = ecdhComputeSharedSecret(&context->ecdhContext, context->premasterSecret,
+            sizeof(context->premasterSecret), &context->premasterSecretLength);
+         //Any error to report?
+         if(error) return error;
+      }
    }
    else
 #endif
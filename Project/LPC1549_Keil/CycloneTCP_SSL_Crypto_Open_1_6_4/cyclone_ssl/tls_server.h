@@ -40,6 +40,7 @@ error_t tlsSendServerHello(TlsContext *context);
 error_t tlsSendServerKeyExchange(TlsContext *context);
 error_t tlsSendCertificateRequest(TlsContext *context);
 error_t tlsSendServerHelloDone(TlsContext *context);
+error_t tlsSendNewSessionTicket(TlsContext *context);
 
 error_t tlsParseClientHello(TlsContext *context, const TlsClientHello *message, size_t length);
 error_t tlsParseClientKeyExchange(TlsContext *context, const TlsClientKeyExchange *message, size_t length);
@@ -0,0 +1,393 @@
+/**
+ * @file tls_ticket.c
+ * @brief Session tickets
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneSSL Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * Session tickets allow a server to resume sessions without keeping any
+ * per-client state. The session state is encrypted and authenticated with
+ * AES-128-GCM under a key known only to the server, and handed to the client
+ * which presents it back in a subsequent handshake. Refer to RFC 5077 for
+ * more details. The ticket follows the recommended format:
+ * - key_name (16 bytes), sent in the clear and used as additional data
+ * - IV (12 bytes)
+ * - encrypted state (version, cipher suite, compression method, time stamp
+ *   and master secret)
+ * - authentication tag (16 bytes)
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL TLS_TRACE_LEVEL
+
+//Dependencies
+#include <string.h>
+#include "tls.h"
+#include "tls_ticket.h"
+#include "tls_misc.h"
+#include "aes.h"
+#include "cipher_mode_gcm.h"
+#include "debug.h"
+
+//Check SSL library configuration
+#if (TLS_SUPPORT == ENABLED && TLS_TICKET_SUPPORT == ENABLED)
+
+
+/**
+ * @brief Session ticket encryption context initialization
+ * @return Handle referencing the fully initialized context
+ **/
+
+TlsTicketContext *tlsInitTicketContext(void)
+{
+   TlsTicketContext *ticketContext;
+
+   //Allocate a memory buffer to hold the ticket encryption context
+   ticketContext = osAllocMem(sizeof(TlsTicketContext));
+   //Failed to allocate memory?
+   if(ticketContext == NULL) return NULL;
+
+   //Clear memory. The first key will be generated when the first
+   //ticket is issued
+   memset(ticketContext, 0, sizeof(TlsTicketContext));
+
+   //Create a mutex to prevent simultaneous access to the keys
+   if(!osCreateMutex(&ticketContext->mutex))
+   {
+      //Clean up side effects
+      osFreeMem(ticketContext);
+      //Report an error
+      return NULL;
+   }
+
+   //Return a pointer to the newly created context
+   return ticketContext;
+}
+
+
+/**
+ * @brief Encrypt the current session state into a ticket
+ * @param[in] context Pointer to the TLS context
+ * @param[out] ticket Buffer where to store the ticket
+ *   (at least TLS_TICKET_SIZE bytes)
+ * @param[out] length Length of the resulting ticket
+ * @return Error code
+ **/
+
+error_t tlsEncryptTicket(TlsContext *context, uint8_t *ticket, size_t *length)
+{
+   error_t error;
+   systime_t time;
+   uint8_t *iv;
+   uint8_t *state;
+   TlsTicketKey *key;
+   TlsTicketContext *ticketContext;
+   AesContext *aesContext;
+   GcmContext *gcmContext;
+
+   //Point to the ticket encryption context
+   ticketContext = context->ticketContext;
+   //Session tickets are not enabled?
+   if(ticketContext == NULL)
+      return ERROR_FAILURE;
+
+   //Allocate AES and GCM contexts
+   aesContext = osAllocMem(sizeof(AesContext));
+   gcmContext = osAllocMem(sizeof(GcmContext));
+
+   //Failed to allocate memory?
+   if(aesContext == NULL || gcmContext == NULL)
+   {
+      //Clean up side effects
+      osFreeMem(aesContext);
+      osFreeMem(gcmContext);
+      //Report an error
+      return ERROR_OUT_OF_MEMORY;
+   }
+
+   //Point to the fields of the ticket
+   iv = ticket + TLS_TICKET_KEY_NAME_SIZE;
+   state = iv + TLS_TICKET_IV_SIZE;
+
+   //Get current time
+   time = osGetSystemTime();
+
+   //Acquire exclusive access to the keys
+   osAcquireMutex(&ticketContext->mutex);
+
+   //Start of exception handling block
+   do
+   {
+      //Point to the current key
+      key = &ticketContext->keys[0];
+
+      //Rotate keys periodically
+      if(!key->valid || (time - key->timestamp) >= TLS_TICKET_KEY_LIFETIME)
+      {
+         //The current key becomes the previous one. Tickets protected
+         //by this key remain valid until they expire
+         ticketContext->keys[1] = ticketContext->keys[0];
+         key->valid = FALSE;
+
+         //Generate a new key name
+         error = context->prngAlgo->read(context->prngContext,
+            key->name, TLS_TICKET_KEY_NAME_SIZE);
+         //Any error to report?
+         if(error) break;
+
+         //Generate a new AES key
+         error = context->prngAlgo->read(context->prngContext, key->key, 16);
+         //Any error to report?
+         if(error) break;
+
+         //Save the time at which the key was generated
+         key->timestamp = time;
+         key->valid = TRUE;
+
+         //Debug message
+         TRACE_INFO("New session ticket key generated\r\n");
+      }
+
+      //Initialize AES context with the current key
+      error = aesInit(aesContext, key->key, 16);
+      //Any error to report?
+      if(error) break;
+
+      //Initialize GCM context
+      error = gcmInit(gcmContext, AES_CIPHER_ALGO, aesContext);
+      //Any error to report?
+      if(error) break;
+
+      //The key name tells the server which key protects the ticket
+      memcpy(ticket, key->name, TLS_TICKET_KEY_NAME_SIZE);
+
+      //Each ticket is encrypted with a fresh IV
+      error = context->prngAlgo->read(context->prngContext,
+         iv, TLS_TICKET_IV_SIZE);
+      //Any error to report?
+      if(error) break;
+
+      //Format the session state
+      STORE16BE(context->version, state);
+      STORE16BE(context->cipherSuite, state + 2);
+      state[4] = context->compressionMethod;
+      STORE32BE(time, state + 5);
+      memcpy(state + 9, context->masterSecret, 48);
+
+      //Encrypt the session state in place. The key name is authenticated
+      //as additional data
+      error = gcmEncrypt(gcmContext, iv, TLS_TICKET_IV_SIZE, ticket,
+         TLS_TICKET_KEY_NAME_SIZE, state, state, TLS_TICKET_STATE_SIZE,
+         state + TLS_TICKET_STATE_SIZE, TLS_TICKET_TAG_SIZE);
+      //Any error to report?
+      if(error) break;
+
+      //Length of the resulting ticket
+      *length = TLS_TICKET_SIZE;
+
+      //End of exception handling block
+   } while(0);
+
+   //Release exclusive access to the keys
+   osReleaseMutex(&ticketContext->mutex);
+
+   //Clear AES and GCM contexts before freeing memory
+   memset(aesContext, 0, sizeof(AesContext));
+   memset(gcmContext, 0, sizeof(GcmContext));
+   osFreeMem(aesContext);
+   osFreeMem(gcmContext);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Decrypt a ticket and restore the session state
+ *
+ * The TLS context is only updated when the ticket is authentic, has
+ * not expired and matches the negotiated version. Otherwise the server
+ * falls back to a full handshake
+ *
+ * @param[in] context Pointer to the TLS context
+ * @param[in] ticket Ticket presented by the client
+ * @param[in] length Length of the ticket
+ * @return Error code
+ **/
+
+error_t tlsDecryptTicket(TlsContext *context, const uint8_t *ticket, size_t length)
+{
+   error_t error;
+   uint_t i;
+   systime_t time;
+   const uint8_t *iv;
+   const uint8_t *data;
+   uint8_t state[TLS_TICKET_STATE_SIZE];
+   TlsTicketKey *key;
+   TlsTicketContext *ticketContext;
+   AesContext *aesContext;
+   GcmContext *gcmContext;
+
+   //Point to the ticket encryption context
+   ticketContext = context->ticketContext;
+   //Session tickets are not enabled?
+   if(ticketContext == NULL)
+      return ERROR_FAILURE;
+
+   //Tickets that were not issued by this server are rejected
+   if(length != TLS_TICKET_SIZE)
+      return ERROR_DECRYPTION_FAILED;
+
+   //Allocate AES and GCM contexts
+   aesContext = osAllocMem(sizeof(AesContext));
+   gcmContext = osAllocMem(sizeof(GcmContext));
+
+   //Failed to allocate memory?
+   if(aesContext == NULL || gcmContext == NULL)
+   {
+      //Clean up side effects
+      osFreeMem(aesContext);
+      osFreeMem(gcmContext);
+      //Report an error
+      return ERROR_OUT_OF_MEMORY;
+   }
+
+   //Point to the fields of the ticket
+   iv = ticket + TLS_TICKET_KEY_NAME_SIZE;
+   data = iv + TLS_TICKET_IV_SIZE;
+
+   //Get current time
+   time = osGetSystemTime();
+
+   //Acquire exclusive access to the keys
+   osAcquireMutex(&ticketContext->mutex);
+
+   //Start of exception handling block
+   do
+   {
+      //Search for the key that protects the ticket
+      for(i = 0; i < arraysize(ticketContext->keys); i++)
+      {
+         //Point to the current key
+         key = &ticketContext->keys[i];
+
+         //Check whether the key name matches
+         if(key->valid && !memcmp(key->name, ticket, TLS_TICKET_KEY_NAME_SIZE))
+            break;
+      }
+
+      //Unknown key name?
+      if(i >= arraysize(ticketContext->keys))
+      {
+         //The key has been rotated out, or the ticket is forged
+         error = ERROR_DECRYPTION_FAILED;
+         break;
+      }
+
+      //Initialize AES context
+      error = aesInit(aesContext, key->key, 16);
+      //Any error to report?
+      if(error) break;
+
+      //Initialize GCM context
+      error = gcmInit(gcmContext, AES_CIPHER_ALGO, aesContext);
+      //Any error to report?
+      if(error) break;
+
+      //Decrypt the session state and check the authentication tag
+      error = gcmDecrypt(gcmContext, iv, TLS_TICKET_IV_SIZE, ticket,
+         TLS_TICKET_KEY_NAME_SIZE, data, state, TLS_TICKET_STATE_SIZE,
+         data + TLS_TICKET_STATE_SIZE, TLS_TICKET_TAG_SIZE);
+      //Authentication failed?
+      if(error)
+      {
+         //Report an error
+         error = ERROR_DECRYPTION_FAILED;
+         break;
+      }
+
+      //Check whether the ticket has expired
+      if((time - LOAD32BE(state + 5)) >= TLS_TICKET_LIFETIME)
+      {
+         //Report an error
+         error = ERROR_DECRYPTION_FAILED;
+         break;
+      }
+
+      //The session must be resumed with the same version
+      if(LOAD16BE(state) != context->version)
+      {
+         //Report an error
+         error = ERROR_INVALID_VERSION;
+         break;
+      }
+
+      //Select the cipher suite of the session being resumed
+      error = tlsSetCipherSuite(context, LOAD16BE(state + 2));
+      //Any error to report?
+      if(error) break;
+
+      //Restore compression method and master secret
+      context->compressionMethod = state[4];
+      memcpy(context->masterSecret, state + 9, 48);
+
+      //End of exception handling block
+   } while(0);
+
+   //Release exclusive access to the keys
+   osReleaseMutex(&ticketContext->mutex);
+
+   //Clear the session state and the AES and GCM contexts
+   memset(state, 0, TLS_TICKET_STATE_SIZE);
+   memset(aesContext, 0, sizeof(AesContext));
+   memset(gcmContext, 0, sizeof(GcmContext));
+   osFreeMem(aesContext);
+   osFreeMem(gcmContext);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Properly dispose a session ticket encryption context
+ * @param[in] ticketContext Pointer to the context to be released
+ **/
+
+void tlsFreeTicketContext(TlsTicketContext *ticketContext)
+{
+   //Invalid context?
+   if(ticketContext == NULL)
+      return;
+
+   //Release previously allocated resources
+   osDeleteMutex(&ticketContext->mutex);
+
+   //Clear the keys before freeing memory
+   memset(ticketContext, 0, sizeof(TlsTicketContext));
+   osFreeMem(ticketContext);
+}
+
+#endif
@@ -0,0 +1,54 @@
+/**
+ * @file tls_ticket.h
+ * @brief Session tickets
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneSSL Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+#ifndef _TLS_TICKET_H
+#define _TLS_TICKET_H
+
+//Dependencies
+#include "tls.h"
+
+//Size of the key name
+#define TLS_TICKET_KEY_NAME_SIZE 16
+//Size of the initialization vector
+#define TLS_TICKET_IV_SIZE 12
+//Size of the encrypted session state
+#define TLS_TICKET_STATE_SIZE 57
+//Size of the authentication tag
+#define TLS_TICKET_TAG_SIZE 16
+
+//Total size of a session ticket
+#define TLS_TICKET_SIZE (TLS_TICKET_KEY_NAME_SIZE + TLS_TICKET_IV_SIZE + \
+   TLS_TICKET_STATE_SIZE + TLS_TICKET_TAG_SIZE)
+
+//Session ticket management
+TlsTicketContext *tlsInitTicketContext(void);
+error_t tlsEncryptTicket(TlsContext *context, uint8_t *ticket, size_t *length);
+error_t tlsDecryptTicket(TlsContext *context, const uint8_t *ticket, size_t length);
+void tlsFreeTicketContext(TlsTicketContext *ticketContext);
+
+#endif
@@ -869,6 +869,9 @@ int_t setsockopt(int_t s, int_t level, int_t optname,
    int_t value;
    timeval *t;
    Socket *sock;
+#if (TCP_SUPPORT == ENABLED && TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
+   const TcpCongestAlgo *algo;
+#endif
 
    //Make sure the socket descriptor is valid
    if(s < 0 || s >= SOCKET_MAX_COUNT)
@@ -954,6 +957,50 @@ int_t setsockopt(int_t s, int_t level, int_t optname,
          return SOCKET_ERROR;
       }
    }
+   //TCP level options?
+   else if(level == IPPROTO_TCP)
+   {
+      //Check option type
+      switch(optname)
+      {
+#if (TCP_SUPPORT == ENABLED && TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
+      //Congestion control algorithm
+      case TCP_CONGESTION:
+         //Check option length
+         if(optlen < 0)
+         {
+            socketError(sock, ERROR_INVALID_LENGTH);
+            return SOCKET_ERROR;
+         }
+
+         //Retrieve the algorithm that matches the specified name
+         algo = tcpGetCongestAlgo(optval, (size_t) optlen);
+
+         //Unknown algorithm?
+         if(algo == NULL)
+         {
+            socketError(sock, ERROR_INVALID_PARAMETER);
+            return SOCKET_ERROR;
+         }
+
+         //Select the congestion control algorithm
+         if(socketSetCongestionControl(sock, algo))
+         {
+            socketError(sock, ERROR_INVALID_SOCKET);
+            return SOCKET_ERROR;
+         }
+
+         //Successful processing
+         break;
+#endif
+
+      //Unknown option?
+      default:
+         //Report an error
+         socketError(NULL, ERROR_INVALID_OPTION);
+         return SOCKET_ERROR;
+      }
+   }
    //Unknown level
    else
    {
@@ -983,6 +1030,9 @@ int_t getsockopt(int_t s, int_t level, int_t optname,
 {
    timeval *t;
    Socket *sock;
+#if (TCP_SUPPORT == ENABLED && TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
+   const TcpCongestAlgo *algo;
+#endif
 
    //Make sure the socket descriptor is valid
    if(s < 0 || s >= SOCKET_MAX_COUNT)
@@ -1092,6 +1142,40 @@ int_t getsockopt(int_t s, int_t level, int_t optname,
          return SOCKET_ERROR;
       }
    }
+   //TCP level options?
+   else if(level == IPPROTO_TCP)
+   {
+      //Check option type
+      switch(optname)
+      {
+#if (TCP_SUPPORT == ENABLED && TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
+      //Congestion control algorithm
+      case TCP_CONGESTION:
+         //Algorithm currently selected for the socket
+         algo = (sock->congestAlgo != NULL) ? sock->congestAlgo : TCP_DEFAULT_CONGEST_ALGO;
+
+         //Check option length
+         if(*optlen < 0 || (size_t) *optlen < (strlen(algo->name) + 1))
+         {
+            socketError(NULL, ERROR_INVALID_LENGTH);
+            return SOCKET_ERROR;
+         }
+
+         //Copy the name of the algorithm
+         strcpy(optval, algo->name);
+         //Return the actual length of the option
+         *optlen = strlen(algo->name) + 1;
+         //Successful processing
+         break;
+#endif
+
+      //Unknown option?
+      default:
+         //Report an error
+         socketError(NULL, ERROR_INVALID_OPTION);
+         return SOCKET_ERROR;
+      }
+   }
    //Unknown level
    else
    {
@@ -118,6 +118,7 @@
 
 //TCP level options
 #define TCP_NODELAY      0x0001
+#define TCP_CONGESTION   0x000D
 
 //IOCTL commands
 #define FIONBIO          0x800466FE
@@ -584,6 +584,56 @@ bool_t netGetLinkState(NetInterface *interface)
 }
 
 
+#if (NET_STATS_SUPPORT == ENABLED)
+
+/**
+ * @brief Take a snapshot of the statistics of a network interface
+ *
+ * The counters are copied while traffic is flowing. No lock is taken
+ *
+ * @param[in] interface Pointer to the desired network interface
+ * @param[out] stats Snapshot of the interface statistics
+ * @return Error code
+ **/
+
+error_t netGetInterfaceStats(NetInterface *interface, NetInterfaceStats *stats)
+{
+   //Check parameters
+   if(interface == NULL || stats == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Copy the counters one word at a time
+   netStatsCopy((uint32_t *) stats, (const volatile uint32_t *) &interface->stats,
+      sizeof(NetInterfaceStats));
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Copy a set of statistics counters
+ *
+ * Each 32-bit counter is read exactly once. Aligned 32-bit accesses
+ * are atomic, hence a counter can never be seen half updated
+ *
+ * @param[out] dest Destination buffer
+ * @param[in] src Counters to be copied
+ * @param[in] length Number of bytes to copy (multiple of 4)
+ **/
+
+void netStatsCopy(uint32_t *dest, const volatile uint32_t *src, size_t length)
+{
+   size_t i;
+
+   //Copy the counters one word at a time
+   for(i = 0; i < (length / sizeof(uint32_t)); i++)
+      dest[i] = src[i];
+}
+
+#endif
+
+
 /**
  * @brief Configure network interface
  * @param[in] interface Network interface to configure
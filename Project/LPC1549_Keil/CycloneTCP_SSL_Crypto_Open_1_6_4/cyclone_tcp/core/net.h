@@ -37,6 +37,7 @@ struct _NetInterface;
 #include "os_port.h"
 #include "net_config.h"
 #include "core/net_mem.h"
+#include "core/net_stats.h"
 #include "endian.h"
 #include "error.h"
 #include "core/nic.h"
@@ -186,7 +187,7 @@ struct _NetInterface;
 //TCP/IP stack tick interval
 #ifndef NET_TICK_INTERVAL
    #define NET_TICK_INTERVAL 100
-#elif (NET_TICK_INTERVAL < 100)
+#elif (NET_TICK_INTERVAL < 10)
    #error NET_TICK_INTERVAL parameter is not valid
 #endif
 
@@ -315,6 +316,10 @@ struct _NetInterface
 #if (MIB2_SUPPORT == ENABLED)
    Mib2IfEntry *mibIfEntry;
 #endif
+
+#if (NET_STATS_SUPPORT == ENABLED)
+   NetInterfaceStats stats;                             ///<Hot-path statistics counters
+#endif
 };
 
 
@@ -358,6 +363,7 @@ error_t netSetUartDriver(NetInterface *interface, const UartDriver *driver);
 error_t netSetExtIntDriver(NetInterface *interface, const ExtIntDriver *driver);
 
 bool_t netGetLinkState(NetInterface *interface);
+error_t netGetInterfaceStats(NetInterface *interface, NetInterfaceStats *stats);
 
 error_t netConfigInterface(NetInterface *interface);
 
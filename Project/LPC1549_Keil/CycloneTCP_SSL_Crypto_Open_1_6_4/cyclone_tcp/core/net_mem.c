@@ -48,17 +48,44 @@
 
 //Mutex preventing simultaneous access to the memory pool
 static OsMutex memPoolMutex;
-//Memory pool
+
+//Small buffers
+#if (NET_MEM_POOL_SMALL_BUFFER_COUNT > 0)
+static uint8_t memPoolSmall[NET_MEM_POOL_SMALL_BUFFER_COUNT][NET_MEM_POOL_SMALL_BUFFER_SIZE];
+static bool_t memPoolSmallAllocTable[NET_MEM_POOL_SMALL_BUFFER_COUNT];
+#endif
+
+//Medium buffers
+#if (NET_MEM_POOL_MEDIUM_BUFFER_COUNT > 0)
+static uint8_t memPoolMedium[NET_MEM_POOL_MEDIUM_BUFFER_COUNT][NET_MEM_POOL_MEDIUM_BUFFER_SIZE];
+static bool_t memPoolMediumAllocTable[NET_MEM_POOL_MEDIUM_BUFFER_COUNT];
+#endif
+
+//Full-size buffers
 static uint8_t memPool[NET_MEM_POOL_BUFFER_COUNT][NET_MEM_POOL_BUFFER_SIZE];
-//Allocation table
 static bool_t memPoolAllocTable[NET_MEM_POOL_BUFFER_COUNT];
-//Number of buffers currently allocated
-uint_t memPoolCurrentUsage;
-//Maximum number of buffers that have been allocated so far
-uint_t memPoolMaxUsage;
+
+//Size classes, sorted by ascending block size
+static MemPoolClass memPoolClass[NET_MEM_POOL_CLASS_COUNT];
+
+//Usage of the memory pool, all size classes combined
+static uint_t memPoolCurrentUsage;
+static uint_t memPoolMaxUsage;
+
+//Internal functions
+static void memPoolInitClass(MemPoolClass *cls, void *pool,
+   bool_t *allocTable, size_t blockSize, uint_t blockCount);
+
+static void memPoolLock(void);
+static void memPoolUnlock(void);
+static void *memPoolGetBlock(size_t size);
+static void memPoolPutBlock(void *p);
 
 #endif
 
+//Capacity of a memory block
+static size_t memPoolGetCapacity(const void *p, size_t size);
+
 
 /**
  * @brief Memory pool initialization
@@ -69,6 +96,8 @@ error_t memPoolInit(void)
 {
 //Use fixed-size blocks allocation?
 #if (NET_MEM_POOL_SUPPORT == ENABLED)
+   uint_t i;
+
    //Create a mutex to prevent simultaneous access to the memory pool
    if(!osCreateMutex(&memPoolMutex))
    {
@@ -76,12 +105,28 @@ error_t memPoolInit(void)
       return ERROR_OUT_OF_RESOURCES;
    }
 
-   //Clear allocation table
-   memset(memPoolAllocTable, 0, sizeof(memPoolAllocTable));
+   //Index of the first size class
+   i = 0;
 
    //Clear statistics
    memPoolCurrentUsage = 0;
    memPoolMaxUsage = 0;
+
+#if (NET_MEM_POOL_SMALL_BUFFER_COUNT > 0)
+   //Initialize the pool of small buffers
+   memPoolInitClass(&memPoolClass[i++], memPoolSmall, memPoolSmallAllocTable,
+      NET_MEM_POOL_SMALL_BUFFER_SIZE, NET_MEM_POOL_SMALL_BUFFER_COUNT);
+#endif
+
+#if (NET_MEM_POOL_MEDIUM_BUFFER_COUNT > 0)
+   //Initialize the pool of medium buffers
+   memPoolInitClass(&memPoolClass[i++], memPoolMedium, memPoolMediumAllocTable,
+      NET_MEM_POOL_MEDIUM_BUFFER_SIZE, NET_MEM_POOL_MEDIUM_BUFFER_COUNT);
+#endif
+
+   //Initialize the pool of full-size buffers
+   memPoolInitClass(&memPoolClass[i], memPool, memPoolAllocTable,
+      NET_MEM_POOL_BUFFER_SIZE, NET_MEM_POOL_BUFFER_COUNT);
 #endif
 
    //Successful initialization
@@ -97,12 +142,8 @@ error_t memPoolInit(void)
 
 void *memPoolAlloc(size_t size)
 {
-#if (NET_MEM_POOL_SUPPORT == ENABLED)
-   uint_t i;
-#endif
-
    //Pointer to the allocated memory block
-   void *p = NULL;
+   void *p;
 
    //Debug message
    TRACE_DEBUG("Allocating %" PRIuSIZE " bytes...\r\n", size);
@@ -110,35 +151,11 @@ void *memPoolAlloc(size_t size)
 //Use fixed-size blocks allocation?
 #if (NET_MEM_POOL_SUPPORT == ENABLED)
    //Acquire exclusive access to the memory pool
-   osAcquireMutex(&memPoolMutex);
-
-   //Enforce block size
-   if(size <= NET_MEM_POOL_BUFFER_SIZE)
-   {
-      //Loop through allocation table
-      for(i = 0; i < NET_MEM_POOL_BUFFER_COUNT; i++)
-      {
-         //Check whether the current block is free
-         if(!memPoolAllocTable[i])
-         {
-            //Mark the current entry as used
-            memPoolAllocTable[i] = TRUE;
-            //Point to the corresponding memory block
-            p = memPool[i];
-
-            //Update statistics
-            memPoolCurrentUsage++;
-            //Maximum number of buffers that have been allocated so far
-            memPoolMaxUsage = MAX(memPoolCurrentUsage, memPoolMaxUsage);
-
-            //Exit immediately
-            break;
-         }
-      }
-   }
-
+   memPoolLock();
+   //Pop a block from the free list
+   p = memPoolGetBlock(size);
    //Release exclusive access to the memory pool
-   osReleaseMutex(&memPoolMutex);
+   memPoolUnlock();
 #else
    //Allocate a memory block
    p = osAllocMem(size);
@@ -165,38 +182,311 @@ void memPoolFree(void *p)
 {
 //Use fixed-size blocks allocation?
 #if (NET_MEM_POOL_SUPPORT == ENABLED)
-   uint_t i;
+   //Acquire exclusive access to the memory pool
+   memPoolLock();
+   //Push the block back onto the free list
+   memPoolPutBlock(p);
+   //Release exclusive access to the memory pool
+   memPoolUnlock();
+#else
+   //Release memory block
+   osFreeMem(p);
+#endif
+}
+
+
+/**
+ * @brief Allocate a memory block from an interrupt service routine
+ *
+ * This function is only available when both NET_MEM_POOL_SUPPORT and
+ * NET_MEM_POOL_ISR_SUPPORT are enabled. NIC drivers may call it to
+ * refill their RX descriptors without going through the mutex
+ *
+ * @param[in] size Bytes to allocate
+ * @return Pointer to the allocated space or NULL if there is insufficient memory available
+ **/
+
+void *memPoolAllocFromIsr(size_t size)
+{
+#if (NET_MEM_POOL_SUPPORT == ENABLED && NET_MEM_POOL_ISR_SUPPORT == ENABLED)
+   void *p;
+
+   //Enter critical section
+   netMemEnterCriticalSection();
+   //Pop a block from the free list
+   p = memPoolGetBlock(size);
+   //Leave critical section
+   netMemLeaveCriticalSection();
+
+   //Return a pointer to the allocated memory block
+   return p;
+#else
+   //Not implemented
+   return NULL;
+#endif
+}
 
+
+/**
+ * @brief Release a memory block from an interrupt service routine
+ * @param[in] p Previously allocated memory block to be freed
+ **/
+
+void memPoolFreeFromIsr(void *p)
+{
+#if (NET_MEM_POOL_SUPPORT == ENABLED && NET_MEM_POOL_ISR_SUPPORT == ENABLED)
+   //Enter critical section
+   netMemEnterCriticalSection();
+   //Push the block back onto the free list
+   memPoolPutBlock(p);
+   //Leave critical section
+   netMemLeaveCriticalSection();
+#endif
+}
+
+
+//Use fixed-size blocks allocation?
+#if (NET_MEM_POOL_SUPPORT == ENABLED)
+
+/**
+ * @brief Acquire exclusive access to the memory pool
+ **/
+
+static void memPoolLock(void)
+{
+#if (NET_MEM_POOL_ISR_SUPPORT == ENABLED)
+   //The free list may also be accessed from interrupt context
+   netMemEnterCriticalSection();
+#else
    //Acquire exclusive access to the memory pool
    osAcquireMutex(&memPoolMutex);
+#endif
+}
+
+
+/**
+ * @brief Release exclusive access to the memory pool
+ **/
+
+static void memPoolUnlock(void)
+{
+#if (NET_MEM_POOL_ISR_SUPPORT == ENABLED)
+   //Leave critical section
+   netMemLeaveCriticalSection();
+#else
+   //Release exclusive access to the memory pool
+   osReleaseMutex(&memPoolMutex);
+#endif
+}
+
+
+/**
+ * @brief Initialize a size class
+ * @param[in] cls Size class to be initialized
+ * @param[in] pool Storage area
+ * @param[in] allocTable Allocation table
+ * @param[in] blockSize Size of each block
+ * @param[in] blockCount Number of blocks
+ **/
+
+static void memPoolInitClass(MemPoolClass *cls, void *pool,
+   bool_t *allocTable, size_t blockSize, uint_t blockCount)
+{
+   uint_t i;
+   uint8_t *p;
+
+   //Save parameters
+   cls->pool = pool;
+   cls->allocTable = allocTable;
+   cls->blockSize = blockSize;
+   cls->blockCount = blockCount;
+
+   //Clear allocation table
+   memset(allocTable, 0, blockCount * sizeof(bool_t));
 
-   //Loop through allocation table
-   for(i = 0; i < NET_MEM_POOL_BUFFER_COUNT; i++)
+   //Chain all the blocks together, lowest address first
+   for(i = 0, p = cls->pool; i < (blockCount - 1); i++, p += blockSize)
+      *((void **) p) = p + blockSize;
+
+   //Terminate the list
+   *((void **) p) = NULL;
+   //Point to the first free block
+   cls->freeList = cls->pool;
+
+   //Clear statistics
+   cls->currentUsage = 0;
+   cls->maxUsage = 0;
+}
+
+
+/**
+ * @brief Pop a block from the free list
+ *
+ * The smallest size class that can hold the requested number of bytes is
+ * tried first. Larger classes are used when it is exhausted. The caller is
+ * responsible for serializing access to the memory pool
+ *
+ * @param[in] size Bytes to allocate
+ * @return Pointer to the allocated block or NULL if the pool is exhausted
+ **/
+
+static void *memPoolGetBlock(size_t size)
+{
+   uint_t i;
+   uint_t j;
+   void *p;
+   MemPoolClass *cls;
+
+   //Loop through size classes
+   for(i = 0; i < NET_MEM_POOL_CLASS_COUNT; i++)
    {
-      if(memPool[i] == p)
-      {
-         //Mark the current block as free
-         memPoolAllocTable[i] = FALSE;
+      //Point to the current size class
+      cls = &memPoolClass[i];
+
+      //Enforce block size
+      if(size > cls->blockSize)
+         continue;
+
+      //Point to the first free block
+      p = cls->freeList;
+      //This size class is exhausted?
+      if(p == NULL)
+         continue;
+
+      //Unlink the block from the free list
+      cls->freeList = *((void **) p);
+
+      //Compute the index of the block
+      j = ((uint8_t *) p - cls->pool) / cls->blockSize;
+      //Mark the corresponding entry as used
+      cls->allocTable[j] = TRUE;
+
+      //Update statistics
+      cls->currentUsage++;
+      //Maximum number of blocks that have been allocated so far
+      cls->maxUsage = MAX(cls->currentUsage, cls->maxUsage);
+
+      //Update the statistics of the whole memory pool
+      memPoolCurrentUsage++;
+      memPoolMaxUsage = MAX(memPoolCurrentUsage, memPoolMaxUsage);
+
+      //Return a pointer to the allocated block
+      return p;
+   }
+
+   //The memory pool is exhausted
+   return NULL;
+}
+
+
+/**
+ * @brief Push a block back onto the free list
+ *
+ * The caller is responsible for serializing access to the memory pool
+ *
+ * @param[in] p Previously allocated memory block to be freed
+ **/
 
-         //Update statistics
-         memPoolCurrentUsage--;
+static void memPoolPutBlock(void *p)
+{
+   uint_t i;
+   uint_t j;
+   size_t offset;
+   MemPoolClass *cls;
 
-         //Exit immediately
+   //Loop through size classes
+   for(i = 0; i < NET_MEM_POOL_CLASS_COUNT; i++)
+   {
+      //Point to the current size class
+      cls = &memPoolClass[i];
+
+      //Check whether the pointer lies within the storage area of the class
+      if((uint8_t *) p >= cls->pool &&
+         (uint8_t *) p < (cls->pool + cls->blockCount * cls->blockSize))
+      {
          break;
       }
    }
 
-   //Release exclusive access to the memory pool
-   osReleaseMutex(&memPoolMutex);
-#else
-   //Release memory block
-   osFreeMem(p);
+   //The pointer does not belong to the memory pool?
+   if(i >= NET_MEM_POOL_CLASS_COUNT)
+      return;
+
+   //Offset of the block from the beginning of the storage area
+   offset = (uint8_t *) p - cls->pool;
+
+   //The pointer must match the start of a block
+   if((offset % cls->blockSize) != 0)
+      return;
+
+   //The block index is deduced from its address
+   j = offset / cls->blockSize;
+
+   //Discard blocks that are not currently allocated
+   if(!cls->allocTable[j])
+      return;
+
+   //Mark the current block as free
+   cls->allocTable[j] = FALSE;
+
+   //Insert the block at the head of the free list
+   *((void **) p) = cls->freeList;
+   cls->freeList = p;
+
+   //Update statistics
+   cls->currentUsage--;
+   memPoolCurrentUsage--;
+}
+
+#endif
+
+
+/**
+ * @brief Get the capacity of an allocated memory block
+ *
+ * A request may be served by a block larger than the number of bytes asked
+ * for, either because of the granularity of the size classes or because
+ * the smallest suitable class was exhausted
+ *
+ * @param[in] p Memory block returned by memPoolAlloc()
+ * @param[in] size Number of bytes that were requested
+ * @return Number of bytes that can actually be used
+ **/
+
+static size_t memPoolGetCapacity(const void *p, size_t size)
+{
+//Use fixed-size blocks allocation?
+#if (NET_MEM_POOL_SUPPORT == ENABLED)
+   uint_t i;
+   MemPoolClass *cls;
+
+   //Loop through size classes
+   for(i = 0; i < NET_MEM_POOL_CLASS_COUNT; i++)
+   {
+      //Point to the current size class
+      cls = &memPoolClass[i];
+
+      //Check whether the pointer lies within the storage area of the class
+      if((const uint8_t *) p >= cls->pool &&
+         (const uint8_t *) p < (cls->pool + cls->blockCount * cls->blockSize))
+      {
+         //Return the size of the blocks of this class
+         return cls->blockSize;
+      }
+   }
 #endif
+
+   //The block is exactly the size that was requested
+   return size;
 }
 
 
 /**
  * @brief Get memory pool usage
+ *
+ * The figures cover all size classes. Use memPoolGetClassStats() to
+ * retrieve the usage of the small, medium and full-size buffers separately
+ *
  * @param[out] currentUsage Number of buffers currently allocated
  * @param[out] maxUsage Maximum number of buffers that have been allocated so far
  * @param[out] size Total number of buffers in the memory pool
@@ -206,6 +496,8 @@ void memPoolGetStats(uint_t *currentUsage, uint_t *maxUsage, uint_t *size)
 {
 //Use fixed-size blocks allocation?
 #if (NET_MEM_POOL_SUPPORT == ENABLED)
+   uint_t i;
+
    //Number of buffers currently allocated
    if(currentUsage != NULL)
       *currentUsage = memPoolCurrentUsage;
@@ -216,7 +508,11 @@ void memPoolGetStats(uint_t *currentUsage, uint_t *maxUsage, uint_t *size)
 
    //Total number of buffers in the memory pool
    if(size != NULL)
-      *size = NET_MEM_POOL_BUFFER_COUNT;
+   {
+      //Sum the number of blocks of each size class
+      for(*size = 0, i = 0; i < NET_MEM_POOL_CLASS_COUNT; i++)
+         *size += memPoolClass[i].blockCount;
+   }
 #else
    //Memory pool is not used...
    if(currentUsage != NULL)
@@ -231,6 +527,55 @@ void memPoolGetStats(uint_t *currentUsage, uint_t *maxUsage, uint_t *size)
 }
 
 
+/**
+ * @brief Get the usage of a given size class
+ * @param[in] index Zero-based index of the size class (smallest blocks first)
+ * @param[out] blockSize Size of the blocks belonging to the class
+ * @param[out] currentUsage Number of blocks currently allocated
+ * @param[out] maxUsage Maximum number of blocks that have been allocated so far
+ * @param[out] size Total number of blocks in the size class
+ * @return Error code
+ **/
+
+error_t memPoolGetClassStats(uint_t index, size_t *blockSize,
+   uint_t *currentUsage, uint_t *maxUsage, uint_t *size)
+{
+//Use fixed-size blocks allocation?
+#if (NET_MEM_POOL_SUPPORT == ENABLED)
+   MemPoolClass *cls;
+
+   //Check the index of the size class
+   if(index >= NET_MEM_POOL_CLASS_COUNT)
+      return ERROR_INVALID_PARAMETER;
+
+   //Point to the size class
+   cls = &memPoolClass[index];
+
+   //Size of the blocks
+   if(blockSize != NULL)
+      *blockSize = cls->blockSize;
+
+   //Number of blocks currently allocated
+   if(currentUsage != NULL)
+      *currentUsage = cls->currentUsage;
+
+   //Maximum number of blocks that have been allocated so far
+   if(maxUsage != NULL)
+      *maxUsage = cls->maxUsage;
+
+   //Total number of blocks in the size class
+   if(size != NULL)
+      *size = cls->blockCount;
+
+   //Successful processing
+   return NO_ERROR;
+#else
+   //Memory pool is not used...
+   return ERROR_INVALID_PARAMETER;
+#endif
+}
+
+
 /**
  * @brief Allocate a multi-part buffer
  * @param[in] length Desired length
@@ -241,10 +586,15 @@ void memPoolGetStats(uint_t *currentUsage, uint_t *maxUsage, uint_t *size)
 NetBuffer *netBufferAlloc(size_t length)
 {
    error_t error;
+   size_t n;
    NetBuffer *buffer;
 
+   //The header and the first chunk share the same block, hence small
+   //packets are served by the smallest size class that can hold both
+   n = MIN(CHUNKED_BUFFER_HEADER_SIZE + length, NET_MEM_POOL_BUFFER_SIZE);
+
    //Allocate memory to hold the multi-part buffer
-   buffer = memPoolAlloc(NET_MEM_POOL_BUFFER_SIZE);
+   buffer = memPoolAlloc(n);
    //Failed to allocate memory?
    if(!buffer) return NULL;
 
@@ -252,7 +602,7 @@ NetBuffer *netBufferAlloc(size_t length)
    buffer->chunkCount = 1;
    buffer->maxChunkCount = MAX_CHUNK_COUNT;
    buffer->chunk[0].address = (uint8_t *) buffer + CHUNKED_BUFFER_HEADER_SIZE;
-   buffer->chunk[0].length = NET_MEM_POOL_BUFFER_SIZE - CHUNKED_BUFFER_HEADER_SIZE;
+   buffer->chunk[0].length = memPoolGetCapacity(buffer, n) - CHUNKED_BUFFER_HEADER_SIZE;
    buffer->chunk[0].size = 0;
 
    //Adjust the length of the buffer
@@ -317,6 +667,7 @@ size_t netBufferGetLength(const NetBuffer *buffer)
 error_t netBufferSetLength(NetBuffer *buffer, size_t length)
 {
    uint_t i;
+   size_t n;
    uint_t chunkCount;
    ChunkDesc *chunk;
 
@@ -377,15 +728,23 @@ error_t netBufferSetLength(NetBuffer *buffer, size_t length)
          //Point to the chunk descriptor;
          chunk = &buffer->chunk[i];
 
+         //The last chunk may be sized to the remaining data. This is only
+         //done once per buffer, so that a buffer which keeps growing (IP
+         //reassembly for instance) does not end up with many small chunks
+         if(i == 0 || buffer->chunk[i - 1].size == 0)
+            n = MIN(length, NET_MEM_POOL_BUFFER_SIZE);
+         else
+            n = NET_MEM_POOL_BUFFER_SIZE;
+
          //Allocate memory to hold a new chunk
-         chunk->address = memPoolAlloc(NET_MEM_POOL_BUFFER_SIZE);
+         chunk->address = memPoolAlloc(n);
          //Failed to allocate memory?
          if(!chunk->address) return ERROR_OUT_OF_MEMORY;
 
-         //Allocated memory
-         chunk->size = NET_MEM_POOL_BUFFER_SIZE;
+         //The block may be larger than requested
+         chunk->size = memPoolGetCapacity(chunk->address, n);
          //Actual length of the data chunk
-         chunk->length = MIN(length, NET_MEM_POOL_BUFFER_SIZE);
+         chunk->length = MIN(length, chunk->size);
 
          //Prepare to process next chunk
          length -= chunk->length;
@@ -487,6 +846,61 @@ error_t netBufferConcat(NetBuffer *dest,
 }
 
 
+/**
+ * @brief Get a scatter-gather view of a multi-part buffer
+ * @param[in] buffer Pointer to the multi-part buffer
+ * @param[in] offset Offset to the first data byte
+ * @param[in] length Number of data bytes to describe
+ * @param[out] chunk Array where to store the chunk descriptors
+ * @param[in] maxChunkCount Number of entries in the array
+ * @param[out] chunkCount Number of chunk descriptors that have been filled
+ * @return Number of data bytes covered by the chunk descriptors
+ **/
+
+size_t netBufferGetChunks(const NetBuffer *buffer, size_t offset, size_t length,
+   ChunkDesc *chunk, uint_t maxChunkCount, uint_t *chunkCount)
+{
+   uint_t i;
+   uint_t j;
+   size_t n;
+
+   //Skip the beginning of the data
+   for(j = 0; j < buffer->chunkCount; j++)
+   {
+      //The data at the specified offset resides in the current chunk?
+      if(offset < buffer->chunk[j].length)
+         break;
+
+      //Jump to the next chunk
+      offset -= buffer->chunk[j].length;
+   }
+
+   //Total number of bytes described so far
+   n = 0;
+
+   //Describe data blocks
+   for(i = 0; length > 0 && i < maxChunkCount && j < buffer->chunkCount; i++, j++)
+   {
+      //Point to the data in place
+      chunk[i].address = (uint8_t *) buffer->chunk[j].address + offset;
+      chunk[i].length = MIN(length, buffer->chunk[j].length - offset);
+      //The memory is not owned by the recipient
+      chunk[i].size = 0;
+
+      //Decrement the number of remaining bytes
+      length -= chunk[i].length;
+      n += chunk[i].length;
+      //Next chunks are described from their beginning
+      offset = 0;
+   }
+
+   //Number of chunk descriptors
+   *chunkCount = i;
+   //Return the number of bytes described
+   return n;
+}
+
+
 /**
  * @brief Copy data between multi-part buffers
  * @param[out] dest Pointer to the destination buffer
@@ -71,6 +71,75 @@
    #error NET_MEM_POOL_BUFFER_SIZE parameter is not valid
 #endif
 
+//Number of small buffers (0 disables the size class)
+#ifndef NET_MEM_POOL_SMALL_BUFFER_COUNT
+   #define NET_MEM_POOL_SMALL_BUFFER_COUNT 0
+#elif (NET_MEM_POOL_SMALL_BUFFER_COUNT < 0)
+   #error NET_MEM_POOL_SMALL_BUFFER_COUNT parameter is not valid
+#endif
+
+//Size of the small buffers. A multi-part buffer holds its header
+//(CHUNKED_BUFFER_HEADER_SIZE bytes) and its first chunk in the same block,
+//so the default size leaves room for the header of a pure TCP segment
+//(ACK, SYN, FIN or RST) together with the lower-layer headers
+#ifndef NET_MEM_POOL_SMALL_BUFFER_SIZE
+   #define NET_MEM_POOL_SMALL_BUFFER_SIZE 256
+#elif (NET_MEM_POOL_SMALL_BUFFER_SIZE < 32 || (NET_MEM_POOL_SMALL_BUFFER_SIZE % 4) != 0)
+   #error NET_MEM_POOL_SMALL_BUFFER_SIZE parameter is not valid
+#endif
+
+//Number of medium buffers (0 disables the size class)
+#ifndef NET_MEM_POOL_MEDIUM_BUFFER_COUNT
+   #define NET_MEM_POOL_MEDIUM_BUFFER_COUNT 0
+#elif (NET_MEM_POOL_MEDIUM_BUFFER_COUNT < 0)
+   #error NET_MEM_POOL_MEDIUM_BUFFER_COUNT parameter is not valid
+#endif
+
+//Size of the medium buffers
+#ifndef NET_MEM_POOL_MEDIUM_BUFFER_SIZE
+   #define NET_MEM_POOL_MEDIUM_BUFFER_SIZE 768
+#elif (NET_MEM_POOL_MEDIUM_BUFFER_SIZE < 32 || (NET_MEM_POOL_MEDIUM_BUFFER_SIZE % 4) != 0)
+   #error NET_MEM_POOL_MEDIUM_BUFFER_SIZE parameter is not valid
+#endif
+
+//Size classes must be sorted in ascending order
+#if (NET_MEM_POOL_SMALL_BUFFER_COUNT > 0 && NET_MEM_POOL_MEDIUM_BUFFER_COUNT > 0)
+   #if (NET_MEM_POOL_SMALL_BUFFER_SIZE >= NET_MEM_POOL_MEDIUM_BUFFER_SIZE)
+      #error NET_MEM_POOL_SMALL_BUFFER_SIZE must be lower than NET_MEM_POOL_MEDIUM_BUFFER_SIZE
+   #endif
+#endif
+
+#if (NET_MEM_POOL_SMALL_BUFFER_COUNT > 0)
+   #if (NET_MEM_POOL_SMALL_BUFFER_SIZE >= NET_MEM_POOL_BUFFER_SIZE)
+      #error NET_MEM_POOL_SMALL_BUFFER_SIZE must be lower than NET_MEM_POOL_BUFFER_SIZE
+   #endif
+#endif
+
+#if (NET_MEM_POOL_MEDIUM_BUFFER_COUNT > 0)
+   #if (NET_MEM_POOL_MEDIUM_BUFFER_SIZE >= NET_MEM_POOL_BUFFER_SIZE)
+      #error NET_MEM_POOL_MEDIUM_BUFFER_SIZE must be lower than NET_MEM_POOL_BUFFER_SIZE
+   #endif
+#endif
+
+//Number of size classes (small, medium and full-size buffers)
+#define NET_MEM_POOL_CLASS_COUNT (1 + (NET_MEM_POOL_SMALL_BUFFER_COUNT > 0) + \
+   (NET_MEM_POOL_MEDIUM_BUFFER_COUNT > 0))
+
+//Allow memory blocks to be allocated and released from interrupt context?
+#ifndef NET_MEM_POOL_ISR_SUPPORT
+   #define NET_MEM_POOL_ISR_SUPPORT DISABLED
+#elif (NET_MEM_POOL_ISR_SUPPORT != ENABLED && NET_MEM_POOL_ISR_SUPPORT != DISABLED)
+   #error NET_MEM_POOL_ISR_SUPPORT parameter is not valid
+#endif
+
+//The free list is then protected by a short critical section (typically
+//__disable_irq() and __enable_irq() on Cortex-M) instead of a mutex
+#if (NET_MEM_POOL_SUPPORT == ENABLED && NET_MEM_POOL_ISR_SUPPORT == ENABLED)
+   #if !defined(netMemEnterCriticalSection) || !defined(netMemLeaveCriticalSection)
+      #error netMemEnterCriticalSection and netMemLeaveCriticalSection must be defined
+   #endif
+#endif
+
 //Size of the header part of the buffer
 #define CHUNKED_BUFFER_HEADER_SIZE (sizeof(NetBuffer) + MAX_CHUNK_COUNT * sizeof(ChunkDesc))
 
@@ -90,6 +159,22 @@ typedef struct
 } ChunkDesc;
 
 
+/**
+ * @brief Fixed-size blocks belonging to a given size class
+ **/
+
+typedef struct
+{
+   size_t blockSize;    ///<Size of each block
+   uint_t blockCount;   ///<Number of blocks in the pool
+   uint8_t *pool;       ///<Storage area
+   bool_t *allocTable;  ///<Allocation table
+   void *freeList;      ///<List of free blocks
+   uint_t currentUsage; ///<Number of blocks currently allocated
+   uint_t maxUsage;     ///<Maximum number of blocks that have been allocated so far
+} MemPoolClass;
+
+
 /**
  * @brief Structure describing a buffer that spans multiple chunks
  **/
@@ -114,8 +199,13 @@ typedef struct
 error_t memPoolInit(void);
 void *memPoolAlloc(size_t size);
 void memPoolFree(void *p);
+void *memPoolAllocFromIsr(size_t size);
+void memPoolFreeFromIsr(void *p);
 void memPoolGetStats(uint_t *currentUsage, uint_t *maxUsage, uint_t *size);
 
+error_t memPoolGetClassStats(uint_t index, size_t *blockSize,
+   uint_t *currentUsage, uint_t *maxUsage, uint_t *size);
+
 NetBuffer *netBufferAlloc(size_t length);
 void netBufferFree(NetBuffer *buffer);
 
@@ -127,6 +217,9 @@ void *netBufferAt(const NetBuffer *buffer, size_t offset);
 error_t netBufferConcat(NetBuffer *dest,
    const NetBuffer *src, size_t srcOffset, size_t length);
 
+size_t netBufferGetChunks(const NetBuffer *buffer, size_t offset, size_t length,
+   ChunkDesc *chunk, uint_t maxChunkCount, uint_t *chunkCount);
+
 error_t netBufferCopy(NetBuffer *dest, size_t destOffset,
    const NetBuffer *src, size_t srcOffset, size_t length);
 
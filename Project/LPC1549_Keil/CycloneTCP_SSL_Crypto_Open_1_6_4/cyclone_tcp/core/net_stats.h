@@ -0,0 +1,144 @@
+/**
+ * @file net_stats.h
+ * @brief Hot-path statistics counters
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * Every counter is a naturally aligned 32-bit word that is only ever written
+ * by a single context at a time (the TCP/IP stack task, a task holding
+ * the socket mutex or the NIC driver mutex, or the task that owns a UDP
+ * socket), so a plain increment behaves as
+ * a relaxed atomic increment. Snapshots read each word exactly once, without
+ * taking any lock, and hence never stall the traffic. Each counter is
+ * consistent on its own, but a snapshot is not an atomic view of the whole
+ * set of counters
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+#ifndef _NET_STATS_H
+#define _NET_STATS_H
+
+//Dependencies
+#include "net_config.h"
+#include "os_port.h"
+#include "error.h"
+
+//Statistics support
+#ifndef NET_STATS_SUPPORT
+   #define NET_STATS_SUPPORT DISABLED
+#elif (NET_STATS_SUPPORT != ENABLED && NET_STATS_SUPPORT != DISABLED)
+   #error NET_STATS_SUPPORT parameter is not valid
+#endif
+
+//Increment a statistics counter
+#if (NET_STATS_SUPPORT == ENABLED)
+   #define NET_STATS_INC_COUNTER(name, value) ((name) += (value))
+#else
+   #define NET_STATS_INC_COUNTER(name, value) ((void) 0)
+#endif
+
+
+/**
+ * @brief Per-interface statistics
+ *
+ * All the fields are 32-bit counters. New fields must be appended
+ * at the end of the structure, since the SNMP exporter maps each
+ * column of the interface table to the field with the same rank
+ **/
+
+typedef struct
+{
+   uint32_t rxPackets;           ///<Frames received by the NIC driver
+   uint32_t rxBytes;             ///<Bytes received by the NIC driver
+   uint32_t txPackets;           ///<Frames successfully handed to the NIC driver
+   uint32_t txBytes;             ///<Bytes successfully handed to the NIC driver
+   uint32_t txErrors;            ///<Frames that could not be sent
+   uint32_t ipv4InPackets;       ///<IPv4 packets received
+   uint32_t ipv4InHdrErrors;     ///<IPv4 packets discarded because of a malformed header
+   uint32_t ipv4InAddrErrors;    ///<IPv4 packets discarded by address filtering
+   uint32_t ipv4InUnknownProtos; ///<IPv4 datagrams carrying an unsupported protocol
+   uint32_t tcpInSegments;       ///<TCP segments received
+   uint32_t tcpInErrors;         ///<TCP segments discarded because of a malformed header or a bad checksum
+   uint32_t tcpNoSocket;         ///<TCP segments that did not match any socket
+   uint32_t udpInDatagrams;      ///<UDP datagrams received
+   uint32_t udpInErrors;         ///<UDP datagrams discarded because of a malformed header or a bad checksum
+   uint32_t udpNoPorts;          ///<UDP datagrams that did not match any socket
+} NetInterfaceStats;
+
+
+/**
+ * @brief Per-socket statistics
+ **/
+
+typedef struct
+{
+   uint32_t txPackets;           ///<Segments or datagrams sent
+   uint32_t txBytes;             ///<Data bytes sent, including retransmissions
+   uint32_t rxPackets;           ///<Segments or datagrams received
+   uint32_t rxBytes;             ///<Data bytes received
+   uint32_t retransmits;         ///<Segments retransmitted
+   uint32_t timeouts;            ///<Retransmission timer expirations
+   uint32_t fastRetransmits;     ///<Loss recovery episodes triggered by duplicate ACKs
+   uint32_t dupAcks;             ///<Duplicate ACKs received
+   uint32_t outOfOrderSegments;  ///<Segments received out of order
+   uint32_t droppedSegments;     ///<Segments or datagrams discarded by the socket
+   uint32_t rxBufferFull;        ///<Incoming data that did not fit in the receive buffer
+   uint32_t txBufferFull;        ///<Send calls that had to wait for room in the send buffer
+} SocketStats;
+
+
+/**
+ * @brief Snapshot of the statistics of a socket
+ *
+ * All the fields are 32-bit words. New fields must be appended
+ * at the end of the structure, since the SNMP exporter maps each
+ * column of the socket table to the field with the same rank
+ **/
+
+typedef struct
+{
+   uint32_t type;                ///<Socket type
+   uint32_t protocol;            ///<Protocol
+   uint32_t localPort;           ///<Local port number
+   uint32_t remotePort;          ///<Remote port number
+   uint32_t state;               ///<State of the connection (TCP)
+   uint32_t srtt;                ///<Smoothed round-trip time, in ms (TCP)
+   uint32_t rttvar;              ///<Round-trip time variation, in ms (TCP)
+   uint32_t rto;                 ///<Retransmission timeout, in ms (TCP)
+   uint32_t cwnd;                ///<Congestion window (TCP)
+   uint32_t ssthresh;            ///<Slow start threshold (TCP)
+   uint32_t sndWnd;              ///<Send window (TCP)
+   uint32_t rcvWnd;              ///<Receive window (TCP)
+   uint32_t bytesInFlight;       ///<Data sent but not yet acknowledged (TCP)
+   uint32_t rxQueued;            ///<Data waiting to be read by the application (TCP)
+   uint32_t outOfOrderBlocks;    ///<Non-contiguous blocks held in the receive buffer (TCP)
+   SocketStats counters;         ///<Hot-path counters
+} SocketStatsSnapshot;
+
+
+//Statistics related functions
+void netStatsCopy(uint32_t *dest, const volatile uint32_t *src, size_t length);
+
+#endif
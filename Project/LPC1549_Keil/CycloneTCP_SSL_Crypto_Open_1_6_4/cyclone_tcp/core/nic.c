@@ -146,6 +146,17 @@ error_t nicSendPacket(NetInterface *interface, const NetBuffer *buffer, size_t o
       //Send Ethernet frame
       error = interface->nicDriver->sendPacket(interface, buffer, offset);
 
+      //Update statistics
+      if(!error)
+      {
+         NET_STATS_INC_COUNTER(interface->stats.txPackets, 1);
+         NET_STATS_INC_COUNTER(interface->stats.txBytes, netBufferGetLength(buffer) - offset);
+      }
+      else
+      {
+         NET_STATS_INC_COUNTER(interface->stats.txErrors, 1);
+      }
+
       //Re-enable interrupts if necessary
       if(interface->configured)
          interface->nicDriver->enableIrq(interface);
@@ -155,6 +166,8 @@ error_t nicSendPacket(NetInterface *interface, const NetBuffer *buffer, size_t o
    }
    else
    {
+      //Update statistics
+      NET_STATS_INC_COUNTER(interface->stats.txErrors, 1);
       //The transmitter is busy...
       return ERROR_FAILURE;
    }
@@ -182,6 +195,10 @@ void nicProcessPacket(NetInterface *interface, void *packet, size_t length)
    //Release exclusive access to the device
    osReleaseMutex(&interface->nicDriverMutex);
 
+   //Update statistics
+   NET_STATS_INC_COUNTER(interface->stats.rxPackets, 1);
+   NET_STATS_INC_COUNTER(interface->stats.rxBytes, length);
+
    //Debug message
    TRACE_DEBUG("Packet received (%" PRIuSIZE " bytes)...\r\n", length);
    TRACE_DEBUG_ARRAY("  ", packet, length);
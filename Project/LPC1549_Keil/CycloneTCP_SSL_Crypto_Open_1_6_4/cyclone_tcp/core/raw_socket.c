@@ -59,6 +59,7 @@ error_t rawSocketProcessIpPacket(NetInterface *interface,
    IpPseudoHeader *pseudoHeader, const NetBuffer *buffer, size_t offset)
 {
    uint_t i;
+   uint_t protocol;
    size_t length;
    Socket *socket;
    SocketQueueItem *queueItem;
@@ -67,9 +68,53 @@ error_t rawSocketProcessIpPacket(NetInterface *interface,
    //Retrieve the length of the raw IP packet
    length = netBufferGetLength(buffer) - offset;
 
+#if (IPV4_SUPPORT == ENABLED)
+   //An IPv4 packet was received?
+   if(pseudoHeader->length == sizeof(Ipv4PseudoHeader))
+   {
+      //Retrieve the protocol field
+      protocol = pseudoHeader->ipv4Data.protocol;
+   }
+   else
+#endif
+#if (IPV6_SUPPORT == ENABLED)
+   //An IPv6 packet was received?
+   if(pseudoHeader->length == sizeof(Ipv6PseudoHeader))
+   {
+      //Retrieve the next header field
+      protocol = pseudoHeader->ipv6Data.nextHeader;
+   }
+   else
+#endif
+   //An invalid packet was received?
+   {
+      //This should never occur...
+      return ERROR_INVALID_PARAMETER;
+   }
+
    //Enter critical section
    osAcquireMutex(&socketMutex);
 
+#if (SOCKET_HASH_SUPPORT == ENABLED)
+   //Point to the bucket that holds the sockets bound to this protocol
+   socket = socketRawHashTable[socketHashPort(protocol)];
+
+   //Loop through the sockets in the bucket
+   while(socket != NULL)
+   {
+      //Check socket type, protocol and IP addresses
+      if(socket->type == SOCKET_TYPE_RAW_IP &&
+         socket->protocol == protocol &&
+         socketMatchAddr(socket, interface, pseudoHeader))
+      {
+         //The current socket meets all the criteria
+         break;
+      }
+
+      //Next socket in the same bucket
+      socket = socket->hashNext;
+   }
+#else
    //Loop through opened sockets
    for(i = 0; i < SOCKET_MAX_COUNT; i++)
    {
@@ -79,82 +124,24 @@ error_t rawSocketProcessIpPacket(NetInterface *interface,
       //Raw socket found?
       if(socket->type != SOCKET_TYPE_RAW_IP)
          continue;
-      //Check whether the socket is bound to a particular interface
-      if(socket->interface && socket->interface != interface)
+      //Check protocol field
+      if(socket->protocol != protocol)
          continue;
-
-#if (IPV4_SUPPORT == ENABLED)
-      //An IPv4 packet was received?
-      if(pseudoHeader->length == sizeof(Ipv4PseudoHeader))
-      {
-         //Check protocol field
-         if(socket->protocol != pseudoHeader->ipv4Data.protocol)
-            continue;
-         //Destination IP address filtering
-         if(socket->localIpAddr.length)
-         {
-            //An IPv4 address is expected
-            if(socket->localIpAddr.length != sizeof(Ipv4Addr))
-               continue;
-            //Filter out non-matching addresses
-            if(socket->localIpAddr.ipv4Addr != pseudoHeader->ipv4Data.destAddr)
-               continue;
-         }
-         //Source IP address filtering
-         if(socket->remoteIpAddr.length)
-         {
-            //An IPv4 address is expected
-            if(socket->remoteIpAddr.length != sizeof(Ipv4Addr))
-               continue;
-            //Filter out non-matching addresses
-            if(socket->remoteIpAddr.ipv4Addr != pseudoHeader->ipv4Data.srcAddr)
-               continue;
-         }
-      }
-      else
-#endif
-#if (IPV6_SUPPORT == ENABLED)
-      //An IPv6 packet was received?
-      if(pseudoHeader->length == sizeof(Ipv6PseudoHeader))
-      {
-         //Check protocol field
-         if(socket->protocol != pseudoHeader->ipv6Data.nextHeader)
-            continue;
-         //Destination IP address filtering
-         if(socket->localIpAddr.length)
-         {
-            //An IPv6 address is expected
-            if(socket->localIpAddr.length != sizeof(Ipv6Addr))
-               continue;
-            //Filter out non-matching addresses
-            if(!ipv6CompAddr(&socket->localIpAddr.ipv6Addr, &pseudoHeader->ipv6Data.destAddr))
-               continue;
-         }
-         //Source IP address filtering
-         if(socket->remoteIpAddr.length)
-         {
-            //An IPv6 address is expected
-            if(socket->remoteIpAddr.length != sizeof(Ipv6Addr))
-               continue;
-            //Filter out non-matching addresses
-            if(!ipv6CompAddr(&socket->remoteIpAddr.ipv6Addr, &pseudoHeader->ipv6Data.srcAddr))
-               continue;
-         }
-      }
-      else
-#endif
-      //An invalid packet was received?
-      {
-         //This should never occur...
+      //Check interface and IP addresses
+      if(!socketMatchAddr(socket, interface, pseudoHeader))
          continue;
-      }
 
       //The current socket meets all the criteria
       break;
    }
 
-   //Drop incoming packet if no matching socket was found
+   //No matching socket found?
    if(i >= SOCKET_MAX_COUNT)
+      socket = NULL;
+#endif
+
+   //Drop incoming packet if no matching socket was found
+   if(socket == NULL)
    {
       //Leave critical section
       osReleaseMutex(&socketMutex);
@@ -285,12 +272,61 @@ void rawSocketProcessEthPacket(NetInterface *interface,
 {
    uint_t i;
    Socket *socket;
+#if (SOCKET_HASH_SUPPORT == ENABLED)
+   Socket *allSocket;
+#endif
    SocketQueueItem *queueItem;
    NetBuffer *p;
 
    //Enter critical section
    osAcquireMutex(&socketMutex);
 
+#if (SOCKET_HASH_SUPPORT == ENABLED)
+   //Sockets bound to this particular Ethernet type
+   socket = socketRawHashTable[socketHashPort(ntohs(ethFrame->type))];
+
+   //Loop through the sockets in the bucket
+   while(socket != NULL)
+   {
+      //Check socket type, protocol and interface
+      if(socket->type == SOCKET_TYPE_RAW_ETH &&
+         socket->protocol == ntohs(ethFrame->type) &&
+         (!socket->interface || socket->interface == interface))
+      {
+         //The current socket meets all the criteria
+         break;
+      }
+
+      //Next socket in the same bucket
+      socket = socket->hashNext;
+   }
+
+   //Sockets that receive all Ethernet frames
+   allSocket = socketRawHashTable[socketHashPort(SOCKET_ETH_PROTO_ALL)];
+
+   //Loop through the sockets in the bucket
+   while(allSocket != NULL)
+   {
+      //Check socket type, protocol and interface
+      if(allSocket->type == SOCKET_TYPE_RAW_ETH &&
+         allSocket->protocol == SOCKET_ETH_PROTO_ALL &&
+         (!allSocket->interface || allSocket->interface == interface))
+      {
+         //The current socket meets all the criteria
+         break;
+      }
+
+      //Next socket in the same bucket
+      allSocket = allSocket->hashNext;
+   }
+
+   //Select the socket that comes first in the socket table
+   if(socket == NULL || (allSocket != NULL &&
+      allSocket->descriptor < socket->descriptor))
+   {
+      socket = allSocket;
+   }
+#else
    //Loop through opened sockets
    for(i = 0; i < SOCKET_MAX_COUNT; i++)
    {
@@ -311,8 +347,13 @@ void rawSocketProcessEthPacket(NetInterface *interface,
       break;
    }
 
-   //Drop incoming packet if no matching socket was found
+   //No matching socket found?
    if(i >= SOCKET_MAX_COUNT)
+      socket = NULL;
+#endif
+
+   //Drop incoming packet if no matching socket was found
+   if(socket == NULL)
    {
       //Leave critical section
       osReleaseMutex(&socketMutex);
@@ -37,6 +37,7 @@
 #include "core/udp.h"
 #include "core/tcp.h"
 #include "core/tcp_misc.h"
+#include "core/tcp_timer.h"
 #include "dns/dns_client.h"
 #include "mdns/mdns_client.h"
 #include "netbios/nbns_client.h"
@@ -47,6 +48,15 @@ OsMutex socketMutex;
 //Socket table
 Socket socketTable[SOCKET_MAX_COUNT];
 
+#if (SOCKET_HASH_SUPPORT == ENABLED)
+//TCP connections, indexed by local port and remote endpoint
+Socket *socketConnHashTable[SOCKET_HASH_TABLE_SIZE];
+//Listening TCP sockets and UDP sockets, indexed by local port
+Socket *socketPortHashTable[SOCKET_HASH_TABLE_SIZE];
+//Raw sockets, indexed by protocol
+Socket *socketRawHashTable[SOCKET_HASH_TABLE_SIZE];
+#endif
+
 
 /**
  * @brief Socket related initialization
@@ -68,6 +78,13 @@ error_t socketInit(void)
    //Initialize socket related data
    memset(socketTable, 0, sizeof(socketTable));
 
+#if (SOCKET_HASH_SUPPORT == ENABLED)
+   //All the hash buckets are empty
+   memset(socketConnHashTable, 0, sizeof(socketConnHashTable));
+   memset(socketPortHashTable, 0, sizeof(socketPortHashTable));
+   memset(socketRawHashTable, 0, sizeof(socketRawHashTable));
+#endif
+
    //Loop through socket descriptors
    for(i = 0; i < SOCKET_MAX_COUNT; i++)
    {
@@ -186,6 +203,17 @@ Socket *socketOpen(uint_t type, uint_t protocol)
       //Check whether the current entry is free
       if(socket != NULL)
       {
+#if (SOCKET_HASH_SUPPORT == ENABLED)
+         //Make sure the entry is no longer referenced by the hash tables
+         socketHashRemove(socket);
+#endif
+
+#if (TCP_SUPPORT == ENABLED)
+         //The timers must be removed from the timing wheel before the
+         //structure is cleared
+         tcpStopTimers(socket);
+#endif
+
          //Save socket descriptor
          i = socket->descriptor;
          //Save event object instance
@@ -207,6 +235,11 @@ Socket *socketOpen(uint_t type, uint_t protocol)
          socket->txBufferSize = MIN(TCP_DEFAULT_TX_BUFFER_SIZE, TCP_MAX_TX_BUFFER_SIZE);
          socket->rxBufferSize = MIN(TCP_DEFAULT_RX_BUFFER_SIZE, TCP_MAX_RX_BUFFER_SIZE);
 #endif
+
+#if (SOCKET_HASH_SUPPORT == ENABLED)
+         //UDP and raw sockets can receive packets right away
+         socketHashUpdate(socket);
+#endif
       }
    }
 
@@ -307,6 +340,40 @@ error_t socketSetRxBufferSize(Socket *socket, size_t size)
 }
 
 
+/**
+ * @brief Select the congestion control algorithm
+ * @param[in] socket Handle to a socket
+ * @param[in] algo Congestion control algorithm (TCP_NEWRENO_ALGO or TCP_CUBIC_ALGO)
+ * @return Error code
+ **/
+
+error_t socketSetCongestionControl(Socket *socket, const TcpCongestAlgo *algo)
+{
+#if (TCP_SUPPORT == ENABLED && TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
+   //Make sure the socket handle is valid
+   if(!socket)
+      return ERROR_INVALID_PARAMETER;
+   //Check parameter value
+   if(!algo)
+      return ERROR_INVALID_PARAMETER;
+
+   //This function shall be used with connection-oriented socket types
+   if(socket->type != SOCKET_TYPE_STREAM)
+      return ERROR_INVALID_SOCKET;
+   //The algorithm cannot be changed once a connection is in progress
+   if(tcpGetState(socket) != TCP_STATE_CLOSED && tcpGetState(socket) != TCP_STATE_LISTEN)
+      return ERROR_INVALID_SOCKET;
+
+   //Use the specified algorithm
+   socket->congestAlgo = algo;
+   //No error to report
+   return NO_ERROR;
+#else
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
 /**
  * @brief Bind a socket to a particular network interface
  * @param[in] socket Handle to a socket
@@ -345,10 +412,21 @@ error_t socketBind(Socket *socket, const IpAddr *localIpAddr, uint16_t localPort
    if(socket->type != SOCKET_TYPE_STREAM && socket->type != SOCKET_TYPE_DGRAM)
       return ERROR_INVALID_SOCKET;
 
+   //Enter critical section
+   osAcquireMutex(&socketMutex);
+
    //Associate the specified IP address and port number
    socket->localIpAddr = *localIpAddr;
    socket->localPort = localPort;
 
+#if (SOCKET_HASH_SUPPORT == ENABLED)
+   //The port number is used as hash key
+   socketHashUpdate(socket);
+#endif
+
+   //Leave critical section
+   osReleaseMutex(&socketMutex);
+
    //No error to report
    return NO_ERROR;
 }
@@ -588,6 +666,74 @@ error_t socketSendTo(Socket *socket, const IpAddr *destIpAddr, uint16_t destPort
 }
 
 
+/**
+ * @brief Send caller-owned data without copying it
+ *
+ * The data is referenced in place until the remote host acknowledges it, so
+ * the buffer must remain valid and unmodified until the callback is invoked.
+ * The callback runs outside the socket critical section and may use the
+ * socket API.
+ *
+ * Either the callback is invoked or an error is returned, never both. When
+ * only part of the buffer can be queued, the function succeeds and reports
+ * the number of bytes accepted through the written parameter. The callback
+ * then releases that part once it has been acknowledged, or once the
+ * connection is closed. The SOCKET_FLAG_WAIT_ACK flag is ignored, since the
+ * callback already reports the acknowledgment
+ *
+ * @param[in] socket Handle that identifies a connected socket
+ * @param[in] data Pointer to the data to be transmitted
+ * @param[in] length Number of data bytes to send
+ * @param[in] callback Function invoked once the data can be released
+ * @param[in] param Opaque pointer passed to the callback
+ * @param[out] written Actual number of bytes written (optional parameter)
+ * @param[in] flags Set of flags that influences the behavior of this function
+ * @return Error code
+ **/
+
+error_t socketSendRef(Socket *socket, const void *data, size_t length,
+   TcpTxRefCallback callback, void *param, size_t *written, uint_t flags)
+{
+#if (TCP_SUPPORT == ENABLED && TCP_ZERO_COPY_SUPPORT == ENABLED)
+   error_t error;
+   uint_t txRefCount;
+   TcpTxRef txRef[TCP_MAX_TX_REF_COUNT];
+
+   //No data has been transmitted yet
+   if(written)
+      *written = 0;
+
+   //Make sure the socket handle is valid
+   if(!socket)
+      return ERROR_INVALID_PARAMETER;
+   //Check parameters
+   if(!data || !callback)
+      return ERROR_INVALID_PARAMETER;
+
+   //This function shall be used with connection-oriented socket types
+   if(socket->type != SOCKET_TYPE_STREAM)
+      return ERROR_INVALID_SOCKET;
+
+   //Enter critical section
+   osAcquireMutex(&socketMutex);
+   //Queue the data for transmission
+   error = tcpSendRef(socket, data, length, callback, param, written, flags);
+   //Retrieve the buffers that have been released in the meantime
+   txRefCount = tcpGetCompletedTxRefs(socket, txRef);
+   //Leave critical section
+   osReleaseMutex(&socketMutex);
+
+   //The owners are notified outside the critical section
+   tcpNotifyTxRefs(socket, txRef, txRefCount);
+
+   //Return status code
+   return error;
+#else
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
 /**
  * @brief Receive data from a connected socket
  * @param[in] socket Handle that identifies a connected socket
@@ -708,6 +854,131 @@ error_t socketReceiveEx(Socket *socket, IpAddr *srcIpAddr, uint16_t *srcPort,
 }
 
 
+/**
+ * @brief Receive data without copying it
+ *
+ * The chunk descriptors point directly to the data held by the TCP/IP stack.
+ * The data remains valid until it is given back with socketReleaseRef(),
+ * which also reopens the receive window of connection-oriented sockets
+ *
+ * @param[in] socket Handle that identifies a socket
+ * @param[out] srcIpAddr Source IP address (optional)
+ * @param[out] srcPort Source port number (optional)
+ * @param[out] chunk Array where to store the chunk descriptors
+ * @param[in] maxChunkCount Number of entries in the array
+ * @param[out] chunkCount Number of chunk descriptors that have been filled
+ * @param[out] received Number of data bytes covered by the chunk descriptors
+ * @param[in] flags Set of flags that influences the behavior of this function
+ * @return Error code
+ **/
+
+error_t socketReceiveRef(Socket *socket, IpAddr *srcIpAddr, uint16_t *srcPort,
+   ChunkDesc *chunk, uint_t maxChunkCount, uint_t *chunkCount, size_t *received, uint_t flags)
+{
+   error_t error;
+
+   //No data has been lent yet
+   *chunkCount = 0;
+   *received = 0;
+
+   //Make sure the socket handle is valid
+   if(!socket)
+      return ERROR_INVALID_PARAMETER;
+   //Check parameters
+   if(!chunk || !maxChunkCount)
+      return ERROR_INVALID_PARAMETER;
+
+   //Enter critical section
+   osAcquireMutex(&socketMutex);
+
+#if (TCP_SUPPORT == ENABLED && TCP_ZERO_COPY_SUPPORT == ENABLED)
+   //Connection-oriented socket?
+   if(socket->type == SOCKET_TYPE_STREAM)
+   {
+      //Lend received data
+      error = tcpReceiveRef(socket, chunk, maxChunkCount, chunkCount, received, flags);
+
+      //Output parameters
+      if(srcIpAddr)
+         *srcIpAddr = socket->remoteIpAddr;
+      if(srcPort)
+         *srcPort = socket->remotePort;
+   }
+   else
+#endif
+#if (UDP_SUPPORT == ENABLED && UDP_ZERO_COPY_SUPPORT == ENABLED)
+   //Connectionless socket?
+   if(socket->type == SOCKET_TYPE_DGRAM)
+   {
+      //Lend the oldest UDP datagram
+      error = udpReceiveDatagramRef(socket, srcIpAddr, srcPort, NULL,
+         chunk, maxChunkCount, chunkCount, received, flags);
+   }
+   else
+#endif
+   //Socket type not supported...
+   {
+      //Invalid socket type
+      error = ERROR_INVALID_SOCKET;
+   }
+
+   //Leave critical section
+   osReleaseMutex(&socketMutex);
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Give back data previously lent by socketReceiveRef()
+ * @param[in] socket Handle that identifies a socket
+ * @param[in] length Number of bytes consumed by the application (connection-oriented
+ *   sockets only, the whole datagram is always released for connectionless sockets)
+ * @return Error code
+ **/
+
+error_t socketReleaseRef(Socket *socket, size_t length)
+{
+   error_t error;
+
+   //Make sure the socket handle is valid
+   if(!socket)
+      return ERROR_INVALID_PARAMETER;
+
+   //Enter critical section
+   osAcquireMutex(&socketMutex);
+
+#if (TCP_SUPPORT == ENABLED && TCP_ZERO_COPY_SUPPORT == ENABLED)
+   //Connection-oriented socket?
+   if(socket->type == SOCKET_TYPE_STREAM)
+   {
+      //Consume the specified number of bytes and reopen the window
+      error = tcpReleaseRef(socket, length);
+   }
+   else
+#endif
+#if (UDP_SUPPORT == ENABLED && UDP_ZERO_COPY_SUPPORT == ENABLED)
+   //Connectionless socket?
+   if(socket->type == SOCKET_TYPE_DGRAM)
+   {
+      //Discard the oldest UDP datagram
+      error = udpReleaseDatagram(socket);
+   }
+   else
+#endif
+   //Socket type not supported...
+   {
+      //Invalid socket type
+      error = ERROR_INVALID_SOCKET;
+   }
+
+   //Leave critical section
+   osReleaseMutex(&socketMutex);
+   //Return status code
+   return error;
+}
+
+
 /**
  * @brief Retrieve the local address for a given socket
  * @param[in] socket Handle that identifies a socket
@@ -810,9 +1081,19 @@ error_t socketShutdown(Socket *socket, uint_t how)
 
 void socketClose(Socket *socket)
 {
+#if (TCP_SUPPORT == ENABLED && TCP_ZERO_COPY_SUPPORT == ENABLED)
+   uint_t txRefCount;
+   TcpTxRef txRef[TCP_MAX_TX_REF_COUNT];
+#endif
+
    //Make sure the socket handle is valid
    if(!socket) return;
 
+#if (TCP_SUPPORT == ENABLED && TCP_ZERO_COPY_SUPPORT == ENABLED)
+   //No caller-owned buffer has been released yet
+   txRefCount = 0;
+#endif
+
    //Enter critical section
    osAcquireMutex(&socketMutex);
 
@@ -822,6 +1103,11 @@ void socketClose(Socket *socket)
    {
       //Abort the current TCP connection
       tcpAbort(socket);
+
+#if (TCP_ZERO_COPY_SUPPORT == ENABLED)
+      //Retrieve the caller-owned buffers before the socket can be reused
+      txRefCount = tcpGetCompletedTxRefs(socket, txRef);
+#endif
    }
 #endif
 #if (UDP_SUPPORT == ENABLED || RAW_SOCKET_SUPPORT == ENABLED)
@@ -844,6 +1130,11 @@ void socketClose(Socket *socket)
          queueItem = nextQueueItem;
       }
 
+#if (SOCKET_HASH_SUPPORT == ENABLED)
+      //Incoming packets must not be delivered to this socket anymore
+      socketHashRemove(socket);
+#endif
+
       //Mark the socket as closed
       socket->type = SOCKET_TYPE_UNUSED;
    }
@@ -851,6 +1142,11 @@ void socketClose(Socket *socket)
 
    //Leave critical section
    osReleaseMutex(&socketMutex);
+
+#if (TCP_SUPPORT == ENABLED && TCP_ZERO_COPY_SUPPORT == ENABLED)
+   //The owners are notified outside the critical section
+   tcpNotifyTxRefs(socket, txRef, txRefCount);
+#endif
 }
 
 
@@ -1088,6 +1384,353 @@ error_t socketGetLastError(Socket *socket)
 }
 
 
+#if (NET_STATS_SUPPORT == ENABLED)
+
+/**
+ * @brief Take a snapshot of the statistics of a socket
+ *
+ * The counters and the state variables are copied while traffic is
+ * flowing. The socket mutex is not acquired
+ *
+ * @param[in] socket Handle that identifies a socket
+ * @param[out] stats Snapshot of the socket statistics
+ * @return Error code
+ **/
+
+error_t socketGetStats(Socket *socket, SocketStatsSnapshot *stats)
+{
+   //Check parameters
+   if(socket == NULL || stats == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Clear the state variables that do not apply to the socket
+   memset(stats, 0, sizeof(SocketStatsSnapshot));
+
+   //Socket type and protocol
+   stats->type = socket->type;
+   stats->protocol = socket->protocol;
+   //Port numbers
+   stats->localPort = socket->localPort;
+   stats->remotePort = socket->remotePort;
+
+#if (TCP_SUPPORT == ENABLED)
+   //Connection-oriented socket?
+   if(socket->type == SOCKET_TYPE_STREAM)
+   {
+      //Current state of the TCP finite state machine
+      stats->state = socket->state;
+
+      //Round-trip time estimates
+      stats->srtt = socket->srtt >> TCP_RTT_FRAC_BITS;
+      stats->rttvar = socket->rttvar >> TCP_RTT_FRAC_BITS;
+      stats->rto = socket->rto;
+
+#if (TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
+      //Congestion control state
+      stats->cwnd = socket->cwnd;
+      stats->ssthresh = socket->ssthresh;
+#endif
+
+      //Send and receive windows
+      stats->sndWnd = socket->sndWnd;
+      stats->rcvWnd = socket->rcvWnd;
+
+      //Amount of data in flight and waiting to be read
+      stats->bytesInFlight = socket->sndNxt - socket->sndUna;
+      stats->rxQueued = socket->rcvUser;
+      //Depth of the out-of-order queue
+      stats->outOfOrderBlocks = socket->sackBlockCount;
+   }
+#endif
+
+   //Copy the counters one word at a time
+   netStatsCopy((uint32_t *) &stats->counters, (const volatile uint32_t *) &socket->stats,
+      sizeof(SocketStats));
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+#endif
+
+
+/**
+ * @brief Check whether a socket accepts a packet with the given addresses
+ * @param[in] socket Handle referencing the socket
+ * @param[in] interface Underlying network interface
+ * @param[in] pseudoHeader IPv4 or IPv6 pseudo header of the incoming packet
+ * @return TRUE if the local and remote IP addresses of the socket match
+ *   the packet, else FALSE
+ **/
+
+bool_t socketMatchAddr(Socket *socket, NetInterface *interface,
+   const IpPseudoHeader *pseudoHeader)
+{
+   //Check whether the socket is bound to a particular interface
+   if(socket->interface && socket->interface != interface)
+      return FALSE;
+
+#if (IPV4_SUPPORT == ENABLED)
+   //An IPv4 packet was received?
+   if(pseudoHeader->length == sizeof(Ipv4PseudoHeader))
+   {
+      //Destination IP address filtering
+      if(socket->localIpAddr.length)
+      {
+         //An IPv4 address is expected
+         if(socket->localIpAddr.length != sizeof(Ipv4Addr))
+            return FALSE;
+         //Filter out non-matching addresses
+         if(socket->localIpAddr.ipv4Addr != pseudoHeader->ipv4Data.destAddr)
+            return FALSE;
+      }
+      //Source IP address filtering
+      if(socket->remoteIpAddr.length)
+      {
+         //An IPv4 address is expected
+         if(socket->remoteIpAddr.length != sizeof(Ipv4Addr))
+            return FALSE;
+         //Filter out non-matching addresses
+         if(socket->remoteIpAddr.ipv4Addr != pseudoHeader->ipv4Data.srcAddr)
+            return FALSE;
+      }
+   }
+   else
+#endif
+#if (IPV6_SUPPORT == ENABLED)
+   //An IPv6 packet was received?
+   if(pseudoHeader->length == sizeof(Ipv6PseudoHeader))
+   {
+      //Destination IP address filtering
+      if(socket->localIpAddr.length)
+      {
+         //An IPv6 address is expected
+         if(socket->localIpAddr.length != sizeof(Ipv6Addr))
+            return FALSE;
+         //Filter out non-matching addresses
+         if(!ipv6CompAddr(&socket->localIpAddr.ipv6Addr, &pseudoHeader->ipv6Data.destAddr))
+            return FALSE;
+      }
+      //Source IP address filtering
+      if(socket->remoteIpAddr.length)
+      {
+         //An IPv6 address is expected
+         if(socket->remoteIpAddr.length != sizeof(Ipv6Addr))
+            return FALSE;
+         //Filter out non-matching addresses
+         if(!ipv6CompAddr(&socket->remoteIpAddr.ipv6Addr, &pseudoHeader->ipv6Data.srcAddr))
+            return FALSE;
+      }
+   }
+   else
+#endif
+   //An invalid packet was received?
+   {
+      //This should never occur...
+      return FALSE;
+   }
+
+   //The socket meets all the criteria
+   return TRUE;
+}
+
+
+/**
+ * @brief Retrieve the source address of an incoming packet
+ * @param[in] pseudoHeader IPv4 or IPv6 pseudo header of the incoming packet
+ * @param[out] srcIpAddr Source IP address
+ **/
+
+void socketGetSrcAddr(const IpPseudoHeader *pseudoHeader, IpAddr *srcIpAddr)
+{
+#if (IPV4_SUPPORT == ENABLED)
+   //An IPv4 packet was received?
+   if(pseudoHeader->length == sizeof(Ipv4PseudoHeader))
+   {
+      srcIpAddr->length = sizeof(Ipv4Addr);
+      srcIpAddr->ipv4Addr = pseudoHeader->ipv4Data.srcAddr;
+   }
+   else
+#endif
+#if (IPV6_SUPPORT == ENABLED)
+   //An IPv6 packet was received?
+   if(pseudoHeader->length == sizeof(Ipv6PseudoHeader))
+   {
+      srcIpAddr->length = sizeof(Ipv6Addr);
+      srcIpAddr->ipv6Addr = pseudoHeader->ipv6Data.srcAddr;
+   }
+   else
+#endif
+   //An invalid packet was received?
+   {
+      srcIpAddr->length = 0;
+   }
+}
+
+
+/**
+ * @brief Hash function for TCP connections
+ * @param[in] localPort Local port number
+ * @param[in] remoteIpAddr IP address of the remote host
+ * @param[in] remotePort Remote port number
+ * @return Index of the hash bucket
+ **/
+
+uint_t socketHashConn(uint16_t localPort,
+   const IpAddr *remoteIpAddr, uint16_t remotePort)
+{
+   uint32_t h;
+
+   //Combine port numbers
+   h = ((uint32_t) localPort << 16) | remotePort;
+
+#if (IPV4_SUPPORT == ENABLED)
+   //IPv4 address?
+   if(remoteIpAddr->length == sizeof(Ipv4Addr))
+   {
+      //Mix in the remote address
+      h ^= remoteIpAddr->ipv4Addr;
+   }
+#endif
+#if (IPV6_SUPPORT == ENABLED)
+   //IPv6 address?
+   if(remoteIpAddr->length == sizeof(Ipv6Addr))
+   {
+      //Mix in the remote address
+      h ^= remoteIpAddr->ipv6Addr.dw[0] ^ remoteIpAddr->ipv6Addr.dw[1] ^
+         remoteIpAddr->ipv6Addr.dw[2] ^ remoteIpAddr->ipv6Addr.dw[3];
+   }
+#endif
+
+   //Spread the bits across the whole word (multiplicative hashing)
+   h *= 0x9E3779B1;
+
+   //Return the index of the bucket
+   return (h >> 16) & (SOCKET_HASH_TABLE_SIZE - 1);
+}
+
+
+/**
+ * @brief Hash function for port numbers and protocol values
+ * @param[in] port Port number (or protocol value for raw sockets)
+ * @return Index of the hash bucket
+ **/
+
+uint_t socketHashPort(uint16_t port)
+{
+   uint32_t h;
+
+   //Spread the bits across the whole word (multiplicative hashing)
+   h = port * 0x9E3779B1;
+
+   //Return the index of the bucket
+   return (h >> 16) & (SOCKET_HASH_TABLE_SIZE - 1);
+}
+
+
+/**
+ * @brief Insert a socket in the hash table that matches its current state
+ *
+ * TCP connections are indexed by local port and remote endpoint, listening
+ * TCP sockets and UDP sockets by local port, and raw sockets by protocol.
+ * Closed TCP sockets are not indexed. The caller must hold the socket mutex
+ *
+ * @param[in] socket Handle referencing the socket
+ **/
+
+void socketHashUpdate(Socket *socket)
+{
+#if (SOCKET_HASH_SUPPORT == ENABLED)
+   Socket **bucket;
+   Socket **p;
+
+   //Remove the socket from its current hash bucket, if any
+   socketHashRemove(socket);
+
+   //Select the relevant hash bucket
+   bucket = NULL;
+
+#if (TCP_SUPPORT == ENABLED)
+   //Connection-oriented socket?
+   if(socket->type == SOCKET_TYPE_STREAM)
+   {
+      //Listening socket?
+      if(socket->state == TCP_STATE_LISTEN)
+      {
+         bucket = &socketPortHashTable[socketHashPort(socket->localPort)];
+      }
+      //Synchronized socket?
+      else if(socket->state != TCP_STATE_CLOSED)
+      {
+         bucket = &socketConnHashTable[socketHashConn(socket->localPort,
+            &socket->remoteIpAddr, socket->remotePort)];
+      }
+   }
+   else
+#endif
+   //Connectionless socket?
+   if(socket->type == SOCKET_TYPE_DGRAM)
+   {
+      bucket = &socketPortHashTable[socketHashPort(socket->localPort)];
+   }
+   //Raw socket?
+   else if(socket->type == SOCKET_TYPE_RAW_IP ||
+      socket->type == SOCKET_TYPE_RAW_ETH)
+   {
+      bucket = &socketRawHashTable[socketHashPort(socket->protocol)];
+   }
+
+   //The socket does not need to be indexed?
+   if(bucket == NULL)
+      return;
+
+   //Sockets are kept sorted by descriptor, so that a lookup returns
+   //the same socket as a linear scan of the socket table
+   for(p = bucket; *p != NULL; p = &(*p)->hashNext)
+   {
+      if((*p)->descriptor > socket->descriptor)
+         break;
+   }
+
+   //Link the socket into the bucket
+   socket->hashNext = *p;
+   socket->hashPrev = p;
+
+   if(*p != NULL)
+      (*p)->hashPrev = &socket->hashNext;
+
+   *p = socket;
+#endif
+}
+
+
+/**
+ * @brief Remove a socket from the hash tables
+ *
+ * The caller must hold the socket mutex
+ *
+ * @param[in] socket Handle referencing the socket
+ **/
+
+void socketHashRemove(Socket *socket)
+{
+#if (SOCKET_HASH_SUPPORT == ENABLED)
+   //The socket is not indexed?
+   if(socket->hashPrev == NULL)
+      return;
+
+   //Unlink the socket
+   *socket->hashPrev = socket->hashNext;
+
+   if(socket->hashNext != NULL)
+      socket->hashNext->hashPrev = socket->hashPrev;
+
+   socket->hashNext = NULL;
+   socket->hashPrev = NULL;
+#endif
+}
+
+
 /**
  * @brief Resolve a host name into an IP address
  * @param[in] interface Underlying network interface (optional parameter)
@@ -37,6 +37,8 @@ struct _Socket;
 #include "core/net.h"
 #include "core/ip.h"
 #include "core/tcp.h"
+#include "core/tcp_cc.h"
+#include "core/tcp_cubic.h"
 
 //Number of sockets that can be opened simultaneously
 #ifndef SOCKET_MAX_COUNT
@@ -45,6 +47,20 @@ struct _Socket;
    #error SOCKET_MAX_COUNT parameter is not valid
 #endif
 
+//Hash-based demultiplexing of incoming packets
+#ifndef SOCKET_HASH_SUPPORT
+   #define SOCKET_HASH_SUPPORT DISABLED
+#elif (SOCKET_HASH_SUPPORT != ENABLED && SOCKET_HASH_SUPPORT != DISABLED)
+   #error SOCKET_HASH_SUPPORT parameter is not valid
+#endif
+
+//Number of buckets in each hash table (must be a power of two)
+#ifndef SOCKET_HASH_TABLE_SIZE
+   #define SOCKET_HASH_TABLE_SIZE 16
+#elif (SOCKET_HASH_TABLE_SIZE < 1 || (SOCKET_HASH_TABLE_SIZE & (SOCKET_HASH_TABLE_SIZE - 1)) != 0)
+   #error SOCKET_HASH_TABLE_SIZE parameter is not valid
+#endif
+
 //Dynamic port range (lower limit)
 #ifndef SOCKET_EPHEMERAL_PORT_MIN
    #define SOCKET_EPHEMERAL_PORT_MIN 49152
@@ -227,6 +243,15 @@ struct _Socket
    uint_t eventFlags;
    OsEvent *userEvent;
 
+#if (SOCKET_HASH_SUPPORT == ENABLED)
+   Socket *hashNext;              ///<Next socket in the same hash bucket
+   Socket **hashPrev;             ///<Link that points to this socket in its hash bucket
+#endif
+
+#if (NET_STATS_SUPPORT == ENABLED)
+   SocketStats stats;             ///<Hot-path statistics counters
+#endif
+
 //TCP specific variables
 #if (TCP_SUPPORT == ENABLED)
    TcpState state;                ///<Current state of the TCP finite state machine
@@ -240,30 +265,55 @@ struct _Socket
 
    uint32_t sndUna;               ///<Data that have been sent but not yet acknowledged
    uint32_t sndNxt;               ///<Sequence number of the next byte to be sent
-   uint16_t sndUser;              ///<Amount of data buffered but not yet sent
-   uint16_t sndWnd;               ///<Size of the send window
-   uint16_t maxSndWnd;            ///<Maximum send window it has seen so far on the connection
+   uint32_t sndUser;              ///<Amount of data buffered but not yet sent
+   uint32_t sndWnd;               ///<Size of the send window
+   uint32_t maxSndWnd;            ///<Maximum send window it has seen so far on the connection
    uint32_t sndWl1;               ///<Segment sequence number used for last window update
    uint32_t sndWl2;               ///<Segment acknowledgment number used for last window update
 
    uint32_t rcvNxt;               ///<Receive next
-   uint16_t rcvUser;              ///<Number of data received but not yet consumed
-   uint16_t rcvWnd;               ///<Receive window
+   uint32_t rcvUser;              ///<Number of data received but not yet consumed
+   uint32_t rcvWnd;               ///<Receive window
+
+#if (TCP_WINDOW_SCALE_SUPPORT == ENABLED)
+   bool_t wndScaleEnabled;        ///<Window scale option is in use on the connection
+   uint8_t sndWndShift;           ///<Shift count applied to the windows advertised by the peer
+   uint8_t rcvWndShift;           ///<Shift count applied to the windows we advertise
+#endif
+
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+   bool_t tsEnabled;              ///<Timestamps option is in use on the connection
+   uint32_t tsOffset;             ///<Random offset applied to the local timestamp clock
+   uint32_t tsRecent;             ///<Timestamp to be echoed in the next segment (TS.Recent)
+   uint32_t lastAckSent;          ///<Last acknowledgment number sent (Last.ACK.sent)
+#endif
 
    bool_t rttBusy;                ///<RTT measurement is being performed
    uint32_t rttSeqNum;            ///<Sequence number identifying a TCP segment
    systime_t rttStartTime;        ///<Round-trip start time
-   systime_t srtt;                ///<Smoothed round-trip time
-   systime_t rttvar;              ///<Round-trip time variation
+   systime_t srtt;                ///<Smoothed round-trip time (fixed-point)
+   systime_t rttvar;              ///<Round-trip time variation (fixed-point)
    systime_t rto;                 ///<Retransmission timeout
 
 #if (TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
-   uint16_t cwnd;                 ///<Congestion window
-   uint16_t ssthresh;             ///<Slow start threshold
-   uint_t n;                      ///<Number of bytes acknowledged during the whole round-trip
+   const TcpCongestAlgo *congestAlgo; ///<Congestion control algorithm
+   uint32_t cwnd;                 ///<Congestion window
+   uint32_t ssthresh;             ///<Slow start threshold
+   uint_t n;                      ///<Number of bytes acknowledged since the last window increase
+   systime_t lastTxTime;          ///<Time at which data was last sent
+#if (TCP_CUBIC_SUPPORT == ENABLED)
+   uint32_t wMax;                 ///<Congestion window just before the last reduction (CUBIC)
+   uint32_t cubicK;               ///<Time needed to grow back to wMax, in ms (CUBIC)
+   uint32_t cubicOrigin;          ///<Plateau of the cubic function (CUBIC)
+   systime_t epochStart;          ///<Beginning of the current congestion avoidance epoch (CUBIC)
+   uint32_t wEst;                 ///<Window of standard TCP, for the TCP-friendly region (CUBIC)
+   uint_t wEstAcked;              ///<Bytes acknowledged since the last wEst increase (CUBIC)
+#endif
 #endif
 
    uint_t dupAckCount;            ///<Number of consecutive duplicate ACKs
+   bool_t lossRecovery;           ///<Fast recovery in progress
+   uint32_t recoveryPoint;        ///<SND.NXT when the last loss recovery started
 
    TcpTxBuffer txBuffer;          ///<Send buffer
    size_t txBufferSize;           ///<Size of the send buffer
@@ -285,14 +335,28 @@ struct _Socket
    TcpTimer finWait2Timer;        ///<FIN-WAIT-2 timer
    TcpTimer timeWaitTimer;        ///<2MSL timer
 
-   bool_t sackPermitted;                        ///<SACK Permitted option received
+#if (TCP_DELAYED_ACK_SUPPORT == ENABLED)
+   TcpTimer delayedAckTimer;      ///<Delayed ACK timer
+   uint_t delayedAckBytes;        ///<Number of bytes received but not yet acknowledged
+   uint_t rcvMss;                 ///<Largest segment received so far
+   bool_t ackRequired;            ///<An ACK must be sent once the incoming segment has been processed
+#endif
+
+   bool_t sackPermitted;                        ///<SACK is in use on the connection
    TcpSackBlock sackBlock[TCP_MAX_SACK_BLOCKS]; ///<List of non-contiguous blocks that have been received
    uint_t sackBlockCount;                       ///<Number of non-contiguous blocks that have been received
+
+#if (TCP_ZERO_COPY_SUPPORT == ENABLED)
+   TcpTxRef txRef[TCP_MAX_TX_REF_COUNT];        ///<Caller-owned buffers queued for transmission
+   uint_t txRefCount;                           ///<Number of caller-owned buffers
+   uint_t txRefDoneCount;                       ///<Number of buffers waiting for their completion callback
+#endif
 #endif
 
 //UDP specific variables
 #if (UDP_SUPPORT == ENABLED || RAW_SOCKET_SUPPORT == ENABLED)
    SocketQueueItem *receiveQueue;
+   SocketQueueItem *lentItem; ///<Datagram lent to the application (zero-copy receive)
 #endif
 };
 
@@ -313,6 +377,12 @@ typedef struct
 extern OsMutex socketMutex;
 extern Socket socketTable[SOCKET_MAX_COUNT];
 
+#if (SOCKET_HASH_SUPPORT == ENABLED)
+extern Socket *socketConnHashTable[SOCKET_HASH_TABLE_SIZE];
+extern Socket *socketPortHashTable[SOCKET_HASH_TABLE_SIZE];
+extern Socket *socketRawHashTable[SOCKET_HASH_TABLE_SIZE];
+#endif
+
 //Socket related functions
 error_t socketInit(void);
 
@@ -321,6 +391,7 @@ Socket *socketOpen(uint_t type, uint_t protocol);
 error_t socketSetTimeout(Socket *socket, systime_t timeout);
 error_t socketSetTxBufferSize(Socket *socket, size_t size);
 error_t socketSetRxBufferSize(Socket *socket, size_t size);
+error_t socketSetCongestionControl(Socket *socket, const TcpCongestAlgo *algo);
 
 error_t socketBindToInterface(Socket *socket, NetInterface *interface);
 error_t socketBind(Socket *socket, const IpAddr *localIpAddr, uint16_t localPort);
@@ -334,6 +405,9 @@ error_t socketSend(Socket *socket, const void *data,
 error_t socketSendTo(Socket *socket, const IpAddr *destIpAddr, uint16_t destPort,
    const void *data, size_t length, size_t *written, uint_t flags);
 
+error_t socketSendRef(Socket *socket, const void *data, size_t length,
+   TcpTxRefCallback callback, void *param, size_t *written, uint_t flags);
+
 error_t socketReceive(Socket *socket, void *data,
    size_t size, size_t *received, uint_t flags);
 
@@ -343,6 +417,11 @@ error_t socketReceiveFrom(Socket *socket, IpAddr *srcIpAddr, uint16_t *srcPort,
 error_t socketReceiveEx(Socket *socket, IpAddr *srcIpAddr, uint16_t *srcPort,
    IpAddr *destIpAddr, void *data, size_t size, size_t *received, uint_t flags);
 
+error_t socketReceiveRef(Socket *socket, IpAddr *srcIpAddr, uint16_t *srcPort,
+   ChunkDesc *chunk, uint_t maxChunkCount, uint_t *chunkCount, size_t *received, uint_t flags);
+
+error_t socketReleaseRef(Socket *socket, size_t length);
+
 error_t socketGetLocalAddr(Socket *socket, IpAddr *localIpAddr, uint16_t *localPort);
 error_t socketGetRemoteAddr(Socket *socket, IpAddr *remoteIpAddr, uint16_t *remotePort);
 
@@ -356,6 +435,19 @@ error_t socketGetEvents(Socket *socket, uint_t *eventFlags);
 
 error_t socketError(Socket *socket, error_t error);
 error_t socketGetLastError(Socket *socket);
+error_t socketGetStats(Socket *socket, SocketStatsSnapshot *stats);
+
+bool_t socketMatchAddr(Socket *socket, NetInterface *interface,
+   const IpPseudoHeader *pseudoHeader);
+
+void socketGetSrcAddr(const IpPseudoHeader *pseudoHeader, IpAddr *srcIpAddr);
+
+uint_t socketHashConn(uint16_t localPort,
+   const IpAddr *remoteIpAddr, uint16_t remotePort);
+
+uint_t socketHashPort(uint16_t port);
+void socketHashUpdate(Socket *socket);
+void socketHashRemove(Socket *socket);
 
 error_t getHostByName(NetInterface *interface,
    const char_t *name, IpAddr *ipAddr, uint_t flags);
@@ -36,6 +36,9 @@
 #include "core/tcp.h"
 #include "core/tcp_misc.h"
 #include "core/tcp_timer.h"
+#include "core/tcp_cc.h"
+#include "core/tcp_cubic.h"
+#include "core/tcp_syn_cookie.h"
 #include "debug.h"
 
 //Check TCP/IP stack configuration
@@ -57,6 +60,8 @@ error_t tcpInit(void)
 {
    //Reset ephemeral port number
    tcpDynamicPort = 0;
+   //Initialize the timing wheel
+   tcpTimerInit();
 
    //Successful initialization
    return NO_ERROR;
@@ -146,9 +151,42 @@ error_t tcpConnect(Socket *socket)
    socket->sndNxt = socket->iss + 1;
    socket->rcvUser = 0;
    socket->rcvWnd = socket->rxBufferSize;
+
+#if (TCP_WINDOW_SCALE_SUPPORT == ENABLED)
+   //Always offer the Window Scale option in the initial SYN, so that the
+   //peer can scale its own window even if our buffer is small
+   socket->wndScaleEnabled = TRUE;
+   socket->sndWndShift = 0;
+   socket->rcvWndShift = tcpComputeWindowScale(socket);
+#endif
+
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+   //Offer the Timestamps option in the initial SYN. A random offset
+   //keeps the local clock from being exposed to the remote host
+   socket->tsEnabled = TRUE;
+   socket->tsOffset = netGetRand();
+   socket->tsRecent = 0;
+#endif
+
+#if (TCP_SACK_SUPPORT == ENABLED)
+   //Offer the SACK Permitted option in the initial SYN
+   socket->sackPermitted = TRUE;
+#endif
+
+   //No loss recovery in progress
+   socket->lossRecovery = FALSE;
+   socket->recoveryPoint = socket->iss;
+
    //Default retransmission timeout
    socket->rto = TCP_INITIAL_RTO;
 
+#if (TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
+   //Use the default congestion control algorithm unless another
+   //one has been selected by the application
+   if(socket->congestAlgo == NULL)
+      socket->congestAlgo = TCP_DEFAULT_CONGEST_ALGO;
+#endif
+
    //Send a SYN segment
    error = tcpSendSegment(socket, TCP_FLAG_SYN, socket->iss, 0, 0, TRUE);
    //Failed to send TCP segment?
@@ -305,6 +343,13 @@ Socket *tcpAccept(Socket *socket, IpAddr *clientIpAddr, uint16_t *clientPort)
             newSocket->mss = queueItem->mss;
 
             //Initialize TCP control block
+#if (TCP_SYN_COOKIE_SUPPORT == ENABLED)
+            //The ISS of a connection established with a SYN cookie
+            //is the value of the cookie itself
+            if(queueItem->synCookie)
+               newSocket->iss = queueItem->iss;
+            else
+#endif
             newSocket->iss = netGetRand();
             newSocket->irs = queueItem->isn;
             newSocket->sndUna = newSocket->iss;
@@ -313,14 +358,91 @@ Socket *tcpAccept(Socket *socket, IpAddr *clientIpAddr, uint16_t *clientPort)
             newSocket->rcvUser = 0;
             newSocket->rcvWnd = newSocket->rxBufferSize;
 
+#if (TCP_WINDOW_SCALE_SUPPORT == ENABLED)
+            //Window scaling is enabled only if the SYN carried the option
+            newSocket->wndScaleEnabled = queueItem->wndScaleOption;
+            newSocket->sndWndShift = queueItem->wndScale;
+
+            //Compute the shift count to advertise in the SYN-ACK
+            if(newSocket->wndScaleEnabled)
+               newSocket->rcvWndShift = tcpComputeWindowScale(newSocket);
+            else
+               newSocket->rcvWndShift = 0;
+#endif
+
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+            //Timestamps are enabled only if the SYN carried the option
+            newSocket->tsEnabled = queueItem->tsOption;
+            newSocket->tsRecent = queueItem->tsVal;
+
+#if (TCP_SYN_COOKIE_SUPPORT == ENABLED)
+            //Keep using the timestamp offset of the SYN-ACK
+            if(queueItem->synCookie)
+               newSocket->tsOffset = queueItem->tsOffset;
+            else
+#endif
+            newSocket->tsOffset = netGetRand();
+
+            //The option is carried by every subsequent segment
+            if(newSocket->tsEnabled)
+               newSocket->mss -= TCP_TIMESTAMP_OPTION_SIZE;
+#endif
+
+#if (TCP_SACK_SUPPORT == ENABLED)
+            //SACK is used only if the SYN carried the SACK Permitted option
+            newSocket->sackPermitted = queueItem->sackPermitted;
+#endif
+
+            //No loss recovery in progress
+            newSocket->lossRecovery = FALSE;
+            newSocket->recoveryPoint = newSocket->iss;
+
             //Default retransmission timeout
             newSocket->rto = TCP_INITIAL_RTO;
 
 #if (TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
-            //Initial congestion window
-            newSocket->cwnd = MIN(TCP_INITIAL_WINDOW * newSocket->mss, newSocket->txBufferSize);
-            //Slow start threshold should be set arbitrarily high
-            newSocket->ssthresh = UINT16_MAX;
+            //The new connection inherits the congestion control
+            //algorithm of the listening socket
+            if(socket->congestAlgo != NULL)
+               newSocket->congestAlgo = socket->congestAlgo;
+            else
+               newSocket->congestAlgo = TCP_DEFAULT_CONGEST_ALGO;
+
+            //Initialize congestion control state
+            newSocket->congestAlgo->init(newSocket);
+            //The connection is not idle when it is established
+            newSocket->lastTxTime = osGetSystemTime();
+#endif
+
+#if (TCP_SYN_COOKIE_SUPPORT == ENABLED)
+            //The three-way handshake has already been completed?
+            if(queueItem->synCookie)
+            {
+               //Initialize the send window from the final ACK of the handshake
+               newSocket->sndUna = newSocket->sndNxt;
+               newSocket->sndWnd = queueItem->sndWnd;
+               newSocket->sndWl1 = newSocket->rcvNxt;
+               newSocket->sndWl2 = newSocket->sndNxt;
+               //Maximum send window it has seen so far on the connection
+               newSocket->maxSndWnd = newSocket->sndWnd;
+
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+               //Last acknowledgment number sent (Last.ACK.sent)
+               newSocket->lastAckSent = newSocket->rcvNxt;
+#endif
+               //Remove the item from the SYN queue
+               socket->synQueue = queueItem->next;
+               //Deallocate memory buffer
+               memPoolFree(queueItem);
+               //Update the state of events
+               tcpUpdateEvents(socket);
+
+               //The connection state should be changed to ESTABLISHED
+               tcpChangeState(newSocket, TCP_STATE_ESTABLISHED);
+
+               //We are done...
+               break;
+            }
 #endif
 
             //Send a SYN ACK control segment
@@ -352,6 +474,13 @@ Socket *tcpAccept(Socket *socket, IpAddr *clientIpAddr, uint16_t *clientPort)
       //Debug message
       TRACE_WARNING("Cannot accept TCP connection!\r\n");
 
+#if (TCP_SYN_COOKIE_SUPPORT == ENABLED)
+      //The client of a connection established with a SYN cookie has
+      //already completed the handshake and must be notified
+      if(queueItem->synCookie)
+         tcpRejectSynCookie(socket, queueItem);
+#endif
+
       //Remove the item from the SYN queue
       socket->synQueue = queueItem->next;
       //Deallocate memory buffer
@@ -395,6 +524,13 @@ error_t tcpSend(Socket *socket, const uint8_t *data,
    //Send as much data as possible
    do
    {
+      //The send buffer is full?
+      if((socket->sndUser + socket->sndNxt - socket->sndUna) >= socket->txBufferSize)
+      {
+         //Update statistics
+         NET_STATS_INC_COUNTER(socket->stats.txBufferFull, 1);
+      }
+
       //Wait until there is more room in the send buffer
       event = tcpWaitForEvents(socket, SOCKET_EVENT_TX_READY, socket->timeout);
 
@@ -492,6 +628,162 @@ error_t tcpSend(Socket *socket, const uint8_t *data,
 }
 
 
+#if (TCP_ZERO_COPY_SUPPORT == ENABLED)
+
+/**
+ * @brief Send caller-owned data without copying it to the send buffer
+ * @param[in] socket Handle that identifies a connected socket
+ * @param[in] data Pointer to the data to be transmitted
+ * @param[in] length Number of bytes to be transmitted
+ * @param[in] callback Function invoked once the data can be released
+ * @param[in] param Opaque pointer passed to the callback
+ * @param[out] written Actual number of bytes written (optional parameter)
+ * @param[in] flags Set of flags that influences the behavior of this function
+ * @return Error code
+ **/
+
+error_t tcpSendRef(Socket *socket, const uint8_t *data, size_t length,
+   TcpTxRefCallback callback, void *param, size_t *written, uint_t flags)
+{
+   error_t error;
+   uint_t i;
+   uint_t n;
+   uint_t totalLength;
+   uint_t event;
+   uint32_t seqNum;
+   TcpTxRef *ref;
+
+   //Check whether the socket is in the listening state
+   if(socket->state == TCP_STATE_LISTEN)
+      return ERROR_NOT_CONNECTED;
+
+   //Initialize status code
+   error = NO_ERROR;
+   //Actual number of bytes written
+   totalLength = 0;
+   //Sequence number of the first byte
+   seqNum = 0;
+
+   //Send as much data as possible
+   while(totalLength < length)
+   {
+      //The send buffer is full?
+      if((socket->sndUser + socket->sndNxt - socket->sndUna) >= socket->txBufferSize)
+      {
+         //Update statistics
+         NET_STATS_INC_COUNTER(socket->stats.txBufferFull, 1);
+      }
+
+      //Wait until there is more room in the send buffer
+      event = tcpWaitForEvents(socket, SOCKET_EVENT_TX_READY, socket->timeout);
+
+      //A timeout exception occurred?
+      if(event != SOCKET_EVENT_TX_READY)
+      {
+         error = ERROR_TIMEOUT;
+         break;
+      }
+
+      //Check current TCP state
+      if(socket->state == TCP_STATE_LAST_ACK || socket->state == TCP_STATE_FIN_WAIT_1 ||
+         socket->state == TCP_STATE_FIN_WAIT_2 || socket->state == TCP_STATE_CLOSING ||
+         socket->state == TCP_STATE_TIME_WAIT)
+      {
+         //The connection is being closed
+         error = ERROR_CONNECTION_CLOSING;
+         break;
+      }
+      else if(socket->state != TCP_STATE_ESTABLISHED && socket->state != TCP_STATE_CLOSE_WAIT)
+      {
+         //The connection was reset by remote side?
+         error = (socket->resetFlag) ? ERROR_CONNECTION_RESET : ERROR_NOT_CONNECTED;
+         break;
+      }
+
+      //Determine the actual number of bytes in the send buffer. Referenced
+      //data consumes sequence space, hence the same room as copied data
+      n = socket->sndUser + socket->sndNxt - socket->sndUna;
+      //Exit immediately if the transmission buffer is full (sanity check)
+      if(n >= socket->txBufferSize)
+      {
+         error = ERROR_FAILURE;
+         break;
+      }
+
+      //Number of bytes available for writing
+      n = socket->txBufferSize - n;
+      //Calculate the number of bytes to queue at a time
+      n = MIN(n, length - totalLength);
+
+      //First chunk of data?
+      if(!totalLength)
+      {
+         //Make sure there is a free descriptor
+         if(socket->txRefCount >= TCP_MAX_TX_REF_COUNT)
+         {
+            error = ERROR_OUT_OF_RESOURCES;
+            break;
+         }
+
+         //The descriptor covers the whole buffer from the start, so that
+         //it cannot be released before the last byte has been acknowledged
+         seqNum = socket->sndNxt + socket->sndUser;
+         ref = &socket->txRef[socket->txRefCount++];
+         ref->seqNum = seqNum;
+         ref->data = data;
+         ref->length = length;
+         ref->callback = callback;
+         ref->param = param;
+      }
+
+      //The data is referenced in place rather than copied
+      socket->sndUser += n;
+      //Update byte counter
+      totalLength += n;
+
+      //Total number of data that have been written
+      if(written != NULL)
+         *written = totalLength;
+
+      //Update TX events
+      tcpUpdateEvents(socket);
+
+      //To avoid a deadlock, it is necessary to have a timeout to force
+      //transmission of data, overriding the SWS avoidance algorithm
+      if(socket->sndUser == n)
+         tcpTimerStart(&socket->overrideTimer, TCP_OVERRIDE_TIMEOUT);
+
+      //The Nagle algorithm should be implemented to coalesce
+      //short segments (refer to RFC 1122 4.2.3.4)
+      tcpNagleAlgo(socket, flags);
+   }
+
+   //Part of the buffer could not be queued?
+   if(error && totalLength > 0)
+   {
+      //Loop through the caller-owned buffers
+      for(i = 0; i < socket->txRefCount; i++)
+      {
+         //Only the queued bytes will be released by the callback
+         if(socket->txRef[i].seqNum == seqNum)
+            socket->txRef[i].length = totalLength;
+      }
+
+      //The queued bytes may already have been acknowledged
+      tcpUpdateTxRefQueue(socket);
+
+      //The callback now owns the outcome of the queued bytes, hence the
+      //partial write is reported through the written parameter only
+      error = NO_ERROR;
+   }
+
+   //Return status code
+   return error;
+}
+
+#endif
+
+
 /**
  * @brief Receive data from a connected socket
  * @param[in] socket Handle that identifies a connected socket
@@ -638,6 +930,133 @@ error_t tcpReceive(Socket *socket, uint8_t *data,
 }
 
 
+#if (TCP_ZERO_COPY_SUPPORT == ENABLED)
+
+/**
+ * @brief Lend received data to the application without copying it
+ *
+ * The data remains in the receive buffer, and keeps occupying the receive
+ * window, until the application gives it back with tcpReleaseRef()
+ *
+ * @param[in] socket Handle that identifies a connected socket
+ * @param[out] chunk Array where to store the chunk descriptors
+ * @param[in] maxChunkCount Number of entries in the array
+ * @param[out] chunkCount Number of chunk descriptors that have been filled
+ * @param[out] received Number of data bytes covered by the chunk descriptors
+ * @param[in] flags Set of flags that influences the behavior of this function
+ * @return Error code
+ **/
+
+error_t tcpReceiveRef(Socket *socket, ChunkDesc *chunk,
+   uint_t maxChunkCount, uint_t *chunkCount, size_t *received, uint_t flags)
+{
+   uint_t event;
+   uint32_t seqNum;
+   systime_t timeout;
+
+   //No data has been lent yet
+   *chunkCount = 0;
+   *received = 0;
+
+   //Check whether the socket is in the listening state
+   if(socket->state == TCP_STATE_LISTEN)
+      return ERROR_NOT_CONNECTED;
+
+   //The SOCKET_FLAG_DONT_WAIT enables non-blocking operation
+   timeout = (flags & SOCKET_FLAG_DONT_WAIT) ? 0 : socket->timeout;
+   //Wait for data to be available for reading
+   event = tcpWaitForEvents(socket, SOCKET_EVENT_RX_READY, timeout);
+
+   //A timeout exception occurred?
+   if(event != SOCKET_EVENT_RX_READY)
+      return ERROR_TIMEOUT;
+
+   //Check current TCP state
+   switch(socket->state)
+   {
+   //ESTABLISHED, FIN-WAIT-1 or FIN-WAIT-2 state?
+   case TCP_STATE_ESTABLISHED:
+   case TCP_STATE_FIN_WAIT_1:
+   case TCP_STATE_FIN_WAIT_2:
+      //Sequence number of the first byte to read
+      seqNum = socket->rcvNxt - socket->rcvUser;
+      //Data is available in the receive buffer
+      break;
+
+   //CLOSE-WAIT, LAST-ACK, CLOSING or TIME-WAIT state?
+   case TCP_STATE_CLOSE_WAIT:
+   case TCP_STATE_LAST_ACK:
+   case TCP_STATE_CLOSING:
+   case TCP_STATE_TIME_WAIT:
+      //The user must be satisfied with data already on hand
+      if(!socket->rcvUser)
+         return ERROR_END_OF_STREAM;
+
+      //Sequence number of the first byte to read
+      seqNum = (socket->rcvNxt - 1) - socket->rcvUser;
+      //Data is available in the receive buffer
+      break;
+
+   //CLOSED state?
+   default:
+      //The connection was reset by remote side?
+      if(socket->resetFlag)
+         return ERROR_CONNECTION_RESET;
+      //The connection has not yet been established?
+      if(!socket->closedFlag)
+         return ERROR_NOT_CONNECTED;
+
+      //The user must be satisfied with data already on hand
+      if(!socket->rcvUser)
+         return ERROR_END_OF_STREAM;
+
+      //Sequence number of the first byte to read
+      seqNum = (socket->rcvNxt - 1) - socket->rcvUser;
+      //Data is available in the receive buffer
+      break;
+   }
+
+   //Sanity check
+   if(!socket->rcvUser)
+      return ERROR_FAILURE;
+
+   //Point directly to the data held in the circular buffer
+   *received = tcpGetRxBufferChunks(socket, seqNum, socket->rcvUser,
+      chunk, maxChunkCount, chunkCount);
+
+   //Successful read operation
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Give back data previously lent by tcpReceiveRef()
+ * @param[in] socket Handle that identifies a connected socket
+ * @param[in] length Number of bytes consumed by the application
+ * @return Error code
+ **/
+
+error_t tcpReleaseRef(Socket *socket, size_t length)
+{
+   //The application cannot consume more than what is available
+   if(length > socket->rcvUser)
+      return ERROR_INVALID_PARAMETER;
+
+   //Remove the data from the receive buffer
+   socket->rcvUser -= length;
+
+   //Update the receive window
+   tcpUpdateReceiveWindow(socket);
+   //Update RX event state
+   tcpUpdateEvents(socket);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+#endif
+
+
 /**
  * @brief Shutdown gracefully reception, transmission, or both
  *
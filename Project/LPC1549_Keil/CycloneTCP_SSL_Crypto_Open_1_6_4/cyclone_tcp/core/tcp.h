@@ -49,10 +49,24 @@
 //TCP tick interval
 #ifndef TCP_TICK_INTERVAL
    #define TCP_TICK_INTERVAL 100
-#elif (TCP_TICK_INTERVAL < 100)
+#elif (TCP_TICK_INTERVAL < 10)
    #error TCP_TICK_INTERVAL parameter is not valid
 #endif
 
+//Number of slots per level of the timing wheel, as a power of two
+#ifndef TCP_TIMER_WHEEL_BITS
+   #define TCP_TIMER_WHEEL_BITS 5
+#elif (TCP_TIMER_WHEEL_BITS < 2 || TCP_TIMER_WHEEL_BITS > 8)
+   #error TCP_TIMER_WHEEL_BITS parameter is not valid
+#endif
+
+//Number of levels of the timing wheel
+#ifndef TCP_TIMER_WHEEL_LEVELS
+   #define TCP_TIMER_WHEEL_LEVELS 4
+#elif (TCP_TIMER_WHEEL_LEVELS < 1 || (TCP_TIMER_WHEEL_LEVELS * TCP_TIMER_WHEEL_BITS) > 30)
+   #error TCP_TIMER_WHEEL_LEVELS parameter is not valid
+#endif
+
 //Maximum segment size
 #ifndef TCP_MAX_MSS
    #define TCP_MAX_MSS 1430
@@ -77,7 +91,7 @@
 //Maximum acceptable size for the send buffer
 #ifndef TCP_MAX_TX_BUFFER_SIZE
    #define TCP_MAX_TX_BUFFER_SIZE 11440
-#elif (TCP_MAX_TX_BUFFER_SIZE < 1)
+#elif (TCP_MAX_TX_BUFFER_SIZE < 1 || TCP_MAX_TX_BUFFER_SIZE > 1073725440)
    #error TCP_MAX_TX_BUFFER_SIZE parameter is not valid
 #endif
 
@@ -91,7 +105,7 @@
 //Maximum acceptable size for the receive buffer
 #ifndef TCP_MAX_RX_BUFFER_SIZE
    #define TCP_MAX_RX_BUFFER_SIZE 11440
-#elif (TCP_MAX_RX_BUFFER_SIZE < 1)
+#elif (TCP_MAX_RX_BUFFER_SIZE < 1 || TCP_MAX_RX_BUFFER_SIZE > 1073725440)
    #error TCP_MAX_RX_BUFFER_SIZE parameter is not valid
 #endif
 
@@ -109,6 +123,20 @@
    #error TCP_MAX_SYN_QUEUE_SIZE parameter is not valid
 #endif
 
+//SYN cookie support
+#ifndef TCP_SYN_COOKIE_SUPPORT
+   #define TCP_SYN_COOKIE_SUPPORT DISABLED
+#elif (TCP_SYN_COOKIE_SUPPORT != ENABLED && TCP_SYN_COOKIE_SUPPORT != DISABLED)
+   #error TCP_SYN_COOKIE_SUPPORT parameter is not valid
+#endif
+
+//Lifetime of a SYN cookie, in minutes
+#ifndef TCP_SYN_COOKIE_MAX_AGE
+   #define TCP_SYN_COOKIE_MAX_AGE 2
+#elif (TCP_SYN_COOKIE_MAX_AGE < 1 || TCP_SYN_COOKIE_MAX_AGE > 127)
+   #error TCP_SYN_COOKIE_MAX_AGE parameter is not valid
+#endif
+
 //Maximum number of retransmissions
 #ifndef TCP_MAX_RETRIES
    #define TCP_MAX_RETRIES 5
@@ -126,7 +154,7 @@
 //Minimum retransmission timeout
 #ifndef TCP_MIN_RTO
    #define TCP_MIN_RTO 1000
-#elif (TCP_MIN_RTO < 100)
+#elif (TCP_MIN_RTO < 10)
    #error TCP_MIN_RTO parameter is not valid
 #endif
 
@@ -152,6 +180,13 @@
    #error TCP_CONGESTION_CONTROL_SUPPORT parameter is not valid
 #endif
 
+//CUBIC congestion control algorithm
+#ifndef TCP_CUBIC_SUPPORT
+   #define TCP_CUBIC_SUPPORT ENABLED
+#elif (TCP_CUBIC_SUPPORT != ENABLED && TCP_CUBIC_SUPPORT != DISABLED)
+   #error TCP_CUBIC_SUPPORT parameter is not valid
+#endif
+
 //Size of the congestion window after the three-way handshake is completed
 #ifndef TCP_INITIAL_WINDOW
    #define TCP_INITIAL_WINDOW 3
@@ -187,6 +222,20 @@
    #error TCP_OVERRIDE_TIMEOUT parameter is not valid
 #endif
 
+//Delayed acknowledgment support
+#ifndef TCP_DELAYED_ACK_SUPPORT
+   #define TCP_DELAYED_ACK_SUPPORT DISABLED
+#elif (TCP_DELAYED_ACK_SUPPORT != ENABLED && TCP_DELAYED_ACK_SUPPORT != DISABLED)
+   #error TCP_DELAYED_ACK_SUPPORT parameter is not valid
+#endif
+
+//Delayed ACK timeout (must be less than 0.5 seconds)
+#ifndef TCP_DELAYED_ACK_TIMEOUT
+   #define TCP_DELAYED_ACK_TIMEOUT 200
+#elif (TCP_DELAYED_ACK_TIMEOUT < 10 || TCP_DELAYED_ACK_TIMEOUT >= 500)
+   #error TCP_DELAYED_ACK_TIMEOUT parameter is not valid
+#endif
+
 //FIN-WAIT-2 timer
 #ifndef TCP_FIN_WAIT_2_TIMER
    #define TCP_FIN_WAIT_2_TIMER 4000
@@ -201,6 +250,20 @@
    #error TCP_2MSL_TIMER parameter is not valid
 #endif
 
+//Window scale option support
+#ifndef TCP_WINDOW_SCALE_SUPPORT
+   #define TCP_WINDOW_SCALE_SUPPORT DISABLED
+#elif (TCP_WINDOW_SCALE_SUPPORT != ENABLED && TCP_WINDOW_SCALE_SUPPORT != DISABLED)
+   #error TCP_WINDOW_SCALE_SUPPORT parameter is not valid
+#endif
+
+//Timestamps option support (RTTM and PAWS)
+#ifndef TCP_TIMESTAMP_SUPPORT
+   #define TCP_TIMESTAMP_SUPPORT DISABLED
+#elif (TCP_TIMESTAMP_SUPPORT != ENABLED && TCP_TIMESTAMP_SUPPORT != DISABLED)
+   #error TCP_TIMESTAMP_SUPPORT parameter is not valid
+#endif
+
 //Selective acknowledgment support
 #ifndef TCP_SACK_SUPPORT
    #define TCP_SACK_SUPPORT DISABLED
@@ -215,10 +278,32 @@
    #error TCP_MAX_SACK_BLOCKS parameter is not valid
 #endif
 
+//Zero-copy send and receive support
+#ifndef TCP_ZERO_COPY_SUPPORT
+   #define TCP_ZERO_COPY_SUPPORT DISABLED
+#elif (TCP_ZERO_COPY_SUPPORT != ENABLED && TCP_ZERO_COPY_SUPPORT != DISABLED)
+   #error TCP_ZERO_COPY_SUPPORT parameter is not valid
+#endif
+
+//Maximum number of caller-owned buffers queued for transmission
+#ifndef TCP_MAX_TX_REF_COUNT
+   #define TCP_MAX_TX_REF_COUNT 4
+#elif (TCP_MAX_TX_REF_COUNT < 1)
+   #error TCP_MAX_TX_REF_COUNT parameter is not valid
+#endif
+
 //Maximum TCP header length
 #define TCP_MAX_HEADER_LENGTH 60
 //Default maximum segment size
 #define TCP_DEFAULT_MSS 536
+//Maximum shift count of the window scale option (refer to RFC 7323 2.3)
+#define TCP_MAX_WINDOW_SCALE 14
+//Space taken by the Timestamps option, including padding
+#define TCP_TIMESTAMP_OPTION_SIZE 12
+//Upper bound on the number of RTT samples weighted per round-trip
+#define TCP_MAX_RTT_SAMPLES 16
+//Number of fractional bits used to store SRTT and RTTVAR
+#define TCP_RTT_FRAC_BITS 8
 
 //Sequence number comparison macro
 #define TCP_CMP_SEQ(a, b) ((int32_t) ((a) - (b)))
@@ -275,6 +360,17 @@ typedef enum
 } TcpOptionKind;
 
 
+/**
+ * @brief Events reported to the congestion control algorithm
+ **/
+
+typedef enum
+{
+   TCP_CONGEST_EVENT_TX_START     = 0,
+   TCP_CONGEST_EVENT_RECOVERY_END = 1
+} TcpCongestEvent;
+
+
 //CodeWarrior or Win32 compiler?
 #if defined(__CWCC__) || defined(_WIN32)
    #pragma pack(push, 1)
@@ -331,8 +427,11 @@ typedef __start_packed struct
  * @brief TCP timer
  **/
 
-typedef struct
+typedef struct _TcpTimer
 {
+   struct _TcpTimer *next;
+   struct _TcpTimer **pprev;
+   uint32_t expires;
    bool_t running;
    systime_t startTime;
    systime_t interval;
@@ -348,6 +447,8 @@ typedef struct _TcpQueueItem
    struct _TcpQueueItem *next;
    uint_t length;
    uint_t sacked;
+   bool_t lost;
+   bool_t retransmitted;
    IpPseudoHeader pseudoHeader;
    uint8_t header[TCP_MAX_HEADER_LENGTH];
 } TcpQueueItem;
@@ -366,6 +467,25 @@ typedef struct _TcpSynQueueItem
    IpAddr destAddr;
    uint32_t isn;
    uint16_t mss;
+#if (TCP_WINDOW_SCALE_SUPPORT == ENABLED)
+   bool_t wndScaleOption;
+   uint8_t wndScale;
+#endif
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+   bool_t tsOption;
+   uint32_t tsVal;
+#endif
+#if (TCP_SACK_SUPPORT == ENABLED)
+   bool_t sackPermitted;
+#endif
+#if (TCP_SYN_COOKIE_SUPPORT == ENABLED)
+   bool_t synCookie;
+   uint32_t iss;
+   uint32_t sndWnd;
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+   uint32_t tsOffset;
+#endif
+#endif
 } TcpSynQueueItem;
 
 
@@ -380,6 +500,51 @@ typedef struct
 } TcpSackBlock;
 
 
+/**
+ * @brief Completion callback for zero-copy transmission
+ **/
+
+typedef void (*TcpTxRefCallback)(Socket *socket,
+   const uint8_t *data, size_t length, void *param);
+
+
+/**
+ * @brief Caller-owned buffer queued for transmission
+ **/
+
+typedef struct
+{
+   uint32_t seqNum;
+   const uint8_t *data;
+   size_t length;
+   TcpTxRefCallback callback;
+   void *param;
+} TcpTxRef;
+
+
+//Congestion control algorithm related functions
+typedef void (*TcpCongestInit)(Socket *socket);
+typedef void (*TcpCongestOnAck)(Socket *socket, uint32_t n);
+typedef void (*TcpCongestOnLoss)(Socket *socket);
+typedef void (*TcpCongestOnTimeout)(Socket *socket);
+typedef void (*TcpCongestCwndEvent)(Socket *socket, TcpCongestEvent event);
+
+
+/**
+ * @brief Common interface for congestion control algorithms
+ **/
+
+typedef struct
+{
+   const char_t *name;
+   TcpCongestInit init;
+   TcpCongestOnAck onAck;
+   TcpCongestOnLoss onLoss;
+   TcpCongestOnTimeout onTimeout;
+   TcpCongestCwndEvent cwndEvent;
+} TcpCongestAlgo;
+
+
 /**
  * @brief Transmit buffer
  **/
@@ -418,9 +583,17 @@ Socket *tcpAccept(Socket *socket, IpAddr *clientIpAddr, uint16_t *clientPort);
 error_t tcpSend(Socket *socket, const uint8_t *data,
    size_t length, size_t *written, uint_t flags);
 
+error_t tcpSendRef(Socket *socket, const uint8_t *data, size_t length,
+   TcpTxRefCallback callback, void *param, size_t *written, uint_t flags);
+
 error_t tcpReceive(Socket *socket, uint8_t *data,
    size_t size, size_t *received, uint_t flags);
 
+error_t tcpReceiveRef(Socket *socket, ChunkDesc *chunk,
+   uint_t maxChunkCount, uint_t *chunkCount, size_t *received, uint_t flags);
+
+error_t tcpReleaseRef(Socket *socket, size_t length);
+
 error_t tcpShutdown(Socket *socket, uint_t how);
 error_t tcpAbort(Socket *socket);
 TcpState tcpGetState(Socket *socket);
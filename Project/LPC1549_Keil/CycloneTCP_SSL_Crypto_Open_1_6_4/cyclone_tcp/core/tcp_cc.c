@@ -0,0 +1,205 @@
+/**
+ * @file tcp_cc.c
+ * @brief TCP congestion control framework and NewReno algorithm
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * The congestion control algorithm is selected on a per-socket basis.
+ * Each algorithm only decides how cwnd and ssthresh evolve, while fast
+ * retransmit and loss recovery (NewReno partial ACKs or SACK) are handled
+ * by the TCP core. Refer to the following RFCs for complete details:
+ * - RFC 5681: TCP Congestion Control
+ * - RFC 6582: The NewReno Modification to TCP's Fast Recovery Algorithm
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL TCP_TRACE_LEVEL
+
+//Dependencies
+#include <string.h>
+#include "core/net.h"
+#include "core/socket.h"
+#include "core/tcp.h"
+#include "core/tcp_cc.h"
+#include "core/tcp_cubic.h"
+#include "debug.h"
+
+//Check TCP/IP stack configuration
+#if (TCP_SUPPORT == ENABLED && TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
+
+/**
+ * @brief NewReno congestion control algorithm
+ **/
+
+const TcpCongestAlgo tcpNewRenoAlgo =
+{
+   "newreno",
+   tcpNewRenoInit,
+   tcpNewRenoOnAck,
+   tcpNewRenoOnLoss,
+   tcpNewRenoOnTimeout,
+   tcpNewRenoCwndEvent
+};
+
+//List of supported congestion control algorithms
+static const TcpCongestAlgo *tcpCongestAlgoList[] =
+{
+   TCP_NEWRENO_ALGO,
+#if (TCP_CUBIC_SUPPORT == ENABLED)
+   TCP_CUBIC_ALGO,
+#endif
+};
+
+
+/**
+ * @brief Find a congestion control algorithm by name
+ * @param[in] name Name of the algorithm (not necessarily NULL-terminated)
+ * @param[in] length Maximum length of the name
+ * @return Pointer to the algorithm, or NULL if the name is unknown
+ **/
+
+const TcpCongestAlgo *tcpGetCongestAlgo(const char_t *name, size_t length)
+{
+   uint_t i;
+   size_t n;
+
+   //Loop through the list of supported algorithms
+   for(i = 0; i < arraysize(tcpCongestAlgoList); i++)
+   {
+      //Length of the current name
+      n = strlen(tcpCongestAlgoList[i]->name);
+
+      //Compare names
+      if(length >= n && !strncmp(name, tcpCongestAlgoList[i]->name, n))
+      {
+         //The name may be followed by a NULL terminator
+         if(length == n || name[n] == '\0')
+            return tcpCongestAlgoList[i];
+      }
+   }
+
+   //Unknown algorithm
+   return NULL;
+}
+
+
+/**
+ * @brief Initialize congestion control state
+ * @param[in] socket Handle referencing the socket
+ **/
+
+void tcpNewRenoInit(Socket *socket)
+{
+   //Initial congestion window
+   socket->cwnd = MIN(TCP_INITIAL_WINDOW * socket->mss, socket->txBufferSize);
+   //Slow start threshold should be set arbitrarily high
+   socket->ssthresh = UINT32_MAX;
+   //Reset the byte counter
+   socket->n = 0;
+}
+
+
+/**
+ * @brief Update the congestion window when new data is acknowledged
+ * @param[in] socket Handle referencing the socket
+ * @param[in] n Number of bytes acknowledged by the incoming ACK
+ **/
+
+void tcpNewRenoOnAck(Socket *socket, uint32_t n)
+{
+   //Slow start algorithm is used when cwnd is lower than ssthresh
+   if(socket->cwnd < socket->ssthresh)
+   {
+      //During slow start, TCP increments cwnd by at most SMSS bytes
+      //for each ACK received that cumulatively acknowledges new data
+      socket->cwnd += MIN(n, socket->mss);
+   }
+   //Congestion avoidance algorithm is used when cwnd exceeds ssthresh
+   else
+   {
+      //Total number of bytes acknowledged since the last increase
+      socket->n += n;
+
+      //cwnd is incremented by SMSS bytes once a full window has been
+      //acknowledged (appropriate byte counting, refer to RFC 5681 3.1)
+      if(socket->n >= socket->cwnd)
+      {
+         socket->n -= socket->cwnd;
+         socket->cwnd += socket->mss;
+      }
+   }
+}
+
+
+/**
+ * @brief Adjust ssthresh when loss is detected by duplicate ACKs
+ * @param[in] socket Handle referencing the socket
+ **/
+
+void tcpNewRenoOnLoss(Socket *socket)
+{
+   //Amount of data that has been sent but not yet acknowledged
+   uint_t flightSize = socket->sndNxt - socket->sndUna;
+
+   //ssthresh must be set to half the flight size (see RFC 5681 3.2)
+   socket->ssthresh = MAX(flightSize / 2, 2 * socket->mss);
+}
+
+
+/**
+ * @brief Adjust ssthresh when the retransmission timer expires
+ * @param[in] socket Handle referencing the socket
+ **/
+
+void tcpNewRenoOnTimeout(Socket *socket)
+{
+   //Amount of data that has been sent but not yet acknowledged
+   uint_t flightSize = socket->sndNxt - socket->sndUna;
+
+   //ssthresh must be set to half the flight size (see RFC 5681 3.1)
+   socket->ssthresh = MAX(flightSize / 2, 2 * socket->mss);
+   //Reset the byte counter
+   socket->n = 0;
+}
+
+
+/**
+ * @brief Process a congestion control event
+ * @param[in] socket Handle referencing the socket
+ * @param[in] event Event to be processed
+ **/
+
+void tcpNewRenoCwndEvent(Socket *socket, TcpCongestEvent event)
+{
+   //Loss recovery complete?
+   if(event == TCP_CONGEST_EVENT_RECOVERY_END)
+   {
+      //Congestion avoidance starts from scratch
+      socket->n = 0;
+   }
+}
+
+#endif
@@ -0,0 +1,55 @@
+/**
+ * @file tcp_cc.h
+ * @brief TCP congestion control framework and NewReno algorithm
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+#ifndef _TCP_CC_H
+#define _TCP_CC_H
+
+//Dependencies
+#include "core/tcp.h"
+
+//NewReno congestion control algorithm
+#define TCP_NEWRENO_ALGO (&tcpNewRenoAlgo)
+
+//Congestion control algorithm used by default
+#ifndef TCP_DEFAULT_CONGEST_ALGO
+   #define TCP_DEFAULT_CONGEST_ALGO TCP_NEWRENO_ALGO
+#endif
+
+//NewReno related constants
+extern const TcpCongestAlgo tcpNewRenoAlgo;
+
+//Congestion control related functions
+const TcpCongestAlgo *tcpGetCongestAlgo(const char_t *name, size_t length);
+
+void tcpNewRenoInit(Socket *socket);
+void tcpNewRenoOnAck(Socket *socket, uint32_t n);
+void tcpNewRenoOnLoss(Socket *socket);
+void tcpNewRenoOnTimeout(Socket *socket);
+void tcpNewRenoCwndEvent(Socket *socket, TcpCongestEvent event);
+
+#endif
@@ -0,0 +1,276 @@
+/**
+ * @file tcp_cubic.c
+ * @brief CUBIC congestion control algorithm
+ *
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * CUBIC grows the congestion window as a cubic function of the time
+ * elapsed since the last congestion event, so that window growth does
+ * not depend on the round-trip time. Refer to RFC 8312 for more details
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL TCP_TRACE_LEVEL
+
+//Dependencies
+#include "core/net.h"
+#include "core/socket.h"
+#include "core/tcp.h"
+#include "core/tcp_cc.h"
+#include "core/tcp_cubic.h"
+#include "debug.h"
+
+//Check TCP/IP stack configuration
+#if (TCP_SUPPORT == ENABLED && TCP_CONGESTION_CONTROL_SUPPORT == ENABLED && \
+   TCP_CUBIC_SUPPORT == ENABLED)
+
+/**
+ * @brief CUBIC congestion control algorithm
+ **/
+
+const TcpCongestAlgo tcpCubicAlgo =
+{
+   "cubic",
+   tcpCubicInit,
+   tcpCubicOnAck,
+   tcpCubicOnLoss,
+   tcpCubicOnTimeout,
+   tcpCubicCwndEvent
+};
+
+
+/**
+ * @brief Initialize congestion control state
+ * @param[in] socket Handle referencing the socket
+ **/
+
+void tcpCubicInit(Socket *socket)
+{
+   //Slow start is the same as for standard TCP
+   tcpNewRenoInit(socket);
+
+   //No congestion event has occurred yet
+   socket->wMax = 0;
+   socket->epochStart = 0;
+}
+
+
+/**
+ * @brief Update the congestion window when new data is acknowledged
+ * @param[in] socket Handle referencing the socket
+ * @param[in] n Number of bytes acknowledged by the incoming ACK
+ **/
+
+void tcpCubicOnAck(Socket *socket, uint32_t n)
+{
+   int32_t t;
+   int64_t delta;
+   int64_t target;
+   uint32_t threshold;
+   systime_t time;
+
+   //Slow start algorithm is used when cwnd is lower than ssthresh
+   if(socket->cwnd < socket->ssthresh)
+   {
+      //During slow start, TCP increments cwnd by at most SMSS bytes
+      //for each ACK received that cumulatively acknowledges new data
+      socket->cwnd += MIN(n, socket->mss);
+      //We are done
+      return;
+   }
+
+   //Get current time
+   time = osGetSystemTime();
+
+   //First ACK of a new congestion avoidance epoch?
+   if(!socket->epochStart)
+   {
+      //Record the beginning of the epoch (zero is reserved)
+      socket->epochStart = time ? time : 1;
+
+      //Check whether the window is still below its previous maximum
+      if(socket->cwnd < socket->wMax)
+      {
+         //K = cubic_root((W_max - cwnd) / C), expressed in milliseconds
+         socket->cubicK = tcpCubeRoot((uint64_t) (socket->wMax - socket->cwnd) *
+            5000000000ULL / (2 * socket->mss));
+         //The cubic function plateaus at W_max
+         socket->cubicOrigin = socket->wMax;
+      }
+      else
+      {
+         //Convex growth starts immediately
+         socket->cubicK = 0;
+         socket->cubicOrigin = socket->cwnd;
+      }
+
+      //The standard TCP window starts from the current window
+      socket->wEst = socket->cwnd;
+      socket->wEstAcked = 0;
+   }
+
+   //Elapsed time, one round-trip ahead, relative to K (refer to RFC 8312 4.1)
+   t = time - socket->epochStart + (socket->srtt >> TCP_RTT_FRAC_BITS) - socket->cubicK;
+   //Keep the cubic term within a sensible range
+   t = MAX(t, -TCP_MAX_RTO);
+   t = MIN(t, TCP_MAX_RTO);
+
+   //W_cubic(t) = C * (t - K)^3 + W_max, with C = 0.4 and t in seconds
+   delta = (int64_t) t * t * t * 2 / 5000000;
+   target = socket->cubicOrigin + delta * socket->mss / 1000;
+
+   //The window may grow by at most 50% per round-trip
+   target = MIN(target, (int64_t) socket->cwnd * 3 / 2);
+
+   //Check whether the window should grow
+   if(target > socket->cwnd)
+   {
+      //Total number of bytes acknowledged since the last increase
+      socket->n += n;
+
+      //cwnd grows by (target - cwnd) / cwnd for each SMSS acknowledged
+      delta = (target - socket->cwnd) * socket->n / socket->cwnd;
+
+      //Increase the congestion window
+      if(delta > 0)
+      {
+         socket->cwnd += (uint32_t) delta;
+         socket->n = 0;
+      }
+   }
+
+   //Estimate the window that standard TCP would reach. W_est grows by
+   //3 * (1 - beta) / (1 + beta) segments per window acknowledged
+   socket->wEstAcked += n;
+   threshold = (uint32_t) ((uint64_t) socket->cwnd * 17 / 9);
+
+   //Update W_est
+   if(socket->wEstAcked >= threshold)
+   {
+      socket->wEstAcked -= threshold;
+      socket->wEst += socket->mss;
+   }
+
+   //In the TCP-friendly region, cwnd follows the standard TCP window
+   if(socket->wEst > socket->cwnd)
+      socket->cwnd = socket->wEst;
+}
+
+
+/**
+ * @brief Adjust the window when loss is detected by duplicate ACKs
+ * @param[in] socket Handle referencing the socket
+ **/
+
+void tcpCubicOnLoss(Socket *socket)
+{
+   //Fast convergence: release bandwidth if the window stopped short
+   //of its previous maximum (refer to RFC 8312 4.6)
+   if(socket->cwnd < socket->wMax)
+      socket->wMax = (uint32_t) ((uint64_t) socket->cwnd * 17 / 20);
+   else
+      socket->wMax = socket->cwnd;
+
+   //Multiplicative decrease with beta = 0.7
+   socket->ssthresh = (uint32_t) ((uint64_t) socket->cwnd * 7 / 10);
+   socket->ssthresh = MAX(socket->ssthresh, 2 * socket->mss);
+
+   //A new epoch starts with the next window increase
+   socket->epochStart = 0;
+   socket->n = 0;
+}
+
+
+/**
+ * @brief Adjust the window when the retransmission timer expires
+ * @param[in] socket Handle referencing the socket
+ **/
+
+void tcpCubicOnTimeout(Socket *socket)
+{
+   //The window reduction is the same as for a fast retransmit. The TCP
+   //core then falls back to slow start (refer to RFC 8312 4.7)
+   tcpCubicOnLoss(socket);
+}
+
+
+/**
+ * @brief Process a congestion control event
+ * @param[in] socket Handle referencing the socket
+ * @param[in] event Event to be processed
+ **/
+
+void tcpCubicCwndEvent(Socket *socket, TcpCongestEvent event)
+{
+   //Transmission resumed after an idle period?
+   if(event == TCP_CONGEST_EVENT_TX_START)
+   {
+      //The idle period must not count as window growth time
+      socket->epochStart = 0;
+   }
+   //Loss recovery complete?
+   else if(event == TCP_CONGEST_EVENT_RECOVERY_END)
+   {
+      //Reset the byte counter
+      socket->n = 0;
+   }
+}
+
+
+/**
+ * @brief Integer cube root
+ * @param[in] x Input value
+ * @return Largest integer y such that y^3 <= x
+ **/
+
+uint32_t tcpCubeRoot(uint64_t x)
+{
+   int_t s;
+   uint64_t y;
+   uint64_t b;
+
+   //Initialize result
+   y = 0;
+
+   //Process the input three bits at a time
+   for(s = 63; s >= 0; s -= 3)
+   {
+      y <<= 1;
+      b = 3 * y * (y + 1) + 1;
+
+      if((x >> s) >= b)
+      {
+         x -= b << s;
+         y++;
+      }
+   }
+
+   //Return the cube root
+   return (uint32_t) y;
+}
+
+#endif
@@ -0,0 +1,51 @@
+/**
+ * @file tcp_cubic.h
+ * @brief CUBIC congestion control algorithm
+ *
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+#ifndef _TCP_CUBIC_H
+#define _TCP_CUBIC_H
+
+//Dependencies
+#include "core/tcp.h"
+
+//CUBIC congestion control algorithm
+#define TCP_CUBIC_ALGO (&tcpCubicAlgo)
+
+//CUBIC related constants
+extern const TcpCongestAlgo tcpCubicAlgo;
+
+//CUBIC related functions
+void tcpCubicInit(Socket *socket);
+void tcpCubicOnAck(Socket *socket, uint32_t n);
+void tcpCubicOnLoss(Socket *socket);
+void tcpCubicOnTimeout(Socket *socket);
+void tcpCubicCwndEvent(Socket *socket, TcpCongestEvent event);
+
+uint32_t tcpCubeRoot(uint64_t x);
+
+#endif
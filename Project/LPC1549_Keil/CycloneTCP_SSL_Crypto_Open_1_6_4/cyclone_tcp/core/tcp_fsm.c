@@ -50,6 +50,7 @@
 #include "core/tcp_fsm.h"
 #include "core/tcp_misc.h"
 #include "core/tcp_timer.h"
+#include "core/tcp_syn_cookie.h"
 #include "date_time.h"
 #include "debug.h"
 
@@ -68,11 +69,19 @@
 void tcpProcessSegment(NetInterface *interface,
    IpPseudoHeader *pseudoHeader, const NetBuffer *buffer, size_t offset)
 {
+#if (SOCKET_HASH_SUPPORT == ENABLED)
+   IpAddr srcIpAddr;
+#else
    uint_t i;
+#endif
    size_t length;
    Socket *socket;
    Socket *passiveSocket;
    TcpHeader *segment;
+#if (TCP_ZERO_COPY_SUPPORT == ENABLED)
+   uint_t txRefCount;
+   TcpTxRef txRef[TCP_MAX_TX_REF_COUNT];
+#endif
 
    //A TCP implementation must silently discard an incoming
    //segment that is addressed to a broadcast or multicast
@@ -103,6 +112,9 @@ void tcpProcessSegment(NetInterface *interface,
       return;
    }
 
+   //Update statistics
+   NET_STATS_INC_COUNTER(interface->stats.tcpInSegments, 1);
+
    //Retrieve the length of the TCP segment
    length = netBufferGetLength(buffer) - offset;
 
@@ -116,6 +128,8 @@ void tcpProcessSegment(NetInterface *interface,
    {
       //Debug message
       TRACE_WARNING("TCP segment length is invalid!\r\n");
+      //Update statistics
+      NET_STATS_INC_COUNTER(interface->stats.tcpInErrors, 1);
       //Exit immediately
       return;
    }
@@ -124,6 +138,8 @@ void tcpProcessSegment(NetInterface *interface,
    {
       //Debug message
       TRACE_WARNING("TCP header length is invalid!\r\n");
+      //Update statistics
+      NET_STATS_INC_COUNTER(interface->stats.tcpInErrors, 1);
       //Exit immediately
       return;
    }
@@ -133,6 +149,8 @@ void tcpProcessSegment(NetInterface *interface,
    {
       //Debug message
       TRACE_WARNING("Wrong TCP header checksum!\r\n");
+      //Update statistics
+      NET_STATS_INC_COUNTER(interface->stats.tcpInErrors, 1);
       //Exit immediately
       return;
    }
@@ -143,6 +161,57 @@ void tcpProcessSegment(NetInterface *interface,
    //No matching socket in the LISTEN state for the moment
    passiveSocket = NULL;
 
+#if (SOCKET_HASH_SUPPORT == ENABLED)
+   //Retrieve the address of the remote host
+   socketGetSrcAddr(pseudoHeader, &srcIpAddr);
+
+   //Point to the bucket that holds the matching connections
+   socket = socketConnHashTable[socketHashConn(ntohs(segment->destPort),
+      &srcIpAddr, ntohs(segment->srcPort))];
+
+   //Look for a connection matching the segment
+   while(socket != NULL)
+   {
+      //Check port numbers and IP addresses
+      if(socket->localPort == ntohs(segment->destPort) &&
+         socket->remotePort == ntohs(segment->srcPort) &&
+         socketMatchAddr(socket, interface, pseudoHeader))
+      {
+         //A matching socket has been found
+         break;
+      }
+
+      //Next socket in the same bucket
+      socket = socket->hashNext;
+   }
+
+   //No synchronized connection found?
+   if(socket == NULL)
+   {
+      //Point to the bucket that holds the listening sockets
+      passiveSocket = socketPortHashTable[socketHashPort(ntohs(segment->destPort))];
+
+      //Look for the first matching socket in the LISTEN state
+      while(passiveSocket != NULL)
+      {
+         //Check socket type, state, port number and IP addresses
+         if(passiveSocket->type == SOCKET_TYPE_STREAM &&
+            passiveSocket->state == TCP_STATE_LISTEN &&
+            passiveSocket->localPort == ntohs(segment->destPort) &&
+            socketMatchAddr(passiveSocket, interface, pseudoHeader))
+         {
+            //A matching socket has been found
+            break;
+         }
+
+         //Next socket in the same bucket
+         passiveSocket = passiveSocket->hashNext;
+      }
+
+      //Use the listening socket, if any
+      socket = passiveSocket;
+   }
+#else
    //Look through opened sockets
    for(i = 0; i < SOCKET_MAX_COUNT; i++)
    {
@@ -152,72 +221,12 @@ void tcpProcessSegment(NetInterface *interface,
       //TCP socket found?
       if(socket->type != SOCKET_TYPE_STREAM)
          continue;
-      //Check whether the socket is bound to a particular interface
-      if(socket->interface && socket->interface != interface)
-         continue;
       //Check destination port number
       if(socket->localPort != ntohs(segment->destPort))
          continue;
-
-#if (IPV4_SUPPORT == ENABLED)
-      //An IPv4 packet was received?
-      if(pseudoHeader->length == sizeof(Ipv4PseudoHeader))
-      {
-         //Destination IP address filtering
-         if(socket->localIpAddr.length)
-         {
-            //An IPv4 address is expected
-            if(socket->localIpAddr.length != sizeof(Ipv4Addr))
-               continue;
-            //Filter out non-matching addresses
-            if(socket->localIpAddr.ipv4Addr != pseudoHeader->ipv4Data.destAddr)
-               continue;
-         }
-         //Source IP address filtering
-         if(socket->remoteIpAddr.length)
-         {
-            //An IPv4 address is expected
-            if(socket->remoteIpAddr.length != sizeof(Ipv4Addr))
-               continue;
-            //Filter out non-matching addresses
-            if(socket->remoteIpAddr.ipv4Addr != pseudoHeader->ipv4Data.srcAddr)
-               continue;
-         }
-      }
-      else
-#endif
-#if (IPV6_SUPPORT == ENABLED)
-      //An IPv6 packet was received?
-      if(pseudoHeader->length == sizeof(Ipv6PseudoHeader))
-      {
-         //Destination IP address filtering
-         if(socket->localIpAddr.length)
-         {
-            //An IPv6 address is expected
-            if(socket->localIpAddr.length != sizeof(Ipv6Addr))
-               continue;
-            //Filter out non-matching addresses
-            if(!ipv6CompAddr(&socket->localIpAddr.ipv6Addr, &pseudoHeader->ipv6Data.destAddr))
-               continue;
-         }
-         //Source IP address filtering
-         if(socket->remoteIpAddr.length)
-         {
-            //An IPv6 address is expected
-            if(socket->remoteIpAddr.length != sizeof(Ipv6Addr))
-               continue;
-            //Filter out non-matching addresses
-            if(!ipv6CompAddr(&socket->remoteIpAddr.ipv6Addr, &pseudoHeader->ipv6Data.srcAddr))
-               continue;
-         }
-      }
-      else
-#endif
-      //An invalid packet was received?
-      {
-         //This should never occur...
+      //Check interface and IP addresses
+      if(!socketMatchAddr(socket, interface, pseudoHeader))
          continue;
-      }
 
       //Keep track of the first matching socket in the LISTEN state
       if(socket->state == TCP_STATE_LISTEN && !passiveSocket)
@@ -233,6 +242,7 @@ void tcpProcessSegment(NetInterface *interface,
    //If no matching socket has been found then try to
    //use the first matching socket in the LISTEN state
    if(i >= SOCKET_MAX_COUNT) socket = passiveSocket;
+#endif
 
    //Offset to the first data byte
    offset += segment->dataOffset * 4;
@@ -260,6 +270,8 @@ void tcpProcessSegment(NetInterface *interface,
    //Specified port is unreachable?
    if(!socket)
    {
+      //Update statistics
+      NET_STATS_INC_COUNTER(interface->stats.tcpNoSocket, 1);
       //An incoming segment not containing a RST causes
       //a reset to be sent in response
       if(!(segment->flags & TCP_FLAG_RST))
@@ -270,6 +282,9 @@ void tcpProcessSegment(NetInterface *interface,
       return;
    }
 
+   //Update statistics
+   NET_STATS_INC_COUNTER(socket->stats.rxPackets, 1);
+
    //Check current state
    switch(socket->state)
    {
@@ -350,8 +365,24 @@ void tcpProcessSegment(NetInterface *interface,
       break;
    }
 
+#if (TCP_DELAYED_ACK_SUPPORT == ENABLED)
+   //An immediate ACK is needed but no outgoing data could carry it?
+   if(socket->ackRequired && socket->state != TCP_STATE_CLOSED)
+      tcpSendSegment(socket, TCP_FLAG_ACK, socket->sndNxt, socket->rcvNxt, 0, FALSE);
+#endif
+
+#if (TCP_ZERO_COPY_SUPPORT == ENABLED)
+   //Retrieve the caller-owned buffers released by the segment
+   txRefCount = tcpGetCompletedTxRefs(socket, txRef);
+#endif
+
    //Leave critical section
    osReleaseMutex(&socketMutex);
+
+#if (TCP_ZERO_COPY_SUPPORT == ENABLED)
+   //The owners are notified outside the critical section
+   tcpNotifyTxRefs(socket, txRef, txRefCount);
+#endif
 }
 
 
@@ -396,9 +427,14 @@ void tcpStateClosed(NetInterface *interface,
 void tcpStateListen(Socket *socket, NetInterface *interface,
    IpPseudoHeader *pseudoHeader, TcpHeader *segment, size_t length)
 {
-   uint_t i;
    TcpOption *option;
    TcpSynQueueItem *queueItem;
+#if (TCP_SYN_COOKIE_SUPPORT == ENABLED)
+   error_t error;
+#endif
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+   uint32_t tsEcr;
+#endif
 
    //Debug message
    TRACE_DEBUG("TCP FSM: LISTEN state\r\n");
@@ -411,6 +447,20 @@ void tcpStateListen(Socket *socket, NetInterface *interface,
    //still in the LISTEN state
    if(segment->flags & TCP_FLAG_ACK)
    {
+#if (TCP_SYN_COOKIE_SUPPORT == ENABLED)
+      //Unless it completes a handshake for which a SYN cookie was sent
+      if(!(segment->flags & TCP_FLAG_SYN))
+      {
+         //Validate the SYN cookie
+         error = tcpCheckSynCookie(socket, interface, pseudoHeader, segment);
+
+         //Segments received while the connection request is pending are
+         //silently discarded. The connection is reset if the cookie is
+         //invalid or if the SYN queue is still full
+         if(!error || error == ERROR_ALREADY_CONNECTED)
+            return;
+      }
+#endif
       //A reset segment should be formed for any arriving ACK-bearing segment
       tcpSendResetSegment(interface, pseudoHeader, segment, length);
       //Return immediately
@@ -420,36 +470,20 @@ void tcpStateListen(Socket *socket, NetInterface *interface,
    //Check the SYN bit
    if(segment->flags & TCP_FLAG_SYN)
    {
-      //The SYN queue is empty?
-      if(!socket->synQueue)
-      {
-         //Allocate memory to save incoming data
-         queueItem = memPoolAlloc(sizeof(TcpSynQueueItem));
-         //Add the newly created item to the queue
-         socket->synQueue = queueItem;
-      }
-      else
-      {
-         //Point to the very first item
-         queueItem = socket->synQueue;
+      //Append a new item to the SYN queue
+      queueItem = tcpAddSynQueueItem(socket);
 
-         //Reach the last item in the receive queue
-         for(i = 1; queueItem->next; i++)
-            queueItem = queueItem->next;
-
-         //Make sure the receive queue is not full
-         if(i >= socket->synQueueSize)
-            return;
-
-         //Allocate memory to save incoming data
-         queueItem->next = memPoolAlloc(sizeof(TcpSynQueueItem));
-         //Point to the newly created item
-         queueItem = queueItem->next;
-      }
-
-      //Failed to allocate memory?
+      //The SYN queue is full or memory could not be allocated?
       if(!queueItem)
+      {
+#if (TCP_SYN_COOKIE_SUPPORT == ENABLED)
+         //Rather than dropping the connection request, reply with a SYN-ACK
+         //whose sequence number encodes the state of the connection
+         tcpSendSynCookie(socket, interface, pseudoHeader, segment);
+#endif
+         //Return immediately
          return;
+      }
 
 #if (IPV4_SUPPORT == ENABLED)
       //IPv4 is currently used?
@@ -483,8 +517,6 @@ void tcpStateListen(Socket *socket, NetInterface *interface,
          return;
       }
 
-      //Initialize next field
-      queueItem->next = NULL;
       //Underlying network interface
       queueItem->interface = interface;
       //Save the port number of the client
@@ -510,6 +542,38 @@ void tcpStateListen(Socket *socket, NetInterface *interface,
          queueItem->mss = MAX(queueItem->mss, TCP_MIN_MSS);
       }
 
+#if (TCP_WINDOW_SCALE_SUPPORT == ENABLED)
+      //Get the window scale factor
+      option = tcpGetOption(segment, TCP_OPTION_WINDOW_SCALE_FACTOR);
+      //Specified option found?
+      if(option && option->length == 3)
+      {
+         //Window scaling will be used in both directions
+         queueItem->wndScaleOption = TRUE;
+         //Shift counts greater than 14 must be treated as 14
+         queueItem->wndScale = MIN(option->value[0], TCP_MAX_WINDOW_SCALE);
+      }
+      else
+      {
+         //Window scaling is not supported by the remote host
+         queueItem->wndScaleOption = FALSE;
+         queueItem->wndScale = 0;
+      }
+#endif
+
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+      //Timestamps are used only if the SYN carried the option
+      queueItem->tsOption = !tcpGetTimestamps(segment, &queueItem->tsVal, &tsEcr);
+#endif
+
+#if (TCP_SACK_SUPPORT == ENABLED)
+      //Check whether the remote host sent the SACK Permitted option
+      if(tcpGetOption(segment, TCP_OPTION_SACK_PERMITTED) != NULL)
+         queueItem->sackPermitted = TRUE;
+      else
+         queueItem->sackPermitted = FALSE;
+#endif
+
       //Notify user that a connection request is pending
       tcpUpdateEvents(socket);
 
@@ -533,6 +597,10 @@ void tcpStateListen(Socket *socket, NetInterface *interface,
 void tcpStateSynSent(Socket *socket, TcpHeader *segment, size_t length)
 {
    TcpOption *option;
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+   uint32_t tsVal;
+   uint32_t tsEcr;
+#endif
 
    //Debug message
    TRACE_DEBUG("TCP FSM: SYN-SENT state\r\n");
@@ -577,7 +645,7 @@ void tcpStateSynSent(Socket *socket, TcpHeader *segment, size_t length)
          socket->sndUna = segment->ackNum;
 
       //Compute retransmission timeout
-      tcpComputeRto(socket);
+      tcpComputeRto(socket, segment);
 
       //Any segments on the retransmission queue which are
       //thereby acknowledged should be removed
@@ -599,11 +667,52 @@ void tcpStateSynSent(Socket *socket, TcpHeader *segment, size_t length)
          socket->mss = MAX(socket->mss, TCP_MIN_MSS);
       }
 
+#if (TCP_WINDOW_SCALE_SUPPORT == ENABLED)
+      //Get the window scale factor
+      option = tcpGetOption(segment, TCP_OPTION_WINDOW_SCALE_FACTOR);
+      //Specified option found?
+      if(option && option->length == 3)
+      {
+         //Shift counts greater than 14 must be treated as 14
+         socket->sndWndShift = MIN(option->value[0], TCP_MAX_WINDOW_SCALE);
+      }
+      else
+      {
+         //Window scaling is disabled in both directions if the
+         //remote host did not send the option (see RFC 7323 2.2)
+         socket->wndScaleEnabled = FALSE;
+         socket->sndWndShift = 0;
+         socket->rcvWndShift = 0;
+      }
+#endif
+
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+      //Check whether the remote host sent the Timestamps option
+      if(!tcpGetTimestamps(segment, &tsVal, &tsEcr))
+      {
+         //Record the timestamp to be echoed
+         socket->tsRecent = tsVal;
+         //The option is carried by every subsequent segment
+         socket->mss -= TCP_TIMESTAMP_OPTION_SIZE;
+      }
+      else
+      {
+         //Timestamps are disabled in both directions (see RFC 7323 3.2)
+         socket->tsEnabled = FALSE;
+      }
+#endif
+
+#if (TCP_SACK_SUPPORT == ENABLED)
+      //SACK cannot be used unless the remote host permits it
+      if(tcpGetOption(segment, TCP_OPTION_SACK_PERMITTED) == NULL)
+         socket->sackPermitted = FALSE;
+#endif
+
 #if (TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
-      //Initial congestion window
-      socket->cwnd = MIN(TCP_INITIAL_WINDOW * socket->mss, socket->txBufferSize);
-      //Slow start threshold should be set arbitrarily high
-      socket->ssthresh = UINT16_MAX;
+      //Initialize congestion control state
+      socket->congestAlgo->init(socket);
+      //The connection is not idle when it is established
+      socket->lastTxTime = osGetSystemTime();
 #endif
 
       //Check whether our SYN has been acknowledged (SND.UNA > ISS)
@@ -682,11 +791,11 @@ void tcpStateSynReceived(Socket *socket, TcpHeader *segment,
    }
 
    //Update the send window before entering ESTABLISHED state (see RFC 1122 4.2.2.20)
-   socket->sndWnd = segment->window;
+   socket->sndWnd = tcpGetSegmentWindow(socket, segment);
    socket->sndWl1 = segment->seqNum;
    socket->sndWl2 = segment->ackNum;
    //Maximum send window it has seen so far on the connection
-   socket->maxSndWnd = segment->window;
+   socket->maxSndWnd = socket->sndWnd;
 
    //Enter ESTABLISHED state
    tcpChangeState(socket, TCP_STATE_ESTABLISHED);
@@ -63,14 +63,35 @@ error_t tcpSendSegment(Socket *socket, uint8_t flags, uint32_t seqNum,
    error_t error;
    size_t offset;
    size_t totalLength;
+   uint32_t window;
    NetBuffer *buffer;
    TcpHeader *segment;
    TcpQueueItem *queueItem;
    IpPseudoHeader pseudoHeader;
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+   uint8_t timestamps[8];
+#endif
+#if (TCP_SACK_SUPPORT == ENABLED)
+   uint_t i;
+   uint_t n;
+   uint8_t sackBlocks[TCP_MAX_SACK_BLOCKS * 8];
+#endif
 
    //Maximum segment size
    const uint16_t mss = HTONS(TCP_MAX_MSS);
 
+   //The window field in a SYN segment is never scaled
+   if(flags & TCP_FLAG_SYN)
+      window = socket->rcvWnd;
+#if (TCP_WINDOW_SCALE_SUPPORT == ENABLED)
+   //The window field of any other segment is right-shifted by the
+   //shift count we advertised in our SYN (refer to RFC 7323 2.3)
+   else if(socket->wndScaleEnabled)
+      window = socket->rcvWnd >> socket->rcvWndShift;
+#endif
+   else
+      window = socket->rcvWnd;
+
    //Allocate a memory buffer to hold the TCP segment
    buffer = ipAllocBuffer(TCP_MAX_HEADER_LENGTH, &offset);
    //Failed to allocate memory?
@@ -88,7 +109,7 @@ error_t tcpSendSegment(Socket *socket, uint8_t flags, uint32_t seqNum,
    segment->dataOffset = 5;
    segment->flags = flags;
    segment->reserved2 = 0;
-   segment->window = htons(socket->rcvWnd);
+   segment->window = htons(MIN(window, UINT16_MAX));
    segment->checksum = 0;
    segment->urgentPointer = 0;
 
@@ -98,11 +119,63 @@ error_t tcpSendSegment(Socket *socket, uint8_t flags, uint32_t seqNum,
       //Append MSS option
       tcpAddOption(segment, TCP_OPTION_MAX_SEGMENT_SIZE, &mss, sizeof(mss));
 
+#if (TCP_WINDOW_SCALE_SUPPORT == ENABLED)
+      //A SYN-ACK may only carry the option if the peer sent it first
+      if(socket->wndScaleEnabled)
+      {
+         //Append Window Scale option
+         tcpAddOption(segment, TCP_OPTION_WINDOW_SCALE_FACTOR,
+            &socket->rcvWndShift, sizeof(uint8_t));
+      }
+#endif
+
 #if (TCP_SACK_SUPPORT == ENABLED)
-      //Append SACK Permitted option
-      tcpAddOption(segment, TCP_OPTION_SACK_PERMITTED, NULL, 0);
+      //A SYN-ACK may only carry the option if the peer sent it first
+      if(socket->sackPermitted)
+      {
+         //Append SACK Permitted option
+         tcpAddOption(segment, TCP_OPTION_SACK_PERMITTED, NULL, 0);
+      }
+#endif
+   }
+
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+   //Once negotiated, the Timestamps option must be sent in every
+   //non-RST segment (refer to RFC 7323 3.2)
+   if(socket->tsEnabled && !(flags & TCP_FLAG_RST))
+   {
+      //TSval is derived from the system clock (1 ms granularity)
+      STORE32BE(osGetSystemTime() + socket->tsOffset, timestamps);
+      //TSecr is only valid when the ACK bit is set
+      STORE32BE((flags & TCP_FLAG_ACK) ? socket->tsRecent : 0, timestamps + 4);
+
+      //Append Timestamps option
+      tcpAddOption(segment, TCP_OPTION_TIMESTAMP, timestamps, sizeof(timestamps));
+   }
 #endif
+
+#if (TCP_SACK_SUPPORT == ENABLED)
+   //Report non-contiguous blocks of queued data in pure ACK segments, so
+   //that the MSS agreed with the peer is never exceeded
+   if(socket->sackPermitted && socket->sackBlockCount > 0 &&
+      (flags & TCP_FLAG_ACK) && !(flags & (TCP_FLAG_SYN | TCP_FLAG_RST)) && !length)
+   {
+      //Limit the number of blocks to the space left in the options field
+      n = (TCP_MAX_HEADER_LENGTH - segment->dataOffset * 4 - 4) / 8;
+      n = MIN(n, socket->sackBlockCount);
+
+      //The first block must specify the most recently received segment
+      for(i = 0; i < n; i++)
+      {
+         STORE32BE(socket->sackBlock[i].leftEdge, sackBlocks + i * 8);
+         STORE32BE(socket->sackBlock[i].rightEdge, sackBlocks + i * 8 + 4);
+      }
+
+      //Append SACK option
+      if(n > 0)
+         tcpAddOption(segment, TCP_OPTION_SACK, sackBlocks, n * 8);
    }
+#endif
 
    //Adjust the length of the multi-part buffer
    netBufferSetLength(buffer, offset + segment->dataOffset * 4);
@@ -205,6 +278,8 @@ error_t tcpSendSegment(Socket *socket, uint8_t flags, uint32_t seqNum,
       queueItem->next = NULL;
       queueItem->length = length;
       queueItem->sacked = FALSE;
+      queueItem->lost = FALSE;
+      queueItem->retransmitted = FALSE;
       //Save TCP header
       memcpy(queueItem->header, segment, segment->dataOffset * 4);
       //Save pseudo header
@@ -219,11 +294,6 @@ error_t tcpSendSegment(Socket *socket, uint8_t flags, uint32_t seqNum,
          socket->rttSeqNum = ntohl(segment->seqNum);
          //Wait for an acknowledgment that covers that sequence number...
          socket->rttBusy = TRUE;
-
-#if (TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
-         //Reset the byte counter
-         socket->n = 0;
-#endif
       }
 
       //Check whether the RTO timer is already running
@@ -247,6 +317,39 @@ error_t tcpSendSegment(Socket *socket, uint8_t flags, uint32_t seqNum,
    //Send TCP segment
    error = ipSendDatagram(socket->interface, &pseudoHeader, buffer, offset, 0);
 
+   //Update statistics
+   if(!error)
+   {
+      NET_STATS_INC_COUNTER(socket->stats.txPackets, 1);
+      NET_STATS_INC_COUNTER(socket->stats.txBytes, length);
+   }
+
+#if (TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
+   //Keep track of the last transmission of data
+   if(!error && length > 0)
+      socket->lastTxTime = osGetSystemTime();
+#endif
+
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+   //Keep track of the last acknowledgment number actually sent (Last.ACK.sent)
+   if(!error && (flags & TCP_FLAG_ACK))
+      socket->lastAckSent = ackNum;
+#endif
+
+#if (TCP_DELAYED_ACK_SUPPORT == ENABLED)
+   //A segment acknowledging RCV.NXT acknowledges all the data received so
+   //far. Resets and replies to invalid segments do not count
+   if(!error && (flags & TCP_FLAG_ACK) && !(flags & TCP_FLAG_RST) &&
+      ackNum == socket->rcvNxt)
+   {
+      //No more ACK is pending
+      socket->delayedAckBytes = 0;
+      socket->ackRequired = FALSE;
+      //Turn off the delayed ACK timer
+      tcpTimerStop(&socket->delayedAckTimer);
+   }
+#endif
+
    //Free previously allocated memory
    netBufferFree(buffer);
    //Return error code
@@ -484,6 +587,79 @@ TcpOption *tcpGetOption(TcpHeader *segment, uint8_t kind)
 }
 
 
+/**
+ * @brief Compute the window scale factor to advertise
+ *
+ * The shift count is the smallest value that allows the whole receive
+ * buffer to be advertised in the 16-bit window field (see RFC 7323 2.2)
+ *
+ * @param[in] socket Handle referencing the socket
+ * @return Shift count
+ **/
+
+uint8_t tcpComputeWindowScale(Socket *socket)
+{
+   uint8_t shift;
+
+   //Find the smallest shift count that covers the receive buffer
+   for(shift = 0; shift < TCP_MAX_WINDOW_SCALE; shift++)
+   {
+      if((socket->rxBufferSize >> shift) <= UINT16_MAX)
+         break;
+   }
+
+   //Return the shift count
+   return shift;
+}
+
+
+/**
+ * @brief Retrieve the send window advertised in an incoming segment
+ * @param[in] socket Handle referencing the socket
+ * @param[in] segment Pointer to the TCP header
+ * @return Size of the window, in bytes
+ **/
+
+uint32_t tcpGetSegmentWindow(Socket *socket, TcpHeader *segment)
+{
+#if (TCP_WINDOW_SCALE_SUPPORT == ENABLED)
+   //The window field in a SYN segment is never scaled
+   if(socket->wndScaleEnabled && !(segment->flags & TCP_FLAG_SYN))
+      return (uint32_t) segment->window << socket->sndWndShift;
+#endif
+
+   //The window field is not scaled
+   return segment->window;
+}
+
+
+/**
+ * @brief Retrieve the Timestamps option of an incoming segment
+ * @param[in] segment Pointer to the TCP header
+ * @param[out] tsVal Timestamp value sent by the remote host
+ * @param[out] tsEcr Timestamp echo reply
+ * @return NO_ERROR if a valid Timestamps option was found, ERROR_FAILURE otherwise
+ **/
+
+error_t tcpGetTimestamps(TcpHeader *segment, uint32_t *tsVal, uint32_t *tsEcr)
+{
+   TcpOption *option;
+
+   //Search the TCP header for the Timestamps option
+   option = tcpGetOption(segment, TCP_OPTION_TIMESTAMP);
+   //Option not found or malformed?
+   if(!option || option->length != 10)
+      return ERROR_FAILURE;
+
+   //Retrieve TSval and TSecr fields
+   *tsVal = LOAD32BE(option->value);
+   *tsEcr = LOAD32BE(option->value + 4);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
 /**
  * @brief Test the sequence number of an incoming segment
  * @param[in] socket Handle referencing the current socket
@@ -496,6 +672,14 @@ error_t tcpCheckSequenceNumber(Socket *socket, TcpHeader *segment, size_t length
 {
    //Acceptability test for an incoming segment
    bool_t acceptable = FALSE;
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+   error_t error;
+   uint32_t tsVal;
+   uint32_t tsEcr;
+
+   //Retrieve the Timestamps option, if any
+   error = tcpGetTimestamps(segment, &tsVal, &tsEcr);
+#endif
 
    //Case where both segment length and receive window are zero
    if(!length && !socket->rcvWnd)
@@ -525,11 +709,37 @@ error_t tcpCheckSequenceNumber(Socket *socket, TcpHeader *segment, size_t length
          acceptable = TRUE;
    }
 
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+   //PAWS applies to all non-RST segments (refer to RFC 7323 5.3)
+   if(acceptable && socket->tsEnabled && !error && !(segment->flags & TCP_FLAG_RST))
+   {
+      //A segment whose TSval is older than TS.Recent is an old duplicate
+      //and is processed as a segment that is not acceptable
+      if(TCP_CMP_SEQ(tsVal, socket->tsRecent) < 0)
+      {
+         //Debug message
+         TRACE_WARNING("TCP segment rejected by PAWS!\r\n");
+         //Reject the segment
+         acceptable = FALSE;
+      }
+   }
+#endif
+
    //Non acceptable sequence number?
    if(!acceptable)
    {
       //Debug message
       TRACE_WARNING("Sequence number is not acceptable!\r\n");
+
+      //Update statistics
+      NET_STATS_INC_COUNTER(socket->stats.droppedSegments, 1);
+
+      //The segment carries data while the receive buffer is full?
+      if(length && !socket->rcvWnd)
+      {
+         NET_STATS_INC_COUNTER(socket->stats.rxBufferFull, 1);
+      }
+
       //If an incoming segment is not acceptable, an acknowledgment
       //should be sent in reply (unless the RST bit is set)
       if(!(segment->flags & TCP_FLAG_RST))
@@ -538,6 +748,20 @@ error_t tcpCheckSequenceNumber(Socket *socket, TcpHeader *segment, size_t length
       return ERROR_FAILURE;
    }
 
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+   //TS.Recent is updated only by segments that cover Last.ACK.sent,
+   //so that delayed ACKs echo the earliest pending timestamp
+   if(socket->tsEnabled && !error)
+   {
+      if(TCP_CMP_SEQ(tsVal, socket->tsRecent) >= 0 &&
+         TCP_CMP_SEQ(segment->seqNum, socket->lastAckSent) <= 0)
+      {
+         //Record the timestamp to be echoed
+         socket->tsRecent = tsVal;
+      }
+   }
+#endif
+
    //Sequence number is acceptable
    return NO_ERROR;
 }
@@ -582,10 +806,16 @@ error_t tcpCheckSyn(Socket *socket, TcpHeader *segment, size_t length)
 
 error_t tcpCheckAck(Socket *socket, TcpHeader *segment, size_t length)
 {
+   uint32_t n;
+   uint32_t window;
+
    //If the ACK bit is off drop the segment and return
    if(!(segment->flags & TCP_FLAG_ACK))
       return ERROR_FAILURE;
 
+   //Retrieve the window advertised by the peer
+   window = tcpGetSegmentWindow(socket, segment);
+
    //Old duplicate ACK received (SEG.ACK < SND.UNA)
    if(TCP_CMP_SEQ(segment->ackNum, socket->sndUna) < 0)
    {
@@ -617,9 +847,16 @@ error_t tcpCheckAck(Socket *socket, TcpHeader *segment, size_t length)
       //advertised window in the incoming acknowledgment equals the advertised
       //window in the last incoming acknowledgment (refer to RFC 5681 section 2)
       if(socket->retransmitQueue && !length && segment->ackNum == socket->sndUna)
+      {
+         //Update statistics
+         NET_STATS_INC_COUNTER(socket->stats.dupAcks, 1);
+         //Increment duplicate ACK counter
          socket->dupAckCount++;
+      }
       else
+      {
          socket->dupAckCount = 0;
+      }
 
       //Case where neither the sequence nor the acknowledgment number is increased
       if(segment->seqNum == socket->sndWl1 && segment->ackNum == socket->sndWl2)
@@ -627,15 +864,15 @@ error_t tcpCheckAck(Socket *socket, TcpHeader *segment, size_t length)
          //TCP may ignore a window update with a smaller window than
          //previously offered if neither the sequence number nor the
          //acknowledgment number is increased (see RFC 1122 4.2.2.16)
-         if(segment->window > socket->sndWnd)
+         if(window > socket->sndWnd)
          {
             //Update the send window and record the sequence number and
             //the acknowledgment number used to update SND.WND
-            socket->sndWnd = segment->window;
+            socket->sndWnd = window;
             socket->sndWl1 = segment->seqNum;
             socket->sndWl2 = segment->ackNum;
             //Maximum send window it has seen so far on the connection
-            socket->maxSndWnd = MAX(socket->maxSndWnd, segment->window);
+            socket->maxSndWnd = MAX(socket->maxSndWnd, window);
 
             //Reset duplicate ACK counter since the advertised window
             //has changed (refer to RFC 5681 section 2)
@@ -647,7 +884,7 @@ error_t tcpCheckAck(Socket *socket, TcpHeader *segment, size_t length)
          TCP_CMP_SEQ(segment->ackNum, socket->sndWl2) >= 0)
       {
          //The remote host advertises a zero window?
-         if(!segment->window && socket->sndWnd)
+         if(!window && socket->sndWnd)
          {
             //Start the persist timer
             socket->wndProbeCount = 0;
@@ -657,62 +894,106 @@ error_t tcpCheckAck(Socket *socket, TcpHeader *segment, size_t length)
 
          //Update the send window and record the sequence number and
          //the acknowledgment number used to update SND.WND
-         socket->sndWnd = segment->window;
+         socket->sndWnd = window;
          socket->sndWl1 = segment->seqNum;
          socket->sndWl2 = segment->ackNum;
          //Maximum send window it has seen so far on the connection
-         socket->maxSndWnd = MAX(socket->maxSndWnd, segment->window);
+         socket->maxSndWnd = MAX(socket->maxSndWnd, window);
 
          //Reset duplicate ACK counter since the advertised window
          //has changed (refer to RFC 5681 section 2)
          socket->dupAckCount = 0;
       }
 
+#if (TCP_SACK_SUPPORT == ENABLED)
+      //Record the blocks of data that the peer has selectively acknowledged
+      if(socket->sackPermitted)
+         tcpUpdateScoreboard(socket, segment);
+#endif
+
       //The incoming ACK segment acknowledges new data?
       if(TCP_CMP_SEQ(segment->ackNum, socket->sndUna) > 0)
       {
-#if (TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
          //Compute the number of bytes acknowledged by the incoming ACK
-         uint_t n = segment->ackNum - socket->sndUna;
+         n = segment->ackNum - socket->sndUna;
 
          //Check whether the ACK segment acknowledges our SYN
          if(socket->sndUna == socket->iss)
             n--;
 
-         //Total number of bytes acknowledged during the whole round-trip
-         socket->n += n;
-
-         //Slow start algorithm is used when cwnd is lower than ssthresh
-         if(socket->cwnd < socket->ssthresh)
-         {
-            //During slow start, TCP increments cwnd by at most SMSS bytes
-            //for each ACK received that cumulatively acknowledges new data
-            socket->cwnd += MIN(n, socket->mss);
-         }
-         //Congestion avoidance algorithm is used when cwnd exceeds ssthres
-         else
+#if (TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
+         //The congestion window is not increased during fast recovery
+         if(!socket->lossRecovery)
          {
-            //Congestion window is updated once per RTT
-            if(socket->rttBusy && TCP_CMP_SEQ(segment->ackNum, socket->rttSeqNum) > 0)
-            {
-               //TCP must not increment cwnd by more than SMSS bytes
-               socket->cwnd += MIN(socket->n, socket->mss);
-            }
+            //Let the congestion control algorithm update cwnd
+            socket->congestAlgo->onAck(socket, n);
+            //Limit the size of the congestion window
+            socket->cwnd = MIN(socket->cwnd, socket->txBufferSize);
          }
-
-         //Limit the size of the congestion window
-         socket->cwnd = MIN(socket->cwnd, socket->txBufferSize);
 #endif
 
          //Update SND.UNA pointer
          socket->sndUna = segment->ackNum;
 
          //Compute retransmission timeout
-         tcpComputeRto(socket);
+         tcpComputeRto(socket, segment);
 
          //Any segments on the retransmission queue which are thereby
          //entirely acknowledged are removed
          tcpUpdateRetransmitQueue(socket);
+
+#if (TCP_ZERO_COPY_SUPPORT == ENABLED)
+         //Caller-owned buffers which are entirely acknowledged are released
+         tcpUpdateTxRefQueue(socket);
+#endif
+
+         //Loss recovery terminates once all the data outstanding
+         //when it started has been acknowledged
+         if(TCP_CMP_SEQ(socket->sndUna, socket->recoveryPoint) >= 0)
+         {
+            //Fast recovery in progress?
+            if(socket->lossRecovery)
+            {
+               //Debug message
+               TRACE_INFO("TCP loss recovery complete\r\n");
+
+#if (TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
+               //Deflate the congestion window (refer to RFC 6582 3.2 step 3)
+               socket->cwnd = MAX(socket->sndNxt - socket->sndUna, socket->mss) + socket->mss;
+               socket->cwnd = MIN(socket->cwnd, socket->ssthresh);
+               //Notify the congestion control algorithm
+               socket->congestAlgo->cwndEvent(socket, TCP_CONGEST_EVENT_RECOVERY_END);
+#endif
+               //Leave fast recovery
+               socket->lossRecovery = FALSE;
+            }
+         }
+#if (TCP_SACK_SUPPORT == ENABLED)
+         //SACK in use?
+         else if(socket->sackPermitted)
+         {
+            //A partial ACK: keep filling the remaining holes
+            tcpSackRetransmit(socket);
+         }
+#endif
+         //Fast recovery in progress?
+         else if(socket->lossRecovery)
+         {
+            //A partial ACK indicates that the first unacknowledged segment
+            //was lost as well (refer to RFC 6582 3.2 step 5)
+            if(socket->retransmitQueue != NULL)
+               tcpRetransmitQueueItem(socket, socket->retransmitQueue);
+
+#if (TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
+            //Deflate the congestion window by the amount of new data
+            //acknowledged, then add back one SMSS
+            socket->cwnd = (socket->cwnd > n) ? (socket->cwnd - n) : 0;
+            socket->cwnd = MAX(socket->cwnd, socket->mss);
+
+            if(n >= socket->mss)
+               socket->cwnd += socket->mss;
+#endif
+         }
       }
       //The incoming ACK segment does not acknowledge new data?
       else
@@ -723,18 +1004,68 @@ error_t tcpCheckAck(Socket *socket, TcpHeader *segment, size_t length)
             TRACE_INFO("TCP duplicate ACK #%u\r\n", socket->dupAckCount);
          }
 
-         //Check the number of duplicate ACKs that have been received
-         if(socket->dupAckCount == TCP_FAST_RETRANSMIT_THRES)
+#if (TCP_SACK_SUPPORT == ENABLED)
+         //SACK in use?
+         if(socket->sackPermitted)
          {
+            //Loss recovery already in progress?
+            if(TCP_CMP_SEQ(socket->sndUna, socket->recoveryPoint) < 0)
+            {
+               //Retransmit the holes that the pipe allows
+               tcpSackRetransmit(socket);
+            }
+            //Enough duplicate ACKs or the first segment deemed lost?
+            else if(socket->retransmitQueue != NULL &&
+               (socket->dupAckCount >= TCP_FAST_RETRANSMIT_THRES ||
+               tcpIsSegmentLost(socket, socket->retransmitQueue)))
+            {
+               //Debug message
+               TRACE_INFO("%s: TCP SACK loss recovery...\r\n",
+                  formatSystemTime(osGetSystemTime(), NULL));
+               //Update statistics
+               NET_STATS_INC_COUNTER(socket->stats.fastRetransmits, 1);
+
+               //Enter fast recovery
+               socket->lossRecovery = TRUE;
+               //Recovery ends when all the data sent so far is acknowledged
+               socket->recoveryPoint = socket->sndNxt;
+
 #if (TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
-            //Amount of data that has been sent but not yet acknowledged
-            uint_t flightSize = socket->sndNxt - socket->sndUna;
-            //After receiving 3 duplicate ACKs, ssthresh must be adjusted
-            socket->ssthresh = MAX(flightSize / 2, 2 * socket->mss);
+               //Let the congestion control algorithm compute ssthresh
+               socket->congestAlgo->onLoss(socket);
+               //cwnd is set to ssthresh (refer to RFC 6675 5 step 4.2)
+               socket->cwnd = socket->ssthresh;
 #endif
+               //The first unacknowledged segment must be retransmitted
+               //without regard to the pipe (refer to RFC 6675 5 step 4.2)
+               tcpRetransmitQueueItem(socket, socket->retransmitQueue);
+               //Then use the remaining window to fill other holes
+               tcpSackRetransmit(socket);
+            }
+         }
+         else
+#endif
+         //Check the number of duplicate ACKs that have been received. Fast
+         //retransmit is not invoked again until the data outstanding at the
+         //time of the last loss is acknowledged (refer to RFC 6582 3.2)
+         if(!socket->lossRecovery && socket->dupAckCount == TCP_FAST_RETRANSMIT_THRES &&
+            TCP_CMP_SEQ(socket->sndUna, socket->recoveryPoint) >= 0)
+         {
             //Debug message
             TRACE_INFO("%s: TCP fast retransmit...\r\n",
                formatSystemTime(osGetSystemTime(), NULL));
+            //Update statistics
+            NET_STATS_INC_COUNTER(socket->stats.fastRetransmits, 1);
+
+            //Enter fast recovery
+            socket->lossRecovery = TRUE;
+            //Recovery ends when all the data sent so far is acknowledged
+            socket->recoveryPoint = socket->sndNxt;
+
+#if (TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
+            //After receiving 3 duplicate ACKs, ssthresh must be adjusted
+            socket->congestAlgo->onLoss(socket);
+#endif
 
             //TCP performs a retransmission of what appears to be the missing
             //segment, without waiting for the retransmission timer to expire
@@ -747,7 +1078,7 @@ error_t tcpCheckAck(Socket *socket, TcpHeader *segment, size_t length)
             socket->cwnd = socket->ssthresh + TCP_FAST_RETRANSMIT_THRES * socket->mss;
 #endif
          }
-         else if(socket->dupAckCount > TCP_FAST_RETRANSMIT_THRES)
+         else if(socket->lossRecovery)
          {
 #if (TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
             //For each additional duplicate ACK received (after the third),
@@ -802,8 +1133,13 @@ void tcpProcessSegmentData(Socket *socket, TcpHeader *segment,
    {
       //Ignore the data that falls outside the receive window
       rightEdge = socket->rcvNxt + socket->rcvWnd;
+      //Update statistics
+      NET_STATS_INC_COUNTER(socket->stats.rxBufferFull, 1);
    }
 
+   //Update statistics
+   NET_STATS_INC_COUNTER(socket->stats.rxBytes, rightEdge - leftEdge);
+
    //Copy the incoming data to the receive buffer
    tcpWriteRxBuffer(socket, leftEdge, buffer, offset, rightEdge - leftEdge);
 
@@ -814,12 +1150,39 @@ void tcpProcessSegmentData(Socket *socket, TcpHeader *segment,
    //Check whether the segment was received out of order
    if(TCP_CMP_SEQ(leftEdge, socket->rcvNxt) > 0)
    {
+      //Update statistics
+      NET_STATS_INC_COUNTER(socket->stats.outOfOrderSegments, 1);
+
       //Out of order data segments should be acknowledged
       //immediately, in order to accelerate loss recovery
       tcpSendSegment(socket, TCP_FLAG_ACK, socket->sndNxt, socket->rcvNxt, 0, FALSE);
    }
    else
    {
+#if (TCP_DELAYED_ACK_SUPPORT == ENABLED)
+      //The largest segment received so far gives the size of the
+      //full-sized segments sent by the peer
+      socket->rcvMss = MAX(socket->rcvMss, MIN(length, TCP_MAX_MSS));
+      //More data waiting to be acknowledged
+      socket->delayedAckBytes += length;
+
+      //An ACK should be generated for at least every second full-sized
+      //segment, and immediately when a segment fills in a gap in the
+      //sequence space (refer to RFC 5681 4.2)
+      if(socket->delayedAckBytes >= (2 * socket->rcvMss) ||
+         TCP_CMP_SEQ(rightEdge, segment->seqNum + length) > 0)
+      {
+         //The ACK is sent once the incoming segment has been processed,
+         //so that it can be piggybacked on outgoing data
+         socket->ackRequired = TRUE;
+      }
+      else if(!tcpTimerRunning(&socket->delayedAckTimer))
+      {
+         //Otherwise the ACK may be delayed for a limited time
+         tcpTimerStart(&socket->delayedAckTimer, TCP_DELAYED_ACK_TIMEOUT);
+      }
+#endif
+
       //Number of contiguous bytes that have been received
       length = rightEdge - leftEdge;
 
@@ -830,8 +1193,10 @@ void tcpProcessSegmentData(Socket *socket, TcpHeader *segment,
       //Update the receive window
       socket->rcvWnd -= length;
 
-      //Acknowledge the received data (delayed ACK not supported)
+#if (TCP_DELAYED_ACK_SUPPORT == DISABLED)
+      //Acknowledge the received data
       tcpSendSegment(socket, TCP_FLAG_ACK, socket->sndNxt, socket->rcvNxt, 0, FALSE);
+#endif
       //Notify user task that data is available
       tcpUpdateEvents(socket);
    }
@@ -851,6 +1216,11 @@ void tcpDeleteControlBlock(Socket *socket)
    //Delete SYN queue
    tcpFlushSynQueue(socket);
 
+#if (TCP_ZERO_COPY_SUPPORT == ENABLED)
+   //Give caller-owned buffers back
+   tcpFlushTxRefQueue(socket);
+#endif
+
    //Release transmit buffer
    netBufferSetLength((NetBuffer *) &socket->txBuffer, 0);
 
@@ -966,6 +1336,62 @@ void tcpFlushRetransmitQueue(Socket *socket)
 }
 
 
+/**
+ * @brief Append a new item to the SYN queue
+ * @param[in] socket Handle referencing the listening socket
+ * @return Pointer to the newly created item, or NULL if the
+ *   SYN queue is full or if memory could not be allocated
+ **/
+
+TcpSynQueueItem *tcpAddSynQueueItem(Socket *socket)
+{
+   uint_t i;
+   TcpSynQueueItem *queueItem;
+
+   //The SYN queue is empty?
+   if(!socket->synQueue)
+   {
+      //Allocate memory to save incoming data
+      queueItem = memPoolAlloc(sizeof(TcpSynQueueItem));
+      //Add the newly created item to the queue
+      socket->synQueue = queueItem;
+   }
+   else
+   {
+      //Point to the very first item
+      queueItem = socket->synQueue;
+
+      //Reach the last item in the receive queue
+      for(i = 1; queueItem->next; i++)
+         queueItem = queueItem->next;
+
+      //Make sure the receive queue is not full
+      if(i >= socket->synQueueSize)
+         return NULL;
+
+      //Allocate memory to save incoming data
+      queueItem->next = memPoolAlloc(sizeof(TcpSynQueueItem));
+      //Point to the newly created item
+      queueItem = queueItem->next;
+   }
+
+   //Failed to allocate memory?
+   if(!queueItem)
+      return NULL;
+
+   //Initialize next field
+   queueItem->next = NULL;
+
+#if (TCP_SYN_COOKIE_SUPPORT == ENABLED)
+   //The item describes a regular connection request by default
+   queueItem->synCookie = FALSE;
+#endif
+
+   //Return a pointer to the newly created item
+   return queueItem;
+}
+
+
 /**
  * @brief Flush SYN queue
  * @param[in] socket Handle referencing the socket
@@ -992,6 +1418,109 @@ void tcpFlushSynQueue(Socket *socket)
 }
 
 
+#if (TCP_ZERO_COPY_SUPPORT == ENABLED)
+
+/**
+ * @brief Mark the caller-owned buffers that have been acknowledged
+ *
+ * The completion callbacks are not invoked here, since the socket mutex is
+ * held. The buffers stay at the head of the queue until they are retrieved
+ * by tcpGetCompletedTxRefs()
+ *
+ * @param[in] socket Handle referencing the socket
+ **/
+
+void tcpUpdateTxRefQueue(Socket *socket)
+{
+   TcpTxRef *ref;
+
+   //Buffers are queued in sequence number order
+   while(socket->txRefDoneCount < socket->txRefCount)
+   {
+      //Point to the oldest buffer that is still in use
+      ref = &socket->txRef[socket->txRefDoneCount];
+
+      //Wait until its last byte has been acknowledged
+      if(TCP_CMP_SEQ(socket->sndUna, ref->seqNum + ref->length) < 0)
+         break;
+
+      //The buffer is no longer referenced by the TCP layer
+      socket->txRefDoneCount++;
+   }
+}
+
+
+/**
+ * @brief Mark all caller-owned buffers as released
+ * @param[in] socket Handle referencing the socket
+ **/
+
+void tcpFlushTxRefQueue(Socket *socket)
+{
+   //The data will never be sent, so all the buffers can be given back
+   socket->txRefDoneCount = socket->txRefCount;
+}
+
+
+/**
+ * @brief Remove the released buffers from the queue
+ *
+ * This function is called with the socket mutex held. The owners of the
+ * buffers are then notified by tcpNotifyTxRefs() once the mutex has been
+ * released, so that the completion callbacks may use the socket API
+ *
+ * @param[in] socket Handle referencing the socket
+ * @param[out] ref Array of TCP_MAX_TX_REF_COUNT entries where to copy the
+ *   released buffers
+ * @return Number of released buffers
+ **/
+
+uint_t tcpGetCompletedTxRefs(Socket *socket, TcpTxRef *ref)
+{
+   uint_t n;
+
+   //Number of buffers waiting for their completion callback
+   n = socket->txRefDoneCount;
+
+   //Any buffer to give back?
+   if(n > 0)
+   {
+      //Copy the released buffers
+      memcpy(ref, socket->txRef, n * sizeof(TcpTxRef));
+
+      //Remove them from the queue
+      socket->txRefCount -= n;
+      socket->txRefDoneCount = 0;
+      memmove(socket->txRef, socket->txRef + n, socket->txRefCount * sizeof(TcpTxRef));
+   }
+
+   //Return the number of released buffers
+   return n;
+}
+
+
+/**
+ * @brief Notify the owners of released buffers
+ *
+ * This function must be called without holding the socket mutex
+ *
+ * @param[in] socket Handle referencing the socket
+ * @param[in] ref Buffers returned by tcpGetCompletedTxRefs()
+ * @param[in] count Number of buffers
+ **/
+
+void tcpNotifyTxRefs(Socket *socket, const TcpTxRef *ref, uint_t count)
+{
+   uint_t i;
+
+   //Loop through the released buffers, oldest first
+   for(i = 0; i < count; i++)
+      ref[i].callback(socket, ref[i].data, ref[i].length, ref[i].param);
+}
+
+#endif
+
+
 /**
  * @brief Update the list of non-contiguous blocks that have been received
  * @param[in] socket Handle referencing the socket
@@ -1041,14 +1570,310 @@ void tcpUpdateSackBlocks(Socket *socket, uint32_t *leftEdge, uint32_t *rightEdge
 
 
 /**
- * @brief Update receive window so as to avoid Silly Window Syndrome
+ * @brief Update the SACK scoreboard
+ * @param[in] socket Handle referencing the socket
+ * @param[in] segment Incoming ACK segment
+ **/
+
+void tcpUpdateScoreboard(Socket *socket, TcpHeader *segment)
+{
+   uint_t i;
+   uint_t n;
+   uint32_t leftEdge;
+   uint32_t rightEdge;
+   uint32_t seqNum;
+   bool_t updated;
+   TcpOption *option;
+   TcpQueueItem *queueItem;
+   TcpHeader *header;
+
+   //Search the TCP header for the SACK option
+   option = tcpGetOption(segment, TCP_OPTION_SACK);
+   //Option not found or malformed?
+   if(!option || option->length < 10 || ((option->length - 2) % 8) != 0)
+      return;
+
+   //No segment has been marked yet
+   updated = FALSE;
+
+   //Number of blocks reported by the remote host
+   n = (option->length - 2) / 8;
+
+   //Loop through the SACK blocks
+   for(i = 0; i < n; i++)
+   {
+      //Retrieve the edges of the current block
+      leftEdge = LOAD32BE(option->value + i * 8);
+      rightEdge = LOAD32BE(option->value + i * 8 + 4);
+
+      //Discard invalid blocks as well as D-SACK blocks that
+      //report data below the cumulative acknowledgment
+      if(TCP_CMP_SEQ(leftEdge, rightEdge) >= 0)
+         continue;
+      if(TCP_CMP_SEQ(rightEdge, segment->ackNum) <= 0)
+         continue;
+      if(TCP_CMP_SEQ(rightEdge, socket->sndNxt) > 0)
+         continue;
+
+      //Mark the segments entirely covered by the block
+      for(queueItem = socket->retransmitQueue; queueItem != NULL; queueItem = queueItem->next)
+      {
+         //Point to the TCP header
+         header = (TcpHeader *) queueItem->header;
+         //First sequence number occupied by the segment
+         seqNum = ntohl(header->seqNum);
+
+         //Check whether the segment falls within the block
+         if(!queueItem->sacked && queueItem->length > 0 &&
+            TCP_CMP_SEQ(seqNum, leftEdge) >= 0 &&
+            TCP_CMP_SEQ(seqNum + queueItem->length, rightEdge) <= 0)
+         {
+            queueItem->sacked = TRUE;
+            updated = TRUE;
+         }
+      }
+   }
+
+   //The loss state only changes when new segments are SACKed
+   if(updated)
+      tcpUpdateLossState(socket);
+}
+
+
+/**
+ * @brief Update the loss state of the segments in the retransmission queue
+ *
+ * A segment is deemed lost when either DupThresh segments or more than
+ * (DupThresh - 1) * SMSS bytes above it have been selectively acknowledged
+ * (refer to RFC 6675 4). The SACKed segments and bytes above each segment
+ * are derived from the totals in a single walk of the queue, and the result
+ * is cached until the scoreboard changes. Removing acknowledged segments
+ * from the head of the queue or appending new ones at the tail leaves the
+ * loss state of the other segments unchanged
+ *
+ * @param[in] socket Handle referencing the socket
+ **/
+
+void tcpUpdateLossState(Socket *socket)
+{
+   uint_t n;
+   size_t length;
+   TcpQueueItem *queueItem;
+
+   //Total number of SACKed segments and bytes
+   n = 0;
+   length = 0;
+
+   //Loop through the retransmission queue
+   for(queueItem = socket->retransmitQueue; queueItem != NULL; queueItem = queueItem->next)
+   {
+      if(queueItem->sacked)
+      {
+         n++;
+         length += queueItem->length;
+      }
+   }
+
+   //Loop through the retransmission queue again
+   for(queueItem = socket->retransmitQueue; queueItem != NULL; queueItem = queueItem->next)
+   {
+      //SACKed segments have been received
+      if(queueItem->sacked)
+      {
+         //Only count the SACKed data above the following segments
+         n--;
+         length -= queueItem->length;
+         queueItem->lost = FALSE;
+      }
+      //Apply the loss detection rule
+      else if(n >= TCP_FAST_RETRANSMIT_THRES)
+      {
+         queueItem->lost = TRUE;
+      }
+      else if(length > (TCP_FAST_RETRANSMIT_THRES - 1) * socket->mss)
+      {
+         queueItem->lost = TRUE;
+      }
+      else
+      {
+         queueItem->lost = FALSE;
+      }
+   }
+}
+
+
+/**
+ * @brief Determine whether a segment is deemed lost
+ *
+ * A segment is considered lost when either DupThresh segments or more
+ * than (DupThresh - 1) * SMSS bytes above it have been selectively
+ * acknowledged (refer to RFC 6675 4). After a retransmission timeout,
+ * every segment that has not been SACKed is considered lost. The result
+ * is taken from the state cached by tcpUpdateLossState()
+ *
+ * @param[in] socket Handle referencing the socket
+ * @param[in] queueItem Segment in the retransmission queue
+ * @return TRUE if the segment is deemed lost, else FALSE
+ **/
+
+bool_t tcpIsSegmentLost(Socket *socket, TcpQueueItem *queueItem)
+{
+   //SACKed segments have been received
+   if(queueItem->sacked)
+      return FALSE;
+
+   //Recovery following a retransmission timeout?
+   if(!socket->lossRecovery && TCP_CMP_SEQ(socket->sndUna, socket->recoveryPoint) < 0)
+      return TRUE;
+
+   //Apply the loss detection rule
+   return queueItem->lost;
+}
+
+
+/**
+ * @brief Estimate the number of bytes still in the network (RFC 6675 SetPipe)
+ * @param[in] socket Handle referencing the socket
+ * @return Amount of outstanding data, in bytes
+ **/
+
+uint32_t tcpComputePipe(Socket *socket)
+{
+   uint32_t pipe;
+   TcpQueueItem *queueItem;
+
+   //Initialize the estimate
+   pipe = 0;
+
+   //Loop through the retransmission queue
+   for(queueItem = socket->retransmitQueue; queueItem != NULL; queueItem = queueItem->next)
+   {
+      //SACKed segments have left the network
+      if(!queueItem->sacked)
+      {
+         //The original transmission is still in flight unless deemed lost
+         if(!tcpIsSegmentLost(socket, queueItem))
+            pipe += queueItem->length;
+         //So is the retransmission, if any
+         if(queueItem->retransmitted)
+            pipe += queueItem->length;
+      }
+   }
+
+   //Return the amount of outstanding data
+   return pipe;
+}
+
+
+/**
+ * @brief Retransmit the holes of the SACK scoreboard
+ *
+ * Segments are selected as in RFC 6675 NextSeg(), as long as the
+ * congestion window allows at least one full-sized segment to be sent.
+ * New data is handled by tcpNagleAlgo(). The pipe is computed once and
+ * then updated after each retransmission, and the searches resume where
+ * the previous ones stopped, so that the whole queue is walked a bounded
+ * number of times
+ *
+ * @param[in] socket Handle referencing the socket
+ **/
+
+void tcpSackRetransmit(Socket *socket)
+{
+   error_t error;
+   uint32_t n;
+   uint32_t pipe;
+   TcpQueueItem *queueItem;
+   TcpQueueItem *hole;
+   TcpQueueItem *nextLost;
+   TcpQueueItem *nextRescue;
+
+   //The amount of data in flight is limited by the receiver window
+   n = MIN(socket->sndWnd, socket->txBufferSize);
+
+#if (TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
+   //Check the congestion window
+   n = MIN(n, socket->cwnd);
+#endif
+
+   //Estimate the amount of outstanding data
+   pipe = tcpComputePipe(socket);
+
+   //The searches start at the head of the retransmission queue
+   nextLost = socket->retransmitQueue;
+   nextRescue = socket->retransmitQueue;
+
+   //Send as many segments as the window allows
+   while(1)
+   {
+      //At least one full-sized segment must fit in the window
+      if(pipe >= n || (n - pipe) < socket->mss)
+         break;
+
+      //Find the first segment that is deemed lost and has not been
+      //retransmitted yet
+      for(hole = nextLost; hole != NULL; hole = hole->next)
+      {
+         if(hole->length > 0 && !hole->retransmitted && tcpIsSegmentLost(socket, hole))
+            break;
+      }
+
+      //The segments skipped so far will not be selected later
+      nextLost = hole;
+
+      //When no new data is waiting, retransmit the first segment that
+      //has not been SACKed and lies below the highest SACKed one
+      if(hole == NULL && !socket->sndUser)
+      {
+         for(queueItem = nextRescue; queueItem != NULL; queueItem = queueItem->next)
+         {
+            //SACKed segment found above a candidate?
+            if(queueItem->sacked && hole != NULL)
+               break;
+            //Record the first candidate
+            if(!queueItem->sacked && !queueItem->retransmitted &&
+               queueItem->length > 0 && hole == NULL)
+            {
+               hole = queueItem;
+            }
+         }
+
+         //The candidate is not followed by any SACKed segment
+         if(queueItem == NULL)
+            hole = NULL;
+         else
+            nextRescue = hole->next;
+      }
+
+      //Nothing left to retransmit?
+      if(hole == NULL)
+         break;
+
+      //Retransmit the segment
+      error = tcpRetransmitQueueItem(socket, hole);
+      //Any error to report?
+      if(error) break;
+
+      //The retransmission is now in flight. The original transmission
+      //was either deemed lost or already counted in the pipe
+      pipe += hole->length;
+
+      //Resume the search after the segment that has just been resent
+      if(nextLost == hole)
+         nextLost = hole->next;
+   }
+}
+
+
+/**
+ * @brief Update receive window so as to avoid Silly Window Syndrome
  * @param[in] socket Handle referencing the socket
  **/
 
 void tcpUpdateReceiveWindow(Socket *socket)
 {
    //Space available but not yet advertised
-   uint16_t reduction = socket->rxBufferSize - socket->rcvUser - socket->rcvWnd;
+   uint32_t reduction = socket->rxBufferSize - socket->rcvUser - socket->rcvWnd;
 
    //To avoid SWS, the receiver should not advertise small windows
    if((socket->rcvWnd + reduction) >= MIN(socket->mss, socket->rxBufferSize / 2))
@@ -1076,48 +1901,106 @@ void tcpUpdateReceiveWindow(Socket *socket)
 
 /**
  * @brief Compute retransmission timeout
+ *
+ * When the Timestamps option is in use, every ACK that acknowledges new
+ * data yields an RTT sample and the estimator gains are scaled down by
+ * the number of samples expected per round-trip (refer to RFC 7323
+ * appendix G). Otherwise, one segment per round-trip is timed
+ *
  * @param[in] socket Handle referencing the socket
+ * @param[in] segment Incoming ACK segment
  **/
 
-void tcpComputeRto(Socket *socket)
+void tcpComputeRto(Socket *socket, TcpHeader *segment)
 {
-   //Ensure the incoming ACK number covers the expected sequence number
-   if(socket->rttBusy && TCP_CMP_SEQ(socket->sndUna, socket->rttSeqNum) > 0)
+   bool_t valid;
+   uint_t k;
+   systime_t r;
+   systime_t delta;
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+   uint32_t tsVal;
+   uint32_t tsEcr;
+#endif
+
+   //No RTT sample yet
+   valid = FALSE;
+   r = 0;
+   //Number of RTT samples expected per round-trip
+   k = 1;
+
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+   //A non-zero TSecr echoes the TSval of the segment being acknowledged
+   if(socket->tsEnabled && !tcpGetTimestamps(segment, &tsVal, &tsEcr) && tsEcr != 0)
    {
       //Calculate round-time trip
-      systime_t r = osGetSystemTime() - socket->rttStartTime;
+      r = osGetSystemTime() + socket->tsOffset - tsEcr;
 
-      //First RTT measurement?
-      if(!socket->srtt && !socket->rttvar)
+      //Discard samples echoing a timestamp from the future
+      if((int32_t) r >= 0)
       {
-         //Initialize RTO calculation algorithm
-         socket->srtt = r;
-         socket->rttvar = r / 2;
+         //ExpectedSamples = ceiling(FlightSize / (SMSS * 2))
+         k = (socket->sndNxt - socket->sndUna + 2 * socket->mss - 1) / (2 * socket->mss);
+         k = MAX(k, 1);
+         k = MIN(k, TCP_MAX_RTT_SAMPLES);
+
+         //The RTT sample is valid
+         valid = TRUE;
       }
-      else
+   }
+#endif
+
+   //Ensure the incoming ACK number covers the expected sequence number
+   if(socket->rttBusy && TCP_CMP_SEQ(socket->sndUna, socket->rttSeqNum) > 0)
+   {
+      //Fall back to the timed segment if no timestamp could be used
+      if(!valid)
       {
-         //Calculate the difference between the measured value and the current RTT estimator
-         systime_t delta = (r > socket->srtt) ? (r - socket->srtt) : (socket->srtt - r);
-         //Implement Van Jacobson's algorithm (as specified in RFC 6298 2.3)
-         socket->rttvar = (3 * socket->rttvar + delta) / 4;
-         socket->srtt = (7 * socket->srtt + r) / 8;
+         //Calculate round-time trip
+         r = osGetSystemTime() - socket->rttStartTime;
+         //The RTT sample is valid
+         valid = TRUE;
       }
 
-      //Calculate the next retransmission timeout
-      socket->rto = socket->srtt + 4 * socket->rttvar;
-      //Whenever RTO is computed, if it is less than 1 second, then
-      //the RTO should be rounded up to 1 second
-      socket->rto = MAX(socket->rto, TCP_MIN_RTO);
-      //A maximum value may be placed on RTO provided it is at least 60 seconds
-      socket->rto = MIN(socket->rto, TCP_MAX_RTO);
-
-      //Debug message
-      TRACE_DEBUG("R=%" PRIu32 ", SRTT=%" PRIu32 ", RTTVAR=%" PRIu32 ", RTO=%" PRIu32 "\r\n",
-         r, socket->srtt, socket->rttvar, socket->rto);
-
       //RTT measurement is complete
       socket->rttBusy = FALSE;
    }
+
+   //No RTT sample available?
+   if(!valid)
+      return;
+
+   //Convert the RTT sample to fixed-point representation
+   r = MIN(r, TCP_MAX_RTO) << TCP_RTT_FRAC_BITS;
+
+   //First RTT measurement?
+   if(!socket->srtt && !socket->rttvar)
+   {
+      //Initialize RTO calculation algorithm
+      socket->srtt = r;
+      socket->rttvar = r / 2;
+   }
+   else
+   {
+      //Calculate the difference between the measured value and the current RTT estimator
+      delta = (r > socket->srtt) ? (r - socket->srtt) : (socket->srtt - r);
+      //Implement Van Jacobson's algorithm (as specified in RFC 6298 2.3),
+      //with alpha = 1/(8k) and beta = 1/(4k)
+      socket->rttvar = ((4 * k - 1) * socket->rttvar + delta) / (4 * k);
+      socket->srtt = ((8 * k - 1) * socket->srtt + r) / (8 * k);
+   }
+
+   //Calculate the next retransmission timeout
+   socket->rto = (socket->srtt + 4 * socket->rttvar) >> TCP_RTT_FRAC_BITS;
+   //Whenever RTO is computed, if it is less than 1 second, then
+   //the RTO should be rounded up to 1 second
+   socket->rto = MAX(socket->rto, TCP_MIN_RTO);
+   //A maximum value may be placed on RTO provided it is at least 60 seconds
+   socket->rto = MIN(socket->rto, TCP_MAX_RTO);
+
+   //Debug message
+   TRACE_DEBUG("R=%" PRIu32 ", SRTT=%" PRIu32 ", RTTVAR=%" PRIu32 ", RTO=%" PRIu32 "\r\n",
+      r >> TCP_RTT_FRAC_BITS, socket->srtt >> TCP_RTT_FRAC_BITS,
+      socket->rttvar >> TCP_RTT_FRAC_BITS, socket->rto);
 }
 
 
@@ -1130,11 +2013,8 @@ void tcpComputeRto(Socket *socket)
 error_t tcpRetransmitSegment(Socket *socket)
 {
    error_t error;
-   size_t offset;
    size_t length;
-   NetBuffer *buffer;
    TcpQueueItem *queueItem;
-   TcpHeader *header;
 
    //Initialize error code
    error = NO_ERROR;
@@ -1147,68 +2027,135 @@ error_t tcpRetransmitSegment(Socket *socket)
    //Any segment in the retransmission queue?
    while(queueItem != NULL)
    {
-      //Total number of bytes that have been retransmitted
-      length += queueItem->length;
-
-      //The amount of data that can be sent cannot exceed the MSS
-      if(length > socket->mss)
+      //The first segment is always resent. The following ones are
+      //skipped if the peer has already selectively acknowledged them
+      if(queueItem == socket->retransmitQueue || !queueItem->sacked)
       {
-         //We are done
-         error = NO_ERROR;
-         //Exit immediately
-         break;
-      }
+         //Total number of bytes that have been retransmitted
+         length += queueItem->length;
 
-      //Point to the TCP header
-      header = (TcpHeader *) queueItem->header;
-
-      //Allocate a memory buffer to hold the TCP segment
-      buffer = ipAllocBuffer(0, &offset);
-      //Failed to allocate memory?
-      if(!buffer)
-      {
-         //Report an error
-         error = ERROR_OUT_OF_MEMORY;
-         //Exit immediately
-         break;
-      }
+         //The amount of data that can be sent cannot exceed the MSS
+         if(length > socket->mss)
+         {
+            //We are done
+            error = NO_ERROR;
+            //Exit immediately
+            break;
+         }
 
-      //Start of exception handling block
-      do
-      {
-         //Copy TCP header
-         error = netBufferAppend(buffer, header, header->dataOffset * 4);
+         //Retransmit the current segment
+         error = tcpRetransmitQueueItem(socket, queueItem);
          //Any error to report?
          if(error) break;
+      }
+
+      //Point to the next segment in the queue
+      queueItem = queueItem->next;
+   }
+
+   //Return status code
+   return error;
+}
 
-         //Copy data from send buffer
-         error = tcpReadTxBuffer(socket, ntohl(header->seqNum), buffer, queueItem->length);
-         //Any error to report?
-         if(error) break;
 
-         //Dump TCP header contents for debugging purpose
-         tcpDumpHeader(header, queueItem->length, socket->iss, socket->irs);
+/**
+ * @brief Retransmit a single segment from the retransmission queue
+ * @param[in] socket Handle referencing the socket
+ * @param[in] queueItem Segment to be retransmitted
+ * @return Error code
+ **/
+
+error_t tcpRetransmitQueueItem(Socket *socket, TcpQueueItem *queueItem)
+{
+   error_t error;
+   size_t offset;
+   NetBuffer *buffer;
+   TcpHeader *header;
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+   TcpOption *option;
+#endif
+
+   //Point to the TCP header
+   header = (TcpHeader *) queueItem->header;
 
-         //Retransmit the lost segment without waiting for the
-         //retransmission timer to expire
-         error = ipSendDatagram(socket->interface,
-            &queueItem->pseudoHeader, buffer, offset, 0);
+   //Allocate a memory buffer to hold the TCP segment
+   buffer = ipAllocBuffer(0, &offset);
+   //Failed to allocate memory?
+   if(!buffer) return ERROR_OUT_OF_MEMORY;
 
-         //End of exception handling block
-      } while(0);
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+   //Timestamps option in use?
+   if(socket->tsEnabled)
+   {
+      //Search the saved header for the Timestamps option
+      option = tcpGetOption(header, TCP_OPTION_TIMESTAMP);
 
-      //Free previously allocated memory
-      netBufferFree(buffer);
+      //Refresh TSval and TSecr so that the peer echoes the timestamp
+      //of the retransmission rather than the original transmission
+      if(option && option->length == 10)
+      {
+         STORE32BE(osGetSystemTime() + socket->tsOffset, option->value);
 
+         if(header->flags & TCP_FLAG_ACK)
+            STORE32BE(socket->tsRecent, option->value + 4);
+      }
+
+      //The checksum has to be computed again
+      header->checksum = 0;
+   }
+#endif
+
+   //Start of exception handling block
+   do
+   {
+      //Copy TCP header
+      error = netBufferAppend(buffer, header, header->dataOffset * 4);
       //Any error to report?
-      if(error)
+      if(error) break;
+
+      //Copy data from send buffer
+      error = tcpReadTxBuffer(socket, ntohl(header->seqNum), buffer, queueItem->length);
+      //Any error to report?
+      if(error) break;
+
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+      //Timestamps option in use?
+      if(socket->tsEnabled)
       {
-         //Exit immediately
-         break;
+         //Calculate TCP header checksum
+         header->checksum = ipCalcUpperLayerChecksumEx(queueItem->pseudoHeader.data,
+            queueItem->pseudoHeader.length, buffer, offset,
+            header->dataOffset * 4 + queueItem->length);
+
+         //Update the checksum field of the outgoing segment
+         netBufferWrite(buffer, offset + 16, &header->checksum, sizeof(uint16_t));
       }
+#endif
 
-      //Point to the next segment in the queue
-      queueItem = queueItem->next;
+      //Dump TCP header contents for debugging purpose
+      tcpDumpHeader(header, queueItem->length, socket->iss, socket->irs);
+
+      //Retransmit the lost segment without waiting for the
+      //retransmission timer to expire
+      error = ipSendDatagram(socket->interface,
+         &queueItem->pseudoHeader, buffer, offset, 0);
+
+      //End of exception handling block
+   } while(0);
+
+   //Free previously allocated memory
+   netBufferFree(buffer);
+
+   //Segment successfully retransmitted?
+   if(!error)
+   {
+      //Keep track of retransmitted segments (refer to RFC 6675 4)
+      queueItem->retransmitted = TRUE;
+
+      //Update statistics
+      NET_STATS_INC_COUNTER(socket->stats.retransmits, 1);
+      NET_STATS_INC_COUNTER(socket->stats.txPackets, 1);
+      NET_STATS_INC_COUNTER(socket->stats.txBytes, queueItem->length);
    }
 
    //Return status code
@@ -1241,11 +2188,39 @@ error_t tcpNagleAlgo(Socket *socket, uint_t flags)
    //Retrieve the size of the usable window
    u = n - (socket->sndNxt - socket->sndUna);
 
+#if (TCP_SACK_SUPPORT == ENABLED && TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
+   //During loss recovery, the amount of data in flight is estimated by
+   //the pipe rather than by SND.NXT - SND.UNA (refer to RFC 6675 5)
+   if(socket->sackPermitted && TCP_CMP_SEQ(socket->sndUna, socket->recoveryPoint) < 0)
+   {
+      //Estimate the amount of outstanding data
+      n = tcpComputePipe(socket);
+      //The receiver window still applies
+      u = MIN(socket->sndWnd, socket->txBufferSize) - (socket->sndNxt - socket->sndUna);
+
+      //Check whether the congestion window allows new data to be sent
+      if(n >= socket->cwnd)
+         u = 0;
+      else if((int_t) u >= 0)
+         u = MIN(u, socket->cwnd - n);
+   }
+#endif
+
    //The remote host should not shrink its window. However, we
    //must be robust against window shrinking, which may cause
    //the usable window to become negative
    if((int_t) u < 0) return NO_ERROR;
 
+#if (TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
+   //Transmission resumes after an idle period? The connection is idle when
+   //no data has been sent for at least one RTO (refer to RFC 5681 4.1)
+   if(socket->sndUser > 0 && socket->sndNxt == socket->sndUna &&
+      timeCompare(osGetSystemTime(), socket->lastTxTime + socket->rto) >= 0)
+   {
+      socket->congestAlgo->cwndEvent(socket, TCP_CONGEST_EVENT_TX_START);
+   }
+#endif
+
    //The Nagle algorithm discourages sending tiny segments when
    //the data to be sent increases in small increments
    while(socket->sndUser > 0)
@@ -1368,6 +2343,12 @@ void tcpChangeState(Socket *socket, TcpState newState)
 
    //Enter the desired state
    socket->state = newState;
+
+#if (SOCKET_HASH_SUPPORT == ENABLED)
+   //Move the socket to the hash table matching its new state
+   socketHashUpdate(socket);
+#endif
+
    //Update TCP related events
    tcpUpdateEvents(socket);
 }
@@ -1578,30 +2559,80 @@ error_t tcpReadTxBuffer(Socket *socket, uint32_t seqNum,
    NetBuffer *buffer, size_t length)
 {
    error_t error;
+   size_t n;
+   size_t offset;
+#if (TCP_ZERO_COPY_SUPPORT == ENABLED)
+   uint_t i;
+   TcpTxRef *ref;
+#endif
 
-   //Offset of the first byte to read in the circular buffer
-   size_t offset = (seqNum - socket->iss - 1) % socket->txBufferSize;
+   //Initialize status code
+   error = NO_ERROR;
 
-   //Check whether the specified data crosses buffer boundaries
-   if((offset + length) <= socket->txBufferSize)
-   {
-      //Copy the payload
-      error = netBufferConcat(buffer, (NetBuffer *) &socket->txBuffer,
-         offset, length);
-   }
-   else
+   //Process the requested data piece by piece
+   while(length > 0 && !error)
    {
-      //Copy the first part of the payload
-      error = netBufferConcat(buffer, (NetBuffer *) &socket->txBuffer,
-         offset, socket->txBufferSize - offset);
+      //Number of bytes to read from the circular buffer
+      n = length;
+
+#if (TCP_ZERO_COPY_SUPPORT == ENABLED)
+      //Loop through the caller-owned buffers
+      for(i = 0; i < socket->txRefCount; i++)
+      {
+         //Point to the current buffer
+         ref = &socket->txRef[i];
+
+         //Does the buffer hold the data at the current position?
+         if(TCP_CMP_SEQ(seqNum, ref->seqNum) >= 0 &&
+            TCP_CMP_SEQ(seqNum, ref->seqNum + ref->length) < 0)
+         {
+            //Reference the data in place rather than copying it
+            n = MIN(length, ref->seqNum + ref->length - seqNum);
+            error = netBufferAppend(buffer, ref->data + (seqNum - ref->seqNum), n);
+            break;
+         }
+         //Does the buffer start within the remaining range?
+         else if(TCP_CMP_SEQ(ref->seqNum, seqNum) > 0 &&
+            TCP_CMP_SEQ(ref->seqNum, seqNum + n) < 0)
+         {
+            //Stop reading from the circular buffer where it starts
+            n = ref->seqNum - seqNum;
+         }
+      }
 
-      //Check status code
-      if(!error)
+      //Data not found in a caller-owned buffer?
+      if(i >= socket->txRefCount)
+#endif
       {
-         //Wrap around to the beginning of the circular buffer
-         error = netBufferConcat(buffer, (NetBuffer *) &socket->txBuffer,
-            0, length - socket->txBufferSize + offset);
+         //Offset of the first byte to read in the circular buffer
+         offset = (seqNum - socket->iss - 1) % socket->txBufferSize;
+
+         //Check whether the specified data crosses buffer boundaries
+         if((offset + n) <= socket->txBufferSize)
+         {
+            //Copy the payload
+            error = netBufferConcat(buffer, (NetBuffer *) &socket->txBuffer,
+               offset, n);
+         }
+         else
+         {
+            //Copy the first part of the payload
+            error = netBufferConcat(buffer, (NetBuffer *) &socket->txBuffer,
+               offset, socket->txBufferSize - offset);
+
+            //Check status code
+            if(!error)
+            {
+               //Wrap around to the beginning of the circular buffer
+               error = netBufferConcat(buffer, (NetBuffer *) &socket->txBuffer,
+                  0, n - socket->txBufferSize + offset);
+            }
+         }
       }
+
+      //Advance data pointer
+      seqNum += n;
+      length -= n;
    }
 
    //Return status code
@@ -1675,6 +2706,59 @@ void tcpReadRxBuffer(Socket *socket, uint32_t seqNum, uint8_t *data, size_t leng
 }
 
 
+#if (TCP_ZERO_COPY_SUPPORT == ENABLED)
+
+/**
+ * @brief Describe data held in the receive buffer without copying it
+ * @param[in] socket Handle referencing the socket
+ * @param[in] seqNum Sequence number of the first data to describe
+ * @param[in] length Number of data to describe
+ * @param[out] chunk Array where to store the chunk descriptors
+ * @param[in] maxChunkCount Number of entries in the array
+ * @param[out] chunkCount Number of chunk descriptors that have been filled
+ * @return Number of data bytes covered by the chunk descriptors
+ **/
+
+size_t tcpGetRxBufferChunks(Socket *socket, uint32_t seqNum, size_t length,
+   ChunkDesc *chunk, uint_t maxChunkCount, uint_t *chunkCount)
+{
+   size_t n;
+   uint_t k;
+
+   //Offset of the first byte to describe in the circular buffer
+   size_t offset = (seqNum - socket->irs - 1) % socket->rxBufferSize;
+
+   //Check whether the specified data crosses buffer boundaries
+   if((offset + length) <= socket->rxBufferSize)
+   {
+      //Describe the payload
+      n = netBufferGetChunks((NetBuffer *) &socket->rxBuffer,
+         offset, length, chunk, maxChunkCount, chunkCount);
+   }
+   else
+   {
+      //Describe the first part of the payload
+      n = netBufferGetChunks((NetBuffer *) &socket->rxBuffer,
+         offset, socket->rxBufferSize - offset, chunk, maxChunkCount, chunkCount);
+
+      //Wrap around to the beginning of the circular buffer
+      if(n == (socket->rxBufferSize - offset))
+      {
+         n += netBufferGetChunks((NetBuffer *) &socket->rxBuffer, 0,
+            length - n, chunk + *chunkCount, maxChunkCount - *chunkCount, &k);
+
+         //Total number of chunk descriptors
+         *chunkCount += k;
+      }
+   }
+
+   //Return the number of bytes described
+   return n;
+}
+
+#endif
+
+
 /**
  * @brief Dump TCP header for debugging purpose
  * @param[in] segment Pointer to the TCP header
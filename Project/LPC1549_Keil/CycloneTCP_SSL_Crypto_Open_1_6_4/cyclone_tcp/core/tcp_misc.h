@@ -42,6 +42,10 @@ error_t tcpSendResetSegment(NetInterface *interface,
 error_t tcpAddOption(TcpHeader *segment, uint8_t kind, const void *value, uint8_t length);
 TcpOption *tcpGetOption(TcpHeader *segment, uint8_t kind);
 
+uint8_t tcpComputeWindowScale(Socket *socket);
+uint32_t tcpGetSegmentWindow(Socket *socket, TcpHeader *segment);
+error_t tcpGetTimestamps(TcpHeader *segment, uint32_t *tsVal, uint32_t *tsEcr);
+
 error_t tcpCheckSequenceNumber(Socket *socket, TcpHeader *segment, size_t length);
 error_t tcpCheckSyn(Socket *socket, TcpHeader *segment, size_t length);
 error_t tcpCheckAck(Socket *socket, TcpHeader *segment, size_t length);
@@ -54,13 +58,25 @@ void tcpDeleteControlBlock(Socket *socket);
 void tcpUpdateRetransmitQueue(Socket *socket);
 void tcpFlushRetransmitQueue(Socket *socket);
 
+TcpSynQueueItem *tcpAddSynQueueItem(Socket *socket);
 void tcpFlushSynQueue(Socket *socket);
 
+void tcpUpdateTxRefQueue(Socket *socket);
+void tcpFlushTxRefQueue(Socket *socket);
+uint_t tcpGetCompletedTxRefs(Socket *socket, TcpTxRef *ref);
+void tcpNotifyTxRefs(Socket *socket, const TcpTxRef *ref, uint_t count);
+
 void tcpUpdateSackBlocks(Socket *socket, uint32_t *leftEdge, uint32_t *rightEdge);
+void tcpUpdateScoreboard(Socket *socket, TcpHeader *segment);
+void tcpUpdateLossState(Socket *socket);
+bool_t tcpIsSegmentLost(Socket *socket, TcpQueueItem *queueItem);
+uint32_t tcpComputePipe(Socket *socket);
+void tcpSackRetransmit(Socket *socket);
 void tcpUpdateReceiveWindow(Socket *socket);
 
-void tcpComputeRto(Socket *socket);
+void tcpComputeRto(Socket *socket, TcpHeader *segment);
 error_t tcpRetransmitSegment(Socket *socket);
+error_t tcpRetransmitQueueItem(Socket *socket, TcpQueueItem *queueItem);
 error_t tcpNagleAlgo(Socket *socket, uint_t flags);
 
 void tcpChangeState(Socket *socket, TcpState newState);
@@ -79,6 +95,9 @@ void tcpWriteRxBuffer(Socket *socket, uint32_t seqNum,
 
 void tcpReadRxBuffer(Socket *socket, uint32_t seqNum, uint8_t *data, size_t length);
 
+size_t tcpGetRxBufferChunks(Socket *socket, uint32_t seqNum, size_t length,
+   ChunkDesc *chunk, uint_t maxChunkCount, uint_t *chunkCount);
+
 void tcpDumpHeader(const TcpHeader *segment, size_t length, uint32_t iss, uint32_t irs);
 
 #endif
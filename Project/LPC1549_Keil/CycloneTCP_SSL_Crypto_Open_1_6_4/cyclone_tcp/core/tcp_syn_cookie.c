@@ -0,0 +1,776 @@
+/**
+ * @file tcp_syn_cookie.c
+ * @brief SYN cookies
+ *
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * When the SYN queue of a listening socket is full, the connection request
+ * is answered with a SYN-ACK whose initial sequence number encodes the MSS
+ * and the options of the client, so that no state has to be kept until the
+ * final ACK of the three-way handshake is received. The state of the
+ * connection is then reconstructed from that ACK. Refer to RFC 4987 for
+ * more details
+ *
+ * Once it has sent that ACK, the client considers the connection as
+ * established. Whenever the connection cannot be accepted at this point
+ * (SYN queue still full, or socket creation failing in tcpAccept()), it
+ * is therefore reset and the event is counted as a dropped segment of the
+ * listening socket, so that the client does not wait for data that will
+ * never come
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL TCP_TRACE_LEVEL
+
+//Dependencies
+#include <string.h>
+#include "core/net.h"
+#include "core/ip.h"
+#include "ipv4/ipv4.h"
+#include "ipv6/ipv6.h"
+#include "core/socket.h"
+#include "core/tcp.h"
+#include "core/tcp_misc.h"
+#include "core/tcp_syn_cookie.h"
+#include "date_time.h"
+#include "debug.h"
+
+//Check TCP/IP stack configuration
+#if (TCP_SUPPORT == ENABLED && TCP_SYN_COOKIE_SUPPORT == ENABLED)
+
+//Rotate left operation
+#define SIP_ROL64(a, n) (((a) << (n)) | ((a) >> (64 - (n))))
+
+//SipHash round function
+#define SIP_ROUND(v) \
+{ \
+   v[0] += v[1]; v[1] = SIP_ROL64(v[1], 13); v[1] ^= v[0]; v[0] = SIP_ROL64(v[0], 32); \
+   v[2] += v[3]; v[3] = SIP_ROL64(v[3], 16); v[3] ^= v[2]; \
+   v[0] += v[3]; v[3] = SIP_ROL64(v[3], 21); v[3] ^= v[0]; \
+   v[2] += v[1]; v[1] = SIP_ROL64(v[1], 17); v[1] ^= v[2]; v[2] = SIP_ROL64(v[2], 32); \
+}
+
+//The counter embedded in a SYN cookie is incremented every minute
+#define TCP_SYN_COOKIE_PERIOD 60000
+//Value of the window scale field when the option is not used
+#define TCP_SYN_COOKIE_NO_WND_SCALE 15
+
+//MSS values that can be encoded in a SYN cookie
+static const uint16_t tcpSynCookieMssTable[] =
+{
+   536,
+   1220,
+   1440,
+   1460
+};
+
+//Secret keys used to compute SYN cookies
+static bool_t tcpSynCookieKeyReady = FALSE;
+static uint64_t tcpSynCookieKey[2][2];
+
+//Internal functions
+static bool_t tcpSynCookiePending(Socket *socket,
+   const IpPseudoHeader *pseudoHeader, const TcpHeader *segment);
+
+static uint32_t tcpSynCookieHash(uint_t index, const IpPseudoHeader *pseudoHeader,
+   const TcpHeader *segment, uint32_t value);
+
+static uint64_t tcpSipHash(const uint64_t *key, const uint8_t *data, size_t length);
+
+
+/**
+ * @brief Send a SYN-ACK segment carrying a SYN cookie
+ * @param[in] socket Handle referencing the listening socket
+ * @param[in] interface Underlying network interface
+ * @param[in] pseudoHeader TCP pseudo header describing the incoming SYN
+ * @param[in] segment Incoming SYN segment
+ * @return Error code
+ **/
+
+error_t tcpSendSynCookie(Socket *socket, NetInterface *interface,
+   IpPseudoHeader *pseudoHeader, TcpHeader *segment)
+{
+   error_t error;
+   uint_t i;
+   size_t offset;
+   size_t length;
+   uint16_t mss;
+   uint32_t data;
+   uint32_t count;
+   uint32_t iss;
+   TcpOption *option;
+   NetBuffer *buffer;
+   TcpHeader *segment2;
+   IpPseudoHeader pseudoHeader2;
+#if (TCP_WINDOW_SCALE_SUPPORT == ENABLED)
+   uint8_t wndScale;
+#endif
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+   uint32_t tsVal;
+   uint32_t tsEcr;
+   uint8_t timestamps[8];
+#endif
+
+   //Maximum segment size
+   const uint16_t maxMss = HTONS(TCP_MAX_MSS);
+
+   //Generate the secret keys when the first SYN cookie is issued
+   if(!tcpSynCookieKeyReady)
+   {
+      //Loop through the keys
+      for(i = 0; i < 4; i++)
+      {
+         tcpSynCookieKey[i / 2][i % 2] = ((uint64_t) netGetRand() << 32) |
+            (netGetRand() ^ osGetSystemTime());
+      }
+
+      //The keys are now ready to use
+      tcpSynCookieKeyReady = TRUE;
+   }
+
+   //Default MSS value
+   mss = TCP_DEFAULT_MSS;
+
+   //Get the maximum segment size
+   option = tcpGetOption(segment, TCP_OPTION_MAX_SEGMENT_SIZE);
+   //Specified option found?
+   if(option && option->length == 4)
+      mss = LOAD16BE(option->value);
+
+   //Select the largest MSS value that does not exceed the MSS of the peer
+   for(i = arraysize(tcpSynCookieMssTable) - 1; i > 0; i--)
+   {
+      if(tcpSynCookieMssTable[i] <= mss)
+         break;
+   }
+
+   //The 2 least significant bits of the encoded data hold the MSS index
+   data = i;
+
+#if (TCP_SACK_SUPPORT == ENABLED)
+   //Check whether the remote host sent the SACK Permitted option
+   if(tcpGetOption(segment, TCP_OPTION_SACK_PERMITTED) != NULL)
+      data |= 0x04;
+#endif
+
+#if (TCP_WINDOW_SCALE_SUPPORT == ENABLED)
+   //Get the window scale factor
+   option = tcpGetOption(segment, TCP_OPTION_WINDOW_SCALE_FACTOR);
+   //Specified option found?
+   if(option && option->length == 3)
+      data |= MIN(option->value[0], TCP_MAX_WINDOW_SCALE) << 3;
+   else
+      data |= TCP_SYN_COOKIE_NO_WND_SCALE << 3;
+#else
+   //Window scaling is not used
+   data |= TCP_SYN_COOKIE_NO_WND_SCALE << 3;
+#endif
+
+   //The counter changes every minute, so that old cookies expire
+   count = osGetSystemTime() / TCP_SYN_COOKIE_PERIOD;
+
+   //The initial sequence number is derived from the 4-tuple, the ISN of the
+   //client, the counter and the encoded data
+   iss = tcpSynCookieHash(0, pseudoHeader, segment, 0) + segment->seqNum +
+      (count << 24) + ((tcpSynCookieHash(1, pseudoHeader, segment, count) + data) & 0x00FFFFFF);
+
+   //Allocate a memory buffer to hold the SYN-ACK segment
+   buffer = ipAllocBuffer(TCP_MAX_HEADER_LENGTH, &offset);
+   //Failed to allocate memory?
+   if(!buffer) return ERROR_OUT_OF_MEMORY;
+
+   //Point to the beginning of the TCP segment
+   segment2 = netBufferAt(buffer, offset);
+
+   //Format TCP header
+   segment2->srcPort = htons(segment->destPort);
+   segment2->destPort = htons(segment->srcPort);
+   segment2->seqNum = htonl(iss);
+   segment2->ackNum = htonl(segment->seqNum + 1);
+   segment2->reserved1 = 0;
+   segment2->dataOffset = 5;
+   segment2->flags = TCP_FLAG_SYN | TCP_FLAG_ACK;
+   segment2->reserved2 = 0;
+   segment2->window = htons(MIN(socket->rxBufferSize, UINT16_MAX));
+   segment2->checksum = 0;
+   segment2->urgentPointer = 0;
+
+   //Append MSS option
+   tcpAddOption(segment2, TCP_OPTION_MAX_SEGMENT_SIZE, &maxMss, sizeof(maxMss));
+
+#if (TCP_WINDOW_SCALE_SUPPORT == ENABLED)
+   //A SYN-ACK may only carry the option if the peer sent it first
+   if((data >> 3) != TCP_SYN_COOKIE_NO_WND_SCALE)
+   {
+      //The shift count must match the one used when the connection is accepted
+      wndScale = tcpComputeWindowScale(socket);
+      //Append Window Scale option
+      tcpAddOption(segment2, TCP_OPTION_WINDOW_SCALE_FACTOR, &wndScale, sizeof(uint8_t));
+   }
+#endif
+
+#if (TCP_SACK_SUPPORT == ENABLED)
+   //A SYN-ACK may only carry the option if the peer sent it first
+   if(data & 0x04)
+   {
+      //Append SACK Permitted option
+      tcpAddOption(segment2, TCP_OPTION_SACK_PERMITTED, NULL, 0);
+   }
+#endif
+
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+   //A SYN-ACK may only carry the option if the peer sent it first
+   if(!tcpGetTimestamps(segment, &tsVal, &tsEcr))
+   {
+      //The timestamp offset is derived from the 4-tuple, so that it can be
+      //recomputed when the connection is established
+      STORE32BE(osGetSystemTime() + tcpSynCookieHash(0, pseudoHeader, segment, 1), timestamps);
+      //Echo the timestamp value of the SYN segment
+      STORE32BE(tsVal, timestamps + 4);
+
+      //Append Timestamps option
+      tcpAddOption(segment2, TCP_OPTION_TIMESTAMP, timestamps, sizeof(timestamps));
+   }
+#endif
+
+   //Length of the complete TCP header
+   length = segment2->dataOffset * 4;
+   //Adjust the length of the multi-part buffer
+   netBufferSetLength(buffer, offset + length);
+
+#if (IPV4_SUPPORT == ENABLED)
+   //Destination address is an IPv4 address?
+   if(pseudoHeader->length == sizeof(Ipv4PseudoHeader))
+   {
+      //Format IPv4 pseudo header
+      pseudoHeader2.length = sizeof(Ipv4PseudoHeader);
+      pseudoHeader2.ipv4Data.srcAddr = pseudoHeader->ipv4Data.destAddr;
+      pseudoHeader2.ipv4Data.destAddr = pseudoHeader->ipv4Data.srcAddr;
+      pseudoHeader2.ipv4Data.reserved = 0;
+      pseudoHeader2.ipv4Data.protocol = IPV4_PROTOCOL_TCP;
+      pseudoHeader2.ipv4Data.length = htons(length);
+
+      //Calculate TCP header checksum
+      segment2->checksum = ipCalcUpperLayerChecksumEx(&pseudoHeader2.ipv4Data,
+         sizeof(Ipv4PseudoHeader), buffer, offset, length);
+   }
+   else
+#endif
+#if (IPV6_SUPPORT == ENABLED)
+   //Destination address is an IPv6 address?
+   if(pseudoHeader->length == sizeof(Ipv6PseudoHeader))
+   {
+      //Format IPv6 pseudo header
+      pseudoHeader2.length = sizeof(Ipv6PseudoHeader);
+      pseudoHeader2.ipv6Data.srcAddr = pseudoHeader->ipv6Data.destAddr;
+      pseudoHeader2.ipv6Data.destAddr = pseudoHeader->ipv6Data.srcAddr;
+      pseudoHeader2.ipv6Data.length = htonl(length);
+      pseudoHeader2.ipv6Data.reserved = 0;
+      pseudoHeader2.ipv6Data.nextHeader = IPV6_TCP_HEADER;
+
+      //Calculate TCP header checksum
+      segment2->checksum = ipCalcUpperLayerChecksumEx(&pseudoHeader2.ipv6Data,
+         sizeof(Ipv6PseudoHeader), buffer, offset, length);
+   }
+   else
+#endif
+   //Destination address is not valid?
+   {
+      //Free previously allocated memory
+      netBufferFree(buffer);
+      //This should never occur...
+      return ERROR_INVALID_ADDRESS;
+   }
+
+   //Debug message
+   TRACE_DEBUG("%s: Sending TCP SYN cookie...\r\n",
+      formatSystemTime(osGetSystemTime(), NULL));
+   //Dump TCP header contents for debugging purpose
+   tcpDumpHeader(segment2, 0, iss, segment->seqNum);
+
+   //Send TCP segment
+   error = ipSendDatagram(interface, &pseudoHeader2, buffer, offset, 0);
+
+   //Free previously allocated memory
+   netBufferFree(buffer);
+   //Return error code
+   return error;
+}
+
+
+/**
+ * @brief Validate the SYN cookie acknowledged by an incoming segment
+ *
+ * If the acknowledgment number matches a SYN cookie previously sent by the
+ * listening socket, the state of the connection is reconstructed and a new
+ * item is added to the SYN queue. The connection is then established as soon
+ * as the application calls socketAccept()
+ *
+ * Until then, the client may keep sending data on the connection. Such
+ * segments do not carry a SYN cookie and must neither create a second
+ * connection nor reset the pending one, so they are silently discarded
+ * and will be retransmitted by the client once the connection is accepted
+ *
+ * @param[in] socket Handle referencing the listening socket
+ * @param[in] interface Underlying network interface
+ * @param[in] pseudoHeader TCP pseudo header describing the incoming segment
+ * @param[in] segment Incoming ACK segment
+ * @return NO_ERROR if the SYN cookie is valid and the connection request has
+ *   been queued, ERROR_ALREADY_CONNECTED if a connection request is already
+ *   pending for the same 4-tuple (the segment must be silently discarded),
+ *   ERROR_OUT_OF_RESOURCES if the cookie is valid but the SYN queue is still
+ *   full, ERROR_FAILURE otherwise. The caller must reset the connection in
+ *   the last two cases
+ **/
+
+error_t tcpCheckSynCookie(Socket *socket, NetInterface *interface,
+   IpPseudoHeader *pseudoHeader, TcpHeader *segment)
+{
+   uint_t wndScale;
+   uint32_t isn;
+   uint32_t iss;
+   uint32_t count;
+   uint32_t age;
+   uint32_t value;
+   uint32_t data;
+   TcpSynQueueItem *queueItem;
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+   uint32_t tsEcr;
+#endif
+
+   //No SYN cookie has been issued so far?
+   if(!tcpSynCookieKeyReady)
+      return ERROR_FAILURE;
+
+   //The connection may already be waiting in the SYN queue
+   if(tcpSynCookiePending(socket, pseudoHeader, segment))
+   {
+      //Debug message
+      TRACE_DEBUG("TCP connection request already pending\r\n");
+      //Discard the segment without resetting the connection
+      return ERROR_ALREADY_CONNECTED;
+   }
+
+   //The segment acknowledges our SYN and follows the SYN of the client
+   iss = segment->ackNum - 1;
+   isn = segment->seqNum - 1;
+
+   //Retrieve the current value of the counter
+   count = osGetSystemTime() / TCP_SYN_COOKIE_PERIOD;
+
+   //Remove the first hash and the ISN of the client
+   value = iss - tcpSynCookieHash(0, pseudoHeader, segment, 0) - isn;
+   //Determine the age of the cookie from the 8 most significant bits
+   age = (count - (value >> 24)) & 0xFF;
+
+   //Reject cookies that have expired
+   if(age > TCP_SYN_COOKIE_MAX_AGE)
+      return ERROR_FAILURE;
+
+   //Remove the second hash to recover the encoded data
+   data = (value - tcpSynCookieHash(1, pseudoHeader, segment, count - age)) & 0x00FFFFFF;
+
+   //Only 7 bits of data are encoded in a valid cookie
+   if(data >= 0x80)
+      return ERROR_FAILURE;
+
+   //Retrieve the shift count of the client
+   wndScale = data >> 3;
+
+   //Check the value of the window scale field
+   if(wndScale > TCP_MAX_WINDOW_SCALE && wndScale != TCP_SYN_COOKIE_NO_WND_SCALE)
+      return ERROR_FAILURE;
+
+   //Debug message
+   TRACE_DEBUG("Valid TCP SYN cookie received\r\n");
+
+   //Append a new item to the SYN queue
+   queueItem = tcpAddSynQueueItem(socket);
+
+   //The SYN queue is still full?
+   if(!queueItem)
+   {
+      //Debug message
+      TRACE_WARNING("SYN queue full, resetting TCP SYN cookie connection!\r\n");
+      //Update statistics
+      NET_STATS_INC_COUNTER(socket->stats.droppedSegments, 1);
+
+      //The client already considers the connection as established, so
+      //the caller must reset it rather than silently drop the segment
+      return ERROR_OUT_OF_RESOURCES;
+   }
+
+#if (IPV4_SUPPORT == ENABLED)
+   //IPv4 is currently used?
+   if(pseudoHeader->length == sizeof(Ipv4PseudoHeader))
+   {
+      //Save the source IPv4 address
+      queueItem->srcAddr.length = sizeof(Ipv4Addr);
+      queueItem->srcAddr.ipv4Addr = pseudoHeader->ipv4Data.srcAddr;
+      //Save the destination IPv4 address
+      queueItem->destAddr.length = sizeof(Ipv4Addr);
+      queueItem->destAddr.ipv4Addr = pseudoHeader->ipv4Data.destAddr;
+   }
+   else
+#endif
+#if (IPV6_SUPPORT == ENABLED)
+   //IPv6 is currently used?
+   if(pseudoHeader->length == sizeof(Ipv6PseudoHeader))
+   {
+      //Save the source IPv6 address
+      queueItem->srcAddr.length = sizeof(Ipv6Addr);
+      queueItem->srcAddr.ipv6Addr = pseudoHeader->ipv6Data.srcAddr;
+      //Save the destination IPv6 address
+      queueItem->destAddr.length = sizeof(Ipv6Addr);
+      queueItem->destAddr.ipv6Addr = pseudoHeader->ipv6Data.destAddr;
+   }
+   else
+#endif
+   //Invalid pseudo header?
+   {
+      //This should never occur...
+      return ERROR_INVALID_ADDRESS;
+   }
+
+   //The three-way handshake has already been completed
+   queueItem->synCookie = TRUE;
+   //Underlying network interface
+   queueItem->interface = interface;
+   //Save the port number of the client
+   queueItem->srcPort = segment->srcPort;
+   //Save the initial sequence numbers
+   queueItem->isn = isn;
+   queueItem->iss = iss;
+
+   //Retrieve the MSS value from the cookie
+   queueItem->mss = MIN(tcpSynCookieMssTable[data & 0x03], TCP_MAX_MSS);
+   queueItem->mss = MAX(queueItem->mss, TCP_MIN_MSS);
+
+#if (TCP_WINDOW_SCALE_SUPPORT == ENABLED)
+   //Window scaling is used only if the SYN carried the option
+   if(wndScale != TCP_SYN_COOKIE_NO_WND_SCALE)
+   {
+      queueItem->wndScaleOption = TRUE;
+      queueItem->wndScale = wndScale;
+   }
+   else
+   {
+      queueItem->wndScaleOption = FALSE;
+      queueItem->wndScale = 0;
+   }
+
+   //The window field of the ACK segment is scaled
+   queueItem->sndWnd = (uint32_t) segment->window << queueItem->wndScale;
+#else
+   //The window field is not scaled
+   queueItem->sndWnd = segment->window;
+#endif
+
+#if (TCP_TIMESTAMP_SUPPORT == ENABLED)
+   //The client only sends timestamps if the SYN-ACK carried the option
+   queueItem->tsOption = !tcpGetTimestamps(segment, &queueItem->tsVal, &tsEcr);
+   //Recompute the timestamp offset used in the SYN-ACK
+   queueItem->tsOffset = tcpSynCookieHash(0, pseudoHeader, segment, 1);
+#endif
+
+#if (TCP_SACK_SUPPORT == ENABLED)
+   //Check whether the SYN carried the SACK Permitted option
+   queueItem->sackPermitted = (data & 0x04) ? TRUE : FALSE;
+#endif
+
+   //Notify user that a connection request is pending
+   tcpUpdateEvents(socket);
+
+   //The SYN cookie is valid
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Reset a connection established with a SYN cookie
+ *
+ * This function is called when a connection request reconstructed from a SYN
+ * cookie cannot be accepted. The client has already completed the three-way
+ * handshake, so a reset segment is sent to notify it
+ *
+ * @param[in] socket Handle referencing the listening socket
+ * @param[in] queueItem SYN queue item describing the connection
+ * @return Error code
+ **/
+
+error_t tcpRejectSynCookie(Socket *socket, TcpSynQueueItem *queueItem)
+{
+   error_t error;
+   size_t offset;
+   size_t length;
+   NetBuffer *buffer;
+   TcpHeader *segment;
+   IpPseudoHeader pseudoHeader;
+
+   //Update statistics
+   NET_STATS_INC_COUNTER(socket->stats.droppedSegments, 1);
+
+   //Allocate a memory buffer to hold the reset segment
+   buffer = ipAllocBuffer(sizeof(TcpHeader), &offset);
+   //Failed to allocate memory?
+   if(!buffer) return ERROR_OUT_OF_MEMORY;
+
+   //Point to the beginning of the TCP segment
+   segment = netBufferAt(buffer, offset);
+
+   //The sequence number of the reset is the next one the client expects
+   segment->srcPort = htons(socket->localPort);
+   segment->destPort = htons(queueItem->srcPort);
+   segment->seqNum = htonl(queueItem->iss + 1);
+   segment->ackNum = 0;
+   segment->reserved1 = 0;
+   segment->dataOffset = 5;
+   segment->flags = TCP_FLAG_RST;
+   segment->reserved2 = 0;
+   segment->window = 0;
+   segment->checksum = 0;
+   segment->urgentPointer = 0;
+
+   //Length of the complete TCP header
+   length = segment->dataOffset * 4;
+
+#if (IPV4_SUPPORT == ENABLED)
+   //Destination address is an IPv4 address?
+   if(queueItem->srcAddr.length == sizeof(Ipv4Addr))
+   {
+      //Format IPv4 pseudo header
+      pseudoHeader.length = sizeof(Ipv4PseudoHeader);
+      pseudoHeader.ipv4Data.srcAddr = queueItem->destAddr.ipv4Addr;
+      pseudoHeader.ipv4Data.destAddr = queueItem->srcAddr.ipv4Addr;
+      pseudoHeader.ipv4Data.reserved = 0;
+      pseudoHeader.ipv4Data.protocol = IPV4_PROTOCOL_TCP;
+      pseudoHeader.ipv4Data.length = htons(length);
+
+      //Calculate TCP header checksum
+      segment->checksum = ipCalcUpperLayerChecksumEx(&pseudoHeader.ipv4Data,
+         sizeof(Ipv4PseudoHeader), buffer, offset, length);
+   }
+   else
+#endif
+#if (IPV6_SUPPORT == ENABLED)
+   //Destination address is an IPv6 address?
+   if(queueItem->srcAddr.length == sizeof(Ipv6Addr))
+   {
+      //Format IPv6 pseudo header
+      pseudoHeader.length = sizeof(Ipv6PseudoHeader);
+      pseudoHeader.ipv6Data.srcAddr = queueItem->destAddr.ipv6Addr;
+      pseudoHeader.ipv6Data.destAddr = queueItem->srcAddr.ipv6Addr;
+      pseudoHeader.ipv6Data.length = htonl(length);
+      pseudoHeader.ipv6Data.reserved = 0;
+      pseudoHeader.ipv6Data.nextHeader = IPV6_TCP_HEADER;
+
+      //Calculate TCP header checksum
+      segment->checksum = ipCalcUpperLayerChecksumEx(&pseudoHeader.ipv6Data,
+         sizeof(Ipv6PseudoHeader), buffer, offset, length);
+   }
+   else
+#endif
+   //Destination address is not valid?
+   {
+      //Free previously allocated memory
+      netBufferFree(buffer);
+      //This should never occur...
+      return ERROR_INVALID_ADDRESS;
+   }
+
+   //Debug message
+   TRACE_DEBUG("%s: Resetting TCP SYN cookie connection...\r\n",
+      formatSystemTime(osGetSystemTime(), NULL));
+   //Dump TCP header contents for debugging purpose
+   tcpDumpHeader(segment, 0, queueItem->iss, queueItem->isn);
+
+   //Send TCP segment
+   error = ipSendDatagram(queueItem->interface, &pseudoHeader, buffer, offset, 0);
+
+   //Free previously allocated memory
+   netBufferFree(buffer);
+   //Return error code
+   return error;
+}
+
+
+/**
+ * @brief Check whether a connection request is pending for a given 4-tuple
+ * @param[in] socket Handle referencing the listening socket
+ * @param[in] pseudoHeader TCP pseudo header describing the incoming segment
+ * @param[in] segment Incoming TCP segment
+ * @return TRUE if the SYN queue holds an item for the same connection,
+ *   else FALSE
+ **/
+
+static bool_t tcpSynCookiePending(Socket *socket,
+   const IpPseudoHeader *pseudoHeader, const TcpHeader *segment)
+{
+   TcpSynQueueItem *queueItem;
+
+   //Loop through the SYN queue
+   for(queueItem = socket->synQueue; queueItem != NULL; queueItem = queueItem->next)
+   {
+      //Check the port number of the client
+      if(queueItem->srcPort != segment->srcPort)
+         continue;
+
+#if (IPV4_SUPPORT == ENABLED)
+      //IPv4 is currently used?
+      if(pseudoHeader->length == sizeof(Ipv4PseudoHeader))
+      {
+         //Compare source and destination IPv4 addresses
+         if(queueItem->srcAddr.length == sizeof(Ipv4Addr) &&
+            queueItem->srcAddr.ipv4Addr == pseudoHeader->ipv4Data.srcAddr &&
+            queueItem->destAddr.ipv4Addr == pseudoHeader->ipv4Data.destAddr)
+         {
+            return TRUE;
+         }
+      }
+#endif
+#if (IPV6_SUPPORT == ENABLED)
+      //IPv6 is currently used?
+      if(pseudoHeader->length == sizeof(Ipv6PseudoHeader))
+      {
+         //Compare source and destination IPv6 addresses
+         if(queueItem->srcAddr.length == sizeof(Ipv6Addr) &&
+            ipv6CompAddr(&queueItem->srcAddr.ipv6Addr, &pseudoHeader->ipv6Data.srcAddr) &&
+            ipv6CompAddr(&queueItem->destAddr.ipv6Addr, &pseudoHeader->ipv6Data.destAddr))
+         {
+            return TRUE;
+         }
+      }
+#endif
+   }
+
+   //No matching connection request
+   return FALSE;
+}
+
+
+/**
+ * @brief Compute a keyed hash over the 4-tuple of a connection
+ * @param[in] index Index of the secret key to use
+ * @param[in] pseudoHeader TCP pseudo header describing the incoming segment
+ * @param[in] segment Incoming TCP segment
+ * @param[in] value Additional value to be hashed
+ * @return 32-bit hash value
+ **/
+
+static uint32_t tcpSynCookieHash(uint_t index, const IpPseudoHeader *pseudoHeader,
+   const TcpHeader *segment, uint32_t value)
+{
+   size_t n;
+   uint8_t buffer[2 * sizeof(Ipv6Addr) + 8];
+
+   //Number of bytes to hash
+   n = 0;
+
+#if (IPV4_SUPPORT == ENABLED)
+   //IPv4 is currently used?
+   if(pseudoHeader->length == sizeof(Ipv4PseudoHeader))
+   {
+      //Source and destination IPv4 addresses
+      memcpy(buffer, &pseudoHeader->ipv4Data.srcAddr, sizeof(Ipv4Addr));
+      memcpy(buffer + sizeof(Ipv4Addr), &pseudoHeader->ipv4Data.destAddr, sizeof(Ipv4Addr));
+      n = 2 * sizeof(Ipv4Addr);
+   }
+#endif
+#if (IPV6_SUPPORT == ENABLED)
+   //IPv6 is currently used?
+   if(pseudoHeader->length == sizeof(Ipv6PseudoHeader))
+   {
+      //Source and destination IPv6 addresses
+      memcpy(buffer, &pseudoHeader->ipv6Data.srcAddr, sizeof(Ipv6Addr));
+      memcpy(buffer + sizeof(Ipv6Addr), &pseudoHeader->ipv6Data.destAddr, sizeof(Ipv6Addr));
+      n = 2 * sizeof(Ipv6Addr);
+   }
+#endif
+
+   //Source and destination ports
+   STORE16BE(segment->srcPort, buffer + n);
+   STORE16BE(segment->destPort, buffer + n + 2);
+   //Additional value
+   STORE32BE(value, buffer + n + 4);
+
+   //Only the 32 least significant bits of the hash are used
+   return (uint32_t) tcpSipHash(tcpSynCookieKey[index], buffer, n + 8);
+}
+
+
+/**
+ * @brief SipHash-2-4 keyed hash function
+ * @param[in] key 128-bit secret key
+ * @param[in] data Pointer to the data to be hashed
+ * @param[in] length Length of the data, in bytes
+ * @return 64-bit hash value
+ **/
+
+static uint64_t tcpSipHash(const uint64_t *key, const uint8_t *data, size_t length)
+{
+   size_t i;
+   uint64_t m;
+   uint64_t v[4];
+
+   //Initialize state
+   v[0] = key[0] ^ 0x736F6D6570736575ULL;
+   v[1] = key[1] ^ 0x646F72616E646F6DULL;
+   v[2] = key[0] ^ 0x6C7967656E657261ULL;
+   v[3] = key[1] ^ 0x7465646279746573ULL;
+
+   //Process complete 8-byte blocks
+   for(i = 0; (i + 8) <= length; i += 8)
+   {
+      m = LOAD32LE(data + i) | ((uint64_t) LOAD32LE(data + i + 4) << 32);
+
+      v[3] ^= m;
+      SIP_ROUND(v);
+      SIP_ROUND(v);
+      v[0] ^= m;
+   }
+
+   //The last block holds the remaining bytes and the length of the message
+   for(m = (uint64_t) length << 56; i < length; i++)
+      m |= (uint64_t) data[i] << (8 * (i % 8));
+
+   v[3] ^= m;
+   SIP_ROUND(v);
+   SIP_ROUND(v);
+   v[0] ^= m;
+
+   //Finalization
+   v[2] ^= 0xFF;
+   SIP_ROUND(v);
+   SIP_ROUND(v);
+   SIP_ROUND(v);
+   SIP_ROUND(v);
+
+   //Return the resulting hash value
+   return v[0] ^ v[1] ^ v[2] ^ v[3];
+}
+
+#endif
@@ -0,0 +1,45 @@
+/**
+ * @file tcp_syn_cookie.h
+ * @brief SYN cookies
+ *
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+#ifndef _TCP_SYN_COOKIE_H
+#define _TCP_SYN_COOKIE_H
+
+//Dependencies
+#include "core/tcp.h"
+
+//SYN cookie related functions
+error_t tcpSendSynCookie(Socket *socket, NetInterface *interface,
+   IpPseudoHeader *pseudoHeader, TcpHeader *segment);
+
+error_t tcpCheckSynCookie(Socket *socket, NetInterface *interface,
+   IpPseudoHeader *pseudoHeader, TcpHeader *segment);
+
+error_t tcpRejectSynCookie(Socket *socket, TcpSynQueueItem *queueItem);
+
+#endif
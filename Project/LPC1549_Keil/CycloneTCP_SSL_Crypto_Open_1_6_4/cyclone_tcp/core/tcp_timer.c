@@ -30,6 +30,7 @@
 #define TRACE_LEVEL TCP_TRACE_LEVEL
 
 //Dependencies
+#include <string.h>
 #include "core/net.h"
 #include "core/socket.h"
 #include "core/tcp.h"
@@ -43,218 +44,431 @@
 #if (TCP_SUPPORT == ENABLED)
 
 
+//Timing wheel
+static TcpTimerWheel tcpTimerWheel;
+
+//Internal functions
+static void tcpTimerSchedule(TcpTimer *timer);
+static void tcpTimerLink(TcpTimer *timer);
+static void tcpTimerUnlink(TcpTimer *timer);
+static void tcpTimerCascade(uint_t level, uint_t index);
+static void tcpProcessTimers(Socket *socket);
+
+
+/**
+ * @brief TCP timer initialization
+ **/
+
+void tcpTimerInit(void)
+{
+   //Clear the timing wheel
+   memset(&tcpTimerWheel, 0, sizeof(TcpTimerWheel));
+   //Ticks are counted from now on
+   tcpTimerWheel.time = osGetSystemTime();
+}
+
+
 /**
  * @brief TCP timer handler
  *
  * This routine must be periodically called by the TCP/IP stack to
  * handle retransmissions and TCP related timers (persist timer,
- * FIN-WAIT-2 timer and TIME-WAIT timer)
+ * FIN-WAIT-2 timer and TIME-WAIT timer). Pending timers are kept in
+ * a hierarchical timing wheel, so that only the sockets whose timers
+ * expire are visited
  *
  **/
 
 void tcpTick(void)
 {
-   error_t error;
    uint_t i;
-   uint_t n;
-   uint_t u;
+   uint_t level;
+   systime_t time;
+   TcpTimer *timer;
+   TcpTimer *list;
+#if (TCP_ZERO_COPY_SUPPORT == ENABLED)
+   uint_t txRefCount;
+   TcpTxRef txRef[TCP_MAX_TX_REF_COUNT];
+#endif
 
    //Enter critical section
    osAcquireMutex(&socketMutex);
 
-   //Loop through opened sockets
-   for(i = 0; i < SOCKET_MAX_COUNT; i++)
+   //Get current time
+   time = osGetSystemTime();
+
+   //Process every tick that has elapsed since the last call
+   while(timeCompare(time, tcpTimerWheel.time + TCP_TICK_INTERVAL) >= 0)
    {
-      //Shortcut to the current socket
-      Socket *socket = socketTable + i;
-      //Check socket type
-      if(socket->type != SOCKET_TYPE_STREAM)
-         continue;
-      //Check the current state of the TCP state machine
-      if(socket->state == TCP_STATE_CLOSED)
-         continue;
-
-      //Is there any packet in the retransmission queue?
-      if(socket->retransmitQueue != NULL)
+      //Advance the timing wheel
+      tcpTimerWheel.time += TCP_TICK_INTERVAL;
+      tcpTimerWheel.tick++;
+
+      //Each time a level wraps around, the current slot of the next level
+      //is redistributed over the lower levels
+      for(level = 1; level < TCP_TIMER_WHEEL_LEVELS; level++)
       {
-         //Retransmission timeout?
-         if(tcpTimerElapsed(&socket->retransmitTimer))
-         {
-#if (TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
-            //When a TCP sender detects segment loss using the retransmission
-            //timer and the given segment has not yet been resent by way of
-            //the retransmission timer, the value of ssthresh must be updated
-            if(!socket->retransmitCount)
-            {
-               //Amount of data that has been sent but not yet acknowledged
-               uint_t flightSize = socket->sndNxt - socket->sndUna;
-               //Adjust ssthresh value
-               socket->ssthresh = MAX(flightSize / 2, 2 * socket->mss);
-            }
-
-            //Furthermore, upon a timeout cwnd must be set to no more than
-            //the loss window, LW, which equals 1 full-sized segment
-            socket->cwnd = MIN(TCP_LOSS_WINDOW * socket->mss, socket->txBufferSize);
-#endif
+         //Check whether the lower level has wrapped around
+         if((tcpTimerWheel.tick >> ((level - 1) * TCP_TIMER_WHEEL_BITS)) & (TCP_TIMER_WHEEL_SIZE - 1))
+            break;
 
-            //Make sure the maximum number of retransmissions has not been reached
-            if(socket->retransmitCount < TCP_MAX_RETRIES)
-            {
-               //Debug message
-               TRACE_INFO("%s: TCP segment retransmission #%u (%u data bytes)...\r\n",
-                  formatSystemTime(osGetSystemTime(), NULL), socket->retransmitCount + 1,
-                  socket->retransmitQueue->length);
-
-               //Retransmit the earliest segment that has not been
-               //acknowledged by the TCP receiver
-               tcpRetransmitSegment(socket);
-
-               //Use exponential back-off algorithm to calculate the new RTO
-               socket->rto = MIN(socket->rto * 2, TCP_MAX_RTO);
-               //Restart retransmission timer
-               tcpTimerStart(&socket->retransmitTimer, socket->rto);
-               //Increment retransmission counter
-               socket->retransmitCount++;
-            }
-            else
-            {
-               //The maximum number of retransmissions has been exceeded
-               tcpChangeState(socket, TCP_STATE_CLOSED);
-               //Turn off the retransmission timer
-               tcpTimerStop(&socket->retransmitTimer);
-            }
-
-            //TCP must use Karn's algorithm for taking RTT samples. That is, RTT
-            //samples must not be made using segments that were retransmitted
-            socket->rttBusy = FALSE;
-         }
+         //Redistribute the timers of the current slot
+         tcpTimerCascade(level, (tcpTimerWheel.tick >> (level * TCP_TIMER_WHEEL_BITS)) &
+            (TCP_TIMER_WHEEL_SIZE - 1));
       }
 
-      //Check the current state of the TCP state machine
-      if(socket->state == TCP_STATE_CLOSED)
-         continue;
+      //Detach the list of timers that expire at this tick
+      list = tcpTimerWheel.slot[0][tcpTimerWheel.tick & (TCP_TIMER_WHEEL_SIZE - 1)];
+      tcpTimerWheel.slot[0][tcpTimerWheel.tick & (TCP_TIMER_WHEEL_SIZE - 1)] = NULL;
+
+      //The head of the list is now held by a local variable
+      if(list != NULL)
+         list->pprev = &list;
 
-      //The persist timer is used when the remote host advertises
-      //a window size of zero
-      if(!socket->sndWnd && socket->wndProbeInterval)
+      //Loop through the expired timers
+      while(list != NULL)
       {
-         //Time to send a new probe?
-         if(tcpTimerElapsed(&socket->persistTimer))
+         //Remove the first timer from the list
+         timer = list;
+         tcpTimerUnlink(timer);
+
+         //Stopped timers are never linked (sanity check)
+         if(!timer->running)
+            continue;
+
+         //The timer may have been rounded down to the tick granularity
+         if(!tcpTimerElapsed(timer))
+         {
+            //Wait for the remaining time
+            tcpTimerSchedule(timer);
+         }
+         else
          {
-            //Make sure the maximum number of retransmissions has not been reached
-            if(socket->wndProbeCount < TCP_MAX_RETRIES)
-            {
-               //Debug message
-               TRACE_INFO("%s: TCP zero window probe #%u...\r\n",
-                  formatSystemTime(osGetSystemTime(), NULL), socket->wndProbeCount + 1);
-
-               //Zero window probes usually have the sequence number one less than expected
-               tcpSendSegment(socket, TCP_FLAG_ACK, socket->sndNxt - 1, socket->rcvNxt, 0, FALSE);
-               //The interval between successive probes should be increased exponentially
-               socket->wndProbeInterval = MIN(socket->wndProbeInterval * 2, TCP_MAX_PROBE_INTERVAL);
-               //Restart the persist timer
-               tcpTimerStart(&socket->persistTimer, socket->wndProbeInterval);
-               //Increment window probe counter
-               socket->wndProbeCount++;
-            }
-            else
-            {
-               //Enter CLOSED state
-               tcpChangeState(socket, TCP_STATE_CLOSED);
-            }
+            //Timers are embedded in the socket structures
+            i = ((uint8_t *) timer - (uint8_t *) socketTable) / sizeof(Socket);
+            //Process the timers of the corresponding socket
+            tcpProcessTimers(&socketTable[i]);
          }
       }
+   }
 
-      //To avoid a deadlock, it is necessary to have a timeout to force
-      //transmission of data, overriding the SWS avoidance algorithm. In
-      //practice, this timeout should seldom occur (see RFC 1122 4.2.3.4)
-      if(socket->state == TCP_STATE_ESTABLISHED || socket->state == TCP_STATE_CLOSE_WAIT)
+#if (TCP_ZERO_COPY_SUPPORT == ENABLED)
+   //Give back the caller-owned buffers released since the last tick, for
+   //instance when a connection has been reset or has timed out
+   for(i = 0; i < SOCKET_MAX_COUNT; i++)
+   {
+      //Retrieve the released buffers
+      txRefCount = tcpGetCompletedTxRefs(&socketTable[i], txRef);
+
+      //Any buffer to give back?
+      if(txRefCount > 0)
       {
-         //The override timeout occurred?
-         if(socket->sndUser && tcpTimerElapsed(&socket->overrideTimer))
-         {
-            //The amount of data that can be sent at any given time is
-            //limited by the receiver window and the congestion window
-            n = MIN(socket->sndWnd, socket->txBufferSize);
+         //The owners are notified outside the critical section
+         osReleaseMutex(&socketMutex);
+         tcpNotifyTxRefs(&socketTable[i], txRef, txRefCount);
+         osAcquireMutex(&socketMutex);
+      }
+   }
+#endif
+
+   //Leave critical section
+   osReleaseMutex(&socketMutex);
+}
+
+
+/**
+ * @brief Process the timers of a given socket
+ *
+ * A timer is only visited again once it has been rescheduled. Any timer
+ * that has elapsed is therefore either restarted or stopped, even when
+ * the corresponding action no longer applies
+ *
+ * @param[in] socket Handle referencing the socket
+ **/
+
+static void tcpProcessTimers(Socket *socket)
+{
+   error_t error;
+   uint_t n;
+   uint_t u;
+#if (TCP_SACK_SUPPORT == ENABLED)
+   TcpQueueItem *queueItem;
+#endif
+
+   //Check socket type and the current state of the TCP state machine
+   if(socket->type != SOCKET_TYPE_STREAM || socket->state == TCP_STATE_CLOSED)
+   {
+      //The timers are no longer needed
+      tcpStopTimers(socket);
+      //Exit immediately
+      return;
+   }
+
+   //Is there any packet in the retransmission queue?
+   if(socket->retransmitQueue != NULL)
+   {
+      //Retransmission timeout?
+      if(tcpTimerElapsed(&socket->retransmitTimer))
+      {
+         //Update statistics
+         NET_STATS_INC_COUNTER(socket->stats.timeouts, 1);
 
 #if (TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
-            //Check the congestion window
-            n = MIN(n, socket->cwnd);
+         //When a TCP sender detects segment loss using the retransmission
+         //timer and the given segment has not yet been resent by way of
+         //the retransmission timer, the value of ssthresh must be updated
+         if(!socket->retransmitCount)
+            socket->congestAlgo->onTimeout(socket);
+
+         //Furthermore, upon a timeout cwnd must be set to no more than
+         //the loss window, LW, which equals 1 full-sized segment
+         socket->cwnd = MIN(TCP_LOSS_WINDOW * socket->mss, socket->txBufferSize);
 #endif
-            //Retrieve the size of the usable window
-            u = n - (socket->sndNxt - socket->sndUna);
-
-            //Send as much data as possible
-            while(socket->sndUser > 0)
-            {
-               //The usable window size may become zero or negative,
-               //preventing packet transmission
-               if((int_t) u <= 0) break;
-
-               //Calculate the number of bytes to send at a time
-               n = MIN(u, socket->sndUser);
-               n = MIN(n, socket->mss);
-
-               //Send TCP segment
-               error = tcpSendSegment(socket, TCP_FLAG_PSH | TCP_FLAG_ACK,
-                  socket->sndNxt, socket->rcvNxt, n, TRUE);
-               //Failed to send TCP segment?
-               if(error) break;
-
-               //Advance SND.NXT pointer
-               socket->sndNxt += n;
-               //Adjust the number of bytes buffered but not yet sent
-               socket->sndUser -= n;
-            }
-
-            //Check whether the transmitter can accept more data
-            tcpUpdateEvents(socket);
-
-            //Restart override timer if necessary
-            if(socket->sndUser > 0)
-               tcpTimerStart(&socket->overrideTimer, TCP_OVERRIDE_TIMEOUT);
+
+         //Fast recovery is abandoned. Duplicate ACKs for the data sent
+         //before the timeout must not trigger a new fast retransmit
+         //(refer to RFC 6582 4.1)
+         socket->lossRecovery = FALSE;
+         socket->recoveryPoint = socket->sndNxt;
+
+#if (TCP_SACK_SUPPORT == ENABLED)
+         //SACK in use?
+         if(socket->sackPermitted)
+         {
+            //Every segment that has not been SACKed is now deemed lost and
+            //will be retransmitted as the window opens (see RFC 6675 5.1).
+            //Previous retransmissions are assumed lost as well
+            for(queueItem = socket->retransmitQueue; queueItem != NULL; queueItem = queueItem->next)
+               queueItem->retransmitted = FALSE;
          }
-      }
+#endif
 
-      //The FIN-WAIT-2 timer prevents the connection
-      //from staying in the FIN-WAIT-2 state forever
-      if(socket->state == TCP_STATE_FIN_WAIT_2)
-      {
-         //Maximum FIN-WAIT-2 time has elapsed?
-         if(tcpTimerElapsed(&socket->finWait2Timer))
+         //Make sure the maximum number of retransmissions has not been reached
+         if(socket->retransmitCount < TCP_MAX_RETRIES)
          {
             //Debug message
-            TRACE_WARNING("TCP FIN-WAIT-2 timer elapsed...\r\n");
-            //Enter CLOSED state
+            TRACE_INFO("%s: TCP segment retransmission #%u (%u data bytes)...\r\n",
+               formatSystemTime(osGetSystemTime(), NULL), socket->retransmitCount + 1,
+               socket->retransmitQueue->length);
+
+            //Retransmit the earliest segment that has not been
+            //acknowledged by the TCP receiver
+            tcpRetransmitSegment(socket);
+
+            //Use exponential back-off algorithm to calculate the new RTO
+            socket->rto = MIN(socket->rto * 2, TCP_MAX_RTO);
+            //Restart retransmission timer
+            tcpTimerStart(&socket->retransmitTimer, socket->rto);
+            //Increment retransmission counter
+            socket->retransmitCount++;
+         }
+         else
+         {
+            //The maximum number of retransmissions has been exceeded
             tcpChangeState(socket, TCP_STATE_CLOSED);
+            //Turn off the retransmission timer
+            tcpTimerStop(&socket->retransmitTimer);
          }
+
+         //TCP must use Karn's algorithm for taking RTT samples. That is, RTT
+         //samples must not be made using segments that were retransmitted
+         socket->rttBusy = FALSE;
       }
+   }
+   else if(tcpTimerElapsed(&socket->retransmitTimer))
+   {
+      //All outstanding data has been acknowledged in the meantime
+      tcpTimerStop(&socket->retransmitTimer);
+   }
 
-      //TIME-WAIT timer
-      if(socket->state == TCP_STATE_TIME_WAIT)
+   //Check the current state of the TCP state machine
+   if(socket->state == TCP_STATE_CLOSED)
+   {
+      //The timers are no longer needed
+      tcpStopTimers(socket);
+      //Exit immediately
+      return;
+   }
+
+   //The persist timer is used when the remote host advertises
+   //a window size of zero
+   if(!socket->sndWnd && socket->wndProbeInterval)
+   {
+      //Time to send a new probe?
+      if(tcpTimerElapsed(&socket->persistTimer))
       {
-         //2MSL time has elapsed?
-         if(tcpTimerElapsed(&socket->timeWaitTimer))
+         //Make sure the maximum number of retransmissions has not been reached
+         if(socket->wndProbeCount < TCP_MAX_RETRIES)
          {
             //Debug message
-            TRACE_WARNING("TCP 2MSL timer elapsed (socket %u)...\r\n", i);
+            TRACE_INFO("%s: TCP zero window probe #%u...\r\n",
+               formatSystemTime(osGetSystemTime(), NULL), socket->wndProbeCount + 1);
+
+            //Zero window probes usually have the sequence number one less than expected
+            tcpSendSegment(socket, TCP_FLAG_ACK, socket->sndNxt - 1, socket->rcvNxt, 0, FALSE);
+            //The interval between successive probes should be increased exponentially
+            socket->wndProbeInterval = MIN(socket->wndProbeInterval * 2, TCP_MAX_PROBE_INTERVAL);
+            //Restart the persist timer
+            tcpTimerStart(&socket->persistTimer, socket->wndProbeInterval);
+            //Increment window probe counter
+            socket->wndProbeCount++;
+         }
+         else
+         {
             //Enter CLOSED state
             tcpChangeState(socket, TCP_STATE_CLOSED);
+            //The timers are no longer needed
+            tcpStopTimers(socket);
+            //Exit immediately
+            return;
+         }
+      }
+   }
+   else if(tcpTimerElapsed(&socket->persistTimer))
+   {
+      //The window has been reopened in the meantime
+      tcpTimerStop(&socket->persistTimer);
+   }
 
-            //Dispose the socket if the user does not have the ownership anymore
-            if(!socket->ownedFlag)
-            {
-               //Delete the TCB
-               tcpDeleteControlBlock(socket);
-               //Mark the socket as closed
-               socket->type = SOCKET_TYPE_UNUSED;
-            }
+#if (TCP_DELAYED_ACK_SUPPORT == ENABLED)
+   //The ACK for the data received so far cannot be delayed any longer?
+   if(tcpTimerElapsed(&socket->delayedAckTimer))
+   {
+      //Send a pure ACK (the timer is stopped once the ACK is sent)
+      error = tcpSendSegment(socket, TCP_FLAG_ACK, socket->sndNxt, socket->rcvNxt, 0, FALSE);
+      //Try again at the next tick if the ACK could not be sent
+      if(error)
+         tcpTimerStart(&socket->delayedAckTimer, TCP_TICK_INTERVAL);
+   }
+#endif
+
+   //To avoid a deadlock, it is necessary to have a timeout to force
+   //transmission of data, overriding the SWS avoidance algorithm. In
+   //practice, this timeout should seldom occur (see RFC 1122 4.2.3.4)
+   if((socket->state == TCP_STATE_ESTABLISHED || socket->state == TCP_STATE_CLOSE_WAIT) &&
+      socket->sndUser > 0)
+   {
+      //The override timeout occurred?
+      if(tcpTimerElapsed(&socket->overrideTimer))
+      {
+         //The amount of data that can be sent at any given time is
+         //limited by the receiver window and the congestion window
+         n = MIN(socket->sndWnd, socket->txBufferSize);
+
+#if (TCP_CONGESTION_CONTROL_SUPPORT == ENABLED)
+         //Check the congestion window
+         n = MIN(n, socket->cwnd);
+#endif
+         //Retrieve the size of the usable window
+         u = n - (socket->sndNxt - socket->sndUna);
+
+         //Send as much data as possible
+         while(socket->sndUser > 0)
+         {
+            //The usable window size may become zero or negative,
+            //preventing packet transmission
+            if((int_t) u <= 0) break;
+
+            //Calculate the number of bytes to send at a time
+            n = MIN(u, socket->sndUser);
+            n = MIN(n, socket->mss);
+
+            //Send TCP segment
+            error = tcpSendSegment(socket, TCP_FLAG_PSH | TCP_FLAG_ACK,
+               socket->sndNxt, socket->rcvNxt, n, TRUE);
+            //Failed to send TCP segment?
+            if(error) break;
+
+            //Advance SND.NXT pointer
+            socket->sndNxt += n;
+            //Adjust the number of bytes buffered but not yet sent
+            socket->sndUser -= n;
          }
+
+         //Check whether the transmitter can accept more data
+         tcpUpdateEvents(socket);
+
+         //Restart override timer if necessary
+         if(socket->sndUser > 0)
+            tcpTimerStart(&socket->overrideTimer, TCP_OVERRIDE_TIMEOUT);
+         else
+            tcpTimerStop(&socket->overrideTimer);
       }
    }
+   else if(tcpTimerElapsed(&socket->overrideTimer))
+   {
+      //There is no pending data anymore
+      tcpTimerStop(&socket->overrideTimer);
+   }
 
-   //Leave critical section
-   osReleaseMutex(&socketMutex);
+   //The FIN-WAIT-2 timer prevents the connection
+   //from staying in the FIN-WAIT-2 state forever
+   if(socket->state == TCP_STATE_FIN_WAIT_2)
+   {
+      //Maximum FIN-WAIT-2 time has elapsed?
+      if(tcpTimerElapsed(&socket->finWait2Timer))
+      {
+         //Debug message
+         TRACE_WARNING("TCP FIN-WAIT-2 timer elapsed...\r\n");
+         //Enter CLOSED state
+         tcpChangeState(socket, TCP_STATE_CLOSED);
+         //The timers are no longer needed
+         tcpStopTimers(socket);
+      }
+   }
+   else if(tcpTimerElapsed(&socket->finWait2Timer))
+   {
+      //The connection has left the FIN-WAIT-2 state in the meantime
+      tcpTimerStop(&socket->finWait2Timer);
+   }
+
+   //TIME-WAIT timer
+   if(socket->state == TCP_STATE_TIME_WAIT)
+   {
+      //2MSL time has elapsed?
+      if(tcpTimerElapsed(&socket->timeWaitTimer))
+      {
+         //Debug message
+         TRACE_WARNING("TCP 2MSL timer elapsed (socket %u)...\r\n", socket->descriptor);
+         //Enter CLOSED state
+         tcpChangeState(socket, TCP_STATE_CLOSED);
+         //The timers are no longer needed
+         tcpStopTimers(socket);
+
+         //Dispose the socket if the user does not have the ownership anymore
+         if(!socket->ownedFlag)
+         {
+            //Delete the TCB
+            tcpDeleteControlBlock(socket);
+            //Mark the socket as closed
+            socket->type = SOCKET_TYPE_UNUSED;
+         }
+      }
+   }
+   else if(tcpTimerElapsed(&socket->timeWaitTimer))
+   {
+      //The connection has left the TIME-WAIT state in the meantime
+      tcpTimerStop(&socket->timeWaitTimer);
+   }
+}
+
+
+/**
+ * @brief Stop all the timers of a given socket
+ * @param[in] socket Handle referencing the socket
+ **/
+
+void tcpStopTimers(Socket *socket)
+{
+   //Remove the timers from the timing wheel
+   tcpTimerStop(&socket->retransmitTimer);
+   tcpTimerStop(&socket->persistTimer);
+   tcpTimerStop(&socket->overrideTimer);
+   tcpTimerStop(&socket->finWait2Timer);
+   tcpTimerStop(&socket->timeWaitTimer);
+#if (TCP_DELAYED_ACK_SUPPORT == ENABLED)
+   tcpTimerStop(&socket->delayedAckTimer);
+#endif
 }
 
 
@@ -272,6 +486,10 @@ void tcpTimerStart(TcpTimer *timer, systime_t delay)
 
    //The timer is now running...
    timer->running = TRUE;
+
+   //Move the timer to the slot matching its new expiry time
+   tcpTimerUnlink(timer);
+   tcpTimerSchedule(timer);
 }
 
 
@@ -284,6 +502,8 @@ void tcpTimerStop(TcpTimer *timer)
 {
    //Stop timer
    timer->running = FALSE;
+   //Remove the timer from the timing wheel
+   tcpTimerUnlink(timer);
 }
 
 
@@ -324,4 +544,130 @@ bool_t tcpTimerElapsed(TcpTimer *timer)
       return FALSE;
 }
 
+
+/**
+ * @brief Insert a running timer in the timing wheel
+ * @param[in] timer Pointer to the timer structure
+ **/
+
+static void tcpTimerSchedule(TcpTimer *timer)
+{
+   systime_t delta;
+   uint32_t n;
+
+   //Time remaining from the last processed tick until the timer elapses
+   if(timeCompare(timer->startTime + timer->interval, tcpTimerWheel.time) > 0)
+      delta = timer->startTime + timer->interval - tcpTimerWheel.time;
+   else
+      delta = 0;
+
+   //Convert the delay to a number of ticks, rounding up
+   n = (delta + TCP_TICK_INTERVAL - 1) / TCP_TICK_INTERVAL;
+   //The timer cannot expire at a tick that has already been processed
+   n = MAX(n, 1);
+   //Longer delays are handled in several rounds
+   n = MIN(n, (1UL << (TCP_TIMER_WHEEL_LEVELS * TCP_TIMER_WHEEL_BITS)) - 1);
+
+   //Save expiry tick
+   timer->expires = tcpTimerWheel.tick + n;
+   //Insert the timer in the appropriate slot
+   tcpTimerLink(timer);
+}
+
+
+/**
+ * @brief Link a timer to the slot matching its expiry tick
+ * @param[in] timer Pointer to the timer structure
+ **/
+
+static void tcpTimerLink(TcpTimer *timer)
+{
+   uint_t level;
+   uint32_t delta;
+   TcpTimer **slot;
+
+   //Number of ticks before the timer expires
+   delta = timer->expires - tcpTimerWheel.tick;
+
+   //Overdue timers are processed with the current tick
+   if((int32_t) delta < 0)
+   {
+      timer->expires = tcpTimerWheel.tick;
+      delta = 0;
+   }
+
+   //Select the lowest level whose range covers the delay
+   for(level = 0; level < (TCP_TIMER_WHEEL_LEVELS - 1); level++)
+   {
+      if(delta < (1UL << ((level + 1) * TCP_TIMER_WHEEL_BITS)))
+         break;
+   }
+
+   //Point to the relevant slot
+   slot = &tcpTimerWheel.slot[level][(timer->expires >> (level * TCP_TIMER_WHEEL_BITS)) &
+      (TCP_TIMER_WHEEL_SIZE - 1)];
+
+   //Insert the timer at the head of the list
+   timer->next = *slot;
+   timer->pprev = slot;
+
+   if(*slot != NULL)
+      (*slot)->pprev = &timer->next;
+
+   *slot = timer;
+}
+
+
+/**
+ * @brief Unlink a timer from the timing wheel
+ * @param[in] timer Pointer to the timer structure
+ **/
+
+static void tcpTimerUnlink(TcpTimer *timer)
+{
+   //Check whether the timer is linked to a slot
+   if(timer->pprev != NULL)
+   {
+      //Remove the timer from the list
+      *timer->pprev = timer->next;
+
+      if(timer->next != NULL)
+         timer->next->pprev = timer->pprev;
+
+      //The timer is no longer linked
+      timer->next = NULL;
+      timer->pprev = NULL;
+   }
+}
+
+
+/**
+ * @brief Redistribute the timers of a slot over the lower levels
+ * @param[in] level Level of the timing wheel
+ * @param[in] index Index of the slot
+ **/
+
+static void tcpTimerCascade(uint_t level, uint_t index)
+{
+   TcpTimer *timer;
+   TcpTimer *list;
+
+   //Detach the list of timers
+   list = tcpTimerWheel.slot[level][index];
+   tcpTimerWheel.slot[level][index] = NULL;
+
+   //The head of the list is now held by a local variable
+   if(list != NULL)
+      list->pprev = &list;
+
+   //Loop through the timers
+   while(list != NULL)
+   {
+      //Move the first timer to its new slot
+      timer = list;
+      tcpTimerUnlink(timer);
+      tcpTimerLink(timer);
+   }
+}
+
 #endif
@@ -29,8 +29,26 @@
 #ifndef _TCP_TIMER_H
 #define _TCP_TIMER_H
 
+//Number of slots per level of the timing wheel
+#define TCP_TIMER_WHEEL_SIZE (1 << TCP_TIMER_WHEEL_BITS)
+
+
+/**
+ * @brief Hierarchical timing wheel
+ **/
+
+typedef struct
+{
+   systime_t time;  ///<System time of the last processed tick
+   uint32_t tick;   ///<Last processed tick
+   TcpTimer *slot[TCP_TIMER_WHEEL_LEVELS][TCP_TIMER_WHEEL_SIZE]; ///<Lists of pending timers
+} TcpTimerWheel;
+
+
 //TCP timer related functions
+void tcpTimerInit(void);
 void tcpTick(void);
+void tcpStopTimers(Socket *socket);
 
 void tcpTimerStart(TcpTimer *timer, systime_t delay);
 void tcpTimerStop(TcpTimer *timer);
@@ -132,12 +132,17 @@ error_t udpProcessDatagram(NetInterface *interface,
    SocketQueueItem *queueItem;
    NetBuffer *p;
 
+   //Total number of UDP datagrams received on this interface
+   NET_STATS_INC_COUNTER(interface->stats.udpInDatagrams, 1);
+
    //Retrieve the length of the UDP datagram
    length = netBufferGetLength(buffer) - offset;
 
    //Ensure the UDP header is valid
    if(length < sizeof(UdpHeader))
    {
+      //Number of UDP datagrams discarded due to format errors
+      NET_STATS_INC_COUNTER(interface->stats.udpInErrors, 1);
       //Debug message
       TRACE_WARNING("UDP datagram length is invalid!\r\n");
       //Report an error
@@ -161,6 +166,8 @@ error_t udpProcessDatagram(NetInterface *interface,
       if(ipCalcUpperLayerChecksumEx(pseudoHeader->data,
          pseudoHeader->length, buffer, offset, length) != 0xFFFF)
       {
+         //Number of UDP datagrams discarded due to checksum errors
+         NET_STATS_INC_COUNTER(interface->stats.udpInErrors, 1);
          //Debug message
          TRACE_WARNING("Wrong UDP header checksum!\r\n");
          //Report an error
@@ -171,6 +178,27 @@ error_t udpProcessDatagram(NetInterface *interface,
    //Enter critical section
    osAcquireMutex(&socketMutex);
 
+#if (SOCKET_HASH_SUPPORT == ENABLED)
+   //Point to the bucket that holds the sockets bound to the destination port
+   socket = socketPortHashTable[socketHashPort(ntohs(header->destPort))];
+
+   //Loop through the sockets in the bucket
+   while(socket != NULL)
+   {
+      //Check socket type, port numbers and IP addresses
+      if(socket->type == SOCKET_TYPE_DGRAM &&
+         socket->localPort == ntohs(header->destPort) &&
+         (!socket->remotePort || socket->remotePort == ntohs(header->srcPort)) &&
+         socketMatchAddr(socket, interface, pseudoHeader))
+      {
+         //The current socket meets all the criteria
+         break;
+      }
+
+      //Next socket in the same bucket
+      socket = socket->hashNext;
+   }
+#else
    //Loop through opened sockets
    for(i = 0; i < SOCKET_MAX_COUNT; i++)
    {
@@ -180,91 +208,41 @@ error_t udpProcessDatagram(NetInterface *interface,
       //UDP socket found?
       if(socket->type != SOCKET_TYPE_DGRAM)
          continue;
-      //Check whether the socket is bound to a particular interface
-      if(socket->interface && socket->interface != interface)
-         continue;
       //Check destination port number
       if(socket->localPort != ntohs(header->destPort))
          continue;
       //Source port number filtering
       if(socket->remotePort && socket->remotePort != ntohs(header->srcPort))
          continue;
-
-#if (IPV4_SUPPORT == ENABLED)
-      //An IPv4 packet was received?
-      if(pseudoHeader->length == sizeof(Ipv4PseudoHeader))
-      {
-         //Destination IP address filtering
-         if(socket->localIpAddr.length)
-         {
-            //An IPv4 address is expected
-            if(socket->localIpAddr.length != sizeof(Ipv4Addr))
-               continue;
-            //Filter out non-matching addresses
-            if(socket->localIpAddr.ipv4Addr != pseudoHeader->ipv4Data.destAddr)
-               continue;
-         }
-         //Source IP address filtering
-         if(socket->remoteIpAddr.length)
-         {
-            //An IPv4 address is expected
-            if(socket->remoteIpAddr.length != sizeof(Ipv4Addr))
-               continue;
-            //Filter out non-matching addresses
-            if(socket->remoteIpAddr.ipv4Addr != pseudoHeader->ipv4Data.srcAddr)
-               continue;
-         }
-      }
-      else
-#endif
-#if (IPV6_SUPPORT == ENABLED)
-      //An IPv6 packet was received?
-      if(pseudoHeader->length == sizeof(Ipv6PseudoHeader))
-      {
-         //Destination IP address filtering
-         if(socket->localIpAddr.length)
-         {
-            //An IPv6 address is expected
-            if(socket->localIpAddr.length != sizeof(Ipv6Addr))
-               continue;
-            //Filter out non-matching addresses
-            if(!ipv6CompAddr(&socket->localIpAddr.ipv6Addr, &pseudoHeader->ipv6Data.destAddr))
-               continue;
-         }
-         //Source IP address filtering
-         if(socket->remoteIpAddr.length)
-         {
-            //An IPv6 address is expected
-            if(socket->remoteIpAddr.length != sizeof(Ipv6Addr))
-               continue;
-            //Filter out non-matching addresses
-            if(!ipv6CompAddr(&socket->remoteIpAddr.ipv6Addr, &pseudoHeader->ipv6Data.srcAddr))
-               continue;
-         }
-      }
-      else
-#endif
-      //An invalid packet was received?
-      {
-         //This should never occur...
+      //Check interface and IP addresses
+      if(!socketMatchAddr(socket, interface, pseudoHeader))
          continue;
-      }
 
       //The current socket meets all the criteria
       break;
    }
 
+   //No matching socket found?
+   if(i >= SOCKET_MAX_COUNT)
+      socket = NULL;
+#endif
+
    //Point to the payload
    offset += sizeof(UdpHeader);
    length -= sizeof(UdpHeader);
 
    //No matching socket found?
-   if(i >= SOCKET_MAX_COUNT)
+   if(socket == NULL)
    {
       //Leave critical section
       osReleaseMutex(&socketMutex);
       //Invoke user callback, if any
       error = udpInvokeRxCallback(interface, pseudoHeader, header, buffer, offset);
+
+      //No application at the destination port?
+      if(error == ERROR_PORT_UNREACHABLE)
+         NET_STATS_INC_COUNTER(interface->stats.udpNoPorts, 1);
+
       //Return status code
       return error;
    }
@@ -301,6 +279,9 @@ error_t udpProcessDatagram(NetInterface *interface,
       //Make sure the receive queue is not full
       if(i >= UDP_RX_QUEUE_SIZE)
       {
+         //The datagram is dropped because the receive queue is full
+         NET_STATS_INC_COUNTER(socket->stats.rxBufferFull, 1);
+         NET_STATS_INC_COUNTER(socket->stats.droppedSegments, 1);
          //Leave critical section
          osReleaseMutex(&socketMutex);
          //Notify the calling function that the queue is full
@@ -329,6 +310,8 @@ error_t udpProcessDatagram(NetInterface *interface,
    //Failed to allocate memory?
    if(!queueItem)
    {
+      //The datagram is dropped
+      NET_STATS_INC_COUNTER(socket->stats.droppedSegments, 1);
       //Leave critical section
       osReleaseMutex(&socketMutex);
       //Return error code
@@ -370,6 +353,10 @@ error_t udpProcessDatagram(NetInterface *interface,
    //Copy the payload
    netBufferCopy(queueItem->buffer, queueItem->offset, buffer, offset, length);
 
+   //Update per-socket statistics
+   NET_STATS_INC_COUNTER(socket->stats.rxPackets, 1);
+   NET_STATS_INC_COUNTER(socket->stats.rxBytes, length);
+
    //Notify user that data is available
    udpUpdateEvents(socket);
 
@@ -417,6 +404,10 @@ error_t udpSendDatagram(Socket *socket, const IpAddr *destIpAddr,
    //Successful processing?
    if(!error)
    {
+      //Update per-socket statistics
+      NET_STATS_INC_COUNTER(socket->stats.txPackets, 1);
+      NET_STATS_INC_COUNTER(socket->stats.txBytes, length);
+
       //Total number of data bytes successfully transmitted
       if(written != NULL)
          *written = length;
@@ -596,6 +587,10 @@ error_t udpReceiveDatagram(Socket *socket, IpAddr *srcIpAddr, uint16_t *srcPort,
    //into the buffer but is not removed from the input queue
    if(!(flags & SOCKET_FLAG_PEEK))
    {
+      //A datagram lent to the application can no longer be released
+      if(socket->lentItem == queueItem)
+         socket->lentItem = NULL;
+
       //Remove the item from the receive queue
       socket->receiveQueue = queueItem->next;
       //Deallocate memory buffer
@@ -610,6 +605,129 @@ error_t udpReceiveDatagram(Socket *socket, IpAddr *srcIpAddr, uint16_t *srcPort,
 }
 
 
+#if (UDP_ZERO_COPY_SUPPORT == ENABLED)
+
+/**
+ * @brief Lend the oldest datagram to the application without copying it
+ *
+ * The datagram stays at the head of the receive queue until the application
+ * gives it back with udpReleaseDatagram(). Lending the same datagram twice
+ * is allowed, but it must only be released once
+ *
+ * @param[in] socket Handle referencing the socket
+ * @param[out] srcIpAddr Source IP address (optional)
+ * @param[out] srcPort Source port number (optional)
+ * @param[out] destIpAddr Destination IP address (optional)
+ * @param[out] chunk Array where to store the chunk descriptors
+ * @param[in] maxChunkCount Number of entries in the array
+ * @param[out] chunkCount Number of chunk descriptors that have been filled
+ * @param[out] received Number of data bytes covered by the chunk descriptors
+ * @param[in] flags Set of flags that influences the behavior of this function
+ * @return Error code
+ **/
+
+error_t udpReceiveDatagramRef(Socket *socket, IpAddr *srcIpAddr, uint16_t *srcPort,
+   IpAddr *destIpAddr, ChunkDesc *chunk, uint_t maxChunkCount, uint_t *chunkCount,
+   size_t *received, uint_t flags)
+{
+   size_t length;
+   SocketQueueItem *queueItem;
+
+   //No data has been lent yet
+   *chunkCount = 0;
+   *received = 0;
+
+   //The SOCKET_FLAG_DONT_WAIT enables non-blocking operation
+   if(!(flags & SOCKET_FLAG_DONT_WAIT))
+   {
+      //The receive queue is empty?
+      if(!socket->receiveQueue)
+      {
+         //Set the events the application is interested in
+         socket->eventMask = SOCKET_EVENT_RX_READY;
+         //Reset the event object
+         osResetEvent(&socket->event);
+         //Leave critical section
+         osReleaseMutex(&socketMutex);
+         //Wait until an event is triggered
+         osWaitForEvent(&socket->event, socket->timeout);
+         //Enter critical section
+         osAcquireMutex(&socketMutex);
+      }
+   }
+
+   //Check whether the read operation timed out
+   if(!socket->receiveQueue)
+      return ERROR_TIMEOUT;
+
+   //Point to the first item in the receive queue
+   queueItem = socket->receiveQueue;
+
+   //Length of the UDP payload
+   length = netBufferGetLength(queueItem->buffer) - queueItem->offset;
+
+   //Point directly to the payload held in the multi-part buffer
+   *received = netBufferGetChunks(queueItem->buffer, queueItem->offset,
+      length, chunk, maxChunkCount, chunkCount);
+
+   //Save the source IP address
+   if(srcIpAddr)
+      *srcIpAddr = queueItem->srcIpAddr;
+   //Save the source port number
+   if(srcPort)
+      *srcPort = queueItem->srcPort;
+   //Save the destination IP address
+   if(destIpAddr)
+      *destIpAddr = queueItem->destIpAddr;
+
+   //Keep track of the datagram lent to the application
+   socket->lentItem = queueItem;
+
+   //Successful read operation
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Give back the datagram previously lent by udpReceiveDatagramRef()
+ *
+ * Only the datagram that has actually been lent can be released, so that
+ * a duplicate release cannot discard a datagram the application has not
+ * read yet
+ *
+ * @param[in] socket Handle referencing the socket
+ * @return Error code
+ **/
+
+error_t udpReleaseDatagram(Socket *socket)
+{
+   SocketQueueItem *queueItem;
+
+   //Point to the first item in the receive queue
+   queueItem = socket->receiveQueue;
+
+   //Make sure the datagram at the head of the queue has been lent
+   if(queueItem == NULL || queueItem != socket->lentItem)
+      return ERROR_INVALID_PARAMETER;
+
+   //The datagram is no longer lent
+   socket->lentItem = NULL;
+
+   //Remove the item from the receive queue
+   socket->receiveQueue = queueItem->next;
+   //Deallocate memory buffer
+   netBufferFree(queueItem->buffer);
+
+   //Update the state of events
+   udpUpdateEvents(socket);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+#endif
+
+
 /**
  * @brief Allocate a buffer to hold a UDP packet
  * @param[in] length Desired payload length
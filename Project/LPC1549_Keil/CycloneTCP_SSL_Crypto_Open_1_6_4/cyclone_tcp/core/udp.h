@@ -55,6 +55,13 @@
    #error UDP_RX_QUEUE_SIZE parameter is not valid
 #endif
 
+//Zero-copy receive support
+#ifndef UDP_ZERO_COPY_SUPPORT
+   #define UDP_ZERO_COPY_SUPPORT DISABLED
+#elif (UDP_ZERO_COPY_SUPPORT != ENABLED && UDP_ZERO_COPY_SUPPORT != DISABLED)
+   #error UDP_ZERO_COPY_SUPPORT parameter is not valid
+#endif
+
 
 //CodeWarrior or Win32 compiler?
 #if defined(__CWCC__) || defined(_WIN32)
@@ -119,6 +126,12 @@ error_t udpSendDatagramEx(NetInterface *interface, uint16_t srcPort, const IpAdd
 error_t udpReceiveDatagram(Socket *socket, IpAddr *srcIpAddr, uint16_t *srcPort,
    IpAddr *destIpAddr, void *data, size_t size, size_t *received, uint_t flags);
 
+error_t udpReceiveDatagramRef(Socket *socket, IpAddr *srcIpAddr, uint16_t *srcPort,
+   IpAddr *destIpAddr, ChunkDesc *chunk, uint_t maxChunkCount, uint_t *chunkCount,
+   size_t *received, uint_t flags);
+
+error_t udpReleaseDatagram(Socket *socket);
+
 NetBuffer *udpAllocBuffer(size_t length, size_t *offset);
 
 void udpUpdateEvents(Socket *socket);
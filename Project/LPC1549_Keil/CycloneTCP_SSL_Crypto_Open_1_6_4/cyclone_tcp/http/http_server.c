@@ -1190,4 +1190,169 @@ error_t httpSendRedirectResponse(HttpConnection *connection, uint_t statusCode,
    return error;
 }
 
+
+#if (NET_STATS_SUPPORT == ENABLED)
+
+//Room kept free in the buffer for one field and the surrounding delimiters
+#define HTTP_SERVER_STATS_MARGIN 96
+
+/**
+ * @brief Send the statistics of the TCP/IP stack as a JSON document
+ *
+ * The document holds one object per network interface and one object
+ * per socket in use, with the fields of the NetInterfaceStats and
+ * SocketStatsSnapshot structures
+ *
+ * @param[in] connection Structure representing an HTTP connection
+ * @return Error code
+ **/
+
+error_t httpSendStatsResponse(HttpConnection *connection)
+{
+   error_t error;
+   uint_t i;
+   uint_t j;
+   uint_t k;
+   size_t n;
+   const uint32_t *p;
+   NetInterfaceStats ifStats;
+   SocketStatsSnapshot socketStats;
+
+   //Names of the per-interface fields
+   static const char_t *const ifFields[] =
+   {
+      "rxPackets", "rxBytes", "txPackets", "txBytes", "txErrors",
+      "ipv4InPackets", "ipv4InHdrErrors", "ipv4InAddrErrors",
+      "ipv4InUnknownProtos", "tcpInSegments", "tcpInErrors",
+      "tcpNoSocket", "udpInDatagrams", "udpInErrors", "udpNoPorts"
+   };
+
+   //Names of the per-socket fields
+   static const char_t *const socketFields[] =
+   {
+      "type", "protocol", "localPort", "remotePort", "state", "srtt",
+      "rttvar", "rto", "cwnd", "ssthresh", "sndWnd", "rcvWnd",
+      "bytesInFlight", "rxQueued", "outOfOrderBlocks", "txPackets",
+      "txBytes", "rxPackets", "rxBytes", "retransmits", "timeouts",
+      "fastRetransmits", "dupAcks", "outOfOrderSegments",
+      "droppedSegments", "rxBufferFull", "txBufferFull"
+   };
+
+   //Format HTTP response header
+   connection->response.version = connection->request.version;
+   connection->response.statusCode = 200;
+   connection->response.keepAlive = connection->request.keepAlive;
+   connection->response.noCache = TRUE;
+   connection->response.contentType = mimeGetType(".json");
+   connection->response.chunkedEncoding = TRUE;
+
+   //Send the header to the client
+   error = httpWriteHeader(connection);
+   //Any error to report?
+   if(error) return error;
+
+   //Start of the list of interfaces
+   n = sprintf(connection->buffer, "{\"interfaces\":[");
+
+   //Loop through network interfaces
+   for(i = 0; i < NET_INTERFACE_COUNT; i++)
+   {
+      //Take a snapshot of the interface counters
+      error = netGetInterfaceStats(&netInterface[i], &ifStats);
+      //Any error to report?
+      if(error) return error;
+
+      //Point to the first counter
+      p = (const uint32_t *) &ifStats;
+
+      //Format the index of the interface
+      n += sprintf(connection->buffer + n, "%s{\"index\":%u",
+         (i > 0) ? "," : "", i + 1);
+
+      //Format each counter
+      for(k = 0; k < arraysize(ifFields); k++)
+      {
+         //Flush the buffer before it overflows
+         if((n + HTTP_SERVER_STATS_MARGIN) > HTTP_SERVER_BUFFER_SIZE)
+         {
+            //Send the pending data
+            error = httpWriteStream(connection, connection->buffer, n);
+            //Any error to report?
+            if(error) return error;
+            //The buffer is now empty
+            n = 0;
+         }
+
+         //Format the current field
+         n += sprintf(connection->buffer + n, ",\"%s\":%" PRIu32,
+            ifFields[k], p[k]);
+      }
+
+      //End of the current object
+      n += sprintf(connection->buffer + n, "}");
+   }
+
+   //Start of the list of sockets
+   n += sprintf(connection->buffer + n, "],\"sockets\":[");
+
+   //Loop through sockets
+   for(i = 0, j = 0; i < SOCKET_MAX_COUNT; i++)
+   {
+      //Skip unused sockets
+      if(socketTable[i].type == SOCKET_TYPE_UNUSED)
+         continue;
+
+      //Take a snapshot of the socket statistics
+      error = socketGetStats(&socketTable[i], &socketStats);
+      //Any error to report?
+      if(error) return error;
+
+      //Point to the first field
+      p = (const uint32_t *) &socketStats;
+
+      //Format the index of the socket
+      n += sprintf(connection->buffer + n, "%s{\"index\":%u",
+         (j > 0) ? "," : "", i + 1);
+
+      //Format each field
+      for(k = 0; k < arraysize(socketFields); k++)
+      {
+         //Flush the buffer before it overflows
+         if((n + HTTP_SERVER_STATS_MARGIN) > HTTP_SERVER_BUFFER_SIZE)
+         {
+            //Send the pending data
+            error = httpWriteStream(connection, connection->buffer, n);
+            //Any error to report?
+            if(error) return error;
+            //The buffer is now empty
+            n = 0;
+         }
+
+         //Format the current field
+         n += sprintf(connection->buffer + n, ",\"%s\":%" PRIu32,
+            socketFields[k], p[k]);
+      }
+
+      //End of the current object
+      n += sprintf(connection->buffer + n, "}");
+      //Number of sockets reported so far
+      j++;
+   }
+
+   //End of the JSON document
+   n += sprintf(connection->buffer + n, "]}");
+
+   //Send the remaining data
+   error = httpWriteStream(connection, connection->buffer, n);
+   //Any error to report?
+   if(error) return error;
+
+   //Properly close output stream
+   error = httpCloseStream(connection);
+   //Return status code
+   return error;
+}
+
+#endif
+
 #endif
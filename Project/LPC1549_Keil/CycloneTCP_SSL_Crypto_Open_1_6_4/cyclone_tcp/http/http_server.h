@@ -558,6 +558,7 @@ error_t httpCloseStream(HttpConnection *connection);
 error_t httpSendResponse(HttpConnection *connection, const char_t *uri);
 error_t httpSendErrorResponse(HttpConnection *connection, uint_t statusCode, const char_t *message);
 error_t httpSendRedirectResponse(HttpConnection *connection, uint_t statusCode, const char_t *uri);
+error_t httpSendStatsResponse(HttpConnection *connection);
 
 //HTTP authentication related functions
 bool_t httpCheckPassword(HttpConnection *connection,
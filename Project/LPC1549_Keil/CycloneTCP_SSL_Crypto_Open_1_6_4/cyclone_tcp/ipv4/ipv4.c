@@ -381,9 +381,17 @@ error_t ipv4GetBroadcastAddr(NetInterface *interface, Ipv4Addr *addr)
 
 void ipv4ProcessPacket(NetInterface *interface, Ipv4Header *packet, size_t length)
 {
+   //Update statistics
+   NET_STATS_INC_COUNTER(interface->stats.ipv4InPackets, 1);
+
    //Ensure the packet length is greater than 20 bytes
    if(length < sizeof(Ipv4Header))
+   {
+      //Update statistics
+      NET_STATS_INC_COUNTER(interface->stats.ipv4InHdrErrors, 1);
+      //Discard incoming packet
       return;
+   }
 
    //Debug message
    TRACE_INFO("IPv4 packet received (%" PRIuSIZE " bytes)...\r\n", length);
@@ -392,30 +400,59 @@ void ipv4ProcessPacket(NetInterface *interface, Ipv4Header *packet, size_t lengt
 
    //A packet whose version number is not 4 must be silently discarded
    if(packet->version != IPV4_VERSION)
+   {
+      //Update statistics
+      NET_STATS_INC_COUNTER(interface->stats.ipv4InHdrErrors, 1);
+      //Discard incoming packet
       return;
+   }
    //Valid IPv4 header shall contains more than five 32-bit words
    if(packet->headerLength < 5)
+   {
+      //Update statistics
+      NET_STATS_INC_COUNTER(interface->stats.ipv4InHdrErrors, 1);
+      //Discard incoming packet
       return;
+   }
    //Ensure the total length is correct before processing the packet
-   if(ntohs(packet->totalLength) < (packet->headerLength * 4))
-      return;
-   if(ntohs(packet->totalLength) > length)
+   if(ntohs(packet->totalLength) < (packet->headerLength * 4) ||
+      ntohs(packet->totalLength) > length)
+   {
+      //Update statistics
+      NET_STATS_INC_COUNTER(interface->stats.ipv4InHdrErrors, 1);
+      //Discard incoming packet
       return;
+   }
    //Source address filtering
    if(ipv4CheckSourceAddr(interface, packet->srcAddr))
+   {
+      //Update statistics
+      NET_STATS_INC_COUNTER(interface->stats.ipv4InAddrErrors, 1);
+      //Discard incoming packet
       return;
+   }
 
 #if defined(IPV4_PACKET_FORWARD_HOOK)
    IPV4_PACKET_FORWARD_HOOK(interface, packet, length);
 #else
    //Destination address filtering
    if(ipv4CheckDestAddr(interface, packet->destAddr))
+   {
+      //Update statistics
+      NET_STATS_INC_COUNTER(interface->stats.ipv4InAddrErrors, 1);
+      //Discard incoming packet
       return;
+   }
 #endif
 
    //Packets addressed to a tentative address should be silently discarded
    if(ipv4IsTentativeAddr(interface, packet->destAddr))
+   {
+      //Update statistics
+      NET_STATS_INC_COUNTER(interface->stats.ipv4InAddrErrors, 1);
+      //Discard incoming packet
       return;
+   }
 
    //The host must verify the IP header checksum on every received
    //datagram and silently discard every datagram that has a bad
@@ -424,6 +461,8 @@ void ipv4ProcessPacket(NetInterface *interface, Ipv4Header *packet, size_t lengt
    {
       //Debug message
       TRACE_WARNING("Wrong IP header checksum!\r\n");
+      //Update statistics
+      NET_STATS_INC_COUNTER(interface->stats.ipv4InHdrErrors, 1);
       //Discard incoming packet
       return;
    }
@@ -570,6 +609,8 @@ void ipv4ProcessDatagram(NetInterface *interface, const NetBuffer *buffer)
    //Unreachable protocol?
    if(error == ERROR_PROTOCOL_UNREACHABLE)
    {
+      //Update statistics
+      NET_STATS_INC_COUNTER(interface->stats.ipv4InUnknownProtos, 1);
       //Send a Destination Unreachable message
       icmpSendErrorMessage(interface, ICMP_TYPE_DEST_UNREACHABLE,
          ICMP_CODE_PROTOCOL_UNREACHABLE, 0, buffer);
@@ -0,0 +1,254 @@
+/**
+ * @file net_stats_mib_impl.c
+ * @brief Statistics MIB module implementation
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL SNMP_TRACE_LEVEL
+
+//Dependencies
+#include "core/net.h"
+#include "core/socket.h"
+#include "snmp/net_stats_mib_module.h"
+#include "snmp/net_stats_mib_impl.h"
+#include "oid.h"
+#include "debug.h"
+
+//Check TCP/IP stack configuration
+#if (NET_STATS_MIB_SUPPORT == ENABLED)
+
+
+/**
+ * @brief Statistics MIB module initialization
+ * @return Error code
+ **/
+
+error_t netStatsMibInit(void)
+{
+   //Debug message
+   TRACE_INFO("Initializing statistics MIB...\r\n");
+
+   //The counters are maintained by the TCP/IP stack itself
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Get interface statistics entry
+ * @param[in] object Pointer to the MIB object descriptor
+ * @param[in] oid Object identifier (object name and instance identifier)
+ * @param[in] oidLen Length of the OID, in bytes
+ * @param[out] value Object value
+ * @param[in,out] valueLen Length of the object value, in bytes
+ * @return Error code
+ **/
+
+error_t netStatsMibGetIfEntry(const MibObject *object, const uint8_t *oid,
+   size_t oidLen, MibVariant *value, size_t *valueLen)
+{
+   error_t error;
+   uint_t index;
+   uint_t column;
+   NetInterfaceStats stats;
+
+   //Check OID length
+   if(oidLen != (object->oidLen + 1))
+      return ERROR_INSTANCE_NOT_FOUND;
+
+   //Get index
+   index = oid[oidLen - 1];
+
+   //Check index range
+   if(index < 1 || index > NET_INTERFACE_COUNT)
+      return ERROR_INSTANCE_NOT_FOUND;
+
+   //Each column maps to the field with the same rank
+   column = object->oid[object->oidLen - 1];
+
+   //Check column number
+   if(column < 1 || column > (sizeof(NetInterfaceStats) / sizeof(uint32_t)))
+      return ERROR_OBJECT_NOT_FOUND;
+
+   //Take a snapshot of the interface counters
+   error = netGetInterfaceStats(&netInterface[index - 1], &stats);
+   //Any error to report?
+   if(error) return error;
+
+   //Get object value
+   value->counter32 = ((uint32_t *) &stats)[column - 1];
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Get next interface statistics entry
+ * @param[in] object Pointer to the MIB object descriptor
+ * @param[in] oid Object identifier
+ * @param[in] oidLen Length of the OID, in bytes
+ * @param[out] nextOid OID of the next object in the MIB
+ * @param[out] nextOidLen Length of the next object identifier, in bytes
+ * @return Error code
+ **/
+
+error_t netStatsMibGetNextIfEntry(const MibObject *object, const uint8_t *oid,
+   size_t oidLen, uint8_t *nextOid, size_t *nextOidLen)
+{
+   uint_t index;
+
+   //Make sure the buffer is large enough to hold the entire OID
+   if(*nextOidLen < (object->oidLen + 1))
+      return ERROR_BUFFER_OVERFLOW;
+
+   //Copy object identifier
+   memcpy(nextOid, object->oid, object->oidLen);
+
+   //Loop through interfaces
+   for(index = 1; index <= NET_INTERFACE_COUNT; index++)
+   {
+      //Select instance
+      nextOid[object->oidLen] = index;
+
+      //Compare object identifiers
+      if(oidComp(oid, oidLen, nextOid, object->oidLen + 1) < 0)
+      {
+         //Save the length of the next object identifier
+         *nextOidLen = object->oidLen + 1;
+         //The specified OID lexicographically precedes the name of the current object
+         return NO_ERROR;
+      }
+   }
+
+   //The specified OID does not lexicographically precede the name of some object
+   return ERROR_OBJECT_NOT_FOUND;
+}
+
+
+/**
+ * @brief Get socket statistics entry
+ * @param[in] object Pointer to the MIB object descriptor
+ * @param[in] oid Object identifier (object name and instance identifier)
+ * @param[in] oidLen Length of the OID, in bytes
+ * @param[out] value Object value
+ * @param[in,out] valueLen Length of the object value, in bytes
+ * @return Error code
+ **/
+
+error_t netStatsMibGetSocketEntry(const MibObject *object, const uint8_t *oid,
+   size_t oidLen, MibVariant *value, size_t *valueLen)
+{
+   error_t error;
+   uint_t index;
+   uint_t column;
+   Socket *socket;
+   SocketStatsSnapshot stats;
+
+   //Check OID length
+   if(oidLen != (object->oidLen + 1))
+      return ERROR_INSTANCE_NOT_FOUND;
+
+   //Get index
+   index = oid[oidLen - 1];
+
+   //Check index range
+   if(index < 1 || index > SOCKET_MAX_COUNT)
+      return ERROR_INSTANCE_NOT_FOUND;
+
+   //Point to the socket
+   socket = &socketTable[index - 1];
+
+   //Unused sockets do not appear in the table
+   if(socket->type == SOCKET_TYPE_UNUSED)
+      return ERROR_INSTANCE_NOT_FOUND;
+
+   //Each column maps to the field with the same rank
+   column = object->oid[object->oidLen - 1];
+
+   //Check column number
+   if(column < 1 || column > (sizeof(SocketStatsSnapshot) / sizeof(uint32_t)))
+      return ERROR_OBJECT_NOT_FOUND;
+
+   //Take a snapshot of the socket statistics
+   error = socketGetStats(socket, &stats);
+   //Any error to report?
+   if(error) return error;
+
+   //Get object value
+   value->counter32 = ((uint32_t *) &stats)[column - 1];
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Get next socket statistics entry
+ * @param[in] object Pointer to the MIB object descriptor
+ * @param[in] oid Object identifier
+ * @param[in] oidLen Length of the OID, in bytes
+ * @param[out] nextOid OID of the next object in the MIB
+ * @param[out] nextOidLen Length of the next object identifier, in bytes
+ * @return Error code
+ **/
+
+error_t netStatsMibGetNextSocketEntry(const MibObject *object, const uint8_t *oid,
+   size_t oidLen, uint8_t *nextOid, size_t *nextOidLen)
+{
+   uint_t index;
+
+   //Make sure the buffer is large enough to hold the entire OID
+   if(*nextOidLen < (object->oidLen + 1))
+      return ERROR_BUFFER_OVERFLOW;
+
+   //Copy object identifier
+   memcpy(nextOid, object->oid, object->oidLen);
+
+   //Loop through sockets (the index must fit in a single sub-identifier)
+   for(index = 1; index <= SOCKET_MAX_COUNT && index < 128; index++)
+   {
+      //Skip unused sockets
+      if(socketTable[index - 1].type == SOCKET_TYPE_UNUSED)
+         continue;
+
+      //Select instance
+      nextOid[object->oidLen] = index;
+
+      //Compare object identifiers
+      if(oidComp(oid, oidLen, nextOid, object->oidLen + 1) < 0)
+      {
+         //Save the length of the next object identifier
+         *nextOidLen = object->oidLen + 1;
+         //The specified OID lexicographically precedes the name of the current object
+         return NO_ERROR;
+      }
+   }
+
+   //The specified OID does not lexicographically precede the name of some object
+   return ERROR_OBJECT_NOT_FOUND;
+}
+
+#endif
@@ -0,0 +1,51 @@
+/**
+ * @file net_stats_mib_impl.h
+ * @brief Statistics MIB module implementation
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+#ifndef _NET_STATS_MIB_IMPL_H
+#define _NET_STATS_MIB_IMPL_H
+
+//Dependencies
+#include "core/net.h"
+#include "snmp/mib_common.h"
+
+//Statistics MIB related functions
+error_t netStatsMibInit(void);
+
+error_t netStatsMibGetIfEntry(const MibObject *object, const uint8_t *oid,
+   size_t oidLen, MibVariant *value, size_t *valueLen);
+
+error_t netStatsMibGetNextIfEntry(const MibObject *object, const uint8_t *oid,
+   size_t oidLen, uint8_t *nextOid, size_t *nextOidLen);
+
+error_t netStatsMibGetSocketEntry(const MibObject *object, const uint8_t *oid,
+   size_t oidLen, MibVariant *value, size_t *valueLen);
+
+error_t netStatsMibGetNextSocketEntry(const MibObject *object, const uint8_t *oid,
+   size_t oidLen, uint8_t *nextOid, size_t *nextOidLen);
+
+#endif
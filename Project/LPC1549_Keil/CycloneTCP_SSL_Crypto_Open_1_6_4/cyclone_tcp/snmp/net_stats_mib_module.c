@@ -0,0 +1,704 @@
+/**
+ * @file net_stats_mib_module.c
+ * @brief Statistics MIB module
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * The statistics MIB exports the hot-path counters of the TCP/IP stack.
+ * It is made of two tables located under a configurable OID prefix:
+ * - prefix.1.1.column.index: per-interface counters, indexed by interface
+ * - prefix.2.1.column.index: per-socket statistics, indexed by socket
+ * The columns follow the order of the fields of the NetInterfaceStats
+ * and SocketStatsSnapshot structures
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL SNMP_TRACE_LEVEL
+
+//Dependencies
+#include "core/net.h"
+#include "snmp/net_stats_mib_module.h"
+#include "snmp/net_stats_mib_impl.h"
+#include "asn1.h"
+#include "debug.h"
+
+//Check TCP/IP stack configuration
+#if (NET_STATS_MIB_SUPPORT == ENABLED)
+
+
+/**
+ * @brief Statistics MIB objects
+ **/
+
+const MibObject netStatsMibObjects[] =
+{
+   //nsIfRxPackets object
+   {
+      "nsIfRxPackets",
+      {NET_STATS_MIB_OID_PREFIX, 1, 1, 1},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetIfEntry,
+      netStatsMibGetNextIfEntry
+   },
+   //nsIfRxBytes object
+   {
+      "nsIfRxBytes",
+      {NET_STATS_MIB_OID_PREFIX, 1, 1, 2},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetIfEntry,
+      netStatsMibGetNextIfEntry
+   },
+   //nsIfTxPackets object
+   {
+      "nsIfTxPackets",
+      {NET_STATS_MIB_OID_PREFIX, 1, 1, 3},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetIfEntry,
+      netStatsMibGetNextIfEntry
+   },
+   //nsIfTxBytes object
+   {
+      "nsIfTxBytes",
+      {NET_STATS_MIB_OID_PREFIX, 1, 1, 4},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetIfEntry,
+      netStatsMibGetNextIfEntry
+   },
+   //nsIfTxErrors object
+   {
+      "nsIfTxErrors",
+      {NET_STATS_MIB_OID_PREFIX, 1, 1, 5},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetIfEntry,
+      netStatsMibGetNextIfEntry
+   },
+   //nsIfIpv4InPackets object
+   {
+      "nsIfIpv4InPackets",
+      {NET_STATS_MIB_OID_PREFIX, 1, 1, 6},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetIfEntry,
+      netStatsMibGetNextIfEntry
+   },
+   //nsIfIpv4InHdrErrors object
+   {
+      "nsIfIpv4InHdrErrors",
+      {NET_STATS_MIB_OID_PREFIX, 1, 1, 7},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetIfEntry,
+      netStatsMibGetNextIfEntry
+   },
+   //nsIfIpv4InAddrErrors object
+   {
+      "nsIfIpv4InAddrErrors",
+      {NET_STATS_MIB_OID_PREFIX, 1, 1, 8},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetIfEntry,
+      netStatsMibGetNextIfEntry
+   },
+   //nsIfIpv4InUnknownProtos object
+   {
+      "nsIfIpv4InUnknownProtos",
+      {NET_STATS_MIB_OID_PREFIX, 1, 1, 9},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetIfEntry,
+      netStatsMibGetNextIfEntry
+   },
+   //nsIfTcpInSegments object
+   {
+      "nsIfTcpInSegments",
+      {NET_STATS_MIB_OID_PREFIX, 1, 1, 10},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetIfEntry,
+      netStatsMibGetNextIfEntry
+   },
+   //nsIfTcpInErrors object
+   {
+      "nsIfTcpInErrors",
+      {NET_STATS_MIB_OID_PREFIX, 1, 1, 11},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetIfEntry,
+      netStatsMibGetNextIfEntry
+   },
+   //nsIfTcpNoSocket object
+   {
+      "nsIfTcpNoSocket",
+      {NET_STATS_MIB_OID_PREFIX, 1, 1, 12},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetIfEntry,
+      netStatsMibGetNextIfEntry
+   },
+   //nsIfUdpInDatagrams object
+   {
+      "nsIfUdpInDatagrams",
+      {NET_STATS_MIB_OID_PREFIX, 1, 1, 13},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetIfEntry,
+      netStatsMibGetNextIfEntry
+   },
+   //nsIfUdpInErrors object
+   {
+      "nsIfUdpInErrors",
+      {NET_STATS_MIB_OID_PREFIX, 1, 1, 14},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetIfEntry,
+      netStatsMibGetNextIfEntry
+   },
+   //nsIfUdpNoPorts object
+   {
+      "nsIfUdpNoPorts",
+      {NET_STATS_MIB_OID_PREFIX, 1, 1, 15},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetIfEntry,
+      netStatsMibGetNextIfEntry
+   },
+   //nsSocketType object
+   {
+      "nsSocketType",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 1},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_GAUGE32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketProtocol object
+   {
+      "nsSocketProtocol",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 2},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_GAUGE32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketLocalPort object
+   {
+      "nsSocketLocalPort",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 3},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_GAUGE32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketRemotePort object
+   {
+      "nsSocketRemotePort",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 4},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_GAUGE32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketState object
+   {
+      "nsSocketState",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 5},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_GAUGE32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketSrtt object
+   {
+      "nsSocketSrtt",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 6},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_GAUGE32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketRttvar object
+   {
+      "nsSocketRttvar",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 7},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_GAUGE32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketRto object
+   {
+      "nsSocketRto",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 8},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_GAUGE32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketCwnd object
+   {
+      "nsSocketCwnd",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 9},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_GAUGE32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketSsthresh object
+   {
+      "nsSocketSsthresh",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 10},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_GAUGE32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketSndWnd object
+   {
+      "nsSocketSndWnd",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 11},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_GAUGE32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketRcvWnd object
+   {
+      "nsSocketRcvWnd",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 12},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_GAUGE32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketBytesInFlight object
+   {
+      "nsSocketBytesInFlight",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 13},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_GAUGE32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketRxQueued object
+   {
+      "nsSocketRxQueued",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 14},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_GAUGE32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketOutOfOrderBlocks object
+   {
+      "nsSocketOutOfOrderBlocks",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 15},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_GAUGE32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketTxPackets object
+   {
+      "nsSocketTxPackets",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 16},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketTxBytes object
+   {
+      "nsSocketTxBytes",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 17},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketRxPackets object
+   {
+      "nsSocketRxPackets",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 18},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketRxBytes object
+   {
+      "nsSocketRxBytes",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 19},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketRetransmits object
+   {
+      "nsSocketRetransmits",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 20},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketTimeouts object
+   {
+      "nsSocketTimeouts",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 21},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketFastRetransmits object
+   {
+      "nsSocketFastRetransmits",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 22},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketDupAcks object
+   {
+      "nsSocketDupAcks",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 23},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketOutOfOrderSegments object
+   {
+      "nsSocketOutOfOrderSegments",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 24},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketDroppedSegments object
+   {
+      "nsSocketDroppedSegments",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 25},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketRxBufferFull object
+   {
+      "nsSocketRxBufferFull",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 26},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   },
+   //nsSocketTxBufferFull object
+   {
+      "nsSocketTxBufferFull",
+      {NET_STATS_MIB_OID_PREFIX, 2, 1, 27},
+      NET_STATS_MIB_OID_PREFIX_LEN + 3,
+      ASN1_CLASS_APPLICATION,
+      MIB_TYPE_COUNTER32,
+      MIB_ACCESS_READ_ONLY,
+      NULL,
+      NULL,
+      sizeof(uint32_t),
+      NULL,
+      netStatsMibGetSocketEntry,
+      netStatsMibGetNextSocketEntry
+   }
+};
+
+
+/**
+ * @brief Statistics MIB module
+ **/
+
+const MibModule netStatsMibModule =
+{
+   netStatsMibObjects,
+   arraysize(netStatsMibObjects),
+   netStatsMibInit,
+   NULL,
+   NULL
+};
+
+#endif
@@ -0,0 +1,66 @@
+/**
+ * @file net_stats_mib_module.h
+ * @brief Statistics MIB module
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneTCP Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+#ifndef _NET_STATS_MIB_MODULE_H
+#define _NET_STATS_MIB_MODULE_H
+
+//Dependencies
+#include "core/net.h"
+#include "snmp/mib_common.h"
+
+//Statistics MIB module support
+#ifndef NET_STATS_MIB_SUPPORT
+   #define NET_STATS_MIB_SUPPORT DISABLED
+#elif (NET_STATS_MIB_SUPPORT != ENABLED && NET_STATS_MIB_SUPPORT != DISABLED)
+   #error NET_STATS_MIB_SUPPORT parameter is not valid
+#endif
+
+//OID prefix of the statistics MIB (1.3.6.1.3.1 by default)
+#ifndef NET_STATS_MIB_OID_PREFIX
+   #define NET_STATS_MIB_OID_PREFIX 43, 6, 1, 3, 1
+   #define NET_STATS_MIB_OID_PREFIX_LEN 5
+#endif
+
+//Length of the OID prefix
+#ifndef NET_STATS_MIB_OID_PREFIX_LEN
+   #error NET_STATS_MIB_OID_PREFIX_LEN parameter is not defined
+#elif (NET_STATS_MIB_OID_PREFIX_LEN < 1 || (NET_STATS_MIB_OID_PREFIX_LEN + 4) > MIB_MAX_OID_SIZE)
+   #error NET_STATS_MIB_OID_PREFIX_LEN parameter is not valid
+#endif
+
+//The statistics MIB relies on the statistics counters
+#if (NET_STATS_MIB_SUPPORT == ENABLED && NET_STATS_SUPPORT == DISABLED)
+   #error NET_STATS_SUPPORT must be enabled to use the statistics MIB
+#endif
+
+
+//Statistics MIB related constants
+extern const MibObject netStatsMibObjects[];
+extern const MibModule netStatsMibModule;
+
+#endif
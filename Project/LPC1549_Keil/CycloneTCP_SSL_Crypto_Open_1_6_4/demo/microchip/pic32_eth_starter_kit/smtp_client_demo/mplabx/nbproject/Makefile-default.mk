@@ -45,17 +45,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=../src/main.c ../src/debug.c ../src/sprintf.c ../src/strtok_r.c ../src/ext3_irq_wrapper.S ../src/eth_irq_wrapper.S ../../../../../common/endian.c ../../../../../common/os_port_freertos.c ../../../../../common/date_time.c ../../../../../common/str.c ../../../../../cyclone_tcp/core/tcp_ip_stack.c ../../../../../cyclone_tcp/core/tcp_ip_stack_mem.c ../../../../../cyclone_tcp/drivers/pic32mx_eth.c ../../../../../cyclone_tcp/drivers/dp83848.c ../../../../../cyclone_tcp/core/nic.c ../../../../../cyclone_tcp/core/ethernet.c ../../../../../cyclone_tcp/ipv4/arp.c ../../../../../cyclone_tcp/core/ip.c ../../../../../cyclone_tcp/ipv4/ipv4.c ../../../../../cyclone_tcp/ipv4/ipv4_frag.c ../../../../../cyclone_tcp/ipv4/icmp.c ../../../../../cyclone_tcp/ipv4/igmp.c ../../../../../cyclone_tcp/ipv6/ipv6.c ../../../../../cyclone_tcp/ipv6/ipv6_frag.c ../../../../../cyclone_tcp/ipv6/icmpv6.c ../../../../../cyclone_tcp/ipv6/mld.c ../../../../../cyclone_tcp/ipv6/ndp.c ../../../../../cyclone_tcp/ipv6/slaac.c ../../../../../cyclone_tcp/core/tcp.c ../../../../../cyclone_tcp/core/tcp_fsm.c ../../../../../cyclone_tcp/core/tcp_misc.c ../../../../../cyclone_tcp/core/tcp_timer.c ../../../../../cyclone_tcp/core/udp.c ../../../../../cyclone_tcp/core/socket.c ../../../../../cyclone_tcp/core/bsd_socket.c ../../../../../cyclone_tcp/core/raw_socket.c ../../../../../cyclone_tcp/core/ping.c ../../../../../cyclone_tcp/dns/dns_cache.c ../../../../../cyclone_tcp/dns/dns_client.c ../../../../../cyclone_tcp/dns/dns_common.c ../../../../../cyclone_tcp/dns/dns_debug.c ../../../../../cyclone_tcp/mdns/mdns_client.c ../../../../../cyclone_tcp/mdns/mdns_responder.c ../../../../../cyclone_tcp/mdns/mdns_common.c ../../../../../cyclone_tcp/dhcp/dhcp_client.c ../../../../../cyclone_tcp/dhcp/dhcp_common.c ../../../../../cyclone_tcp/dhcp/dhcp_debug.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_client.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_relay.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_common.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_debug.c ../../../../../cyclone_tcp/smtp/smtp_client.c ../../../../../cyclone_ssl/tls.c ../../../../../cyclone_ssl/tls_cipher_suites.c ../../../../../cyclone_ssl/tls_client.c ../../../../../cyclone_ssl/tls_server.c ../../../../../cyclone_ssl/tls_common.c ../../../../../cyclone_ssl/tls_record.c ../../../../../cyclone_ssl/tls_io.c ../../../../../cyclone_ssl/tls_misc.c ../../../../../cyclone_ssl/tls_cache.c ../../../../../cyclone_ssl/ssl_common.c ../../../../../cyclone_crypto/base64.c ../../../../../cyclone_crypto/md2.c ../../../../../cyclone_crypto/md4.c ../../../../../cyclone_crypto/md5.c ../../../../../cyclone_crypto/ripemd128.c ../../../../../cyclone_crypto/ripemd160.c ../../../../../cyclone_crypto/sha1.c ../../../../../cyclone_crypto/sha224.c ../../../../../cyclone_crypto/sha256.c ../../../../../cyclone_crypto/sha384.c ../../../../../cyclone_crypto/sha512.c ../../../../../cyclone_crypto/sha512_224.c ../../../../../cyclone_crypto/sha512_256.c ../../../../../cyclone_crypto/tiger.c ../../../../../cyclone_crypto/whirlpool.c ../../../../../cyclone_crypto/hmac.c ../../../../../cyclone_crypto/rc4.c ../../../../../cyclone_crypto/rc6.c ../../../../../cyclone_crypto/idea.c ../../../../../cyclone_crypto/des.c ../../../../../cyclone_crypto/des3.c ../../../../../cyclone_crypto/aes.c ../../../../../cyclone_crypto/camellia.c ../../../../../cyclone_crypto/seed.c ../../../../../cyclone_crypto/aria.c ../../../../../cyclone_crypto/cipher_mode_ecb.c ../../../../../cyclone_crypto/cipher_mode_cbc.c ../../../../../cyclone_crypto/cipher_mode_cfb.c ../../../../../cyclone_crypto/cipher_mode_ofb.c ../../../../../cyclone_crypto/cipher_mode_ctr.c ../../../../../cyclone_crypto/cipher_mode_ccm.c ../../../../../cyclone_crypto/cipher_mode_gcm.c ../../../../../cyclone_crypto/dh.c ../../../../../cyclone_crypto/rsa.c ../../../../../cyclone_crypto/dsa.c ../../../../../cyclone_crypto/ec.c ../../../../../cyclone_crypto/ec_curves.c ../../../../../cyclone_crypto/ecdh.c ../../../../../cyclone_crypto/ecdsa.c ../../../../../cyclone_crypto/pkcs5.c ../../../../../cyclone_crypto/mpi.c ../../../../../cyclone_crypto/asn1.c ../../../../../cyclone_crypto/x509.c ../../../../../cyclone_crypto/pem.c ../../../../../cyclone_crypto/yarrow.c ../../../../common/freertos/portable/mplabx/pic32mx/port.c ../../../../common/freertos/portable/mplabx/pic32mx/port_asm.S ../../../../common/freertos/croutine.c ../../../../common/freertos/list.c ../../../../common/freertos/queue.c ../../../../common/freertos/tasks.c ../../../../common/freertos/timers.c ../../../../common/freertos/portable/memmang/heap_3.c
+SOURCEFILES_QUOTED_IF_SPACED=../src/main.c ../src/debug.c ../src/sprintf.c ../src/strtok_r.c ../src/ext3_irq_wrapper.S ../src/eth_irq_wrapper.S ../../../../../common/endian.c ../../../../../common/os_port_freertos.c ../../../../../common/date_time.c ../../../../../common/str.c ../../../../../cyclone_tcp/core/tcp_ip_stack.c ../../../../../cyclone_tcp/core/tcp_ip_stack_mem.c ../../../../../cyclone_tcp/drivers/pic32mx_eth.c ../../../../../cyclone_tcp/drivers/dp83848.c ../../../../../cyclone_tcp/core/nic.c ../../../../../cyclone_tcp/core/ethernet.c ../../../../../cyclone_tcp/ipv4/arp.c ../../../../../cyclone_tcp/core/ip.c ../../../../../cyclone_tcp/ipv4/ipv4.c ../../../../../cyclone_tcp/ipv4/ipv4_frag.c ../../../../../cyclone_tcp/ipv4/icmp.c ../../../../../cyclone_tcp/ipv4/igmp.c ../../../../../cyclone_tcp/ipv6/ipv6.c ../../../../../cyclone_tcp/ipv6/ipv6_frag.c ../../../../../cyclone_tcp/ipv6/icmpv6.c ../../../../../cyclone_tcp/ipv6/mld.c ../../../../../cyclone_tcp/ipv6/ndp.c ../../../../../cyclone_tcp/ipv6/slaac.c ../../../../../cyclone_tcp/core/tcp.c ../../../../../cyclone_tcp/core/tcp_fsm.c ../../../../../cyclone_tcp/core/tcp_misc.c ../../../../../cyclone_tcp/core/tcp_timer.c ../../../../../cyclone_tcp/core/tcp_cc.c ../../../../../cyclone_tcp/core/tcp_cubic.c ../../../../../cyclone_tcp/core/tcp_syn_cookie.c ../../../../../cyclone_tcp/core/udp.c ../../../../../cyclone_tcp/core/socket.c ../../../../../cyclone_tcp/core/bsd_socket.c ../../../../../cyclone_tcp/core/raw_socket.c ../../../../../cyclone_tcp/core/ping.c ../../../../../cyclone_tcp/dns/dns_cache.c ../../../../../cyclone_tcp/dns/dns_client.c ../../../../../cyclone_tcp/dns/dns_common.c ../../../../../cyclone_tcp/dns/dns_debug.c ../../../../../cyclone_tcp/mdns/mdns_client.c ../../../../../cyclone_tcp/mdns/mdns_responder.c ../../../../../cyclone_tcp/mdns/mdns_common.c ../../../../../cyclone_tcp/dhcp/dhcp_client.c ../../../../../cyclone_tcp/dhcp/dhcp_common.c ../../../../../cyclone_tcp/dhcp/dhcp_debug.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_client.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_relay.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_common.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_debug.c ../../../../../cyclone_tcp/smtp/smtp_client.c ../../../../../cyclone_ssl/tls.c ../../../../../cyclone_ssl/tls_cipher_suites.c ../../../../../cyclone_ssl/tls_client.c ../../../../../cyclone_ssl/tls_server.c ../../../../../cyclone_ssl/tls_common.c ../../../../../cyclone_ssl/tls_record.c ../../../../../cyclone_ssl/tls_io.c ../../../../../cyclone_ssl/tls_misc.c ../../../../../cyclone_ssl/tls_cache.c ../../../../../cyclone_ssl/tls_ticket.c ../../../../../cyclone_ssl/ssl_common.c ../../../../../cyclone_crypto/base64.c ../../../../../cyclone_crypto/md2.c ../../../../../cyclone_crypto/md4.c ../../../../../cyclone_crypto/md5.c ../../../../../cyclone_crypto/ripemd128.c ../../../../../cyclone_crypto/ripemd160.c ../../../../../cyclone_crypto/sha1.c ../../../../../cyclone_crypto/sha224.c ../../../../../cyclone_crypto/sha256.c ../../../../../cyclone_crypto/sha384.c ../../../../../cyclone_crypto/sha512.c ../../../../../cyclone_crypto/sha512_224.c ../../../../../cyclone_crypto/sha512_256.c ../../../../../cyclone_crypto/tiger.c ../../../../../cyclone_crypto/whirlpool.c ../../../../../cyclone_crypto/hmac.c ../../../../../cyclone_crypto/rc4.c ../../../../../cyclone_crypto/rc6.c ../../../../../cyclone_crypto/idea.c ../../../../../cyclone_crypto/des.c ../../../../../cyclone_crypto/des3.c ../../../../../cyclone_crypto/aes.c ../../../../../cyclone_crypto/camellia.c ../../../../../cyclone_crypto/seed.c ../../../../../cyclone_crypto/aria.c ../../../../../cyclone_crypto/cipher_mode_ecb.c ../../../../../cyclone_crypto/cipher_mode_cbc.c ../../../../../cyclone_crypto/cipher_mode_cfb.c ../../../../../cyclone_crypto/cipher_mode_ofb.c ../../../../../cyclone_crypto/cipher_mode_ctr.c ../../../../../cyclone_crypto/cipher_mode_ccm.c ../../../../../cyclone_crypto/cipher_mode_gcm.c ../../../../../cyclone_crypto/chacha.c ../../../../../cyclone_crypto/poly1305.c ../../../../../cyclone_crypto/chacha20_poly1305.c ../../../../../cyclone_crypto/dh.c ../../../../../cyclone_crypto/rsa.c ../../../../../cyclone_crypto/dsa.c ../../../../../cyclone_crypto/ec.c ../../../../../cyclone_crypto/ec_curves.c ../../../../../cyclone_crypto/ec_p256.c ../../../../../cyclone_crypto/ecdh.c ../../../../../cyclone_crypto/curve25519.c ../../../../../cyclone_crypto/x25519.c ../../../../../cyclone_crypto/ecdsa.c ../../../../../cyclone_crypto/pkcs5.c ../../../../../cyclone_crypto/mpi.c ../../../../../cyclone_crypto/asn1.c ../../../../../cyclone_crypto/x509.c ../../../../../cyclone_crypto/pem.c ../../../../../cyclone_crypto/yarrow.c ../../../../common/freertos/portable/mplabx/pic32mx/port.c ../../../../common/freertos/portable/mplabx/pic32mx/port_asm.S ../../../../common/freertos/croutine.c ../../../../common/freertos/list.c ../../../../common/freertos/queue.c ../../../../common/freertos/tasks.c ../../../../common/freertos/timers.c ../../../../common/freertos/portable/memmang/heap_3.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1360937237/debug.o ${OBJECTDIR}/_ext/1360937237/sprintf.o ${OBJECTDIR}/_ext/1360937237/strtok_r.o ${OBJECTDIR}/_ext/1360937237/ext3_irq_wrapper.o ${OBJECTDIR}/_ext/1360937237/eth_irq_wrapper.o ${OBJECTDIR}/_ext/360186330/endian.o ${OBJECTDIR}/_ext/360186330/os_port_freertos.o ${OBJECTDIR}/_ext/360186330/date_time.o ${OBJECTDIR}/_ext/360186330/str.o ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack.o ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack_mem.o ${OBJECTDIR}/_ext/1357806602/pic32mx_eth.o ${OBJECTDIR}/_ext/1357806602/dp83848.o ${OBJECTDIR}/_ext/1079766828/nic.o ${OBJECTDIR}/_ext/1079766828/ethernet.o ${OBJECTDIR}/_ext/1079587046/arp.o ${OBJECTDIR}/_ext/1079766828/ip.o ${OBJECTDIR}/_ext/1079587046/ipv4.o ${OBJECTDIR}/_ext/1079587046/ipv4_frag.o ${OBJECTDIR}/_ext/1079587046/icmp.o ${OBJECTDIR}/_ext/1079587046/igmp.o ${OBJECTDIR}/_ext/1079587044/ipv6.o ${OBJECTDIR}/_ext/1079587044/ipv6_frag.o ${OBJECTDIR}/_ext/1079587044/icmpv6.o ${OBJECTDIR}/_ext/1079587044/mld.o ${OBJECTDIR}/_ext/1079587044/ndp.o ${OBJECTDIR}/_ext/1079587044/slaac.o ${OBJECTDIR}/_ext/1079766828/tcp.o ${OBJECTDIR}/_ext/1079766828/tcp_fsm.o ${OBJECTDIR}/_ext/1079766828/tcp_misc.o ${OBJECTDIR}/_ext/1079766828/tcp_timer.o ${OBJECTDIR}/_ext/1079766828/udp.o ${OBJECTDIR}/_ext/1079766828/socket.o ${OBJECTDIR}/_ext/1079766828/bsd_socket.o ${OBJECTDIR}/_ext/1079766828/raw_socket.o ${OBJECTDIR}/_ext/1079766828/ping.o ${OBJECTDIR}/_ext/242264404/dns_cache.o ${OBJECTDIR}/_ext/242264404/dns_client.o ${OBJECTDIR}/_ext/242264404/dns_common.o ${OBJECTDIR}/_ext/242264404/dns_debug.o ${OBJECTDIR}/_ext/1079479599/mdns_client.o ${OBJECTDIR}/_ext/1079479599/mdns_responder.o ${OBJECTDIR}/_ext/1079479599/mdns_common.o ${OBJECTDIR}/_ext/1079744218/dhcp_client.o ${OBJECTDIR}/_ext/1079744218/dhcp_common.o ${OBJECTDIR}/_ext/1079744218/dhcp_debug.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_client.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_relay.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_common.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_debug.o ${OBJECTDIR}/_ext/1079292021/smtp_client.o ${OBJECTDIR}/_ext/476983781/tls.o ${OBJECTDIR}/_ext/476983781/tls_cipher_suites.o ${OBJECTDIR}/_ext/476983781/tls_client.o ${OBJECTDIR}/_ext/476983781/tls_server.o ${OBJECTDIR}/_ext/476983781/tls_common.o ${OBJECTDIR}/_ext/476983781/tls_record.o ${OBJECTDIR}/_ext/476983781/tls_io.o ${OBJECTDIR}/_ext/476983781/tls_misc.o ${OBJECTDIR}/_ext/476983781/tls_cache.o ${OBJECTDIR}/_ext/476983781/ssl_common.o ${OBJECTDIR}/_ext/1613513288/base64.o ${OBJECTDIR}/_ext/1613513288/md2.o ${OBJECTDIR}/_ext/1613513288/md4.o ${OBJECTDIR}/_ext/1613513288/md5.o ${OBJECTDIR}/_ext/1613513288/ripemd128.o ${OBJECTDIR}/_ext/1613513288/ripemd160.o ${OBJECTDIR}/_ext/1613513288/sha1.o ${OBJECTDIR}/_ext/1613513288/sha224.o ${OBJECTDIR}/_ext/1613513288/sha256.o ${OBJECTDIR}/_ext/1613513288/sha384.o ${OBJECTDIR}/_ext/1613513288/sha512.o ${OBJECTDIR}/_ext/1613513288/sha512_224.o ${OBJECTDIR}/_ext/1613513288/sha512_256.o ${OBJECTDIR}/_ext/1613513288/tiger.o ${OBJECTDIR}/_ext/1613513288/whirlpool.o ${OBJECTDIR}/_ext/1613513288/hmac.o ${OBJECTDIR}/_ext/1613513288/rc4.o ${OBJECTDIR}/_ext/1613513288/rc6.o ${OBJECTDIR}/_ext/1613513288/idea.o ${OBJECTDIR}/_ext/1613513288/des.o ${OBJECTDIR}/_ext/1613513288/des3.o ${OBJECTDIR}/_ext/1613513288/aes.o ${OBJECTDIR}/_ext/1613513288/camellia.o ${OBJECTDIR}/_ext/1613513288/seed.o ${OBJECTDIR}/_ext/1613513288/aria.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_ecb.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_cbc.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_cfb.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_ofb.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_ctr.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_ccm.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_gcm.o ${OBJECTDIR}/_ext/1613513288/dh.o ${OBJECTDIR}/_ext/1613513288/rsa.o ${OBJECTDIR}/_ext/1613513288/dsa.o ${OBJECTDIR}/_ext/1613513288/ec.o ${OBJECTDIR}/_ext/1613513288/ec_curves.o ${OBJECTDIR}/_ext/1613513288/ecdh.o ${OBJECTDIR}/_ext/1613513288/ecdsa.o ${OBJECTDIR}/_ext/1613513288/pkcs5.o ${OBJECTDIR}/_ext/1613513288/mpi.o ${OBJECTDIR}/_ext/1613513288/asn1.o ${OBJECTDIR}/_ext/1613513288/x509.o ${OBJECTDIR}/_ext/1613513288/pem.o ${OBJECTDIR}/_ext/1613513288/yarrow.o ${OBJECTDIR}/_ext/1101018382/port.o ${OBJECTDIR}/_ext/1101018382/port_asm.o ${OBJECTDIR}/_ext/55695242/croutine.o ${OBJECTDIR}/_ext/55695242/list.o ${OBJECTDIR}/_ext/55695242/queue.o ${OBJECTDIR}/_ext/55695242/tasks.o ${OBJECTDIR}/_ext/55695242/timers.o ${OBJECTDIR}/_ext/2075018599/heap_3.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/_ext/1360937237/main.o.d ${OBJECTDIR}/_ext/1360937237/debug.o.d ${OBJECTDIR}/_ext/1360937237/sprintf.o.d ${OBJECTDIR}/_ext/1360937237/strtok_r.o.d ${OBJECTDIR}/_ext/1360937237/ext3_irq_wrapper.o.d ${OBJECTDIR}/_ext/1360937237/eth_irq_wrapper.o.d ${OBJECTDIR}/_ext/360186330/endian.o.d ${OBJECTDIR}/_ext/360186330/os_port_freertos.o.d ${OBJECTDIR}/_ext/360186330/date_time.o.d ${OBJECTDIR}/_ext/360186330/str.o.d ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack.o.d ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack_mem.o.d ${OBJECTDIR}/_ext/1357806602/pic32mx_eth.o.d ${OBJECTDIR}/_ext/1357806602/dp83848.o.d ${OBJECTDIR}/_ext/1079766828/nic.o.d ${OBJECTDIR}/_ext/1079766828/ethernet.o.d ${OBJECTDIR}/_ext/1079587046/arp.o.d ${OBJECTDIR}/_ext/1079766828/ip.o.d ${OBJECTDIR}/_ext/1079587046/ipv4.o.d ${OBJECTDIR}/_ext/1079587046/ipv4_frag.o.d ${OBJECTDIR}/_ext/1079587046/icmp.o.d ${OBJECTDIR}/_ext/1079587046/igmp.o.d ${OBJECTDIR}/_ext/1079587044/ipv6.o.d ${OBJECTDIR}/_ext/1079587044/ipv6_frag.o.d ${OBJECTDIR}/_ext/1079587044/icmpv6.o.d ${OBJECTDIR}/_ext/1079587044/mld.o.d ${OBJECTDIR}/_ext/1079587044/ndp.o.d ${OBJECTDIR}/_ext/1079587044/slaac.o.d ${OBJECTDIR}/_ext/1079766828/tcp.o.d ${OBJECTDIR}/_ext/1079766828/tcp_fsm.o.d ${OBJECTDIR}/_ext/1079766828/tcp_misc.o.d ${OBJECTDIR}/_ext/1079766828/tcp_timer.o.d ${OBJECTDIR}/_ext/1079766828/udp.o.d ${OBJECTDIR}/_ext/1079766828/socket.o.d ${OBJECTDIR}/_ext/1079766828/bsd_socket.o.d ${OBJECTDIR}/_ext/1079766828/raw_socket.o.d ${OBJECTDIR}/_ext/1079766828/ping.o.d ${OBJECTDIR}/_ext/242264404/dns_cache.o.d ${OBJECTDIR}/_ext/242264404/dns_client.o.d ${OBJECTDIR}/_ext/242264404/dns_common.o.d ${OBJECTDIR}/_ext/242264404/dns_debug.o.d ${OBJECTDIR}/_ext/1079479599/mdns_client.o.d ${OBJECTDIR}/_ext/1079479599/mdns_responder.o.d ${OBJECTDIR}/_ext/1079479599/mdns_common.o.d ${OBJECTDIR}/_ext/1079744218/dhcp_client.o.d ${OBJECTDIR}/_ext/1079744218/dhcp_common.o.d ${OBJECTDIR}/_ext/1079744218/dhcp_debug.o.d ${OBJECTDIR}/_ext/1747895846/dhcpv6_client.o.d ${OBJECTDIR}/_ext/1747895846/dhcpv6_relay.o.d ${OBJECTDIR}/_ext/1747895846/dhcpv6_common.o.d ${OBJECTDIR}/_ext/1747895846/dhcpv6_debug.o.d ${OBJECTDIR}/_ext/1079292021/smtp_client.o.d ${OBJECTDIR}/_ext/476983781/tls.o.d ${OBJECTDIR}/_ext/476983781/tls_cipher_suites.o.d ${OBJECTDIR}/_ext/476983781/tls_client.o.d ${OBJECTDIR}/_ext/476983781/tls_server.o.d ${OBJECTDIR}/_ext/476983781/tls_common.o.d ${OBJECTDIR}/_ext/476983781/tls_record.o.d ${OBJECTDIR}/_ext/476983781/tls_io.o.d ${OBJECTDIR}/_ext/476983781/tls_misc.o.d ${OBJECTDIR}/_ext/476983781/tls_cache.o.d ${OBJECTDIR}/_ext/476983781/ssl_common.o.d ${OBJECTDIR}/_ext/1613513288/base64.o.d ${OBJECTDIR}/_ext/1613513288/md2.o.d ${OBJECTDIR}/_ext/1613513288/md4.o.d ${OBJECTDIR}/_ext/1613513288/md5.o.d ${OBJECTDIR}/_ext/1613513288/ripemd128.o.d ${OBJECTDIR}/_ext/1613513288/ripemd160.o.d ${OBJECTDIR}/_ext/1613513288/sha1.o.d ${OBJECTDIR}/_ext/1613513288/sha224.o.d ${OBJECTDIR}/_ext/1613513288/sha256.o.d ${OBJECTDIR}/_ext/1613513288/sha384.o.d ${OBJECTDIR}/_ext/1613513288/sha512.o.d ${OBJECTDIR}/_ext/1613513288/sha512_224.o.d ${OBJECTDIR}/_ext/1613513288/sha512_256.o.d ${OBJECTDIR}/_ext/1613513288/tiger.o.d ${OBJECTDIR}/_ext/1613513288/whirlpool.o.d ${OBJECTDIR}/_ext/1613513288/hmac.o.d ${OBJECTDIR}/_ext/1613513288/rc4.o.d ${OBJECTDIR}/_ext/1613513288/rc6.o.d ${OBJECTDIR}/_ext/1613513288/idea.o.d ${OBJECTDIR}/_ext/1613513288/des.o.d ${OBJECTDIR}/_ext/1613513288/des3.o.d ${OBJECTDIR}/_ext/1613513288/aes.o.d ${OBJECTDIR}/_ext/1613513288/camellia.o.d ${OBJECTDIR}/_ext/1613513288/seed.o.d ${OBJECTDIR}/_ext/1613513288/aria.o.d ${OBJECTDIR}/_ext/1613513288/cipher_mode_ecb.o.d ${OBJECTDIR}/_ext/1613513288/cipher_mode_cbc.o.d ${OBJECTDIR}/_ext/1613513288/cipher_mode_cfb.o.d ${OBJECTDIR}/_ext/1613513288/cipher_mode_ofb.o.d ${OBJECTDIR}/_ext/1613513288/cipher_mode_ctr.o.d ${OBJECTDIR}/_ext/1613513288/cipher_mode_ccm.o.d ${OBJECTDIR}/_ext/1613513288/cipher_mode_gcm.o.d ${OBJECTDIR}/_ext/1613513288/dh.o.d ${OBJECTDIR}/_ext/1613513288/rsa.o.d ${OBJECTDIR}/_ext/1613513288/dsa.o.d ${OBJECTDIR}/_ext/1613513288/ec.o.d ${OBJECTDIR}/_ext/1613513288/ec_curves.o.d ${OBJECTDIR}/_ext/1613513288/ecdh.o.d ${OBJECTDIR}/_ext/1613513288/ecdsa.o.d ${OBJECTDIR}/_ext/1613513288/pkcs5.o.d ${OBJECTDIR}/_ext/1613513288/mpi.o.d ${OBJECTDIR}/_ext/1613513288/asn1.o.d ${OBJECTDIR}/_ext/1613513288/x509.o.d ${OBJECTDIR}/_ext/1613513288/pem.o.d ${OBJECTDIR}/_ext/1613513288/yarrow.o.d ${OBJECTDIR}/_ext/1101018382/port.o.d ${OBJECTDIR}/_ext/1101018382/port_asm.o.d ${OBJECTDIR}/_ext/55695242/croutine.o.d ${OBJECTDIR}/_ext/55695242/list.o.d ${OBJECTDIR}/_ext/55695242/queue.o.d ${OBJECTDIR}/_ext/55695242/tasks.o.d ${OBJECTDIR}/_ext/55695242/timers.o.d ${OBJECTDIR}/_ext/2075018599/heap_3.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1360937237/debug.o ${OBJECTDIR}/_ext/1360937237/sprintf.o ${OBJECTDIR}/_ext/1360937237/strtok_r.o ${OBJECTDIR}/_ext/1360937237/ext3_irq_wrapper.o ${OBJECTDIR}/_ext/1360937237/eth_irq_wrapper.o ${OBJECTDIR}/_ext/360186330/endian.o ${OBJECTDIR}/_ext/360186330/os_port_freertos.o ${OBJECTDIR}/_ext/360186330/date_time.o ${OBJECTDIR}/_ext/360186330/str.o ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack.o ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack_mem.o ${OBJECTDIR}/_ext/1357806602/pic32mx_eth.o ${OBJECTDIR}/_ext/1357806602/dp83848.o ${OBJECTDIR}/_ext/1079766828/nic.o ${OBJECTDIR}/_ext/1079766828/ethernet.o ${OBJECTDIR}/_ext/1079587046/arp.o ${OBJECTDIR}/_ext/1079766828/ip.o ${OBJECTDIR}/_ext/1079587046/ipv4.o ${OBJECTDIR}/_ext/1079587046/ipv4_frag.o ${OBJECTDIR}/_ext/1079587046/icmp.o ${OBJECTDIR}/_ext/1079587046/igmp.o ${OBJECTDIR}/_ext/1079587044/ipv6.o ${OBJECTDIR}/_ext/1079587044/ipv6_frag.o ${OBJECTDIR}/_ext/1079587044/icmpv6.o ${OBJECTDIR}/_ext/1079587044/mld.o ${OBJECTDIR}/_ext/1079587044/ndp.o ${OBJECTDIR}/_ext/1079587044/slaac.o ${OBJECTDIR}/_ext/1079766828/tcp.o ${OBJECTDIR}/_ext/1079766828/tcp_fsm.o ${OBJECTDIR}/_ext/1079766828/tcp_misc.o ${OBJECTDIR}/_ext/1079766828/tcp_timer.o ${OBJECTDIR}/_ext/1079766828/tcp_cc.o ${OBJECTDIR}/_ext/1079766828/tcp_cubic.o ${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o ${OBJECTDIR}/_ext/1079766828/udp.o ${OBJECTDIR}/_ext/1079766828/socket.o ${OBJECTDIR}/_ext/1079766828/bsd_socket.o ${OBJECTDIR}/_ext/1079766828/raw_socket.o ${OBJECTDIR}/_ext/1079766828/ping.o ${OBJECTDIR}/_ext/242264404/dns_cache.o ${OBJECTDIR}/_ext/242264404/dns_client.o ${OBJECTDIR}/_ext/242264404/dns_common.o ${OBJECTDIR}/_ext/242264404/dns_debug.o ${OBJECTDIR}/_ext/1079479599/mdns_client.o ${OBJECTDIR}/_ext/1079479599/mdns_responder.o ${OBJECTDIR}/_ext/1079479599/mdns_common.o ${OBJECTDIR}/_ext/1079744218/dhcp_client.o ${OBJECTDIR}/_ext/1079744218/dhcp_common.o ${OBJECTDIR}/_ext/1079744218/dhcp_debug.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_client.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_relay.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_common.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_debug.o ${OBJECTDIR}/_ext/1079292021/smtp_client.o ${OBJECTDIR}/_ext/476983781/tls.o ${OBJECTDIR}/_ext/476983781/tls_cipher_suites.o ${OBJECTDIR}/_ext/476983781/tls_client.o ${OBJECTDIR}/_ext/476983781/tls_server.o ${OBJECTDIR}/_ext/476983781/tls_common.o ${OBJECTDIR}/_ext/476983781/tls_record.o ${OBJECTDIR}/_ext/476983781/tls_io.o ${OBJECTDIR}/_ext/476983781/tls_misc.o ${OBJECTDIR}/_ext/476983781/tls_cache.o ${OBJECTDIR}/_ext/476983781/tls_ticket.o ${OBJECTDIR}/_ext/476983781/ssl_common.o ${OBJECTDIR}/_ext/1613513288/base64.o ${OBJECTDIR}/_ext/1613513288/md2.o ${OBJECTDIR}/_ext/1613513288/md4.o ${OBJECTDIR}/_ext/1613513288/md5.o ${OBJECTDIR}/_ext/1613513288/ripemd128.o ${OBJECTDIR}/_ext/1613513288/ripemd160.o ${OBJECTDIR}/_ext/1613513288/sha1.o ${OBJECTDIR}/_ext/1613513288/sha224.o ${OBJECTDIR}/_ext/1613513288/sha256.o ${OBJECTDIR}/_ext/1613513288/sha384.o ${OBJECTDIR}/_ext/1613513288/sha512.o ${OBJECTDIR}/_ext/1613513288/sha512_224.o ${OBJECTDIR}/_ext/1613513288/sha512_256.o ${OBJECTDIR}/_ext/1613513288/tiger.o ${OBJECTDIR}/_ext/1613513288/whirlpool.o ${OBJECTDIR}/_ext/1613513288/hmac.o ${OBJECTDIR}/_ext/1613513288/rc4.o ${OBJECTDIR}/_ext/1613513288/rc6.o ${OBJECTDIR}/_ext/1613513288/idea.o ${OBJECTDIR}/_ext/1613513288/des.o ${OBJECTDIR}/_ext/1613513288/des3.o ${OBJECTDIR}/_ext/1613513288/aes.o ${OBJECTDIR}/_ext/1613513288/camellia.o ${OBJECTDIR}/_ext/1613513288/seed.o ${OBJECTDIR}/_ext/1613513288/aria.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_ecb.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_cbc.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_cfb.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_ofb.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_ctr.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_ccm.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_gcm.o ${OBJECTDIR}/_ext/1613513288/chacha.o ${OBJECTDIR}/_ext/1613513288/poly1305.o ${OBJECTDIR}/_ext/1613513288/chacha20_poly1305.o ${OBJECTDIR}/_ext/1613513288/dh.o ${OBJECTDIR}/_ext/1613513288/rsa.o ${OBJECTDIR}/_ext/1613513288/dsa.o ${OBJECTDIR}/_ext/1613513288/ec.o ${OBJECTDIR}/_ext/1613513288/ec_curves.o ${OBJECTDIR}/_ext/1613513288/ec_p256.o ${OBJECTDIR}/_ext/1613513288/ecdh.o ${OBJECTDIR}/_ext/1613513288/curve25519.o ${OBJECTDIR}/_ext/1613513288/x25519.o ${OBJECTDIR}/_ext/1613513288/ecdsa.o ${OBJECTDIR}/_ext/1613513288/pkcs5.o ${OBJECTDIR}/_ext/1613513288/mpi.o ${OBJECTDIR}/_ext/1613513288/asn1.o ${OBJECTDIR}/_ext/1613513288/x509.o ${OBJECTDIR}/_ext/1613513288/pem.o ${OBJECTDIR}/_ext/1613513288/yarrow.o ${OBJECTDIR}/_ext/1101018382/port.o ${OBJECTDIR}/_ext/1101018382/port_asm.o ${OBJECTDIR}/_ext/55695242/croutine.o ${OBJECTDIR}/_ext/55695242/list.o ${OBJECTDIR}/_ext/55695242/queue.o ${OBJECTDIR}/_ext/55695242/tasks.o ${OBJECTDIR}/_ext/55695242/timers.o ${OBJECTDIR}/_ext/2075018599/heap_3.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/_ext/1360937237/main.o.d ${OBJECTDIR}/_ext/1360937237/debug.o.d ${OBJECTDIR}/_ext/1360937237/sprintf.o.d ${OBJECTDIR}/_ext/1360937237/strtok_r.o.d ${OBJECTDIR}/_ext/1360937237/ext3_irq_wrapper.o.d ${OBJECTDIR}/_ext/1360937237/eth_irq_wrapper.o.d ${OBJECTDIR}/_ext/360186330/endian.o.d ${OBJECTDIR}/_ext/360186330/os_port_freertos.o.d ${OBJECTDIR}/_ext/360186330/date_time.o.d ${OBJECTDIR}/_ext/360186330/str.o.d ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack.o.d ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack_mem.o.d ${OBJECTDIR}/_ext/1357806602/pic32mx_eth.o.d ${OBJECTDIR}/_ext/1357806602/dp83848.o.d ${OBJECTDIR}/_ext/1079766828/nic.o.d ${OBJECTDIR}/_ext/1079766828/ethernet.o.d ${OBJECTDIR}/_ext/1079587046/arp.o.d ${OBJECTDIR}/_ext/1079766828/ip.o.d ${OBJECTDIR}/_ext/1079587046/ipv4.o.d ${OBJECTDIR}/_ext/1079587046/ipv4_frag.o.d ${OBJECTDIR}/_ext/1079587046/icmp.o.d ${OBJECTDIR}/_ext/1079587046/igmp.o.d ${OBJECTDIR}/_ext/1079587044/ipv6.o.d ${OBJECTDIR}/_ext/1079587044/ipv6_frag.o.d ${OBJECTDIR}/_ext/1079587044/icmpv6.o.d ${OBJECTDIR}/_ext/1079587044/mld.o.d ${OBJECTDIR}/_ext/1079587044/ndp.o.d ${OBJECTDIR}/_ext/1079587044/slaac.o.d ${OBJECTDIR}/_ext/1079766828/tcp.o.d ${OBJECTDIR}/_ext/1079766828/tcp_fsm.o.d ${OBJECTDIR}/_ext/1079766828/tcp_misc.o.d ${OBJECTDIR}/_ext/1079766828/tcp_timer.o.d ${OBJECTDIR}/_ext/1079766828/tcp_cc.o.d ${OBJECTDIR}/_ext/1079766828/tcp_cubic.o.d ${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o.d ${OBJECTDIR}/_ext/1079766828/udp.o.d ${OBJECTDIR}/_ext/1079766828/socket.o.d ${OBJECTDIR}/_ext/1079766828/bsd_socket.o.d ${OBJECTDIR}/_ext/1079766828/raw_socket.o.d ${OBJECTDIR}/_ext/1079766828/ping.o.d ${OBJECTDIR}/_ext/242264404/dns_cache.o.d ${OBJECTDIR}/_ext/242264404/dns_client.o.d ${OBJECTDIR}/_ext/242264404/dns_common.o.d ${OBJECTDIR}/_ext/242264404/dns_debug.o.d ${OBJECTDIR}/_ext/1079479599/mdns_client.o.d ${OBJECTDIR}/_ext/1079479599/mdns_responder.o.d ${OBJECTDIR}/_ext/1079479599/mdns_common.o.d ${OBJECTDIR}/_ext/1079744218/dhcp_client.o.d ${OBJECTDIR}/_ext/1079744218/dhcp_common.o.d ${OBJECTDIR}/_ext/1079744218/dhcp_debug.o.d ${OBJECTDIR}/_ext/1747895846/dhcpv6_client.o.d ${OBJECTDIR}/_ext/1747895846/dhcpv6_relay.o.d ${OBJECTDIR}/_ext/1747895846/dhcpv6_common.o.d ${OBJECTDIR}/_ext/1747895846/dhcpv6_debug.o.d ${OBJECTDIR}/_ext/1079292021/smtp_client.o.d ${OBJECTDIR}/_ext/476983781/tls.o.d ${OBJECTDIR}/_ext/476983781/tls_cipher_suites.o.d ${OBJECTDIR}/_ext/476983781/tls_client.o.d ${OBJECTDIR}/_ext/476983781/tls_server.o.d ${OBJECTDIR}/_ext/476983781/tls_common.o.d ${OBJECTDIR}/_ext/476983781/tls_record.o.d ${OBJECTDIR}/_ext/476983781/tls_io.o.d ${OBJECTDIR}/_ext/476983781/tls_misc.o.d ${OBJECTDIR}/_ext/476983781/tls_cache.o.d ${OBJECTDIR}/_ext/476983781/tls_ticket.o.d ${OBJECTDIR}/_ext/476983781/ssl_common.o.d ${OBJECTDIR}/_ext/1613513288/base64.o.d ${OBJECTDIR}/_ext/1613513288/md2.o.d ${OBJECTDIR}/_ext/1613513288/md4.o.d ${OBJECTDIR}/_ext/1613513288/md5.o.d ${OBJECTDIR}/_ext/1613513288/ripemd128.o.d ${OBJECTDIR}/_ext/1613513288/ripemd160.o.d ${OBJECTDIR}/_ext/1613513288/sha1.o.d ${OBJECTDIR}/_ext/1613513288/sha224.o.d ${OBJECTDIR}/_ext/1613513288/sha256.o.d ${OBJECTDIR}/_ext/1613513288/sha384.o.d ${OBJECTDIR}/_ext/1613513288/sha512.o.d ${OBJECTDIR}/_ext/1613513288/sha512_224.o.d ${OBJECTDIR}/_ext/1613513288/sha512_256.o.d ${OBJECTDIR}/_ext/1613513288/tiger.o.d ${OBJECTDIR}/_ext/1613513288/whirlpool.o.d ${OBJECTDIR}/_ext/1613513288/hmac.o.d ${OBJECTDIR}/_ext/1613513288/rc4.o.d ${OBJECTDIR}/_ext/1613513288/rc6.o.d ${OBJECTDIR}/_ext/1613513288/idea.o.d ${OBJECTDIR}/_ext/1613513288/des.o.d ${OBJECTDIR}/_ext/1613513288/des3.o.d ${OBJECTDIR}/_ext/1613513288/aes.o.d ${OBJECTDIR}/_ext/1613513288/camellia.o.d ${OBJECTDIR}/_ext/1613513288/seed.o.d ${OBJECTDIR}/_ext/1613513288/aria.o.d ${OBJECTDIR}/_ext/1613513288/cipher_mode_ecb.o.d ${OBJECTDIR}/_ext/1613513288/cipher_mode_cbc.o.d ${OBJECTDIR}/_ext/1613513288/cipher_mode_cfb.o.d ${OBJECTDIR}/_ext/1613513288/cipher_mode_ofb.o.d ${OBJECTDIR}/_ext/1613513288/cipher_mode_ctr.o.d ${OBJECTDIR}/_ext/1613513288/cipher_mode_ccm.o.d ${OBJECTDIR}/_ext/1613513288/cipher_mode_gcm.o.d ${OBJECTDIR}/_ext/1613513288/chacha.o.d ${OBJECTDIR}/_ext/1613513288/poly1305.o.d ${OBJECTDIR}/_ext/1613513288/chacha20_poly1305.o.d ${OBJECTDIR}/_ext/1613513288/dh.o.d ${OBJECTDIR}/_ext/1613513288/rsa.o.d ${OBJECTDIR}/_ext/1613513288/dsa.o.d ${OBJECTDIR}/_ext/1613513288/ec.o.d ${OBJECTDIR}/_ext/1613513288/ec_curves.o.d ${OBJECTDIR}/_ext/1613513288/ec_p256.o.d ${OBJECTDIR}/_ext/1613513288/ecdh.o.d ${OBJECTDIR}/_ext/1613513288/curve25519.o.d ${OBJECTDIR}/_ext/1613513288/x25519.o.d ${OBJECTDIR}/_ext/1613513288/ecdsa.o.d ${OBJECTDIR}/_ext/1613513288/pkcs5.o.d ${OBJECTDIR}/_ext/1613513288/mpi.o.d ${OBJECTDIR}/_ext/1613513288/asn1.o.d ${OBJECTDIR}/_ext/1613513288/x509.o.d ${OBJECTDIR}/_ext/1613513288/pem.o.d ${OBJECTDIR}/_ext/1613513288/yarrow.o.d ${OBJECTDIR}/_ext/1101018382/port.o.d ${OBJECTDIR}/_ext/1101018382/port_asm.o.d ${OBJECTDIR}/_ext/55695242/croutine.o.d ${OBJECTDIR}/_ext/55695242/list.o.d ${OBJECTDIR}/_ext/55695242/queue.o.d ${OBJECTDIR}/_ext/55695242/tasks.o.d ${OBJECTDIR}/_ext/55695242/timers.o.d ${OBJECTDIR}/_ext/2075018599/heap_3.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1360937237/debug.o ${OBJECTDIR}/_ext/1360937237/sprintf.o ${OBJECTDIR}/_ext/1360937237/strtok_r.o ${OBJECTDIR}/_ext/1360937237/ext3_irq_wrapper.o ${OBJECTDIR}/_ext/1360937237/eth_irq_wrapper.o ${OBJECTDIR}/_ext/360186330/endian.o ${OBJECTDIR}/_ext/360186330/os_port_freertos.o ${OBJECTDIR}/_ext/360186330/date_time.o ${OBJECTDIR}/_ext/360186330/str.o ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack.o ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack_mem.o ${OBJECTDIR}/_ext/1357806602/pic32mx_eth.o ${OBJECTDIR}/_ext/1357806602/dp83848.o ${OBJECTDIR}/_ext/1079766828/nic.o ${OBJECTDIR}/_ext/1079766828/ethernet.o ${OBJECTDIR}/_ext/1079587046/arp.o ${OBJECTDIR}/_ext/1079766828/ip.o ${OBJECTDIR}/_ext/1079587046/ipv4.o ${OBJECTDIR}/_ext/1079587046/ipv4_frag.o ${OBJECTDIR}/_ext/1079587046/icmp.o ${OBJECTDIR}/_ext/1079587046/igmp.o ${OBJECTDIR}/_ext/1079587044/ipv6.o ${OBJECTDIR}/_ext/1079587044/ipv6_frag.o ${OBJECTDIR}/_ext/1079587044/icmpv6.o ${OBJECTDIR}/_ext/1079587044/mld.o ${OBJECTDIR}/_ext/1079587044/ndp.o ${OBJECTDIR}/_ext/1079587044/slaac.o ${OBJECTDIR}/_ext/1079766828/tcp.o ${OBJECTDIR}/_ext/1079766828/tcp_fsm.o ${OBJECTDIR}/_ext/1079766828/tcp_misc.o ${OBJECTDIR}/_ext/1079766828/tcp_timer.o ${OBJECTDIR}/_ext/1079766828/udp.o ${OBJECTDIR}/_ext/1079766828/socket.o ${OBJECTDIR}/_ext/1079766828/bsd_socket.o ${OBJECTDIR}/_ext/1079766828/raw_socket.o ${OBJECTDIR}/_ext/1079766828/ping.o ${OBJECTDIR}/_ext/242264404/dns_cache.o ${OBJECTDIR}/_ext/242264404/dns_client.o ${OBJECTDIR}/_ext/242264404/dns_common.o ${OBJECTDIR}/_ext/242264404/dns_debug.o ${OBJECTDIR}/_ext/1079479599/mdns_client.o ${OBJECTDIR}/_ext/1079479599/mdns_responder.o ${OBJECTDIR}/_ext/1079479599/mdns_common.o ${OBJECTDIR}/_ext/1079744218/dhcp_client.o ${OBJECTDIR}/_ext/1079744218/dhcp_common.o ${OBJECTDIR}/_ext/1079744218/dhcp_debug.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_client.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_relay.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_common.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_debug.o ${OBJECTDIR}/_ext/1079292021/smtp_client.o ${OBJECTDIR}/_ext/476983781/tls.o ${OBJECTDIR}/_ext/476983781/tls_cipher_suites.o ${OBJECTDIR}/_ext/476983781/tls_client.o ${OBJECTDIR}/_ext/476983781/tls_server.o ${OBJECTDIR}/_ext/476983781/tls_common.o ${OBJECTDIR}/_ext/476983781/tls_record.o ${OBJECTDIR}/_ext/476983781/tls_io.o ${OBJECTDIR}/_ext/476983781/tls_misc.o ${OBJECTDIR}/_ext/476983781/tls_cache.o ${OBJECTDIR}/_ext/476983781/ssl_common.o ${OBJECTDIR}/_ext/1613513288/base64.o ${OBJECTDIR}/_ext/1613513288/md2.o ${OBJECTDIR}/_ext/1613513288/md4.o ${OBJECTDIR}/_ext/1613513288/md5.o ${OBJECTDIR}/_ext/1613513288/ripemd128.o ${OBJECTDIR}/_ext/1613513288/ripemd160.o ${OBJECTDIR}/_ext/1613513288/sha1.o ${OBJECTDIR}/_ext/1613513288/sha224.o ${OBJECTDIR}/_ext/1613513288/sha256.o ${OBJECTDIR}/_ext/1613513288/sha384.o ${OBJECTDIR}/_ext/1613513288/sha512.o ${OBJECTDIR}/_ext/1613513288/sha512_224.o ${OBJECTDIR}/_ext/1613513288/sha512_256.o ${OBJECTDIR}/_ext/1613513288/tiger.o ${OBJECTDIR}/_ext/1613513288/whirlpool.o ${OBJECTDIR}/_ext/1613513288/hmac.o ${OBJECTDIR}/_ext/1613513288/rc4.o ${OBJECTDIR}/_ext/1613513288/rc6.o ${OBJECTDIR}/_ext/1613513288/idea.o ${OBJECTDIR}/_ext/1613513288/des.o ${OBJECTDIR}/_ext/1613513288/des3.o ${OBJECTDIR}/_ext/1613513288/aes.o ${OBJECTDIR}/_ext/1613513288/camellia.o ${OBJECTDIR}/_ext/1613513288/seed.o ${OBJECTDIR}/_ext/1613513288/aria.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_ecb.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_cbc.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_cfb.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_ofb.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_ctr.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_ccm.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_gcm.o ${OBJECTDIR}/_ext/1613513288/dh.o ${OBJECTDIR}/_ext/1613513288/rsa.o ${OBJECTDIR}/_ext/1613513288/dsa.o ${OBJECTDIR}/_ext/1613513288/ec.o ${OBJECTDIR}/_ext/1613513288/ec_curves.o ${OBJECTDIR}/_ext/1613513288/ecdh.o ${OBJECTDIR}/_ext/1613513288/ecdsa.o ${OBJECTDIR}/_ext/1613513288/pkcs5.o ${OBJECTDIR}/_ext/1613513288/mpi.o ${OBJECTDIR}/_ext/1613513288/asn1.o ${OBJECTDIR}/_ext/1613513288/x509.o ${OBJECTDIR}/_ext/1613513288/pem.o ${OBJECTDIR}/_ext/1613513288/yarrow.o ${OBJECTDIR}/_ext/1101018382/port.o ${OBJECTDIR}/_ext/1101018382/port_asm.o ${OBJECTDIR}/_ext/55695242/croutine.o ${OBJECTDIR}/_ext/55695242/list.o ${OBJECTDIR}/_ext/55695242/queue.o ${OBJECTDIR}/_ext/55695242/tasks.o ${OBJECTDIR}/_ext/55695242/timers.o ${OBJECTDIR}/_ext/2075018599/heap_3.o
+OBJECTFILES=${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1360937237/debug.o ${OBJECTDIR}/_ext/1360937237/sprintf.o ${OBJECTDIR}/_ext/1360937237/strtok_r.o ${OBJECTDIR}/_ext/1360937237/ext3_irq_wrapper.o ${OBJECTDIR}/_ext/1360937237/eth_irq_wrapper.o ${OBJECTDIR}/_ext/360186330/endian.o ${OBJECTDIR}/_ext/360186330/os_port_freertos.o ${OBJECTDIR}/_ext/360186330/date_time.o ${OBJECTDIR}/_ext/360186330/str.o ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack.o ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack_mem.o ${OBJECTDIR}/_ext/1357806602/pic32mx_eth.o ${OBJECTDIR}/_ext/1357806602/dp83848.o ${OBJECTDIR}/_ext/1079766828/nic.o ${OBJECTDIR}/_ext/1079766828/ethernet.o ${OBJECTDIR}/_ext/1079587046/arp.o ${OBJECTDIR}/_ext/1079766828/ip.o ${OBJECTDIR}/_ext/1079587046/ipv4.o ${OBJECTDIR}/_ext/1079587046/ipv4_frag.o ${OBJECTDIR}/_ext/1079587046/icmp.o ${OBJECTDIR}/_ext/1079587046/igmp.o ${OBJECTDIR}/_ext/1079587044/ipv6.o ${OBJECTDIR}/_ext/1079587044/ipv6_frag.o ${OBJECTDIR}/_ext/1079587044/icmpv6.o ${OBJECTDIR}/_ext/1079587044/mld.o ${OBJECTDIR}/_ext/1079587044/ndp.o ${OBJECTDIR}/_ext/1079587044/slaac.o ${OBJECTDIR}/_ext/1079766828/tcp.o ${OBJECTDIR}/_ext/1079766828/tcp_fsm.o ${OBJECTDIR}/_ext/1079766828/tcp_misc.o ${OBJECTDIR}/_ext/1079766828/tcp_timer.o ${OBJECTDIR}/_ext/1079766828/tcp_cc.o ${OBJECTDIR}/_ext/1079766828/tcp_cubic.o ${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o ${OBJECTDIR}/_ext/1079766828/udp.o ${OBJECTDIR}/_ext/1079766828/socket.o ${OBJECTDIR}/_ext/1079766828/bsd_socket.o ${OBJECTDIR}/_ext/1079766828/raw_socket.o ${OBJECTDIR}/_ext/1079766828/ping.o ${OBJECTDIR}/_ext/242264404/dns_cache.o ${OBJECTDIR}/_ext/242264404/dns_client.o ${OBJECTDIR}/_ext/242264404/dns_common.o ${OBJECTDIR}/_ext/242264404/dns_debug.o ${OBJECTDIR}/_ext/1079479599/mdns_client.o ${OBJECTDIR}/_ext/1079479599/mdns_responder.o ${OBJECTDIR}/_ext/1079479599/mdns_common.o ${OBJECTDIR}/_ext/1079744218/dhcp_client.o ${OBJECTDIR}/_ext/1079744218/dhcp_common.o ${OBJECTDIR}/_ext/1079744218/dhcp_debug.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_client.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_relay.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_common.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_debug.o ${OBJECTDIR}/_ext/1079292021/smtp_client.o ${OBJECTDIR}/_ext/476983781/tls.o ${OBJECTDIR}/_ext/476983781/tls_cipher_suites.o ${OBJECTDIR}/_ext/476983781/tls_client.o ${OBJECTDIR}/_ext/476983781/tls_server.o ${OBJECTDIR}/_ext/476983781/tls_common.o ${OBJECTDIR}/_ext/476983781/tls_record.o ${OBJECTDIR}/_ext/476983781/tls_io.o ${OBJECTDIR}/_ext/476983781/tls_misc.o ${OBJECTDIR}/_ext/476983781/tls_cache.o ${OBJECTDIR}/_ext/476983781/tls_ticket.o ${OBJECTDIR}/_ext/476983781/ssl_common.o ${OBJECTDIR}/_ext/1613513288/base64.o ${OBJECTDIR}/_ext/1613513288/md2.o ${OBJECTDIR}/_ext/1613513288/md4.o ${OBJECTDIR}/_ext/1613513288/md5.o ${OBJECTDIR}/_ext/1613513288/ripemd128.o ${OBJECTDIR}/_ext/1613513288/ripemd160.o ${OBJECTDIR}/_ext/1613513288/sha1.o ${OBJECTDIR}/_ext/1613513288/sha224.o ${OBJECTDIR}/_ext/1613513288/sha256.o ${OBJECTDIR}/_ext/1613513288/sha384.o ${OBJECTDIR}/_ext/1613513288/sha512.o ${OBJECTDIR}/_ext/1613513288/sha512_224.o ${OBJECTDIR}/_ext/1613513288/sha512_256.o ${OBJECTDIR}/_ext/1613513288/tiger.o ${OBJECTDIR}/_ext/1613513288/whirlpool.o ${OBJECTDIR}/_ext/1613513288/hmac.o ${OBJECTDIR}/_ext/1613513288/rc4.o ${OBJECTDIR}/_ext/1613513288/rc6.o ${OBJECTDIR}/_ext/1613513288/idea.o ${OBJECTDIR}/_ext/1613513288/des.o ${OBJECTDIR}/_ext/1613513288/des3.o ${OBJECTDIR}/_ext/1613513288/aes.o ${OBJECTDIR}/_ext/1613513288/camellia.o ${OBJECTDIR}/_ext/1613513288/seed.o ${OBJECTDIR}/_ext/1613513288/aria.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_ecb.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_cbc.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_cfb.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_ofb.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_ctr.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_ccm.o ${OBJECTDIR}/_ext/1613513288/cipher_mode_gcm.o ${OBJECTDIR}/_ext/1613513288/chacha.o ${OBJECTDIR}/_ext/1613513288/poly1305.o ${OBJECTDIR}/_ext/1613513288/chacha20_poly1305.o ${OBJECTDIR}/_ext/1613513288/dh.o ${OBJECTDIR}/_ext/1613513288/rsa.o ${OBJECTDIR}/_ext/1613513288/dsa.o ${OBJECTDIR}/_ext/1613513288/ec.o ${OBJECTDIR}/_ext/1613513288/ec_curves.o ${OBJECTDIR}/_ext/1613513288/ec_p256.o ${OBJECTDIR}/_ext/1613513288/ecdh.o ${OBJECTDIR}/_ext/1613513288/curve25519.o ${OBJECTDIR}/_ext/1613513288/x25519.o ${OBJECTDIR}/_ext/1613513288/ecdsa.o ${OBJECTDIR}/_ext/1613513288/pkcs5.o ${OBJECTDIR}/_ext/1613513288/mpi.o ${OBJECTDIR}/_ext/1613513288/asn1.o ${OBJECTDIR}/_ext/1613513288/x509.o ${OBJECTDIR}/_ext/1613513288/pem.o ${OBJECTDIR}/_ext/1613513288/yarrow.o ${OBJECTDIR}/_ext/1101018382/port.o ${OBJECTDIR}/_ext/1101018382/port_asm.o ${OBJECTDIR}/_ext/55695242/croutine.o ${OBJECTDIR}/_ext/55695242/list.o ${OBJECTDIR}/_ext/55695242/queue.o ${OBJECTDIR}/_ext/55695242/tasks.o ${OBJECTDIR}/_ext/55695242/timers.o ${OBJECTDIR}/_ext/2075018599/heap_3.o
 
 # Source Files
-SOURCEFILES=../src/main.c ../src/debug.c ../src/sprintf.c ../src/strtok_r.c ../src/ext3_irq_wrapper.S ../src/eth_irq_wrapper.S ../../../../../common/endian.c ../../../../../common/os_port_freertos.c ../../../../../common/date_time.c ../../../../../common/str.c ../../../../../cyclone_tcp/core/tcp_ip_stack.c ../../../../../cyclone_tcp/core/tcp_ip_stack_mem.c ../../../../../cyclone_tcp/drivers/pic32mx_eth.c ../../../../../cyclone_tcp/drivers/dp83848.c ../../../../../cyclone_tcp/core/nic.c ../../../../../cyclone_tcp/core/ethernet.c ../../../../../cyclone_tcp/ipv4/arp.c ../../../../../cyclone_tcp/core/ip.c ../../../../../cyclone_tcp/ipv4/ipv4.c ../../../../../cyclone_tcp/ipv4/ipv4_frag.c ../../../../../cyclone_tcp/ipv4/icmp.c ../../../../../cyclone_tcp/ipv4/igmp.c ../../../../../cyclone_tcp/ipv6/ipv6.c ../../../../../cyclone_tcp/ipv6/ipv6_frag.c ../../../../../cyclone_tcp/ipv6/icmpv6.c ../../../../../cyclone_tcp/ipv6/mld.c ../../../../../cyclone_tcp/ipv6/ndp.c ../../../../../cyclone_tcp/ipv6/slaac.c ../../../../../cyclone_tcp/core/tcp.c ../../../../../cyclone_tcp/core/tcp_fsm.c ../../../../../cyclone_tcp/core/tcp_misc.c ../../../../../cyclone_tcp/core/tcp_timer.c ../../../../../cyclone_tcp/core/udp.c ../../../../../cyclone_tcp/core/socket.c ../../../../../cyclone_tcp/core/bsd_socket.c ../../../../../cyclone_tcp/core/raw_socket.c ../../../../../cyclone_tcp/core/ping.c ../../../../../cyclone_tcp/dns/dns_cache.c ../../../../../cyclone_tcp/dns/dns_client.c ../../../../../cyclone_tcp/dns/dns_common.c ../../../../../cyclone_tcp/dns/dns_debug.c ../../../../../cyclone_tcp/mdns/mdns_client.c ../../../../../cyclone_tcp/mdns/mdns_responder.c ../../../../../cyclone_tcp/mdns/mdns_common.c ../../../../../cyclone_tcp/dhcp/dhcp_client.c ../../../../../cyclone_tcp/dhcp/dhcp_common.c ../../../../../cyclone_tcp/dhcp/dhcp_debug.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_client.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_relay.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_common.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_debug.c ../../../../../cyclone_tcp/smtp/smtp_client.c ../../../../../cyclone_ssl/tls.c ../../../../../cyclone_ssl/tls_cipher_suites.c ../../../../../cyclone_ssl/tls_client.c ../../../../../cyclone_ssl/tls_server.c ../../../../../cyclone_ssl/tls_common.c ../../../../../cyclone_ssl/tls_record.c ../../../../../cyclone_ssl/tls_io.c ../../../../../cyclone_ssl/tls_misc.c ../../../../../cyclone_ssl/tls_cache.c ../../../../../cyclone_ssl/ssl_common.c ../../../../../cyclone_crypto/base64.c ../../../../../cyclone_crypto/md2.c ../../../../../cyclone_crypto/md4.c ../../../../../cyclone_crypto/md5.c ../../../../../cyclone_crypto/ripemd128.c ../../../../../cyclone_crypto/ripemd160.c ../../../../../cyclone_crypto/sha1.c ../../../../../cyclone_crypto/sha224.c ../../../../../cyclone_crypto/sha256.c ../../../../../cyclone_crypto/sha384.c ../../../../../cyclone_crypto/sha512.c ../../../../../cyclone_crypto/sha512_224.c ../../../../../cyclone_crypto/sha512_256.c ../../../../../cyclone_crypto/tiger.c ../../../../../cyclone_crypto/whirlpool.c ../../../../../cyclone_crypto/hmac.c ../../../../../cyclone_crypto/rc4.c ../../../../../cyclone_crypto/rc6.c ../../../../../cyclone_crypto/idea.c ../../../../../cyclone_crypto/des.c ../../../../../cyclone_crypto/des3.c ../../../../../cyclone_crypto/aes.c ../../../../../cyclone_crypto/camellia.c ../../../../../cyclone_crypto/seed.c ../../../../../cyclone_crypto/aria.c ../../../../../cyclone_crypto/cipher_mode_ecb.c ../../../../../cyclone_crypto/cipher_mode_cbc.c ../../../../../cyclone_crypto/cipher_mode_cfb.c ../../../../../cyclone_crypto/cipher_mode_ofb.c ../../../../../cyclone_crypto/cipher_mode_ctr.c ../../../../../cyclone_crypto/cipher_mode_ccm.c ../../../../../cyclone_crypto/cipher_mode_gcm.c ../../../../../cyclone_crypto/dh.c ../../../../../cyclone_crypto/rsa.c ../../../../../cyclone_crypto/dsa.c ../../../../../cyclone_crypto/ec.c ../../../../../cyclone_crypto/ec_curves.c ../../../../../cyclone_crypto/ecdh.c ../../../../../cyclone_crypto/ecdsa.c ../../../../../cyclone_crypto/pkcs5.c ../../../../../cyclone_crypto/mpi.c ../../../../../cyclone_crypto/asn1.c ../../../../../cyclone_crypto/x509.c ../../../../../cyclone_crypto/pem.c ../../../../../cyclone_crypto/yarrow.c ../../../../common/freertos/portable/mplabx/pic32mx/port.c ../../../../common/freertos/portable/mplabx/pic32mx/port_asm.S ../../../../common/freertos/croutine.c ../../../../common/freertos/list.c ../../../../common/freertos/queue.c ../../../../common/freertos/tasks.c ../../../../common/freertos/timers.c ../../../../common/freertos/portable/memmang/heap_3.c
+SOURCEFILES=../src/main.c ../src/debug.c ../src/sprintf.c ../src/strtok_r.c ../src/ext3_irq_wrapper.S ../src/eth_irq_wrapper.S ../../../../../common/endian.c ../../../../../common/os_port_freertos.c ../../../../../common/date_time.c ../../../../../common/str.c ../../../../../cyclone_tcp/core/tcp_ip_stack.c ../../../../../cyclone_tcp/core/tcp_ip_stack_mem.c ../../../../../cyclone_tcp/drivers/pic32mx_eth.c ../../../../../cyclone_tcp/drivers/dp83848.c ../../../../../cyclone_tcp/core/nic.c ../../../../../cyclone_tcp/core/ethernet.c ../../../../../cyclone_tcp/ipv4/arp.c ../../../../../cyclone_tcp/core/ip.c ../../../../../cyclone_tcp/ipv4/ipv4.c ../../../../../cyclone_tcp/ipv4/ipv4_frag.c ../../../../../cyclone_tcp/ipv4/icmp.c ../../../../../cyclone_tcp/ipv4/igmp.c ../../../../../cyclone_tcp/ipv6/ipv6.c ../../../../../cyclone_tcp/ipv6/ipv6_frag.c ../../../../../cyclone_tcp/ipv6/icmpv6.c ../../../../../cyclone_tcp/ipv6/mld.c ../../../../../cyclone_tcp/ipv6/ndp.c ../../../../../cyclone_tcp/ipv6/slaac.c ../../../../../cyclone_tcp/core/tcp.c ../../../../../cyclone_tcp/core/tcp_fsm.c ../../../../../cyclone_tcp/core/tcp_misc.c ../../../../../cyclone_tcp/core/tcp_timer.c ../../../../../cyclone_tcp/core/tcp_cc.c ../../../../../cyclone_tcp/core/tcp_cubic.c ../../../../../cyclone_tcp/core/tcp_syn_cookie.c ../../../../../cyclone_tcp/core/udp.c ../../../../../cyclone_tcp/core/socket.c ../../../../../cyclone_tcp/core/bsd_socket.c ../../../../../cyclone_tcp/core/raw_socket.c ../../../../../cyclone_tcp/core/ping.c ../../../../../cyclone_tcp/dns/dns_cache.c ../../../../../cyclone_tcp/dns/dns_client.c ../../../../../cyclone_tcp/dns/dns_common.c ../../../../../cyclone_tcp/dns/dns_debug.c ../../../../../cyclone_tcp/mdns/mdns_client.c ../../../../../cyclone_tcp/mdns/mdns_responder.c ../../../../../cyclone_tcp/mdns/mdns_common.c ../../../../../cyclone_tcp/dhcp/dhcp_client.c ../../../../../cyclone_tcp/dhcp/dhcp_common.c ../../../../../cyclone_tcp/dhcp/dhcp_debug.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_client.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_relay.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_common.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_debug.c ../../../../../cyclone_tcp/smtp/smtp_client.c ../../../../../cyclone_ssl/tls.c ../../../../../cyclone_ssl/tls_cipher_suites.c ../../../../../cyclone_ssl/tls_client.c ../../../../../cyclone_ssl/tls_server.c ../../../../../cyclone_ssl/tls_common.c ../../../../../cyclone_ssl/tls_record.c ../../../../../cyclone_ssl/tls_io.c ../../../../../cyclone_ssl/tls_misc.c ../../../../../cyclone_ssl/tls_cache.c ../../../../../cyclone_ssl/tls_ticket.c ../../../../../cyclone_ssl/ssl_common.c ../../../../../cyclone_crypto/base64.c ../../../../../cyclone_crypto/md2.c ../../../../../cyclone_crypto/md4.c ../../../../../cyclone_crypto/md5.c ../../../../../cyclone_crypto/ripemd128.c ../../../../../cyclone_crypto/ripemd160.c ../../../../../cyclone_crypto/sha1.c ../../../../../cyclone_crypto/sha224.c ../../../../../cyclone_crypto/sha256.c ../../../../../cyclone_crypto/sha384.c ../../../../../cyclone_crypto/sha512.c ../../../../../cyclone_crypto/sha512_224.c ../../../../../cyclone_crypto/sha512_256.c ../../../../../cyclone_crypto/tiger.c ../../../../../cyclone_crypto/whirlpool.c ../../../../../cyclone_crypto/hmac.c ../../../../../cyclone_crypto/rc4.c ../../../../../cyclone_crypto/rc6.c ../../../../../cyclone_crypto/idea.c ../../../../../cyclone_crypto/des.c ../../../../../cyclone_crypto/des3.c ../../../../../cyclone_crypto/aes.c ../../../../../cyclone_crypto/camellia.c ../../../../../cyclone_crypto/seed.c ../../../../../cyclone_crypto/aria.c ../../../../../cyclone_crypto/cipher_mode_ecb.c ../../../../../cyclone_crypto/cipher_mode_cbc.c ../../../../../cyclone_crypto/cipher_mode_cfb.c ../../../../../cyclone_crypto/cipher_mode_ofb.c ../../../../../cyclone_crypto/cipher_mode_ctr.c ../../../../../cyclone_crypto/cipher_mode_ccm.c ../../../../../cyclone_crypto/cipher_mode_gcm.c ../../../../../cyclone_crypto/chacha.c ../../../../../cyclone_crypto/poly1305.c ../../../../../cyclone_crypto/chacha20_poly1305.c ../../../../../cyclone_crypto/dh.c ../../../../../cyclone_crypto/rsa.c ../../../../../cyclone_crypto/dsa.c ../../../../../cyclone_crypto/ec.c ../../../../../cyclone_crypto/ec_curves.c ../../../../../cyclone_crypto/ec_p256.c ../../../../../cyclone_crypto/ecdh.c ../../../../../cyclone_crypto/curve25519.c ../../../../../cyclone_crypto/x25519.c ../../../../../cyclone_crypto/ecdsa.c ../../../../../cyclone_crypto/pkcs5.c ../../../../../cyclone_crypto/mpi.c ../../../../../cyclone_crypto/asn1.c ../../../../../cyclone_crypto/x509.c ../../../../../cyclone_crypto/pem.c ../../../../../cyclone_crypto/yarrow.c ../../../../common/freertos/portable/mplabx/pic32mx/port.c ../../../../common/freertos/portable/mplabx/pic32mx/port_asm.S ../../../../common/freertos/croutine.c ../../../../common/freertos/list.c ../../../../common/freertos/queue.c ../../../../common/freertos/tasks.c ../../../../common/freertos/timers.c ../../../../common/freertos/portable/memmang/heap_3.c
 
 
 CFLAGS=
@@ -313,6 +313,24 @@ ${OBJECTDIR}/_ext/1079766828/tcp_timer.o: ../../../../../cyclone_tcp/core/tcp_ti
 	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_timer.o 
 	@${FIXDEPS} "${OBJECTDIR}/_ext/1079766828/tcp_timer.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PIC32MXSK=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1079766828/tcp_timer.o.d" -o ${OBJECTDIR}/_ext/1079766828/tcp_timer.o ../../../../../cyclone_tcp/core/tcp_timer.c   
 	
+${OBJECTDIR}/_ext/1079766828/tcp_cc.o: ../../../../../cyclone_tcp/core/tcp_cc.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1079766828 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_cc.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_cc.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1079766828/tcp_cc.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PIC32MXSK=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1079766828/tcp_cc.o.d" -o ${OBJECTDIR}/_ext/1079766828/tcp_cc.o ../../../../../cyclone_tcp/core/tcp_cc.c   
+	
+${OBJECTDIR}/_ext/1079766828/tcp_cubic.o: ../../../../../cyclone_tcp/core/tcp_cubic.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1079766828 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_cubic.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_cubic.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1079766828/tcp_cubic.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PIC32MXSK=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1079766828/tcp_cubic.o.d" -o ${OBJECTDIR}/_ext/1079766828/tcp_cubic.o ../../../../../cyclone_tcp/core/tcp_cubic.c   
+	
+${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o: ../../../../../cyclone_tcp/core/tcp_syn_cookie.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1079766828 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PIC32MXSK=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o.d" -o ${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o ../../../../../cyclone_tcp/core/tcp_syn_cookie.c   
+	
 ${OBJECTDIR}/_ext/1079766828/udp.o: ../../../../../cyclone_tcp/core/udp.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} ${OBJECTDIR}/_ext/1079766828 
 	@${RM} ${OBJECTDIR}/_ext/1079766828/udp.o.d 
@@ -487,6 +505,12 @@ ${OBJECTDIR}/_ext/476983781/tls_cache.o: ../../../../../cyclone_ssl/tls_cache.c
 	@${RM} ${OBJECTDIR}/_ext/476983781/tls_cache.o 
 	@${FIXDEPS} "${OBJECTDIR}/_ext/476983781/tls_cache.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PIC32MXSK=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/476983781/tls_cache.o.d" -o ${OBJECTDIR}/_ext/476983781/tls_cache.o ../../../../../cyclone_ssl/tls_cache.c   
 	
+${OBJECTDIR}/_ext/476983781/tls_ticket.o: ../../../../../cyclone_ssl/tls_ticket.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/476983781 
+	@${RM} ${OBJECTDIR}/_ext/476983781/tls_ticket.o.d 
+	@${RM} ${OBJECTDIR}/_ext/476983781/tls_ticket.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/476983781/tls_ticket.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PIC32MXSK=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/476983781/tls_ticket.o.d" -o ${OBJECTDIR}/_ext/476983781/tls_ticket.o ../../../../../cyclone_ssl/tls_ticket.c   
+	
 ${OBJECTDIR}/_ext/476983781/ssl_common.o: ../../../../../cyclone_ssl/ssl_common.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} ${OBJECTDIR}/_ext/476983781 
 	@${RM} ${OBJECTDIR}/_ext/476983781/ssl_common.o.d 
@@ -685,6 +709,24 @@ ${OBJECTDIR}/_ext/1613513288/cipher_mode_gcm.o: ../../../../../cyclone_crypto/ci
 	@${RM} ${OBJECTDIR}/_ext/1613513288/cipher_mode_gcm.o 
 	@${FIXDEPS} "${OBJECTDIR}/_ext/1613513288/cipher_mode_gcm.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PIC32MXSK=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1613513288/cipher_mode_gcm.o.d" -o ${OBJECTDIR}/_ext/1613513288/cipher_mode_gcm.o ../../../../../cyclone_crypto/cipher_mode_gcm.c   
 	
+${OBJECTDIR}/_ext/1613513288/chacha.o: ../../../../../cyclone_crypto/chacha.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1613513288 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/chacha.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/chacha.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1613513288/chacha.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PIC32MXSK=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1613513288/chacha.o.d" -o ${OBJECTDIR}/_ext/1613513288/chacha.o ../../../../../cyclone_crypto/chacha.c   
+	
+${OBJECTDIR}/_ext/1613513288/poly1305.o: ../../../../../cyclone_crypto/poly1305.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1613513288 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/poly1305.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/poly1305.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1613513288/poly1305.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PIC32MXSK=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1613513288/poly1305.o.d" -o ${OBJECTDIR}/_ext/1613513288/poly1305.o ../../../../../cyclone_crypto/poly1305.c   
+	
+${OBJECTDIR}/_ext/1613513288/chacha20_poly1305.o: ../../../../../cyclone_crypto/chacha20_poly1305.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1613513288 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/chacha20_poly1305.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/chacha20_poly1305.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1613513288/chacha20_poly1305.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PIC32MXSK=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1613513288/chacha20_poly1305.o.d" -o ${OBJECTDIR}/_ext/1613513288/chacha20_poly1305.o ../../../../../cyclone_crypto/chacha20_poly1305.c   
+	
 ${OBJECTDIR}/_ext/1613513288/dh.o: ../../../../../cyclone_crypto/dh.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} ${OBJECTDIR}/_ext/1613513288 
 	@${RM} ${OBJECTDIR}/_ext/1613513288/dh.o.d 
@@ -715,12 +757,30 @@ ${OBJECTDIR}/_ext/1613513288/ec_curves.o: ../../../../../cyclone_crypto/ec_curve
 	@${RM} ${OBJECTDIR}/_ext/1613513288/ec_curves.o 
 	@${FIXDEPS} "${OBJECTDIR}/_ext/1613513288/ec_curves.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PIC32MXSK=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1613513288/ec_curves.o.d" -o ${OBJECTDIR}/_ext/1613513288/ec_curves.o ../../../../../cyclone_crypto/ec_curves.c   
 	
+${OBJECTDIR}/_ext/1613513288/ec_p256.o: ../../../../../cyclone_crypto/ec_p256.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1613513288 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/ec_p256.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/ec_p256.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1613513288/ec_p256.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PIC32MXSK=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1613513288/ec_p256.o.d" -o ${OBJECTDIR}/_ext/1613513288/ec_p256.o ../../../../../cyclone_crypto/ec_p256.c   
+	
 ${OBJECTDIR}/_ext/1613513288/ecdh.o: ../../../../../cyclone_crypto/ecdh.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} ${OBJECTDIR}/_ext/1613513288 
 	@${RM} ${OBJECTDIR}/_ext/1613513288/ecdh.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1613513288/ecdh.o 
 	@${FIXDEPS} "${OBJECTDIR}/_ext/1613513288/ecdh.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PIC32MXSK=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1613513288/ecdh.o.d" -o ${OBJECTDIR}/_ext/1613513288/ecdh.o ../../../../../cyclone_crypto/ecdh.c   
 	
+${OBJECTDIR}/_ext/1613513288/curve25519.o: ../../../../../cyclone_crypto/curve25519.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1613513288 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/curve25519.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/curve25519.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1613513288/curve25519.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PIC32MXSK=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1613513288/curve25519.o.d" -o ${OBJECTDIR}/_ext/1613513288/curve25519.o ../../../../../cyclone_crypto/curve25519.c   
+	
+${OBJECTDIR}/_ext/1613513288/x25519.o: ../../../../../cyclone_crypto/x25519.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1613513288 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/x25519.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/x25519.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1613513288/x25519.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PIC32MXSK=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1613513288/x25519.o.d" -o ${OBJECTDIR}/_ext/1613513288/x25519.o ../../../../../cyclone_crypto/x25519.c   
+	
 ${OBJECTDIR}/_ext/1613513288/ecdsa.o: ../../../../../cyclone_crypto/ecdsa.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} ${OBJECTDIR}/_ext/1613513288 
 	@${RM} ${OBJECTDIR}/_ext/1613513288/ecdsa.o.d 
@@ -986,6 +1046,24 @@ ${OBJECTDIR}/_ext/1079766828/tcp_timer.o: ../../../../../cyclone_tcp/core/tcp_ti
 	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_timer.o 
 	@${FIXDEPS} "${OBJECTDIR}/_ext/1079766828/tcp_timer.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1079766828/tcp_timer.o.d" -o ${OBJECTDIR}/_ext/1079766828/tcp_timer.o ../../../../../cyclone_tcp/core/tcp_timer.c   
 	
+${OBJECTDIR}/_ext/1079766828/tcp_cc.o: ../../../../../cyclone_tcp/core/tcp_cc.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1079766828 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_cc.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_cc.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1079766828/tcp_cc.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1079766828/tcp_cc.o.d" -o ${OBJECTDIR}/_ext/1079766828/tcp_cc.o ../../../../../cyclone_tcp/core/tcp_cc.c   
+	
+${OBJECTDIR}/_ext/1079766828/tcp_cubic.o: ../../../../../cyclone_tcp/core/tcp_cubic.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1079766828 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_cubic.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_cubic.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1079766828/tcp_cubic.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1079766828/tcp_cubic.o.d" -o ${OBJECTDIR}/_ext/1079766828/tcp_cubic.o ../../../../../cyclone_tcp/core/tcp_cubic.c   
+	
+${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o: ../../../../../cyclone_tcp/core/tcp_syn_cookie.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1079766828 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o.d" -o ${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o ../../../../../cyclone_tcp/core/tcp_syn_cookie.c   
+	
 ${OBJECTDIR}/_ext/1079766828/udp.o: ../../../../../cyclone_tcp/core/udp.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} ${OBJECTDIR}/_ext/1079766828 
 	@${RM} ${OBJECTDIR}/_ext/1079766828/udp.o.d 
@@ -1160,6 +1238,12 @@ ${OBJECTDIR}/_ext/476983781/tls_cache.o: ../../../../../cyclone_ssl/tls_cache.c
 	@${RM} ${OBJECTDIR}/_ext/476983781/tls_cache.o 
 	@${FIXDEPS} "${OBJECTDIR}/_ext/476983781/tls_cache.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/476983781/tls_cache.o.d" -o ${OBJECTDIR}/_ext/476983781/tls_cache.o ../../../../../cyclone_ssl/tls_cache.c   
 	
+${OBJECTDIR}/_ext/476983781/tls_ticket.o: ../../../../../cyclone_ssl/tls_ticket.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/476983781 
+	@${RM} ${OBJECTDIR}/_ext/476983781/tls_ticket.o.d 
+	@${RM} ${OBJECTDIR}/_ext/476983781/tls_ticket.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/476983781/tls_ticket.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/476983781/tls_ticket.o.d" -o ${OBJECTDIR}/_ext/476983781/tls_ticket.o ../../../../../cyclone_ssl/tls_ticket.c   
+	
 ${OBJECTDIR}/_ext/476983781/ssl_common.o: ../../../../../cyclone_ssl/ssl_common.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} ${OBJECTDIR}/_ext/476983781 
 	@${RM} ${OBJECTDIR}/_ext/476983781/ssl_common.o.d 
@@ -1358,6 +1442,24 @@ ${OBJECTDIR}/_ext/1613513288/cipher_mode_gcm.o: ../../../../../cyclone_crypto/ci
 	@${RM} ${OBJECTDIR}/_ext/1613513288/cipher_mode_gcm.o 
 	@${FIXDEPS} "${OBJECTDIR}/_ext/1613513288/cipher_mode_gcm.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1613513288/cipher_mode_gcm.o.d" -o ${OBJECTDIR}/_ext/1613513288/cipher_mode_gcm.o ../../../../../cyclone_crypto/cipher_mode_gcm.c   
 	
+${OBJECTDIR}/_ext/1613513288/chacha.o: ../../../../../cyclone_crypto/chacha.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1613513288 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/chacha.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/chacha.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1613513288/chacha.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1613513288/chacha.o.d" -o ${OBJECTDIR}/_ext/1613513288/chacha.o ../../../../../cyclone_crypto/chacha.c   
+	
+${OBJECTDIR}/_ext/1613513288/poly1305.o: ../../../../../cyclone_crypto/poly1305.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1613513288 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/poly1305.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/poly1305.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1613513288/poly1305.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1613513288/poly1305.o.d" -o ${OBJECTDIR}/_ext/1613513288/poly1305.o ../../../../../cyclone_crypto/poly1305.c   
+	
+${OBJECTDIR}/_ext/1613513288/chacha20_poly1305.o: ../../../../../cyclone_crypto/chacha20_poly1305.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1613513288 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/chacha20_poly1305.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/chacha20_poly1305.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1613513288/chacha20_poly1305.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1613513288/chacha20_poly1305.o.d" -o ${OBJECTDIR}/_ext/1613513288/chacha20_poly1305.o ../../../../../cyclone_crypto/chacha20_poly1305.c   
+	
 ${OBJECTDIR}/_ext/1613513288/dh.o: ../../../../../cyclone_crypto/dh.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} ${OBJECTDIR}/_ext/1613513288 
 	@${RM} ${OBJECTDIR}/_ext/1613513288/dh.o.d 
@@ -1388,12 +1490,30 @@ ${OBJECTDIR}/_ext/1613513288/ec_curves.o: ../../../../../cyclone_crypto/ec_curve
 	@${RM} ${OBJECTDIR}/_ext/1613513288/ec_curves.o 
 	@${FIXDEPS} "${OBJECTDIR}/_ext/1613513288/ec_curves.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1613513288/ec_curves.o.d" -o ${OBJECTDIR}/_ext/1613513288/ec_curves.o ../../../../../cyclone_crypto/ec_curves.c   
 	
+${OBJECTDIR}/_ext/1613513288/ec_p256.o: ../../../../../cyclone_crypto/ec_p256.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1613513288 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/ec_p256.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/ec_p256.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1613513288/ec_p256.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1613513288/ec_p256.o.d" -o ${OBJECTDIR}/_ext/1613513288/ec_p256.o ../../../../../cyclone_crypto/ec_p256.c   
+	
 ${OBJECTDIR}/_ext/1613513288/ecdh.o: ../../../../../cyclone_crypto/ecdh.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} ${OBJECTDIR}/_ext/1613513288 
 	@${RM} ${OBJECTDIR}/_ext/1613513288/ecdh.o.d 
 	@${RM} ${OBJECTDIR}/_ext/1613513288/ecdh.o 
 	@${FIXDEPS} "${OBJECTDIR}/_ext/1613513288/ecdh.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1613513288/ecdh.o.d" -o ${OBJECTDIR}/_ext/1613513288/ecdh.o ../../../../../cyclone_crypto/ecdh.c   
 	
+${OBJECTDIR}/_ext/1613513288/curve25519.o: ../../../../../cyclone_crypto/curve25519.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1613513288 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/curve25519.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/curve25519.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1613513288/curve25519.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1613513288/curve25519.o.d" -o ${OBJECTDIR}/_ext/1613513288/curve25519.o ../../../../../cyclone_crypto/curve25519.c   
+	
+${OBJECTDIR}/_ext/1613513288/x25519.o: ../../../../../cyclone_crypto/x25519.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1613513288 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/x25519.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1613513288/x25519.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1613513288/x25519.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_ETH_STARTER_KIT -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_eth_starter_kit" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1613513288/x25519.o.d" -o ${OBJECTDIR}/_ext/1613513288/x25519.o ../../../../../cyclone_crypto/x25519.c   
+	
 ${OBJECTDIR}/_ext/1613513288/ecdsa.o: ../../../../../cyclone_crypto/ecdsa.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} ${OBJECTDIR}/_ext/1613513288 
 	@${RM} ${OBJECTDIR}/_ext/1613513288/ecdsa.o.d 
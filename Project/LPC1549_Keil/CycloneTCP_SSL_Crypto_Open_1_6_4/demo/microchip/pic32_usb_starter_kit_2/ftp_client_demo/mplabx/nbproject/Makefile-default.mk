@@ -45,17 +45,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=../src/main.c ../src/debug.c ../src/spi_driver.c ../src/ext_int_driver.c ../src/sprintf.c ../src/strtok_r.c ../src/ext2_irq_wrapper.S ../../../../../common/endian.c ../../../../../common/os_port_freertos.c ../../../../../common/date_time.c ../../../../../common/str.c ../../../../../cyclone_tcp/core/tcp_ip_stack.c ../../../../../cyclone_tcp/core/tcp_ip_stack_mem.c ../../../../../cyclone_tcp/drivers/enc624j600.c ../../../../../cyclone_tcp/core/nic.c ../../../../../cyclone_tcp/core/ethernet.c ../../../../../cyclone_tcp/ipv4/arp.c ../../../../../cyclone_tcp/core/ip.c ../../../../../cyclone_tcp/ipv4/ipv4.c ../../../../../cyclone_tcp/ipv4/ipv4_frag.c ../../../../../cyclone_tcp/ipv4/icmp.c ../../../../../cyclone_tcp/ipv4/igmp.c ../../../../../cyclone_tcp/ipv6/ipv6.c ../../../../../cyclone_tcp/ipv6/ipv6_frag.c ../../../../../cyclone_tcp/ipv6/icmpv6.c ../../../../../cyclone_tcp/ipv6/mld.c ../../../../../cyclone_tcp/ipv6/ndp.c ../../../../../cyclone_tcp/ipv6/slaac.c ../../../../../cyclone_tcp/core/tcp.c ../../../../../cyclone_tcp/core/tcp_fsm.c ../../../../../cyclone_tcp/core/tcp_misc.c ../../../../../cyclone_tcp/core/tcp_timer.c ../../../../../cyclone_tcp/core/udp.c ../../../../../cyclone_tcp/core/socket.c ../../../../../cyclone_tcp/core/bsd_socket.c ../../../../../cyclone_tcp/core/raw_socket.c ../../../../../cyclone_tcp/core/ping.c ../../../../../cyclone_tcp/dns/dns_cache.c ../../../../../cyclone_tcp/dns/dns_client.c ../../../../../cyclone_tcp/dns/dns_common.c ../../../../../cyclone_tcp/dns/dns_debug.c ../../../../../cyclone_tcp/mdns/mdns_client.c ../../../../../cyclone_tcp/mdns/mdns_responder.c ../../../../../cyclone_tcp/mdns/mdns_common.c ../../../../../cyclone_tcp/dhcp/dhcp_client.c ../../../../../cyclone_tcp/dhcp/dhcp_common.c ../../../../../cyclone_tcp/dhcp/dhcp_debug.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_client.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_relay.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_common.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_debug.c ../../../../../cyclone_tcp/ftp/ftp_client.c ../../../../common/freertos/portable/mplabx/pic32mx/port.c ../../../../common/freertos/portable/mplabx/pic32mx/port_asm.S ../../../../common/freertos/croutine.c ../../../../common/freertos/list.c ../../../../common/freertos/queue.c ../../../../common/freertos/tasks.c ../../../../common/freertos/timers.c ../../../../common/freertos/portable/memmang/heap_3.c
+SOURCEFILES_QUOTED_IF_SPACED=../src/main.c ../src/debug.c ../src/spi_driver.c ../src/ext_int_driver.c ../src/sprintf.c ../src/strtok_r.c ../src/ext2_irq_wrapper.S ../../../../../common/endian.c ../../../../../common/os_port_freertos.c ../../../../../common/date_time.c ../../../../../common/str.c ../../../../../cyclone_tcp/core/tcp_ip_stack.c ../../../../../cyclone_tcp/core/tcp_ip_stack_mem.c ../../../../../cyclone_tcp/drivers/enc624j600.c ../../../../../cyclone_tcp/core/nic.c ../../../../../cyclone_tcp/core/ethernet.c ../../../../../cyclone_tcp/ipv4/arp.c ../../../../../cyclone_tcp/core/ip.c ../../../../../cyclone_tcp/ipv4/ipv4.c ../../../../../cyclone_tcp/ipv4/ipv4_frag.c ../../../../../cyclone_tcp/ipv4/icmp.c ../../../../../cyclone_tcp/ipv4/igmp.c ../../../../../cyclone_tcp/ipv6/ipv6.c ../../../../../cyclone_tcp/ipv6/ipv6_frag.c ../../../../../cyclone_tcp/ipv6/icmpv6.c ../../../../../cyclone_tcp/ipv6/mld.c ../../../../../cyclone_tcp/ipv6/ndp.c ../../../../../cyclone_tcp/ipv6/slaac.c ../../../../../cyclone_tcp/core/tcp.c ../../../../../cyclone_tcp/core/tcp_fsm.c ../../../../../cyclone_tcp/core/tcp_misc.c ../../../../../cyclone_tcp/core/tcp_timer.c ../../../../../cyclone_tcp/core/tcp_cc.c ../../../../../cyclone_tcp/core/tcp_cubic.c ../../../../../cyclone_tcp/core/tcp_syn_cookie.c ../../../../../cyclone_tcp/core/udp.c ../../../../../cyclone_tcp/core/socket.c ../../../../../cyclone_tcp/core/bsd_socket.c ../../../../../cyclone_tcp/core/raw_socket.c ../../../../../cyclone_tcp/core/ping.c ../../../../../cyclone_tcp/dns/dns_cache.c ../../../../../cyclone_tcp/dns/dns_client.c ../../../../../cyclone_tcp/dns/dns_common.c ../../../../../cyclone_tcp/dns/dns_debug.c ../../../../../cyclone_tcp/mdns/mdns_client.c ../../../../../cyclone_tcp/mdns/mdns_responder.c ../../../../../cyclone_tcp/mdns/mdns_common.c ../../../../../cyclone_tcp/dhcp/dhcp_client.c ../../../../../cyclone_tcp/dhcp/dhcp_common.c ../../../../../cyclone_tcp/dhcp/dhcp_debug.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_client.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_relay.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_common.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_debug.c ../../../../../cyclone_tcp/ftp/ftp_client.c ../../../../common/freertos/portable/mplabx/pic32mx/port.c ../../../../common/freertos/portable/mplabx/pic32mx/port_asm.S ../../../../common/freertos/croutine.c ../../../../common/freertos/list.c ../../../../common/freertos/queue.c ../../../../common/freertos/tasks.c ../../../../common/freertos/timers.c ../../../../common/freertos/portable/memmang/heap_3.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1360937237/debug.o ${OBJECTDIR}/_ext/1360937237/spi_driver.o ${OBJECTDIR}/_ext/1360937237/ext_int_driver.o ${OBJECTDIR}/_ext/1360937237/sprintf.o ${OBJECTDIR}/_ext/1360937237/strtok_r.o ${OBJECTDIR}/_ext/1360937237/ext2_irq_wrapper.o ${OBJECTDIR}/_ext/360186330/endian.o ${OBJECTDIR}/_ext/360186330/os_port_freertos.o ${OBJECTDIR}/_ext/360186330/date_time.o ${OBJECTDIR}/_ext/360186330/str.o ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack.o ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack_mem.o ${OBJECTDIR}/_ext/1357806602/enc624j600.o ${OBJECTDIR}/_ext/1079766828/nic.o ${OBJECTDIR}/_ext/1079766828/ethernet.o ${OBJECTDIR}/_ext/1079587046/arp.o ${OBJECTDIR}/_ext/1079766828/ip.o ${OBJECTDIR}/_ext/1079587046/ipv4.o ${OBJECTDIR}/_ext/1079587046/ipv4_frag.o ${OBJECTDIR}/_ext/1079587046/icmp.o ${OBJECTDIR}/_ext/1079587046/igmp.o ${OBJECTDIR}/_ext/1079587044/ipv6.o ${OBJECTDIR}/_ext/1079587044/ipv6_frag.o ${OBJECTDIR}/_ext/1079587044/icmpv6.o ${OBJECTDIR}/_ext/1079587044/mld.o ${OBJECTDIR}/_ext/1079587044/ndp.o ${OBJECTDIR}/_ext/1079587044/slaac.o ${OBJECTDIR}/_ext/1079766828/tcp.o ${OBJECTDIR}/_ext/1079766828/tcp_fsm.o ${OBJECTDIR}/_ext/1079766828/tcp_misc.o ${OBJECTDIR}/_ext/1079766828/tcp_timer.o ${OBJECTDIR}/_ext/1079766828/udp.o ${OBJECTDIR}/_ext/1079766828/socket.o ${OBJECTDIR}/_ext/1079766828/bsd_socket.o ${OBJECTDIR}/_ext/1079766828/raw_socket.o ${OBJECTDIR}/_ext/1079766828/ping.o ${OBJECTDIR}/_ext/242264404/dns_cache.o ${OBJECTDIR}/_ext/242264404/dns_client.o ${OBJECTDIR}/_ext/242264404/dns_common.o ${OBJECTDIR}/_ext/242264404/dns_debug.o ${OBJECTDIR}/_ext/1079479599/mdns_client.o ${OBJECTDIR}/_ext/1079479599/mdns_responder.o ${OBJECTDIR}/_ext/1079479599/mdns_common.o ${OBJECTDIR}/_ext/1079744218/dhcp_client.o ${OBJECTDIR}/_ext/1079744218/dhcp_common.o ${OBJECTDIR}/_ext/1079744218/dhcp_debug.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_client.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_relay.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_common.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_debug.o ${OBJECTDIR}/_ext/242266509/ftp_client.o ${OBJECTDIR}/_ext/1101018382/port.o ${OBJECTDIR}/_ext/1101018382/port_asm.o ${OBJECTDIR}/_ext/55695242/croutine.o ${OBJECTDIR}/_ext/55695242/list.o ${OBJECTDIR}/_ext/55695242/queue.o ${OBJECTDIR}/_ext/55695242/tasks.o ${OBJECTDIR}/_ext/55695242/timers.o ${OBJECTDIR}/_ext/2075018599/heap_3.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/_ext/1360937237/main.o.d ${OBJECTDIR}/_ext/1360937237/debug.o.d ${OBJECTDIR}/_ext/1360937237/spi_driver.o.d ${OBJECTDIR}/_ext/1360937237/ext_int_driver.o.d ${OBJECTDIR}/_ext/1360937237/sprintf.o.d ${OBJECTDIR}/_ext/1360937237/strtok_r.o.d ${OBJECTDIR}/_ext/1360937237/ext2_irq_wrapper.o.d ${OBJECTDIR}/_ext/360186330/endian.o.d ${OBJECTDIR}/_ext/360186330/os_port_freertos.o.d ${OBJECTDIR}/_ext/360186330/date_time.o.d ${OBJECTDIR}/_ext/360186330/str.o.d ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack.o.d ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack_mem.o.d ${OBJECTDIR}/_ext/1357806602/enc624j600.o.d ${OBJECTDIR}/_ext/1079766828/nic.o.d ${OBJECTDIR}/_ext/1079766828/ethernet.o.d ${OBJECTDIR}/_ext/1079587046/arp.o.d ${OBJECTDIR}/_ext/1079766828/ip.o.d ${OBJECTDIR}/_ext/1079587046/ipv4.o.d ${OBJECTDIR}/_ext/1079587046/ipv4_frag.o.d ${OBJECTDIR}/_ext/1079587046/icmp.o.d ${OBJECTDIR}/_ext/1079587046/igmp.o.d ${OBJECTDIR}/_ext/1079587044/ipv6.o.d ${OBJECTDIR}/_ext/1079587044/ipv6_frag.o.d ${OBJECTDIR}/_ext/1079587044/icmpv6.o.d ${OBJECTDIR}/_ext/1079587044/mld.o.d ${OBJECTDIR}/_ext/1079587044/ndp.o.d ${OBJECTDIR}/_ext/1079587044/slaac.o.d ${OBJECTDIR}/_ext/1079766828/tcp.o.d ${OBJECTDIR}/_ext/1079766828/tcp_fsm.o.d ${OBJECTDIR}/_ext/1079766828/tcp_misc.o.d ${OBJECTDIR}/_ext/1079766828/tcp_timer.o.d ${OBJECTDIR}/_ext/1079766828/udp.o.d ${OBJECTDIR}/_ext/1079766828/socket.o.d ${OBJECTDIR}/_ext/1079766828/bsd_socket.o.d ${OBJECTDIR}/_ext/1079766828/raw_socket.o.d ${OBJECTDIR}/_ext/1079766828/ping.o.d ${OBJECTDIR}/_ext/242264404/dns_cache.o.d ${OBJECTDIR}/_ext/242264404/dns_client.o.d ${OBJECTDIR}/_ext/242264404/dns_common.o.d ${OBJECTDIR}/_ext/242264404/dns_debug.o.d ${OBJECTDIR}/_ext/1079479599/mdns_client.o.d ${OBJECTDIR}/_ext/1079479599/mdns_responder.o.d ${OBJECTDIR}/_ext/1079479599/mdns_common.o.d ${OBJECTDIR}/_ext/1079744218/dhcp_client.o.d ${OBJECTDIR}/_ext/1079744218/dhcp_common.o.d ${OBJECTDIR}/_ext/1079744218/dhcp_debug.o.d ${OBJECTDIR}/_ext/1747895846/dhcpv6_client.o.d ${OBJECTDIR}/_ext/1747895846/dhcpv6_relay.o.d ${OBJECTDIR}/_ext/1747895846/dhcpv6_common.o.d ${OBJECTDIR}/_ext/1747895846/dhcpv6_debug.o.d ${OBJECTDIR}/_ext/242266509/ftp_client.o.d ${OBJECTDIR}/_ext/1101018382/port.o.d ${OBJECTDIR}/_ext/1101018382/port_asm.o.d ${OBJECTDIR}/_ext/55695242/croutine.o.d ${OBJECTDIR}/_ext/55695242/list.o.d ${OBJECTDIR}/_ext/55695242/queue.o.d ${OBJECTDIR}/_ext/55695242/tasks.o.d ${OBJECTDIR}/_ext/55695242/timers.o.d ${OBJECTDIR}/_ext/2075018599/heap_3.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1360937237/debug.o ${OBJECTDIR}/_ext/1360937237/spi_driver.o ${OBJECTDIR}/_ext/1360937237/ext_int_driver.o ${OBJECTDIR}/_ext/1360937237/sprintf.o ${OBJECTDIR}/_ext/1360937237/strtok_r.o ${OBJECTDIR}/_ext/1360937237/ext2_irq_wrapper.o ${OBJECTDIR}/_ext/360186330/endian.o ${OBJECTDIR}/_ext/360186330/os_port_freertos.o ${OBJECTDIR}/_ext/360186330/date_time.o ${OBJECTDIR}/_ext/360186330/str.o ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack.o ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack_mem.o ${OBJECTDIR}/_ext/1357806602/enc624j600.o ${OBJECTDIR}/_ext/1079766828/nic.o ${OBJECTDIR}/_ext/1079766828/ethernet.o ${OBJECTDIR}/_ext/1079587046/arp.o ${OBJECTDIR}/_ext/1079766828/ip.o ${OBJECTDIR}/_ext/1079587046/ipv4.o ${OBJECTDIR}/_ext/1079587046/ipv4_frag.o ${OBJECTDIR}/_ext/1079587046/icmp.o ${OBJECTDIR}/_ext/1079587046/igmp.o ${OBJECTDIR}/_ext/1079587044/ipv6.o ${OBJECTDIR}/_ext/1079587044/ipv6_frag.o ${OBJECTDIR}/_ext/1079587044/icmpv6.o ${OBJECTDIR}/_ext/1079587044/mld.o ${OBJECTDIR}/_ext/1079587044/ndp.o ${OBJECTDIR}/_ext/1079587044/slaac.o ${OBJECTDIR}/_ext/1079766828/tcp.o ${OBJECTDIR}/_ext/1079766828/tcp_fsm.o ${OBJECTDIR}/_ext/1079766828/tcp_misc.o ${OBJECTDIR}/_ext/1079766828/tcp_timer.o ${OBJECTDIR}/_ext/1079766828/tcp_cc.o ${OBJECTDIR}/_ext/1079766828/tcp_cubic.o ${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o ${OBJECTDIR}/_ext/1079766828/udp.o ${OBJECTDIR}/_ext/1079766828/socket.o ${OBJECTDIR}/_ext/1079766828/bsd_socket.o ${OBJECTDIR}/_ext/1079766828/raw_socket.o ${OBJECTDIR}/_ext/1079766828/ping.o ${OBJECTDIR}/_ext/242264404/dns_cache.o ${OBJECTDIR}/_ext/242264404/dns_client.o ${OBJECTDIR}/_ext/242264404/dns_common.o ${OBJECTDIR}/_ext/242264404/dns_debug.o ${OBJECTDIR}/_ext/1079479599/mdns_client.o ${OBJECTDIR}/_ext/1079479599/mdns_responder.o ${OBJECTDIR}/_ext/1079479599/mdns_common.o ${OBJECTDIR}/_ext/1079744218/dhcp_client.o ${OBJECTDIR}/_ext/1079744218/dhcp_common.o ${OBJECTDIR}/_ext/1079744218/dhcp_debug.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_client.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_relay.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_common.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_debug.o ${OBJECTDIR}/_ext/242266509/ftp_client.o ${OBJECTDIR}/_ext/1101018382/port.o ${OBJECTDIR}/_ext/1101018382/port_asm.o ${OBJECTDIR}/_ext/55695242/croutine.o ${OBJECTDIR}/_ext/55695242/list.o ${OBJECTDIR}/_ext/55695242/queue.o ${OBJECTDIR}/_ext/55695242/tasks.o ${OBJECTDIR}/_ext/55695242/timers.o ${OBJECTDIR}/_ext/2075018599/heap_3.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/_ext/1360937237/main.o.d ${OBJECTDIR}/_ext/1360937237/debug.o.d ${OBJECTDIR}/_ext/1360937237/spi_driver.o.d ${OBJECTDIR}/_ext/1360937237/ext_int_driver.o.d ${OBJECTDIR}/_ext/1360937237/sprintf.o.d ${OBJECTDIR}/_ext/1360937237/strtok_r.o.d ${OBJECTDIR}/_ext/1360937237/ext2_irq_wrapper.o.d ${OBJECTDIR}/_ext/360186330/endian.o.d ${OBJECTDIR}/_ext/360186330/os_port_freertos.o.d ${OBJECTDIR}/_ext/360186330/date_time.o.d ${OBJECTDIR}/_ext/360186330/str.o.d ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack.o.d ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack_mem.o.d ${OBJECTDIR}/_ext/1357806602/enc624j600.o.d ${OBJECTDIR}/_ext/1079766828/nic.o.d ${OBJECTDIR}/_ext/1079766828/ethernet.o.d ${OBJECTDIR}/_ext/1079587046/arp.o.d ${OBJECTDIR}/_ext/1079766828/ip.o.d ${OBJECTDIR}/_ext/1079587046/ipv4.o.d ${OBJECTDIR}/_ext/1079587046/ipv4_frag.o.d ${OBJECTDIR}/_ext/1079587046/icmp.o.d ${OBJECTDIR}/_ext/1079587046/igmp.o.d ${OBJECTDIR}/_ext/1079587044/ipv6.o.d ${OBJECTDIR}/_ext/1079587044/ipv6_frag.o.d ${OBJECTDIR}/_ext/1079587044/icmpv6.o.d ${OBJECTDIR}/_ext/1079587044/mld.o.d ${OBJECTDIR}/_ext/1079587044/ndp.o.d ${OBJECTDIR}/_ext/1079587044/slaac.o.d ${OBJECTDIR}/_ext/1079766828/tcp.o.d ${OBJECTDIR}/_ext/1079766828/tcp_fsm.o.d ${OBJECTDIR}/_ext/1079766828/tcp_misc.o.d ${OBJECTDIR}/_ext/1079766828/tcp_timer.o.d ${OBJECTDIR}/_ext/1079766828/tcp_cc.o.d ${OBJECTDIR}/_ext/1079766828/tcp_cubic.o.d ${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o.d ${OBJECTDIR}/_ext/1079766828/udp.o.d ${OBJECTDIR}/_ext/1079766828/socket.o.d ${OBJECTDIR}/_ext/1079766828/bsd_socket.o.d ${OBJECTDIR}/_ext/1079766828/raw_socket.o.d ${OBJECTDIR}/_ext/1079766828/ping.o.d ${OBJECTDIR}/_ext/242264404/dns_cache.o.d ${OBJECTDIR}/_ext/242264404/dns_client.o.d ${OBJECTDIR}/_ext/242264404/dns_common.o.d ${OBJECTDIR}/_ext/242264404/dns_debug.o.d ${OBJECTDIR}/_ext/1079479599/mdns_client.o.d ${OBJECTDIR}/_ext/1079479599/mdns_responder.o.d ${OBJECTDIR}/_ext/1079479599/mdns_common.o.d ${OBJECTDIR}/_ext/1079744218/dhcp_client.o.d ${OBJECTDIR}/_ext/1079744218/dhcp_common.o.d ${OBJECTDIR}/_ext/1079744218/dhcp_debug.o.d ${OBJECTDIR}/_ext/1747895846/dhcpv6_client.o.d ${OBJECTDIR}/_ext/1747895846/dhcpv6_relay.o.d ${OBJECTDIR}/_ext/1747895846/dhcpv6_common.o.d ${OBJECTDIR}/_ext/1747895846/dhcpv6_debug.o.d ${OBJECTDIR}/_ext/242266509/ftp_client.o.d ${OBJECTDIR}/_ext/1101018382/port.o.d ${OBJECTDIR}/_ext/1101018382/port_asm.o.d ${OBJECTDIR}/_ext/55695242/croutine.o.d ${OBJECTDIR}/_ext/55695242/list.o.d ${OBJECTDIR}/_ext/55695242/queue.o.d ${OBJECTDIR}/_ext/55695242/tasks.o.d ${OBJECTDIR}/_ext/55695242/timers.o.d ${OBJECTDIR}/_ext/2075018599/heap_3.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1360937237/debug.o ${OBJECTDIR}/_ext/1360937237/spi_driver.o ${OBJECTDIR}/_ext/1360937237/ext_int_driver.o ${OBJECTDIR}/_ext/1360937237/sprintf.o ${OBJECTDIR}/_ext/1360937237/strtok_r.o ${OBJECTDIR}/_ext/1360937237/ext2_irq_wrapper.o ${OBJECTDIR}/_ext/360186330/endian.o ${OBJECTDIR}/_ext/360186330/os_port_freertos.o ${OBJECTDIR}/_ext/360186330/date_time.o ${OBJECTDIR}/_ext/360186330/str.o ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack.o ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack_mem.o ${OBJECTDIR}/_ext/1357806602/enc624j600.o ${OBJECTDIR}/_ext/1079766828/nic.o ${OBJECTDIR}/_ext/1079766828/ethernet.o ${OBJECTDIR}/_ext/1079587046/arp.o ${OBJECTDIR}/_ext/1079766828/ip.o ${OBJECTDIR}/_ext/1079587046/ipv4.o ${OBJECTDIR}/_ext/1079587046/ipv4_frag.o ${OBJECTDIR}/_ext/1079587046/icmp.o ${OBJECTDIR}/_ext/1079587046/igmp.o ${OBJECTDIR}/_ext/1079587044/ipv6.o ${OBJECTDIR}/_ext/1079587044/ipv6_frag.o ${OBJECTDIR}/_ext/1079587044/icmpv6.o ${OBJECTDIR}/_ext/1079587044/mld.o ${OBJECTDIR}/_ext/1079587044/ndp.o ${OBJECTDIR}/_ext/1079587044/slaac.o ${OBJECTDIR}/_ext/1079766828/tcp.o ${OBJECTDIR}/_ext/1079766828/tcp_fsm.o ${OBJECTDIR}/_ext/1079766828/tcp_misc.o ${OBJECTDIR}/_ext/1079766828/tcp_timer.o ${OBJECTDIR}/_ext/1079766828/udp.o ${OBJECTDIR}/_ext/1079766828/socket.o ${OBJECTDIR}/_ext/1079766828/bsd_socket.o ${OBJECTDIR}/_ext/1079766828/raw_socket.o ${OBJECTDIR}/_ext/1079766828/ping.o ${OBJECTDIR}/_ext/242264404/dns_cache.o ${OBJECTDIR}/_ext/242264404/dns_client.o ${OBJECTDIR}/_ext/242264404/dns_common.o ${OBJECTDIR}/_ext/242264404/dns_debug.o ${OBJECTDIR}/_ext/1079479599/mdns_client.o ${OBJECTDIR}/_ext/1079479599/mdns_responder.o ${OBJECTDIR}/_ext/1079479599/mdns_common.o ${OBJECTDIR}/_ext/1079744218/dhcp_client.o ${OBJECTDIR}/_ext/1079744218/dhcp_common.o ${OBJECTDIR}/_ext/1079744218/dhcp_debug.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_client.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_relay.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_common.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_debug.o ${OBJECTDIR}/_ext/242266509/ftp_client.o ${OBJECTDIR}/_ext/1101018382/port.o ${OBJECTDIR}/_ext/1101018382/port_asm.o ${OBJECTDIR}/_ext/55695242/croutine.o ${OBJECTDIR}/_ext/55695242/list.o ${OBJECTDIR}/_ext/55695242/queue.o ${OBJECTDIR}/_ext/55695242/tasks.o ${OBJECTDIR}/_ext/55695242/timers.o ${OBJECTDIR}/_ext/2075018599/heap_3.o
+OBJECTFILES=${OBJECTDIR}/_ext/1360937237/main.o ${OBJECTDIR}/_ext/1360937237/debug.o ${OBJECTDIR}/_ext/1360937237/spi_driver.o ${OBJECTDIR}/_ext/1360937237/ext_int_driver.o ${OBJECTDIR}/_ext/1360937237/sprintf.o ${OBJECTDIR}/_ext/1360937237/strtok_r.o ${OBJECTDIR}/_ext/1360937237/ext2_irq_wrapper.o ${OBJECTDIR}/_ext/360186330/endian.o ${OBJECTDIR}/_ext/360186330/os_port_freertos.o ${OBJECTDIR}/_ext/360186330/date_time.o ${OBJECTDIR}/_ext/360186330/str.o ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack.o ${OBJECTDIR}/_ext/1079766828/tcp_ip_stack_mem.o ${OBJECTDIR}/_ext/1357806602/enc624j600.o ${OBJECTDIR}/_ext/1079766828/nic.o ${OBJECTDIR}/_ext/1079766828/ethernet.o ${OBJECTDIR}/_ext/1079587046/arp.o ${OBJECTDIR}/_ext/1079766828/ip.o ${OBJECTDIR}/_ext/1079587046/ipv4.o ${OBJECTDIR}/_ext/1079587046/ipv4_frag.o ${OBJECTDIR}/_ext/1079587046/icmp.o ${OBJECTDIR}/_ext/1079587046/igmp.o ${OBJECTDIR}/_ext/1079587044/ipv6.o ${OBJECTDIR}/_ext/1079587044/ipv6_frag.o ${OBJECTDIR}/_ext/1079587044/icmpv6.o ${OBJECTDIR}/_ext/1079587044/mld.o ${OBJECTDIR}/_ext/1079587044/ndp.o ${OBJECTDIR}/_ext/1079587044/slaac.o ${OBJECTDIR}/_ext/1079766828/tcp.o ${OBJECTDIR}/_ext/1079766828/tcp_fsm.o ${OBJECTDIR}/_ext/1079766828/tcp_misc.o ${OBJECTDIR}/_ext/1079766828/tcp_timer.o ${OBJECTDIR}/_ext/1079766828/tcp_cc.o ${OBJECTDIR}/_ext/1079766828/tcp_cubic.o ${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o ${OBJECTDIR}/_ext/1079766828/udp.o ${OBJECTDIR}/_ext/1079766828/socket.o ${OBJECTDIR}/_ext/1079766828/bsd_socket.o ${OBJECTDIR}/_ext/1079766828/raw_socket.o ${OBJECTDIR}/_ext/1079766828/ping.o ${OBJECTDIR}/_ext/242264404/dns_cache.o ${OBJECTDIR}/_ext/242264404/dns_client.o ${OBJECTDIR}/_ext/242264404/dns_common.o ${OBJECTDIR}/_ext/242264404/dns_debug.o ${OBJECTDIR}/_ext/1079479599/mdns_client.o ${OBJECTDIR}/_ext/1079479599/mdns_responder.o ${OBJECTDIR}/_ext/1079479599/mdns_common.o ${OBJECTDIR}/_ext/1079744218/dhcp_client.o ${OBJECTDIR}/_ext/1079744218/dhcp_common.o ${OBJECTDIR}/_ext/1079744218/dhcp_debug.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_client.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_relay.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_common.o ${OBJECTDIR}/_ext/1747895846/dhcpv6_debug.o ${OBJECTDIR}/_ext/242266509/ftp_client.o ${OBJECTDIR}/_ext/1101018382/port.o ${OBJECTDIR}/_ext/1101018382/port_asm.o ${OBJECTDIR}/_ext/55695242/croutine.o ${OBJECTDIR}/_ext/55695242/list.o ${OBJECTDIR}/_ext/55695242/queue.o ${OBJECTDIR}/_ext/55695242/tasks.o ${OBJECTDIR}/_ext/55695242/timers.o ${OBJECTDIR}/_ext/2075018599/heap_3.o
 
 # Source Files
-SOURCEFILES=../src/main.c ../src/debug.c ../src/spi_driver.c ../src/ext_int_driver.c ../src/sprintf.c ../src/strtok_r.c ../src/ext2_irq_wrapper.S ../../../../../common/endian.c ../../../../../common/os_port_freertos.c ../../../../../common/date_time.c ../../../../../common/str.c ../../../../../cyclone_tcp/core/tcp_ip_stack.c ../../../../../cyclone_tcp/core/tcp_ip_stack_mem.c ../../../../../cyclone_tcp/drivers/enc624j600.c ../../../../../cyclone_tcp/core/nic.c ../../../../../cyclone_tcp/core/ethernet.c ../../../../../cyclone_tcp/ipv4/arp.c ../../../../../cyclone_tcp/core/ip.c ../../../../../cyclone_tcp/ipv4/ipv4.c ../../../../../cyclone_tcp/ipv4/ipv4_frag.c ../../../../../cyclone_tcp/ipv4/icmp.c ../../../../../cyclone_tcp/ipv4/igmp.c ../../../../../cyclone_tcp/ipv6/ipv6.c ../../../../../cyclone_tcp/ipv6/ipv6_frag.c ../../../../../cyclone_tcp/ipv6/icmpv6.c ../../../../../cyclone_tcp/ipv6/mld.c ../../../../../cyclone_tcp/ipv6/ndp.c ../../../../../cyclone_tcp/ipv6/slaac.c ../../../../../cyclone_tcp/core/tcp.c ../../../../../cyclone_tcp/core/tcp_fsm.c ../../../../../cyclone_tcp/core/tcp_misc.c ../../../../../cyclone_tcp/core/tcp_timer.c ../../../../../cyclone_tcp/core/udp.c ../../../../../cyclone_tcp/core/socket.c ../../../../../cyclone_tcp/core/bsd_socket.c ../../../../../cyclone_tcp/core/raw_socket.c ../../../../../cyclone_tcp/core/ping.c ../../../../../cyclone_tcp/dns/dns_cache.c ../../../../../cyclone_tcp/dns/dns_client.c ../../../../../cyclone_tcp/dns/dns_common.c ../../../../../cyclone_tcp/dns/dns_debug.c ../../../../../cyclone_tcp/mdns/mdns_client.c ../../../../../cyclone_tcp/mdns/mdns_responder.c ../../../../../cyclone_tcp/mdns/mdns_common.c ../../../../../cyclone_tcp/dhcp/dhcp_client.c ../../../../../cyclone_tcp/dhcp/dhcp_common.c ../../../../../cyclone_tcp/dhcp/dhcp_debug.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_client.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_relay.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_common.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_debug.c ../../../../../cyclone_tcp/ftp/ftp_client.c ../../../../common/freertos/portable/mplabx/pic32mx/port.c ../../../../common/freertos/portable/mplabx/pic32mx/port_asm.S ../../../../common/freertos/croutine.c ../../../../common/freertos/list.c ../../../../common/freertos/queue.c ../../../../common/freertos/tasks.c ../../../../common/freertos/timers.c ../../../../common/freertos/portable/memmang/heap_3.c
+SOURCEFILES=../src/main.c ../src/debug.c ../src/spi_driver.c ../src/ext_int_driver.c ../src/sprintf.c ../src/strtok_r.c ../src/ext2_irq_wrapper.S ../../../../../common/endian.c ../../../../../common/os_port_freertos.c ../../../../../common/date_time.c ../../../../../common/str.c ../../../../../cyclone_tcp/core/tcp_ip_stack.c ../../../../../cyclone_tcp/core/tcp_ip_stack_mem.c ../../../../../cyclone_tcp/drivers/enc624j600.c ../../../../../cyclone_tcp/core/nic.c ../../../../../cyclone_tcp/core/ethernet.c ../../../../../cyclone_tcp/ipv4/arp.c ../../../../../cyclone_tcp/core/ip.c ../../../../../cyclone_tcp/ipv4/ipv4.c ../../../../../cyclone_tcp/ipv4/ipv4_frag.c ../../../../../cyclone_tcp/ipv4/icmp.c ../../../../../cyclone_tcp/ipv4/igmp.c ../../../../../cyclone_tcp/ipv6/ipv6.c ../../../../../cyclone_tcp/ipv6/ipv6_frag.c ../../../../../cyclone_tcp/ipv6/icmpv6.c ../../../../../cyclone_tcp/ipv6/mld.c ../../../../../cyclone_tcp/ipv6/ndp.c ../../../../../cyclone_tcp/ipv6/slaac.c ../../../../../cyclone_tcp/core/tcp.c ../../../../../cyclone_tcp/core/tcp_fsm.c ../../../../../cyclone_tcp/core/tcp_misc.c ../../../../../cyclone_tcp/core/tcp_timer.c ../../../../../cyclone_tcp/core/tcp_cc.c ../../../../../cyclone_tcp/core/tcp_cubic.c ../../../../../cyclone_tcp/core/tcp_syn_cookie.c ../../../../../cyclone_tcp/core/udp.c ../../../../../cyclone_tcp/core/socket.c ../../../../../cyclone_tcp/core/bsd_socket.c ../../../../../cyclone_tcp/core/raw_socket.c ../../../../../cyclone_tcp/core/ping.c ../../../../../cyclone_tcp/dns/dns_cache.c ../../../../../cyclone_tcp/dns/dns_client.c ../../../../../cyclone_tcp/dns/dns_common.c ../../../../../cyclone_tcp/dns/dns_debug.c ../../../../../cyclone_tcp/mdns/mdns_client.c ../../../../../cyclone_tcp/mdns/mdns_responder.c ../../../../../cyclone_tcp/mdns/mdns_common.c ../../../../../cyclone_tcp/dhcp/dhcp_client.c ../../../../../cyclone_tcp/dhcp/dhcp_common.c ../../../../../cyclone_tcp/dhcp/dhcp_debug.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_client.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_relay.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_common.c ../../../../../cyclone_tcp/dhcpv6/dhcpv6_debug.c ../../../../../cyclone_tcp/ftp/ftp_client.c ../../../../common/freertos/portable/mplabx/pic32mx/port.c ../../../../common/freertos/portable/mplabx/pic32mx/port_asm.S ../../../../common/freertos/croutine.c ../../../../common/freertos/list.c ../../../../common/freertos/queue.c ../../../../common/freertos/tasks.c ../../../../common/freertos/timers.c ../../../../common/freertos/portable/memmang/heap_3.c
 
 
 CFLAGS=
@@ -305,6 +305,24 @@ ${OBJECTDIR}/_ext/1079766828/tcp_timer.o: ../../../../../cyclone_tcp/core/tcp_ti
 	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_timer.o 
 	@${FIXDEPS} "${OBJECTDIR}/_ext/1079766828/tcp_timer.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PIC32MXSK=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_USB_STARTER_KIT_2 -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_usb_starter_kit_2" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1079766828/tcp_timer.o.d" -o ${OBJECTDIR}/_ext/1079766828/tcp_timer.o ../../../../../cyclone_tcp/core/tcp_timer.c   
 	
+${OBJECTDIR}/_ext/1079766828/tcp_cc.o: ../../../../../cyclone_tcp/core/tcp_cc.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1079766828 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_cc.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_cc.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1079766828/tcp_cc.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PIC32MXSK=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_USB_STARTER_KIT_2 -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_usb_starter_kit_2" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1079766828/tcp_cc.o.d" -o ${OBJECTDIR}/_ext/1079766828/tcp_cc.o ../../../../../cyclone_tcp/core/tcp_cc.c   
+	
+${OBJECTDIR}/_ext/1079766828/tcp_cubic.o: ../../../../../cyclone_tcp/core/tcp_cubic.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1079766828 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_cubic.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_cubic.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1079766828/tcp_cubic.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PIC32MXSK=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_USB_STARTER_KIT_2 -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_usb_starter_kit_2" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1079766828/tcp_cubic.o.d" -o ${OBJECTDIR}/_ext/1079766828/tcp_cubic.o ../../../../../cyclone_tcp/core/tcp_cubic.c   
+	
+${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o: ../../../../../cyclone_tcp/core/tcp_syn_cookie.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1079766828 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PIC32MXSK=1 -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_USB_STARTER_KIT_2 -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_usb_starter_kit_2" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o.d" -o ${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o ../../../../../cyclone_tcp/core/tcp_syn_cookie.c   
+	
 ${OBJECTDIR}/_ext/1079766828/udp.o: ../../../../../cyclone_tcp/core/udp.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} ${OBJECTDIR}/_ext/1079766828 
 	@${RM} ${OBJECTDIR}/_ext/1079766828/udp.o.d 
@@ -654,6 +672,24 @@ ${OBJECTDIR}/_ext/1079766828/tcp_timer.o: ../../../../../cyclone_tcp/core/tcp_ti
 	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_timer.o 
 	@${FIXDEPS} "${OBJECTDIR}/_ext/1079766828/tcp_timer.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_USB_STARTER_KIT_2 -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_usb_starter_kit_2" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1079766828/tcp_timer.o.d" -o ${OBJECTDIR}/_ext/1079766828/tcp_timer.o ../../../../../cyclone_tcp/core/tcp_timer.c   
 	
+${OBJECTDIR}/_ext/1079766828/tcp_cc.o: ../../../../../cyclone_tcp/core/tcp_cc.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1079766828 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_cc.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_cc.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1079766828/tcp_cc.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_USB_STARTER_KIT_2 -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_usb_starter_kit_2" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1079766828/tcp_cc.o.d" -o ${OBJECTDIR}/_ext/1079766828/tcp_cc.o ../../../../../cyclone_tcp/core/tcp_cc.c   
+	
+${OBJECTDIR}/_ext/1079766828/tcp_cubic.o: ../../../../../cyclone_tcp/core/tcp_cubic.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1079766828 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_cubic.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_cubic.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1079766828/tcp_cubic.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_USB_STARTER_KIT_2 -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_usb_starter_kit_2" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1079766828/tcp_cubic.o.d" -o ${OBJECTDIR}/_ext/1079766828/tcp_cubic.o ../../../../../cyclone_tcp/core/tcp_cubic.c   
+	
+${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o: ../../../../../cyclone_tcp/core/tcp_syn_cookie.c  nbproject/Makefile-${CND_CONF}.mk
+	@${MKDIR} ${OBJECTDIR}/_ext/1079766828 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o.d 
+	@${RM} ${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o 
+	@${FIXDEPS} "${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o.d" $(SILENT) -rsi ${MP_CC_DIR}../  -c ${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION) -DUSE_PIC32_USB_STARTER_KIT_2 -I"../src" -I"../../../../common/microchip/devices/pic32" -I"../../../../common/microchip/boards/common" -I"../../../../common/microchip/boards/pic32_usb_starter_kit_2" -I"../../../../common/freertos/include" -I"../../../../common/freertos/portable/mplabx/pic32mx" -I"../../../../../common" -I"../../../../../cyclone_tcp" -I"../../../../../cyclone_tcp/drivers" -I"../../../../../cyclone_tcp/core" -I"../../../../../cyclone_tcp/ipv4" -I"../../../../../cyclone_tcp/ipv6" -I"../../../../../cyclone_tcp/dns" -I"../../../../../cyclone_tcp/mdns" -I"../../../../../cyclone_tcp/dhcp" -I"../../../../../cyclone_tcp/dhcpv6" -I"../../../../../cyclone_tcp/ftp" -I"../../../../../cyclone_tcp/http" -I"../../../../../cyclone_tcp/smtp" -I"../../../../../cyclone_tcp/sntp" -I"../../../../../cyclone_tcp/icecast" -I"../../../../../cyclone_tcp/std_services" -I"../../../../../cyclone_crypto" -I"../../../../../cyclone_ssl" -MMD -MF "${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o.d" -o ${OBJECTDIR}/_ext/1079766828/tcp_syn_cookie.o ../../../../../cyclone_tcp/core/tcp_syn_cookie.c   
+	
 ${OBJECTDIR}/_ext/1079766828/udp.o: ../../../../../cyclone_tcp/core/udp.c  nbproject/Makefile-${CND_CONF}.mk
 	@${MKDIR} ${OBJECTDIR}/_ext/1079766828 
 	@${RM} ${OBJECTDIR}/_ext/1079766828/udp.o.d 
@@ -0,0 +1,45 @@
+/**
+ * @file crypto_config.h
+ * @brief CycloneCrypto configuration file (cryptographic benchmark)
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+#ifndef _CRYPTO_CONFIG_H
+#define _CRYPTO_CONFIG_H
+
+//Trace level for crypto library debugging
+#define CRYPTO_TRACE_LEVEL 0
+
+//AES-GCM
+#define AES_SUPPORT ENABLED
+#define GCM_SUPPORT ENABLED
+
+//ChaCha20-Poly1305
+#define CHACHA_SUPPORT ENABLED
+#define POLY1305_SUPPORT ENABLED
+#define CHACHA20_POLY1305_SUPPORT ENABLED
+
+//Count point doublings and additions
+#define EC_STATS_SUPPORT ENABLED
+
+#endif
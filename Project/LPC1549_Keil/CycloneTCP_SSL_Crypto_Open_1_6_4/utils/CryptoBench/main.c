@@ -0,0 +1,531 @@
+/**
+ * @file main.c
+ * @brief Throughput benchmark for the cryptographic primitives used by TLS
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * The GHASH function is measured with the table-driven multiplication
+ * of cipher_mode_gcm.c and with the bit-serial multiplication of the
+ * GCM specification (algorithm 1 of NIST SP 800-38D), which is kept
+ * here as a reference. Both must give the same result. The throughput
+ * of AES-GCM and ChaCha20-Poly1305 is then reported for TLS records of
+ * various sizes. Build the benchmark with -DGCM_TABLE_W=8 to measure the
+ * 8-bit table
+ *
+ * For each curve, variable-base scalar multiplications are performed with
+ * ecMult() and ecMultLadder(), and the average number of point doublings
+ * and additions is reported along with the time per multiplication. Both
+ * functions use the dedicated P-256 code on secp256r1. Build the benchmark
+ * with -DEC_WNAF_WIDTH=2 to measure the plain NAF method, or with
+ * -DEC_P256_SUPPORT=DISABLED to measure the generic code on P-256
+ *
+ * Build and run the benchmark on the host with:
+ * gcc -std=gnu99 -O2 -I. -I../../common -I../../cyclone_crypto main.c
+ *    ../../cyclone_crypto/aes.c ../../cyclone_crypto/cipher_mode_gcm.c
+ *    ../../cyclone_crypto/mpi.c ../../cyclone_crypto/ec.c
+ *    ../../cyclone_crypto/ec_curves.c ../../cyclone_crypto/ec_p256.c
+ *    ../../cyclone_crypto/oid.c ../../cyclone_crypto/chacha.c
+ *    ../../cyclone_crypto/poly1305.c ../../cyclone_crypto/chacha20_poly1305.c
+ *    ../../common/os_port_none.c ../../common/endian.c -o crypto_bench
+ * ./crypto_bench
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+//Dependencies
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "crypto.h"
+#include "aes.h"
+#include "cipher_mode_gcm.h"
+#include "chacha20_poly1305.h"
+#include "mpi.h"
+#include "ec.h"
+
+//Minimum duration of each measurement, in seconds
+#define BENCH_MIN_DURATION 0.5
+//Size of the data processed by the GHASH function
+#define BENCH_GHASH_SIZE 16384
+//Number of scalar multiplications for each curve
+#define BENCH_EC_MULT_COUNT 20
+
+//Data processed by the benchmark
+static uint8_t benchData[BENCH_GHASH_SIZE];
+
+
+/**
+ * @brief Get the current time
+ * @return Time in seconds
+ **/
+
+double benchGetTime(void)
+{
+   struct timespec ts;
+
+   //Read the monotonic clock
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   //Convert the time to seconds
+   return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+
+/**
+ * @brief Bit-serial multiplication in GF(2^128) (reference)
+ * @param[in,out] x First block
+ * @param[in] y Second block
+ **/
+
+void benchRefMul(uint8_t *x, const uint8_t *y)
+{
+   uint_t i;
+   uint_t j;
+   uint8_t z[16];
+   uint8_t v[16];
+
+   //Let Z(0) = 0
+   memset(z, 0, 16);
+   //Let V(0) = Y
+   memcpy(v, y, 16);
+
+   //Iterate 128 times
+   for(i = 0; i < 128; i++)
+   {
+      //Z(i+1) = Z(i) xor V(i) when bit i of X is set
+      if(x[i / 8] & (0x80 >> (i % 8)))
+         gcmXorBlock(z, z, v, 16);
+
+      //Shift V(i) to the right and reduce the result if necessary
+      if(v[15] & 0x01)
+      {
+         for(j = 15; j > 0; j--)
+            v[j] = (v[j] >> 1) | (v[j - 1] << 7);
+         v[0] = (v[0] >> 1) ^ 0xE1;
+      }
+      else
+      {
+         for(j = 15; j > 0; j--)
+            v[j] = (v[j] >> 1) | (v[j - 1] << 7);
+         v[0] = v[0] >> 1;
+      }
+   }
+
+   //Copy the resulting block
+   memcpy(x, z, 16);
+}
+
+
+/**
+ * @brief GHASH function, using the reference multiplication
+ * @param[in] h Hash subkey
+ * @param[out] s Resulting hash value
+ * @param[in] data Data to be processed (multiple of 16 bytes)
+ * @param[in] length Length of the data
+ **/
+
+void benchRefGhash(const uint8_t *h, uint8_t *s, const uint8_t *data, size_t length)
+{
+   size_t i;
+
+   //Process the data block by block
+   for(i = 0; i < length; i += 16)
+   {
+      gcmXorBlock(s, s, data + i, 16);
+      benchRefMul(s, h);
+   }
+}
+
+
+/**
+ * @brief GHASH function, using the precalculated table
+ * @param[in] context Pointer to the GCM context
+ * @param[out] s Resulting hash value
+ * @param[in] data Data to be processed (multiple of 16 bytes)
+ * @param[in] length Length of the data
+ **/
+
+void benchTableGhash(GcmContext *context, uint8_t *s, const uint8_t *data, size_t length)
+{
+   size_t i;
+
+   //Process the data block by block
+   for(i = 0; i < length; i += 16)
+   {
+      gcmXorBlock(s, s, data + i, 16);
+      gcmMul(context, s);
+   }
+}
+
+
+/**
+ * @brief Measure the GHASH function
+ * @param[in] context Pointer to the GCM context
+ * @param[in] h Hash subkey
+ * @return Error code
+ **/
+
+error_t benchGhash(GcmContext *context, const uint8_t *h)
+{
+   uint_t n;
+   double start;
+   double elapsed;
+   double refRate;
+   double tableRate;
+   uint8_t s1[16];
+   uint8_t s2[16];
+
+   //Both multiplications must give the same result
+   memset(s1, 0, 16);
+   memset(s2, 0, 16);
+   benchRefGhash(h, s1, benchData, BENCH_GHASH_SIZE);
+   benchTableGhash(context, s2, benchData, BENCH_GHASH_SIZE);
+
+   //Mismatch?
+   if(memcmp(s1, s2, 16))
+      return ERROR_FAILURE;
+
+   //Measure the reference multiplication
+   start = benchGetTime();
+   for(n = 0, elapsed = 0; elapsed < BENCH_MIN_DURATION; n++)
+   {
+      benchRefGhash(h, s1, benchData, BENCH_GHASH_SIZE);
+      elapsed = benchGetTime() - start;
+   }
+   refRate = n * BENCH_GHASH_SIZE / elapsed / 1e6;
+
+   //Measure the table-driven multiplication
+   start = benchGetTime();
+   for(n = 0, elapsed = 0; elapsed < BENCH_MIN_DURATION; n++)
+   {
+      benchTableGhash(context, s2, benchData, BENCH_GHASH_SIZE);
+      elapsed = benchGetTime() - start;
+   }
+   tableRate = n * BENCH_GHASH_SIZE / elapsed / 1e6;
+
+   printf("GHASH, bit-serial:          %8.1f MB/s\n", refRate);
+   printf("GHASH, %u-bit table:         %8.1f MB/s (x%.1f)\n",
+      GCM_TABLE_W, tableRate, tableRate / refRate);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Measure the encryption of TLS records with AES-GCM
+ * @param[in] context Pointer to the GCM context
+ * @param[in] name Name of the cipher
+ * @param[in] length Length of the records
+ **/
+
+void benchGcm(GcmContext *context, const char_t *name, size_t length)
+{
+   uint_t n;
+   double start;
+   double elapsed;
+   uint8_t iv[12];
+   uint8_t aad[13];
+   uint8_t tag[16];
+
+   //Nonce and additional data of the records
+   memset(iv, 0, sizeof(iv));
+   memset(aad, 0, sizeof(aad));
+
+   //Encrypt records in place
+   start = benchGetTime();
+   for(n = 0, elapsed = 0; elapsed < BENCH_MIN_DURATION; n++)
+   {
+      gcmEncrypt(context, iv, sizeof(iv), aad, sizeof(aad),
+         benchData, benchData, length, tag, sizeof(tag));
+      elapsed = benchGetTime() - start;
+   }
+
+   printf("%-17s %5u-byte records: %8.1f MB/s\n",
+      name, (uint_t) length, n * length / elapsed / 1e6);
+}
+
+
+/**
+ * @brief Measure the encryption of TLS records with ChaCha20-Poly1305
+ * @param[in] key 256-bit key
+ * @param[in] length Length of the records
+ * @return Error code
+ **/
+
+error_t benchChaCha20Poly1305(const uint8_t *key, size_t length)
+{
+   uint_t n;
+   error_t error;
+   double start;
+   double elapsed;
+   uint8_t nonce[12];
+   uint8_t aad[13];
+   uint8_t tag[16];
+
+   //Nonce and additional data of the records
+   memset(nonce, 0, sizeof(nonce));
+   memset(aad, 0, sizeof(aad));
+
+   //Encrypt records in place
+   start = benchGetTime();
+   for(n = 0, elapsed = 0; elapsed < BENCH_MIN_DURATION; n++)
+   {
+      error = chacha20Poly1305Encrypt(key, 32, nonce, sizeof(nonce), aad,
+         sizeof(aad), benchData, benchData, length, tag, sizeof(tag));
+      //Any error to report?
+      if(error)
+         return error;
+
+      elapsed = benchGetTime() - start;
+   }
+
+   printf("%-17s %5u-byte records: %8.1f MB/s\n", "ChaCha20-Poly1305",
+      (uint_t) length, n * length / elapsed / 1e6);
+
+   //The last record must decrypt back to the previous plaintext
+   error = chacha20Poly1305Decrypt(key, 32, nonce, sizeof(nonce), aad,
+      sizeof(aad), benchData, benchData, length, tag, sizeof(tag));
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Measure a scalar multiplication method
+ * @param[in] params EC domain parameters
+ * @param[in] curveName Name of the curve
+ * @param[in] name Name of the method
+ * @param[in] mult Scalar multiplication function
+ * @param[out] r Resulting points
+ * @param[in] d Scalars
+ * @param[in] s Points to be multiplied
+ * @return Error code
+ **/
+
+error_t benchEcMult(const EcDomainParameters *params, const char_t *curveName, const char_t *name,
+   error_t (*mult)(const EcDomainParameters *, EcPoint *, const Mpi *, const EcPoint *),
+   EcPoint *r, const Mpi *d, const EcPoint *s)
+{
+   uint_t i;
+   error_t error;
+   double start;
+   double elapsed;
+
+   //Reset statistics
+   memset(&ecStats, 0, sizeof(ecStats));
+
+   //Start of the measurement
+   start = benchGetTime();
+
+   //Perform scalar multiplications
+   for(i = 0; i < BENCH_EC_MULT_COUNT; i++)
+   {
+      error = mult(params, &r[i], &d[i], &s[i]);
+      //Any error to report?
+      if(error)
+         return error;
+   }
+
+   //Elapsed time, in seconds
+   elapsed = benchGetTime() - start;
+
+   printf("%-16s %-7s %6.1f dbl %6.1f add %8.2f ms\n", curveName, name,
+      (double) ecStats.doubleCount / BENCH_EC_MULT_COUNT,
+      (double) ecStats.addCount / BENCH_EC_MULT_COUNT,
+      elapsed * 1000 / BENCH_EC_MULT_COUNT);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Measure variable-base scalar multiplication on a given curve
+ * @param[in] curveInfo Elliptic curve parameters
+ * @return Error code
+ **/
+
+error_t benchEc(const EcCurveInfo *curveInfo)
+{
+   uint_t i;
+   size_t n;
+   error_t error;
+   uint8_t buffer[66];
+   EcDomainParameters params;
+   Mpi d[BENCH_EC_MULT_COUNT];
+   EcPoint s[BENCH_EC_MULT_COUNT];
+   EcPoint r1[BENCH_EC_MULT_COUNT];
+   EcPoint r2[BENCH_EC_MULT_COUNT];
+
+   //Initialize EC domain parameters
+   ecInitDomainParameters(&params);
+
+   //Initialize scalars and points
+   for(i = 0; i < BENCH_EC_MULT_COUNT; i++)
+   {
+      mpiInit(&d[i]);
+      ecInit(&s[i]);
+      ecInit(&r1[i]);
+      ecInit(&r2[i]);
+   }
+
+   //Load EC domain parameters
+   error = ecLoadDomainParameters(&params, curveInfo);
+
+   //Generate random scalars and points
+   for(i = 0; i < BENCH_EC_MULT_COUNT && !error; i++)
+   {
+      //Random scalar in the range 0 < d < q
+      for(n = 0; n < mpiGetByteLength(&params.q); n++)
+         buffer[n] = rand();
+
+      error = mpiReadRaw(&d[i], buffer, n);
+      if(!error)
+         error = mpiMod(&d[i], &d[i], &params.q);
+
+      //Variable point S = d.G, in affine coordinates
+      if(!error)
+         error = ecMultBase(&params, &s[i], &d[i]);
+      if(!error)
+         error = ecAffinify(&params, &s[i], &s[i]);
+   }
+
+   //Measure the wNAF method
+   if(!error)
+      error = benchEcMult(&params, curveInfo->name, "wNAF", ecMult, r1, d, s);
+   //Measure the Montgomery ladder
+   if(!error)
+      error = benchEcMult(&params, curveInfo->name, "ladder", ecMultLadder, r2, d, s);
+
+   //Both methods must give the same result
+   for(i = 0; i < BENCH_EC_MULT_COUNT && !error; i++)
+   {
+      error = ecAffinify(&params, &r1[i], &r1[i]);
+      if(!error)
+         error = ecAffinify(&params, &r2[i], &r2[i]);
+
+      //Mismatch?
+      if(!error && (mpiComp(&r1[i].x, &r2[i].x) || mpiComp(&r1[i].y, &r2[i].y)))
+         error = ERROR_FAILURE;
+   }
+
+   //Release previously allocated resources
+   for(i = 0; i < BENCH_EC_MULT_COUNT; i++)
+   {
+      mpiFree(&d[i]);
+      ecFree(&s[i]);
+      ecFree(&r1[i]);
+      ecFree(&r2[i]);
+   }
+
+   ecFreeDomainParameters(&params);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Main entry point
+ * @return Unix style status code
+ **/
+
+int_t main(void)
+{
+   uint_t i;
+   error_t error;
+   uint8_t key[32];
+   uint8_t h[16];
+   AesContext aesContext;
+   AesContext aes256Context;
+   GcmContext gcmContext;
+   GcmContext gcm256Context;
+
+   //Size of the records
+   static const size_t length[] = {64, 512, 1460, 16384};
+
+   //Curves to be measured
+   static const EcCurveInfo *curveInfo[] =
+   {
+      SECP256R1_CURVE,
+      SECP384R1_CURVE,
+      SECP521R1_CURVE,
+      BRAINPOOLP256R1_CURVE
+   };
+
+   //Arbitrary key and data
+   for(i = 0; i < sizeof(key); i++)
+      key[i] = i;
+   for(i = 0; i < BENCH_GHASH_SIZE; i++)
+      benchData[i] = i * 7;
+
+   //Initialize AES and GCM contexts (128-bit and 256-bit keys)
+   aesInit(&aesContext, key, 16);
+   gcmInit(&gcmContext, AES_CIPHER_ALGO, &aesContext);
+   aesInit(&aes256Context, key, 32);
+   gcmInit(&gcm256Context, AES_CIPHER_ALGO, &aes256Context);
+
+   //Compute the hash subkey H = CIPH(0) for the reference multiplication
+   memset(h, 0, 16);
+   aesEncryptBlock(&aesContext, h, h);
+
+   //Measure the GHASH function
+   error = benchGhash(&gcmContext, h);
+   //Any error to report?
+   if(error)
+   {
+      printf("GHASH mismatch between the bit-serial and table-driven multiplications\n");
+      return EXIT_FAILURE;
+   }
+
+   //Compare AES-GCM and ChaCha20-Poly1305 for each record size
+   for(i = 0; i < arraysize(length); i++)
+   {
+      benchGcm(&gcmContext, "AES-128-GCM", length[i]);
+      benchGcm(&gcm256Context, "AES-256-GCM", length[i]);
+
+      error = benchChaCha20Poly1305(key, length[i]);
+      //Any error to report?
+      if(error)
+      {
+         printf("ChaCha20-Poly1305 authentication failed\n");
+         return EXIT_FAILURE;
+      }
+   }
+
+   //Measure scalar multiplication on each curve
+   for(i = 0; i < arraysize(curveInfo); i++)
+   {
+      error = benchEc(curveInfo[i]);
+      //Any error to report?
+      if(error)
+      {
+         printf("Scalar multiplication failed on %s\n", curveInfo[i]->name);
+         return EXIT_FAILURE;
+      }
+   }
+
+   //Successful processing
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,431 @@
+/**
+ * @file main.c
+ * @brief Packet rate benchmark for the demultiplexing of incoming TCP segments
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * An increasing number of connections is established with a listening
+ * socket. Pure ACK segments are then fed to tcpProcessSegment(), in turn
+ * for each connection, and the number of segments processed per second
+ * is reported. The socket and TCP layers are linked as-is, while the IP
+ * layer is replaced by a few stub functions. The hash-based lookup is
+ * compared with the linear scan of the socket table by building the
+ * benchmark twice
+ *
+ * Build and run the benchmark on the host with:
+ * gcc -std=gnu99 -O2 -I. -I../../common -I../../cyclone_tcp main.c
+ *    ../../cyclone_tcp/core/socket.c ../../cyclone_tcp/core/tcp.c
+ *    ../../cyclone_tcp/core/tcp_fsm.c ../../cyclone_tcp/core/tcp_misc.c
+ *    ../../cyclone_tcp/core/tcp_timer.c ../../cyclone_tcp/core/tcp_syn_cookie.c
+ *    ../../cyclone_tcp/core/tcp_cc.c ../../cyclone_tcp/core/tcp_cubic.c
+ *    ../../cyclone_tcp/core/net_mem.c ../../common/os_port_none.c
+ *    ../../common/endian.c ../../common/date_time.c -o socket_demux_bench
+ * ./socket_demux_bench
+ *
+ * Add -DSOCKET_HASH_SUPPORT=DISABLED to measure the linear scan
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+//Dependencies
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "core/net.h"
+#include "core/socket.h"
+#include "core/tcp.h"
+#include "core/tcp_fsm.h"
+
+//Address of the host under test
+#define BENCH_SERVER_ADDR IPV4_ADDR(192, 168, 0, 1)
+//Address of the simulated peers
+#define BENCH_CLIENT_ADDR IPV4_ADDR(192, 168, 0, 2)
+//Port of the listening socket
+#define BENCH_SERVER_PORT 80
+//First port used by the simulated peers
+#define BENCH_CLIENT_PORT 10000
+
+//Number of segments processed for each measurement
+#define BENCH_SEGMENT_COUNT 1000000
+
+
+/**
+ * @brief Connection with a simulated peer
+ **/
+
+typedef struct
+{
+   Socket *socket;      ///<Connected socket
+   NetBuffer *buffer;   ///<Pure ACK segment sent by the peer
+} BenchConnection;
+
+
+//Address matching any interface
+const IpAddr IP_ADDR_ANY = {0};
+
+//Underlying network interface
+static NetInterface benchInterface;
+//Sequence number of the last segment sent by the host under test
+static uint32_t benchLastSeqNum;
+
+//Connections with the simulated peers
+static BenchConnection benchConnection[SOCKET_MAX_COUNT];
+static uint_t benchConnectionCount;
+
+
+/**
+ * @brief Get a random value (IP layer stub)
+ * @return Random value
+ **/
+
+uint32_t netGetRand(void)
+{
+   return (uint32_t) rand() * 65599 + rand();
+}
+
+
+/**
+ * @brief Get default network interface (stub)
+ * @return Pointer to the default network interface to be used
+ **/
+
+NetInterface *netGetDefaultInterface(void)
+{
+   return &benchInterface;
+}
+
+
+/**
+ * @brief Select the source address of an outgoing packet (IP layer stub)
+ * @param[in,out] interface Network interface to be used
+ * @param[in] destAddr Destination IP address
+ * @param[out] srcAddr Local IP address to be used
+ * @return Error code
+ **/
+
+error_t ipSelectSourceAddr(NetInterface **interface,
+   const IpAddr *destAddr, IpAddr *srcAddr)
+{
+   //Use the address of the host under test
+   *interface = &benchInterface;
+   srcAddr->length = sizeof(Ipv4Addr);
+   srcAddr->ipv4Addr = BENCH_SERVER_ADDR;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Compare an IP address against the unspecified address (IP layer stub)
+ * @param[in] ipAddr IP address
+ * @return TRUE if the IP address is unspecified, else FALSE
+ **/
+
+bool_t ipIsUnspecifiedAddr(const IpAddr *ipAddr)
+{
+   return (ipAddr->length == 0 || ipAddr->ipv4Addr == IPV4_UNSPECIFIED_ADDR) ? TRUE : FALSE;
+}
+
+
+/**
+ * @brief Convert a string representation of an IP address (IP layer stub)
+ * @return Error code
+ **/
+
+error_t ipStringToAddr(const char_t *str, IpAddr *ipAddr)
+{
+   //Host names are not used by the benchmark
+   return ERROR_INVALID_ADDRESS;
+}
+
+
+/**
+ * @brief Allocate a buffer to hold an IP packet (IP layer stub)
+ * @param[in] length Desired payload length
+ * @param[out] offset Offset to the first byte of the payload
+ * @return The function returns a pointer to the newly allocated
+ *   buffer. If the system is out of resources, NULL is returned
+ **/
+
+NetBuffer *ipAllocBuffer(size_t length, size_t *offset)
+{
+   //No room is reserved for the IP header
+   *offset = 0;
+   //Allocate a memory buffer
+   return netBufferAlloc(length);
+}
+
+
+/**
+ * @brief Calculate checksum over an upper-layer packet (IP layer stub)
+ *
+ * Incoming segments are always considered as valid, so that only the
+ * processing of the TCP layer is measured
+ *
+ * @return Checksum value
+ **/
+
+uint16_t ipCalcUpperLayerChecksumEx(const void *pseudoHeader,
+   size_t pseudoHeaderLength, const NetBuffer *buffer, size_t offset, size_t length)
+{
+   return 0xFFFF;
+}
+
+
+/**
+ * @brief Send an IP datagram (IP layer stub)
+ *
+ * Only the sequence number of the segment is kept, so that the handshake
+ * can be completed
+ *
+ * @return Error code
+ **/
+
+error_t ipSendDatagram(NetInterface *interface, IpPseudoHeader *pseudoHeader,
+   NetBuffer *buffer, size_t offset, uint8_t timeToLive)
+{
+   TcpHeader *header;
+
+   //Point to the TCP header
+   header = netBufferAt(buffer, offset);
+   //Save the sequence number
+   benchLastSeqNum = ntohl(header->seqNum);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Format a segment sent by a simulated peer
+ * @param[in] srcPort Port of the peer
+ * @param[in] flags TCP flags
+ * @param[in] seqNum Sequence number
+ * @param[in] ackNum Acknowledgment number
+ * @return Buffer holding the segment
+ **/
+
+NetBuffer *benchFormatSegment(uint16_t srcPort, uint8_t flags,
+   uint32_t seqNum, uint32_t ackNum)
+{
+   NetBuffer *buffer;
+   TcpHeader *header;
+
+   //Allocate a buffer to hold the segment
+   buffer = netBufferAlloc(sizeof(TcpHeader));
+   //Failed to allocate memory?
+   if(buffer == NULL)
+      return NULL;
+
+   //Point to the TCP header
+   header = netBufferAt(buffer, 0);
+
+   //Format TCP header
+   memset(header, 0, sizeof(TcpHeader));
+   header->srcPort = htons(srcPort);
+   header->destPort = htons(BENCH_SERVER_PORT);
+   header->seqNum = htonl(seqNum);
+   header->ackNum = htonl(ackNum);
+   header->dataOffset = 5;
+   header->flags = flags;
+   header->window = htons(8192);
+
+   //Return the segment
+   return buffer;
+}
+
+
+/**
+ * @brief Pass a segment to the TCP layer
+ * @param[in] buffer Buffer holding the segment
+ **/
+
+void benchInject(const NetBuffer *buffer)
+{
+   IpPseudoHeader pseudoHeader;
+
+   //Format IPv4 pseudo header
+   pseudoHeader.length = sizeof(Ipv4PseudoHeader);
+   pseudoHeader.ipv4Data.srcAddr = BENCH_CLIENT_ADDR;
+   pseudoHeader.ipv4Data.destAddr = BENCH_SERVER_ADDR;
+   pseudoHeader.ipv4Data.reserved = 0;
+   pseudoHeader.ipv4Data.protocol = IPV4_PROTOCOL_TCP;
+   pseudoHeader.ipv4Data.length = htons(sizeof(TcpHeader));
+
+   //Process the segment
+   tcpProcessSegment(&benchInterface, &pseudoHeader, buffer, 0);
+}
+
+
+/**
+ * @brief Establish a new connection with a simulated peer
+ * @param[in] listener Handle referencing the listening socket
+ * @return Error code
+ **/
+
+error_t benchConnect(Socket *listener)
+{
+   uint16_t srcPort;
+   uint32_t isn;
+   uint32_t iss;
+   NetBuffer *buffer;
+   Socket *socket;
+
+   //Each peer uses its own port
+   srcPort = BENCH_CLIENT_PORT + benchConnectionCount;
+   isn = netGetRand();
+
+   //The peer sends a SYN
+   buffer = benchFormatSegment(srcPort, TCP_FLAG_SYN, isn, 0);
+   if(buffer == NULL)
+      return ERROR_OUT_OF_MEMORY;
+
+   benchInject(buffer);
+   netBufferFree(buffer);
+
+   //Accept the connection, which sends the SYN-ACK
+   socket = socketAccept(listener, NULL, NULL);
+   if(socket == NULL)
+      return ERROR_OUT_OF_RESOURCES;
+
+   //Initial sequence number of the host under test
+   iss = benchLastSeqNum;
+
+   //The same pure ACK completes the handshake, and is then used to
+   //measure the processing of the segments of an established connection
+   buffer = benchFormatSegment(srcPort, TCP_FLAG_ACK, isn + 1, iss + 1);
+   if(buffer == NULL)
+      return ERROR_OUT_OF_MEMORY;
+
+   benchInject(buffer);
+
+   //The connection must now be established
+   if(socket->state != TCP_STATE_ESTABLISHED)
+      return ERROR_FAILURE;
+
+   //Save the connection
+   benchConnection[benchConnectionCount].socket = socket;
+   benchConnection[benchConnectionCount].buffer = buffer;
+   benchConnectionCount++;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Measure the packet rate
+ * @return Number of segments processed per second
+ **/
+
+double benchMeasure(void)
+{
+   uint_t i;
+   uint_t j;
+   double elapsed;
+   struct timespec start;
+   struct timespec end;
+
+   //Start of the measurement
+   clock_gettime(CLOCK_MONOTONIC, &start);
+
+   //The connections receive a segment in turn
+   for(i = 0, j = 0; i < BENCH_SEGMENT_COUNT; i++)
+   {
+      //Process a pure ACK
+      benchInject(benchConnection[j].buffer);
+
+      //Next connection
+      if(++j >= benchConnectionCount)
+         j = 0;
+   }
+
+   //End of the measurement
+   clock_gettime(CLOCK_MONOTONIC, &end);
+
+   //Elapsed time, in seconds
+   elapsed = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+
+   //Return the packet rate
+   return BENCH_SEGMENT_COUNT / elapsed;
+}
+
+
+/**
+ * @brief Main entry point
+ * @return Unix style status code
+ **/
+
+int_t main(void)
+{
+   uint_t i;
+   error_t error;
+   double rate;
+   Socket *listener;
+
+   //Number of connections for each measurement
+   static const uint_t count[] = {1, 4, 16, 64, SOCKET_MAX_COUNT - 1};
+
+   //Initialize the socket and TCP layers
+   socketInit();
+   tcpInit();
+
+   //Open a listening socket
+   listener = socketOpen(SOCKET_TYPE_STREAM, SOCKET_IP_PROTO_TCP);
+   socketSetTimeout(listener, 0);
+   socketBind(listener, &IP_ADDR_ANY, BENCH_SERVER_PORT);
+   socketListen(listener, 1);
+
+   printf("SOCKET_MAX_COUNT = %u, SOCKET_HASH_SUPPORT = %s\n", SOCKET_MAX_COUNT,
+      (SOCKET_HASH_SUPPORT == ENABLED) ? "ENABLED" : "DISABLED");
+
+   //Loop through the measurements
+   for(i = 0; i < arraysize(count); i++)
+   {
+      //The listening socket uses one entry of the socket table
+      if(count[i] >= SOCKET_MAX_COUNT)
+         break;
+
+      //Establish the additional connections
+      while(benchConnectionCount < count[i])
+      {
+         error = benchConnect(listener);
+         //Any error to report?
+         if(error)
+         {
+            printf("Failed to establish connection %u\n", benchConnectionCount + 1);
+            return EXIT_FAILURE;
+         }
+      }
+
+      //Measure the packet rate
+      rate = benchMeasure();
+
+      printf("%4u connections: %6.2f Mpps, %6.1f ns per segment\n",
+         benchConnectionCount, rate / 1e6, 1e9 / rate);
+   }
+
+   //Successful processing
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,57 @@
+/**
+ * @file net_config.h
+ * @brief CycloneTCP configuration file (socket demultiplexing benchmark)
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+#ifndef _NET_CONFIG_H
+#define _NET_CONFIG_H
+
+//Trace level for TCP/IP stack debugging
+#define MEM_TRACE_LEVEL 0
+#define TCP_TRACE_LEVEL 0
+#define SOCKET_TRACE_LEVEL 0
+
+//Number of network adapters
+#define NET_INTERFACE_COUNT 1
+
+//Only the TCP layer is exercised
+#define IPV6_SUPPORT DISABLED
+#define UDP_SUPPORT DISABLED
+#define RAW_SOCKET_SUPPORT DISABLED
+#define DNS_CLIENT_SUPPORT DISABLED
+#define MDNS_CLIENT_SUPPORT DISABLED
+#define NBNS_CLIENT_SUPPORT DISABLED
+
+//Number of sockets that can be opened simultaneously
+#ifndef SOCKET_MAX_COUNT
+   #define SOCKET_MAX_COUNT 256
+#endif
+
+//Hash-based socket lookup (build with -DSOCKET_HASH_SUPPORT=DISABLED
+//to measure the linear scan of the socket table)
+#ifndef SOCKET_HASH_SUPPORT
+   #define SOCKET_HASH_SUPPORT ENABLED
+#endif
+
+#endif
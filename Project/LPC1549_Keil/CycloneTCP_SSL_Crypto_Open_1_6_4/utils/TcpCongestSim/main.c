@@ -0,0 +1,673 @@
+/**
+ * @file main.c
+ * @brief Lossy-link goodput simulator for the TCP congestion control algorithms
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * A single bulk transfer runs over a bottleneck link with a drop-tail
+ * queue and random segment loss. The congestion control callbacks of
+ * tcp_cc.c and tcp_cubic.c are linked as-is and driven the same way as
+ * in tcp_misc.c and tcp_timer.c (fast retransmit, RFC 6582 fast recovery
+ * and retransmission timeout). The goodput of NewReno and CUBIC is then
+ * reported for a range of loss rates. SACK is not modelled, so several
+ * losses in the same window are repaired at a rate of one per round-trip,
+ * as with a peer that does not support SACK
+ *
+ * Build the simulator on the host with:
+ * gcc -std=gnu99 -O2 -I. -I../../common -I../../cyclone_tcp main.c
+ *    ../../cyclone_tcp/core/tcp_cc.c ../../cyclone_tcp/core/tcp_cubic.c
+ *    -o tcp_congest_sim
+ *
+ * Usage: tcp_congest_sim [rate_kbps] [rtt_ms] [duration_s]
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+//Dependencies
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "core/net.h"
+#include "core/socket.h"
+#include "core/tcp.h"
+#include "core/tcp_cc.h"
+#include "core/tcp_cubic.h"
+
+//Maximum segment size
+#define SIM_MSS 1460
+//Size of the send buffer
+#define SIM_TX_BUFFER_SIZE (1024 * 1024)
+//Number of runs averaged for each loss rate
+#define SIM_RUN_COUNT 5
+
+
+/**
+ * @brief Packet travelling through the simulated network
+ **/
+
+typedef struct
+{
+   uint32_t seg;  ///<Segment index (data) or cumulative ACK (acknowledgment)
+   uint32_t time; ///<Time at which the packet leaves the current stage
+} SimPacket;
+
+
+/**
+ * @brief FIFO of packets
+ **/
+
+typedef struct
+{
+   SimPacket *items;
+   uint32_t size;
+   uint32_t head;
+   uint32_t count;
+} SimFifo;
+
+
+/**
+ * @brief Simulation parameters
+ **/
+
+typedef struct
+{
+   uint32_t rate;      ///<Bottleneck rate, in bytes per millisecond
+   uint32_t rtt;       ///<Base round-trip time, in milliseconds
+   uint32_t queueSize; ///<Size of the bottleneck queue, in segments
+   uint32_t lossRate;  ///<Random loss probability, in parts per million
+   uint32_t duration;  ///<Duration of the transfer, in milliseconds
+   uint32_t seed;      ///<Seed of the pseudo-random generator
+} SimParams;
+
+
+/**
+ * @brief Simulation context
+ **/
+
+typedef struct
+{
+   const SimParams *params;
+   Socket socket;          ///<Sender state seen by the congestion control algorithm
+   uint32_t una;           ///<First unacknowledged segment
+   uint32_t nxt;           ///<Next segment to be sent
+   uint32_t maxSeg;        ///<Number of segments that can be tracked
+   uint_t dupAckCount;     ///<Number of consecutive duplicate ACKs
+   bool_t lossRecovery;    ///<Fast recovery in progress
+   uint32_t recoveryPoint; ///<End of the current recovery episode
+   uint32_t srtt;          ///<Smoothed RTT (fixed point)
+   uint32_t rttvar;        ///<RTT variation (fixed point)
+   uint32_t rto;           ///<Retransmission timeout, in milliseconds
+   uint32_t rtoExpiry;     ///<Time at which the retransmission timer fires
+   uint_t retransmitCount; ///<Number of consecutive timeouts
+   uint32_t *sendTime;     ///<Time at which each segment was first sent
+   uint8_t *retransmitted; ///<Segments sent more than once (Karn's algorithm)
+   uint8_t *received;      ///<Segments received by the peer
+   uint32_t rcvNxt;        ///<Next segment expected by the peer
+   uint32_t credit;        ///<Transmission credit of the bottleneck, in bytes
+   SimFifo queue;          ///<Bottleneck queue
+   SimFifo dataPipe;       ///<Segments propagating towards the peer
+   SimFifo ackPipe;        ///<ACKs propagating towards the sender
+   uint32_t random;        ///<State of the pseudo-random generator
+} SimContext;
+
+
+//Simulated system time
+static systime_t simTime;
+
+
+/**
+ * @brief Retrieve the simulated system time
+ * @return Number of milliseconds elapsed since the beginning of the run
+ **/
+
+systime_t osGetSystemTime(void)
+{
+   return simTime;
+}
+
+
+/**
+ * @brief Pseudo-random number generator
+ * @param[in] context Pointer to the simulation context
+ * @return Random value in the range 0 to 999999
+ **/
+
+uint32_t simRand(SimContext *context)
+{
+   //Linear congruential generator
+   context->random = context->random * 1103515245 + 12345;
+   //Use the most significant bits
+   return (context->random >> 8) % 1000000;
+}
+
+
+/**
+ * @brief Allocate a FIFO
+ * @param[out] fifo Pointer to the FIFO
+ * @param[in] size Maximum number of packets
+ **/
+
+void simFifoInit(SimFifo *fifo, uint32_t size)
+{
+   fifo->items = malloc(size * sizeof(SimPacket));
+   fifo->size = size;
+   fifo->head = 0;
+   fifo->count = 0;
+
+   //Check status
+   if(fifo->items == NULL)
+   {
+      fprintf(stderr, "Out of memory!\n");
+      exit(1);
+   }
+}
+
+
+/**
+ * @brief Append a packet to a FIFO
+ * @param[in] fifo Pointer to the FIFO
+ * @param[in] seg Segment index or cumulative ACK
+ * @param[in] time Time at which the packet leaves the FIFO
+ **/
+
+void simFifoPush(SimFifo *fifo, uint32_t seg, uint32_t time)
+{
+   SimPacket *packet;
+
+   //The FIFOs are sized for the worst case
+   if(fifo->count >= fifo->size)
+   {
+      fprintf(stderr, "FIFO overflow!\n");
+      exit(1);
+   }
+
+   //Point to the tail of the FIFO
+   packet = &fifo->items[(fifo->head + fifo->count) % fifo->size];
+   packet->seg = seg;
+   packet->time = time;
+
+   //Update the number of packets
+   fifo->count++;
+}
+
+
+/**
+ * @brief Remove the packet at the head of a FIFO
+ * @param[in] fifo Pointer to the FIFO
+ * @return Segment index or cumulative ACK
+ **/
+
+uint32_t simFifoPop(SimFifo *fifo)
+{
+   uint32_t seg;
+
+   //Retrieve the packet at the head of the FIFO
+   seg = fifo->items[fifo->head].seg;
+
+   //Remove it from the FIFO
+   fifo->head = (fifo->head + 1) % fifo->size;
+   fifo->count--;
+
+   //Return the segment index or the cumulative ACK
+   return seg;
+}
+
+
+/**
+ * @brief Check whether the packet at the head of a FIFO is due
+ * @param[in] fifo Pointer to the FIFO
+ * @param[in] time Current time
+ * @return TRUE if a packet leaves the FIFO, else FALSE
+ **/
+
+bool_t simFifoReady(const SimFifo *fifo, uint32_t time)
+{
+   return (fifo->count > 0 && fifo->items[fifo->head].time <= time);
+}
+
+
+/**
+ * @brief Hand a segment over to the bottleneck link
+ * @param[in] context Pointer to the simulation context
+ * @param[in] seg Segment index
+ **/
+
+void simSendSegment(SimContext *context, uint32_t seg)
+{
+   //First transmission of the segment?
+   if(seg >= context->nxt && !context->sendTime[seg])
+      context->sendTime[seg] = simTime + 1;
+   else
+      context->retransmitted[seg] = TRUE;
+
+   //Random loss?
+   if(simRand(context) < context->params->lossRate)
+      return;
+
+   //Drop-tail queue full?
+   if(context->queue.count >= context->params->queueSize)
+      return;
+
+   //Enqueue the segment
+   simFifoPush(&context->queue, seg, simTime);
+}
+
+
+/**
+ * @brief Update the RTO estimate with a new RTT sample (RFC 6298)
+ * @param[in] context Pointer to the simulation context
+ * @param[in] r RTT sample, in milliseconds
+ **/
+
+void simUpdateRto(SimContext *context, uint32_t r)
+{
+   int32_t delta;
+
+   //First measurement?
+   if(!context->srtt)
+   {
+      context->srtt = r << TCP_RTT_FRAC_BITS;
+      context->rttvar = (r << TCP_RTT_FRAC_BITS) / 2;
+   }
+   else
+   {
+      //RTTVAR = 3/4 * RTTVAR + 1/4 * |SRTT - R'|
+      delta = (int32_t) (r << TCP_RTT_FRAC_BITS) - (int32_t) context->srtt;
+      context->rttvar = (3 * context->rttvar + (uint32_t) abs(delta)) / 4;
+      //SRTT = 7/8 * SRTT + 1/8 * R'
+      context->srtt = (7 * context->srtt + (r << TCP_RTT_FRAC_BITS)) / 8;
+   }
+
+   //RTO = SRTT + 4 * RTTVAR
+   context->rto = (context->srtt + 4 * context->rttvar) >> TCP_RTT_FRAC_BITS;
+   context->rto = MAX(context->rto, TCP_MIN_RTO);
+   context->rto = MIN(context->rto, TCP_MAX_RTO);
+
+   //The congestion control algorithm sees the smoothed RTT
+   context->socket.srtt = context->srtt;
+}
+
+
+/**
+ * @brief Process an incoming ACK (see tcpProcessSegment)
+ * @param[in] context Pointer to the simulation context
+ * @param[in] ack Cumulative ACK, expressed as a segment index
+ **/
+
+void simProcessAck(SimContext *context, uint32_t ack)
+{
+   uint32_t n;
+   Socket *socket;
+
+   //Point to the sender state
+   socket = &context->socket;
+
+   //The incoming ACK acknowledges new data?
+   if(ack > context->una)
+   {
+      //Compute the number of bytes acknowledged by the incoming ACK
+      n = (ack - context->una) * SIM_MSS;
+
+      //The congestion window is not increased during fast recovery
+      if(!context->lossRecovery)
+      {
+         socket->congestAlgo->onAck(socket, n);
+         socket->cwnd = MIN(socket->cwnd, socket->txBufferSize);
+      }
+
+      //Take an RTT sample, unless the segment was retransmitted
+      if(!context->retransmitted[ack - 1])
+         simUpdateRto(context, simTime - (context->sendTime[ack - 1] - 1));
+
+      //Update SND.UNA pointer
+      context->una = ack;
+      socket->sndUna = ack * SIM_MSS;
+
+      //After a timeout, the peer may acknowledge data beyond SND.NXT
+      if(context->nxt < ack)
+      {
+         context->nxt = ack;
+         socket->sndNxt = ack * SIM_MSS;
+      }
+
+      //Restart the retransmission timer
+      context->retransmitCount = 0;
+      context->rtoExpiry = simTime + context->rto;
+      context->dupAckCount = 0;
+
+      //Loss recovery terminates once all the data outstanding
+      //when it started has been acknowledged
+      if(ack >= context->recoveryPoint)
+      {
+         //Fast recovery in progress?
+         if(context->lossRecovery)
+         {
+            //Deflate the congestion window (refer to RFC 6582 3.2 step 3)
+            socket->cwnd = MAX(socket->sndNxt - socket->sndUna, socket->mss) + socket->mss;
+            socket->cwnd = MIN(socket->cwnd, socket->ssthresh);
+            //Notify the congestion control algorithm
+            socket->congestAlgo->cwndEvent(socket, TCP_CONGEST_EVENT_RECOVERY_END);
+            //Leave fast recovery
+            context->lossRecovery = FALSE;
+         }
+      }
+      //Fast recovery in progress?
+      else if(context->lossRecovery)
+      {
+         //A partial ACK indicates that the first unacknowledged segment
+         //was lost as well (refer to RFC 6582 3.2 step 5)
+         simSendSegment(context, context->una);
+
+         //Deflate the congestion window by the amount of new data
+         //acknowledged, then add back one SMSS
+         socket->cwnd = (socket->cwnd > n) ? (socket->cwnd - n) : 0;
+         socket->cwnd = MAX(socket->cwnd, socket->mss);
+
+         if(n >= socket->mss)
+            socket->cwnd += socket->mss;
+      }
+   }
+   //Duplicate ACK?
+   else if(ack == context->una && context->una != context->nxt)
+   {
+      //Increment duplicate ACK counter
+      context->dupAckCount++;
+
+      //Fast retransmit is not invoked again until the data outstanding
+      //at the time of the last loss is acknowledged
+      if(!context->lossRecovery && context->dupAckCount == TCP_FAST_RETRANSMIT_THRES &&
+         context->una >= context->recoveryPoint)
+      {
+         //Enter fast recovery
+         context->lossRecovery = TRUE;
+         context->recoveryPoint = context->nxt;
+
+         //Let the congestion control algorithm compute ssthresh
+         socket->congestAlgo->onLoss(socket);
+         //Retransmit the missing segment
+         simSendSegment(context, context->una);
+
+         //Inflate the congestion window by the number of segments
+         //that have left the network
+         socket->cwnd = socket->ssthresh + TCP_FAST_RETRANSMIT_THRES * socket->mss;
+      }
+      else if(context->lossRecovery)
+      {
+         //Each additional duplicate ACK reflects another segment
+         //that has left the network
+         socket->cwnd += socket->mss;
+      }
+
+      //Limit the size of the congestion window
+      socket->cwnd = MIN(socket->cwnd, socket->txBufferSize);
+   }
+}
+
+
+/**
+ * @brief Handle the expiration of the retransmission timer (see tcpTick)
+ * @param[in] context Pointer to the simulation context
+ **/
+
+void simTimeout(SimContext *context)
+{
+   Socket *socket;
+
+   //Point to the sender state
+   socket = &context->socket;
+
+   //ssthresh is only updated on the first timeout of a segment
+   if(!context->retransmitCount)
+      socket->congestAlgo->onTimeout(socket);
+
+   //Upon a timeout cwnd must be set to the loss window
+   socket->cwnd = MIN(TCP_LOSS_WINDOW * socket->mss, socket->txBufferSize);
+
+   //Fast recovery is abandoned. Duplicate ACKs for the data sent
+   //before the timeout must not trigger a new fast retransmit
+   context->lossRecovery = FALSE;
+   context->recoveryPoint = context->nxt;
+   context->dupAckCount = 0;
+
+   //Go back to the first unacknowledged segment
+   context->nxt = context->una;
+   socket->sndNxt = context->nxt * SIM_MSS;
+
+   //Back off the retransmission timer
+   context->retransmitCount++;
+   context->rto = MIN(context->rto * 2, TCP_MAX_RTO);
+   context->rtoExpiry = simTime + context->rto;
+}
+
+
+/**
+ * @brief Run a single bulk transfer
+ * @param[in] params Simulation parameters
+ * @param[in] algo Congestion control algorithm
+ * @return Number of bytes delivered in order to the peer
+ **/
+
+uint64_t simRun(const SimParams *params, const TcpCongestAlgo *algo)
+{
+   uint32_t now;
+   uint32_t seg;
+   uint32_t size;
+   uint64_t goodput;
+   SimContext *context;
+   Socket *socket;
+
+   //Allocate the simulation context
+   context = calloc(1, sizeof(SimContext));
+   //Failed to allocate memory?
+   if(context == NULL)
+   {
+      fprintf(stderr, "Out of memory!\n");
+      exit(1);
+   }
+
+   //Save simulation parameters
+   context->params = params;
+   context->random = params->seed;
+   context->rto = TCP_INITIAL_RTO;
+   context->rtoExpiry = TCP_INITIAL_RTO;
+
+   //Worst-case number of segments sent during the transfer
+   context->maxSeg = (uint32_t) ((uint64_t) params->duration * params->rate / SIM_MSS) +
+      SIM_TX_BUFFER_SIZE / SIM_MSS + 16;
+
+   //Allocate the per-segment state
+   context->sendTime = calloc(context->maxSeg, sizeof(uint32_t));
+   context->retransmitted = calloc(context->maxSeg, sizeof(uint8_t));
+   context->received = calloc(context->maxSeg, sizeof(uint8_t));
+
+   //Failed to allocate memory?
+   if(context->sendTime == NULL || context->retransmitted == NULL ||
+      context->received == NULL)
+   {
+      fprintf(stderr, "Out of memory!\n");
+      exit(1);
+   }
+
+   //Maximum number of packets in the network at any time
+   size = (uint32_t) ((uint64_t) params->rate * params->rtt / SIM_MSS) + 64;
+
+   //Allocate the FIFOs
+   simFifoInit(&context->queue, params->queueSize + 1);
+   simFifoInit(&context->dataPipe, size);
+   simFifoInit(&context->ackPipe, size);
+
+   //Initialize the sender state
+   socket = &context->socket;
+   socket->mss = SIM_MSS;
+   socket->txBufferSize = SIM_TX_BUFFER_SIZE;
+   socket->congestAlgo = algo;
+
+   //Initialize congestion control state
+   simTime = 0;
+   algo->init(socket);
+
+   //Run the simulation with a 1ms resolution
+   for(now = 0; now < params->duration; now++)
+   {
+      //Update the simulated system time
+      simTime = now;
+
+      //Process the ACKs that reach the sender
+      while(simFifoReady(&context->ackPipe, now))
+         simProcessAck(context, simFifoPop(&context->ackPipe));
+
+      //Retransmission timer expired?
+      if(context->una != context->nxt && now >= context->rtoExpiry)
+         simTimeout(context);
+
+      //Send as many new segments as the congestion window allows
+      while((context->nxt - context->una + 1) * SIM_MSS <= socket->cwnd &&
+         context->nxt < context->maxSeg)
+      {
+         //Restart the retransmission timer when the pipe was empty
+         if(context->una == context->nxt)
+            context->rtoExpiry = now + context->rto;
+
+         //Transmit the next segment
+         simSendSegment(context, context->nxt);
+         context->nxt++;
+         socket->sndNxt = context->nxt * SIM_MSS;
+      }
+
+      //The bottleneck serves the queue at a constant rate
+      context->credit += params->rate;
+
+      //Forward the segments towards the peer
+      while(context->queue.count > 0 && context->credit >= SIM_MSS)
+      {
+         seg = simFifoPop(&context->queue);
+         simFifoPush(&context->dataPipe, seg, now + params->rtt / 2);
+         context->credit -= SIM_MSS;
+      }
+
+      //An idle link cannot save up transmission credit
+      if(!context->queue.count)
+         context->credit = MIN(context->credit, SIM_MSS);
+
+      //Segments reaching the peer
+      while(simFifoReady(&context->dataPipe, now))
+      {
+         //Mark the segment as received
+         seg = simFifoPop(&context->dataPipe);
+         context->received[seg] = TRUE;
+
+         //Advance RCV.NXT over the data received in order
+         while(context->rcvNxt < context->maxSeg && context->received[context->rcvNxt])
+            context->rcvNxt++;
+
+         //Each segment is acknowledged immediately
+         simFifoPush(&context->ackPipe, context->rcvNxt, now + params->rtt - params->rtt / 2);
+      }
+   }
+
+   //Number of bytes delivered in order
+   goodput = (uint64_t) context->rcvNxt * SIM_MSS;
+
+   //Release resources
+   free(context->queue.items);
+   free(context->dataPipe.items);
+   free(context->ackPipe.items);
+   free(context->sendTime);
+   free(context->retransmitted);
+   free(context->received);
+   free(context);
+
+   //Return the number of bytes delivered
+   return goodput;
+}
+
+
+/**
+ * @brief Main entry point
+ * @param[in] argc Number of arguments
+ * @param[in] argv Argument list
+ * @return Exit code
+ **/
+
+int main(int argc, char *argv[])
+{
+   uint_t i;
+   uint_t j;
+   uint_t k;
+   uint64_t total[2];
+   uint32_t kbps;
+   SimParams params;
+
+   //Loss rates to be simulated, in parts per million
+   static const uint32_t lossRates[] = {0, 100, 1000, 5000, 10000, 20000, 50000};
+   //Congestion control algorithms to be compared
+   static const TcpCongestAlgo *algos[] = {TCP_NEWRENO_ALGO, TCP_CUBIC_ALGO};
+
+   //Default link: 10 Mbit/s, 100 ms round-trip time, 60 s transfer
+   kbps = (argc > 1) ? atoi(argv[1]) : 10000;
+   params.rtt = (argc > 2) ? atoi(argv[2]) : 100;
+   params.duration = ((argc > 3) ? atoi(argv[3]) : 60) * 1000;
+
+   //Check parameters
+   if(kbps < 100 || params.rtt < 2 || params.duration == 0)
+   {
+      fprintf(stderr, "Usage: %s [rate_kbps] [rtt_ms] [duration_s]\n", argv[0]);
+      return 1;
+   }
+
+   //Convert the rate to bytes per millisecond
+   params.rate = kbps / 8;
+   //The bottleneck queue holds one bandwidth-delay product
+   params.queueSize = MAX(params.rate * params.rtt / SIM_MSS, 4);
+
+   //Display the link characteristics
+   printf("Link: %u kbit/s, RTT %u ms, queue %u segments, %u s per run\n\n",
+      kbps, params.rtt, params.queueSize, params.duration / 1000);
+   printf("Loss rate   NewReno (kbit/s)   CUBIC (kbit/s)\n");
+
+   //Loop through the loss rates
+   for(i = 0; i < arraysize(lossRates); i++)
+   {
+      params.lossRate = lossRates[i];
+
+      //Loop through the algorithms
+      for(j = 0; j < arraysize(algos); j++)
+      {
+         total[j] = 0;
+
+         //Average several runs with different seeds
+         for(k = 0; k < SIM_RUN_COUNT; k++)
+         {
+            params.seed = k + 1;
+            total[j] += simRun(&params, algos[j]);
+         }
+      }
+
+      //Display the average goodput
+      printf("%7.2f%%   %16u   %14u\n", lossRates[i] / 10000.0,
+         (uint32_t) (total[0] * 8 / SIM_RUN_COUNT / params.duration),
+         (uint32_t) (total[1] * 8 / SIM_RUN_COUNT / params.duration));
+   }
+
+   //Successful processing
+   return 0;
+}
@@ -0,0 +1,41 @@
+/**
+ * @file net_config.h
+ * @brief CycloneTCP configuration file (congestion control simulator)
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+#ifndef _NET_CONFIG_H
+#define _NET_CONFIG_H
+
+//Trace level for TCP/IP stack debugging
+#define TCP_TRACE_LEVEL 0
+
+//Number of network adapters
+#define NET_INTERFACE_COUNT 1
+
+//TCP congestion control
+#define TCP_CONGESTION_CONTROL_SUPPORT ENABLED
+//CUBIC congestion control algorithm
+#define TCP_CUBIC_SUPPORT ENABLED
+
+#endif
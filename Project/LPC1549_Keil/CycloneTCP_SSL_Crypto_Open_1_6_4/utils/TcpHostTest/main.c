@@ -0,0 +1,1017 @@
+/**
+ * @file main.c
+ * @brief Host test for the TCP layer
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * The socket and TCP layers are linked as-is, while the IP layer is
+ * replaced by a few functions that record every outgoing segment. Segments
+ * are injected through tcpProcessSegment() and time is advanced by hand,
+ * so that each scenario is fully deterministic
+ *
+ * Build and run the test on the host with:
+ * gcc -std=gnu99 -O2 -I. -I../../common -I../../cyclone_tcp main.c
+ *    ../../cyclone_tcp/core/socket.c ../../cyclone_tcp/core/tcp.c
+ *    ../../cyclone_tcp/core/tcp_fsm.c ../../cyclone_tcp/core/tcp_misc.c
+ *    ../../cyclone_tcp/core/tcp_timer.c ../../cyclone_tcp/core/tcp_syn_cookie.c
+ *    ../../cyclone_tcp/core/tcp_cc.c ../../cyclone_tcp/core/tcp_cubic.c
+ *    ../../cyclone_tcp/core/net_mem.c ../../common/os_port_none.c
+ *    ../../common/endian.c ../../common/date_time.c -o tcp_host_test
+ * ./tcp_host_test
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+//Dependencies
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "core/net.h"
+#include "core/net_mem.h"
+#include "core/socket.h"
+#include "core/tcp.h"
+#include "core/tcp_fsm.h"
+#include "core/tcp_timer.h"
+#include "core/tcp_cc.h"
+
+//Maximum number of recorded segments
+#define TEST_MAX_SEGMENTS 64
+//Maximum length of a recorded segment
+#define TEST_MAX_SEGMENT_SIZE 1600
+
+//Address of the host under test
+#define TEST_SERVER_ADDR IPV4_ADDR(192, 168, 0, 1)
+//Address of the simulated peer
+#define TEST_CLIENT_ADDR IPV4_ADDR(192, 168, 0, 2)
+//Port of the listening socket
+#define TEST_SERVER_PORT 80
+
+//Number of full-sized segments of the bulk transfer
+#define TEST_BULK_SEGMENTS 32
+
+//Check a condition and report a failure
+#define TEST_CHECK(cond) testCheck((cond) ? TRUE : FALSE, #cond, __LINE__)
+
+
+/**
+ * @brief Segment sent by the host under test
+ **/
+
+typedef struct
+{
+   uint16_t srcPort;
+   uint16_t destPort;
+   uint32_t seqNum;
+   uint32_t ackNum;
+   uint8_t flags;
+   uint16_t window;
+   size_t length; ///<Length of the payload
+} TestSegment;
+
+
+//Address matching any interface
+const IpAddr IP_ADDR_ANY = {0};
+
+//Underlying network interface
+static NetInterface testInterface;
+//Segments sent by the host under test
+static TestSegment testSegment[TEST_MAX_SEGMENTS];
+static uint_t testSegmentCount;
+
+//Test statistics
+static uint_t testCheckCount;
+static uint_t testFailCount;
+
+//Number of completion callbacks invoked
+static uint_t testTxRefCount;
+//Number of bytes released by the completion callbacks
+static size_t testTxRefLength;
+
+//Number of TCP_CONGEST_EVENT_TX_START events
+static uint_t testTxStartCount;
+
+
+/**
+ * @brief Record the result of a check
+ * @param[in] result Outcome of the check
+ * @param[in] text Condition that has been checked
+ * @param[in] line Line number of the check
+ **/
+
+void testCheck(bool_t result, const char_t *text, uint_t line)
+{
+   //Update statistics
+   testCheckCount++;
+
+   //Report failures
+   if(!result)
+   {
+      printf("  FAILED (line %u): %s\n", line, text);
+      testFailCount++;
+   }
+}
+
+
+/**
+ * @brief Get a random value (IP layer stub)
+ * @return Random value
+ **/
+
+uint32_t netGetRand(void)
+{
+   return (uint32_t) rand() * 65599 + rand();
+}
+
+
+/**
+ * @brief Get default network interface (stub)
+ * @return Pointer to the default network interface to be used
+ **/
+
+NetInterface *netGetDefaultInterface(void)
+{
+   return &testInterface;
+}
+
+
+/**
+ * @brief Select the source address of an outgoing packet (IP layer stub)
+ * @param[in,out] interface Network interface to be used
+ * @param[in] destAddr Destination IP address
+ * @param[out] srcAddr Local IP address to be used
+ * @return Error code
+ **/
+
+error_t ipSelectSourceAddr(NetInterface **interface,
+   const IpAddr *destAddr, IpAddr *srcAddr)
+{
+   //Use the address of the host under test
+   *interface = &testInterface;
+   srcAddr->length = sizeof(Ipv4Addr);
+   srcAddr->ipv4Addr = TEST_SERVER_ADDR;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Compare an IP address against the unspecified address (IP layer stub)
+ * @param[in] ipAddr IP address
+ * @return TRUE if the IP address is unspecified, else FALSE
+ **/
+
+bool_t ipIsUnspecifiedAddr(const IpAddr *ipAddr)
+{
+   return (ipAddr->length == 0 || ipAddr->ipv4Addr == IPV4_UNSPECIFIED_ADDR) ? TRUE : FALSE;
+}
+
+
+/**
+ * @brief Convert a string representation of an IP address (IP layer stub)
+ * @return Error code
+ **/
+
+error_t ipStringToAddr(const char_t *str, IpAddr *ipAddr)
+{
+   //Host names are not used by the test
+   return ERROR_INVALID_ADDRESS;
+}
+
+
+/**
+ * @brief Allocate a buffer to hold an IP packet (IP layer stub)
+ * @param[in] length Desired payload length
+ * @param[out] offset Offset to the first byte of the payload
+ * @return The function returns a pointer to the newly allocated
+ *   buffer. If the system is out of resources, NULL is returned
+ **/
+
+NetBuffer *ipAllocBuffer(size_t length, size_t *offset)
+{
+   //No room is reserved for the IP header
+   *offset = 0;
+   //Allocate a memory buffer
+   return netBufferAlloc(length);
+}
+
+
+/**
+ * @brief Calculate checksum over an upper-layer packet (IP layer stub)
+ *
+ * Checksums are not relevant to the test. Incoming segments are always
+ * considered as valid
+ *
+ * @return Checksum value
+ **/
+
+uint16_t ipCalcUpperLayerChecksumEx(const void *pseudoHeader,
+   size_t pseudoHeaderLength, const NetBuffer *buffer, size_t offset, size_t length)
+{
+   return 0xFFFF;
+}
+
+
+/**
+ * @brief Send an IP datagram (IP layer stub)
+ *
+ * The TCP segment is recorded so that it can be checked by the test
+ *
+ * @return Error code
+ **/
+
+error_t ipSendDatagram(NetInterface *interface, IpPseudoHeader *pseudoHeader,
+   NetBuffer *buffer, size_t offset, uint8_t timeToLive)
+{
+   size_t length;
+   TcpHeader *header;
+   TestSegment *segment;
+   uint8_t data[TEST_MAX_SEGMENT_SIZE];
+
+   //Copy the TCP segment
+   length = netBufferRead(data, buffer, offset, sizeof(data));
+   //Point to the TCP header
+   header = (TcpHeader *) data;
+
+   //Make sure there is room for another segment
+   if(testSegmentCount >= TEST_MAX_SEGMENTS)
+      return ERROR_OUT_OF_RESOURCES;
+
+   //Record the relevant fields of the segment
+   segment = &testSegment[testSegmentCount++];
+   segment->srcPort = ntohs(header->srcPort);
+   segment->destPort = ntohs(header->destPort);
+   segment->seqNum = ntohl(header->seqNum);
+   segment->ackNum = ntohl(header->ackNum);
+   segment->flags = header->flags;
+   segment->window = ntohs(header->window);
+   segment->length = length - header->dataOffset * 4;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Inject a segment sent by the simulated peer
+ * @param[in] srcPort Port of the peer
+ * @param[in] flags TCP flags
+ * @param[in] seqNum Sequence number
+ * @param[in] ackNum Acknowledgment number
+ * @param[in] data Payload
+ * @param[in] length Length of the payload
+ **/
+
+void testInject(uint16_t srcPort, uint8_t flags, uint32_t seqNum,
+   uint32_t ackNum, const void *data, size_t length)
+{
+   NetBuffer *buffer;
+   TcpHeader *header;
+   IpPseudoHeader pseudoHeader;
+
+   //Allocate a buffer to hold the segment
+   buffer = netBufferAlloc(sizeof(TcpHeader) + length);
+   //Point to the TCP header
+   header = netBufferAt(buffer, 0);
+
+   //Format TCP header
+   memset(header, 0, sizeof(TcpHeader));
+   header->srcPort = htons(srcPort);
+   header->destPort = htons(TEST_SERVER_PORT);
+   header->seqNum = htonl(seqNum);
+   header->ackNum = htonl(ackNum);
+   header->dataOffset = 5;
+   header->flags = flags;
+   header->window = htons(8192);
+
+   //Copy the payload
+   netBufferWrite(buffer, sizeof(TcpHeader), data, length);
+
+   //Format IPv4 pseudo header
+   pseudoHeader.length = sizeof(Ipv4PseudoHeader);
+   pseudoHeader.ipv4Data.srcAddr = TEST_CLIENT_ADDR;
+   pseudoHeader.ipv4Data.destAddr = TEST_SERVER_ADDR;
+   pseudoHeader.ipv4Data.reserved = 0;
+   pseudoHeader.ipv4Data.protocol = IPV4_PROTOCOL_TCP;
+   pseudoHeader.ipv4Data.length = htons(sizeof(TcpHeader) + length);
+
+   //Process the segment
+   tcpProcessSegment(&testInterface, &pseudoHeader, buffer, 0);
+   //Release the buffer
+   netBufferFree(buffer);
+}
+
+
+/**
+ * @brief Count the segments sent to a given peer port
+ * @param[in] destPort Port of the peer
+ * @param[in] flags Only count segments carrying all these flags
+ * @return Number of matching segments
+ **/
+
+uint_t testCountSegments(uint16_t destPort, uint8_t flags)
+{
+   uint_t i;
+   uint_t n;
+
+   //Loop through the recorded segments
+   for(n = 0, i = 0; i < testSegmentCount; i++)
+   {
+      if(testSegment[i].destPort == destPort &&
+         (testSegment[i].flags & flags) == flags)
+      {
+         n++;
+      }
+   }
+
+   //Return the number of matching segments
+   return n;
+}
+
+
+/**
+ * @brief Count the pending connections of a listening socket
+ * @param[in] socket Handle referencing the listening socket
+ * @return Number of items in the SYN queue
+ **/
+
+uint_t testSynQueueLength(Socket *socket)
+{
+   uint_t n;
+   TcpSynQueueItem *queueItem;
+
+   //Walk through the SYN queue
+   for(n = 0, queueItem = socket->synQueue; queueItem != NULL; queueItem = queueItem->next)
+      n++;
+
+   //Return the number of pending connections
+   return n;
+}
+
+
+/**
+ * @brief Advance the system time and run the TCP timers
+ * @param[in] delay Amount of time to elapse, in milliseconds
+ **/
+
+void testAdvance(systime_t delay)
+{
+   systime_t i;
+
+   //The timers are processed at every tick
+   for(i = 0; i < delay; i += TCP_TICK_INTERVAL)
+   {
+      systemTicks += TCP_TICK_INTERVAL;
+      tcpTick();
+   }
+}
+
+
+/**
+ * @brief Establish a connection with the simulated peer
+ * @param[in] listener Handle referencing the listening socket
+ * @param[in] srcPort Port of the peer
+ * @param[in] isn Initial sequence number of the peer
+ * @param[out] iss Initial sequence number of the host under test
+ * @return Handle referencing the connected socket
+ **/
+
+Socket *testConnect(Socket *listener, uint16_t srcPort, uint32_t isn, uint32_t *iss)
+{
+   Socket *socket;
+
+   //The peer sends a SYN
+   testInject(srcPort, TCP_FLAG_SYN, isn, 0, NULL, 0);
+
+   //Accept the connection, which sends the SYN-ACK
+   testSegmentCount = 0;
+   socket = socketAccept(listener, NULL, NULL);
+   TEST_CHECK(socket != NULL && testSegmentCount == 1);
+
+   //Check status
+   if(socket == NULL || testSegmentCount != 1)
+      return NULL;
+
+   //Retrieve the initial sequence number of the host under test
+   *iss = testSegment[0].seqNum;
+
+   //The peer completes the three-way handshake
+   testInject(srcPort, TCP_FLAG_ACK, isn + 1, *iss + 1, NULL, 0);
+   TEST_CHECK(socket->state == TCP_STATE_ESTABLISHED);
+
+   //Return the connected socket
+   socketSetTimeout(socket, 0);
+   return socket;
+}
+
+
+/**
+ * @brief Check that every running timer of a socket is still scheduled
+ * @param[in] socket Handle referencing the socket
+ * @return TRUE if all the running timers are linked to the timing wheel
+ **/
+
+bool_t testTimersScheduled(Socket *socket)
+{
+   uint_t i;
+
+   //Timers of the socket
+   TcpTimer *timer[] =
+   {
+      &socket->retransmitTimer,
+      &socket->persistTimer,
+      &socket->overrideTimer,
+      &socket->finWait2Timer,
+      &socket->timeWaitTimer
+   };
+
+   //A running timer that is not linked would never be processed again
+   for(i = 0; i < arraysize(timer); i++)
+   {
+      if(timer[i]->running && timer[i]->pprev == NULL)
+         return FALSE;
+   }
+
+   //All the running timers are scheduled
+   return TRUE;
+}
+
+
+/**
+ * @brief Control segments are served by the small size class
+ *
+ * Pure SYN, SYN-ACK and ACK segments fit in a small block together with
+ * the header of the multi-part buffer, so that full-size buffers are
+ * left to the send and receive buffers of the sockets
+ **/
+
+void testMemPoolClasses(void)
+{
+   uint32_t iss;
+   uint_t smallMaxUsage;
+   uint_t fullMaxUsage;
+   uint_t currentUsage;
+   uint_t size;
+   Socket *listener;
+   Socket *socket;
+
+   printf("Memory pool size classes\n");
+
+   //Open a listening socket
+   listener = socketOpen(SOCKET_TYPE_STREAM, SOCKET_IP_PROTO_TCP);
+   socketSetTimeout(listener, 0);
+   socketBind(listener, &IP_ADDR_ANY, TEST_SERVER_PORT);
+   socketListen(listener, 1);
+
+   //Establish a connection
+   socket = testConnect(listener, 4000, 80000, &iss);
+
+   //Get the usage of the small and full-size buffers
+   memPoolGetClassStats(0, NULL, NULL, &smallMaxUsage, NULL);
+   memPoolGetClassStats(1, NULL, NULL, &fullMaxUsage, NULL);
+
+   //Full-size blocks only hold the send and receive buffers of the socket
+   TEST_CHECK(smallMaxUsage > 0);
+   TEST_CHECK(socket != NULL && fullMaxUsage ==
+      socket->txBuffer.chunkCount + socket->rxBuffer.chunkCount);
+
+   //Release resources
+   if(socket != NULL)
+      socketClose(socket);
+
+   socketClose(listener);
+
+   //The statistics cover both size classes
+   memPoolGetStats(&currentUsage, NULL, &size);
+   TEST_CHECK(currentUsage == 0);
+   TEST_CHECK(size == NET_MEM_POOL_SMALL_BUFFER_COUNT + NET_MEM_POOL_BUFFER_COUNT);
+}
+
+
+/**
+ * @brief Completion callback for zero-copy transmission
+ * @param[in] socket Handle referencing the socket
+ * @param[in] data Buffer that is given back
+ * @param[in] length Number of bytes that have been released
+ * @param[in] param Opaque pointer
+ **/
+
+void testTxRefCallback(Socket *socket, const uint8_t *data,
+   size_t length, void *param)
+{
+   //Keep track of the released bytes
+   testTxRefCount++;
+   testTxRefLength += length;
+
+   //The socket API may be used from the callback
+   tcpGetState(socket);
+}
+
+
+/**
+ * @brief Ownership of caller-owned buffers
+ *
+ * When only part of a buffer can be queued, the function succeeds and the
+ * callback later releases the queued bytes. A failed call never invokes the
+ * callback, and pending buffers are given back when the socket is closed
+ **/
+
+void testSendRef(void)
+{
+   uint32_t iss;
+   uint32_t isn;
+   uint_t i;
+   size_t written;
+   error_t error;
+   Socket *listener;
+   Socket *socket;
+
+   //Caller-owned data, larger than the send buffer
+   static uint8_t data[2 * TCP_DEFAULT_TX_BUFFER_SIZE];
+
+   printf("Zero-copy transmission\n");
+
+   //Open a listening socket
+   listener = socketOpen(SOCKET_TYPE_STREAM, SOCKET_IP_PROTO_TCP);
+   socketSetTimeout(listener, 0);
+   socketBind(listener, &IP_ADDR_ANY, TEST_SERVER_PORT);
+   socketListen(listener, 1);
+
+   //Establish a connection
+   isn = 90000;
+   socket = testConnect(listener, 5000, isn, &iss);
+
+   if(socket != NULL)
+   {
+      //Only part of the buffer fits in the send buffer
+      testTxRefCount = 0;
+      testTxRefLength = 0;
+      error = socketSendRef(socket, data, sizeof(data), testTxRefCallback,
+         NULL, &written, 0);
+
+      //The partial write is not reported as an error
+      TEST_CHECK(error == NO_ERROR);
+      TEST_CHECK(written > 0 && written < sizeof(data));
+      TEST_CHECK(testTxRefCount == 0);
+
+      //The peer acknowledges the data as it is sent
+      for(i = 0; i < 16 && testTxRefCount == 0; i++)
+      {
+         testInject(5000, TCP_FLAG_ACK, isn + 1, socket->sndNxt, NULL, 0);
+         testAdvance(TCP_OVERRIDE_TIMEOUT);
+      }
+
+      //The callback releases the queued bytes exactly once
+      TEST_CHECK(testTxRefCount == 1 && testTxRefLength == written);
+
+      //Queue another buffer, then the peer resets the connection
+      testTxRefCount = 0;
+      testTxRefLength = 0;
+      error = socketSendRef(socket, data, 100, testTxRefCallback,
+         NULL, &written, 0);
+      TEST_CHECK(error == NO_ERROR && written == 100);
+
+      testInject(5000, TCP_FLAG_RST, isn + 1, 0, NULL, 0);
+      TEST_CHECK(socket->state == TCP_STATE_CLOSED);
+
+      //Nothing can be queued anymore, and the callback is not invoked
+      error = socketSendRef(socket, data, 100, testTxRefCallback,
+         NULL, &written, 0);
+      TEST_CHECK(error != NO_ERROR && written == 0);
+
+      //The pending buffer is given back when the socket is closed
+      socketClose(socket);
+      TEST_CHECK(testTxRefCount == 1 && testTxRefLength == 100);
+   }
+
+   //Release resources
+   socketClose(listener);
+}
+
+
+/**
+ * @brief Acknowledgment of a bulk transfer
+ *
+ * The peer sends full-sized segments, which the application reads as
+ * soon as they arrive. The number of segments sent in reply is reported,
+ * so that the packet count can be compared with and without delayed ACK
+ **/
+
+void testBulkReceive(void)
+{
+   uint32_t iss;
+   uint32_t isn;
+   uint32_t seqNum;
+   uint_t i;
+   uint_t count;
+   size_t n;
+   Socket *listener;
+   Socket *socket;
+
+   //Payload of the peer
+   static uint8_t data[TCP_MAX_MSS];
+   static uint8_t buffer[TCP_MAX_MSS];
+
+   printf("Bulk receive\n");
+
+   //Open a listening socket
+   listener = socketOpen(SOCKET_TYPE_STREAM, SOCKET_IP_PROTO_TCP);
+   socketSetTimeout(listener, 0);
+   socketBind(listener, &IP_ADDR_ANY, TEST_SERVER_PORT);
+   socketListen(listener, 1);
+
+   //Establish a connection
+   isn = 100000;
+   socket = testConnect(listener, 6000, isn, &iss);
+
+   if(socket != NULL)
+   {
+      //Sequence number of the first data byte
+      seqNum = isn + 1;
+
+#if (TCP_DELAYED_ACK_SUPPORT == ENABLED)
+      //A full-sized segment followed by a short one is not acknowledged
+      //right away, since less than two full-sized segments were received
+      testSegmentCount = 0;
+      testInject(6000, TCP_FLAG_ACK, seqNum, iss + 1, data, TCP_MAX_MSS);
+      seqNum += TCP_MAX_MSS;
+      testInject(6000, TCP_FLAG_ACK | TCP_FLAG_PSH, seqNum, iss + 1, data, 100);
+      seqNum += 100;
+      TEST_CHECK(testSegmentCount == 0);
+
+      //Read the data
+      socketReceive(socket, buffer, sizeof(buffer), &n, 0);
+      socketReceive(socket, buffer, sizeof(buffer), &n, 0);
+
+      //The next full-sized segment triggers the ACK
+      testInject(6000, TCP_FLAG_ACK, seqNum, iss + 1, data, TCP_MAX_MSS);
+      seqNum += TCP_MAX_MSS;
+      TEST_CHECK(testSegmentCount == 1 && testSegment[0].ackNum == seqNum);
+
+      //Read the data
+      socketReceive(socket, buffer, sizeof(buffer), &n, 0);
+
+      //Let the delayed ACK timer elapse, if running
+      testAdvance(TCP_DELAYED_ACK_TIMEOUT);
+#endif
+
+      //Bulk transfer
+      testSegmentCount = 0;
+      for(i = 0; i < TEST_BULK_SEGMENTS; i++)
+      {
+         //The peer sends a full-sized segment
+         testInject(6000, TCP_FLAG_ACK, seqNum, iss + 1, data, TCP_MAX_MSS);
+         seqNum += TCP_MAX_MSS;
+
+         //The application reads the data right away
+         socketReceive(socket, buffer, sizeof(buffer), &n, 0);
+      }
+
+      //Let the delayed ACK timer elapse, if running
+      testAdvance(TCP_DELAYED_ACK_TIMEOUT);
+
+      //Segments sent by the host under test in reply
+      count = testCountSegments(6000, TCP_FLAG_ACK);
+
+      printf("  %u full-sized segments received, %u segments sent\n",
+         TEST_BULK_SEGMENTS, count);
+
+      //Every byte has been acknowledged
+      TEST_CHECK(testSegmentCount > 0 &&
+         testSegment[testSegmentCount - 1].ackNum == seqNum);
+
+#if (TCP_DELAYED_ACK_SUPPORT == ENABLED)
+      //One ACK for every second full-sized segment
+      TEST_CHECK(count == TEST_BULK_SEGMENTS / 2);
+#else
+      //One ACK per segment
+      TEST_CHECK(count == TEST_BULK_SEGMENTS);
+#endif
+
+      //Release the socket
+      socketClose(socket);
+   }
+
+   //Release resources
+   socketClose(listener);
+}
+
+
+/**
+ * @brief Congestion control event handler that counts restarts after idle
+ * @param[in] socket Handle referencing the socket
+ * @param[in] event Event to be processed
+ **/
+
+void testCwndEvent(Socket *socket, TcpCongestEvent event)
+{
+   //Keep track of the restarts after an idle period
+   if(event == TCP_CONGEST_EVENT_TX_START)
+      testTxStartCount++;
+
+   //Forward the event to NewReno
+   tcpNewRenoCwndEvent(socket, event);
+}
+
+
+//NewReno, with restarts after idle being counted
+static const TcpCongestAlgo testCongestAlgo =
+{
+   "test",
+   tcpNewRenoInit,
+   tcpNewRenoOnAck,
+   tcpNewRenoOnLoss,
+   tcpNewRenoOnTimeout,
+   testCwndEvent
+};
+
+
+/**
+ * @brief Restart of the transmission after an idle period
+ *
+ * Data sent as soon as the previous data has been acknowledged does not
+ * restart the congestion control algorithm. The connection is only
+ * considered idle once nothing has been sent for one RTO
+ **/
+
+void testIdleRestart(void)
+{
+   uint32_t iss;
+   uint32_t isn;
+   uint_t i;
+   size_t written;
+   Socket *listener;
+   Socket *socket;
+
+   //Payload of the host under test
+   static const uint8_t data[100] = {0};
+
+   printf("Restart after idle\n");
+
+   //Open a listening socket
+   listener = socketOpen(SOCKET_TYPE_STREAM, SOCKET_IP_PROTO_TCP);
+   socketSetTimeout(listener, 0);
+   socketSetCongestionControl(listener, &testCongestAlgo);
+   socketBind(listener, &IP_ADDR_ANY, TEST_SERVER_PORT);
+   socketListen(listener, 1);
+
+   //Establish a connection
+   isn = 200000;
+   socket = testConnect(listener, 7000, isn, &iss);
+
+   if(socket != NULL)
+   {
+      //Request/response exchanges with no pause in between
+      testTxStartCount = 0;
+      for(i = 0; i < 4; i++)
+      {
+         socketSend(socket, data, sizeof(data), &written, 0);
+         testInject(7000, TCP_FLAG_ACK, isn + 1, socket->sndNxt, NULL, 0);
+      }
+
+      //All the data has been sent, without any restart
+      TEST_CHECK(socket->sndNxt == iss + 1 + 4 * sizeof(data));
+      TEST_CHECK(testTxStartCount == 0);
+
+      //The connection stays idle for one RTO
+      testAdvance(socket->rto);
+
+      //The next transmission restarts the algorithm
+      socketSend(socket, data, sizeof(data), &written, 0);
+      TEST_CHECK(testTxStartCount == 1);
+
+      //Release the socket
+      socketClose(socket);
+   }
+
+   //Release resources
+   socketClose(listener);
+}
+
+
+/**
+ * @brief Data sent right after the final ACK of a SYN cookie handshake
+ *
+ * The first data segment of the client has the same sequence number as
+ * the ACK that completed the handshake. Neither that segment nor the
+ * following one may create a second connection or reset the pending one
+ **/
+
+void testSynCookieData(void)
+{
+   uint32_t isn;
+   uint32_t iss;
+   uint_t i;
+   Socket *listener;
+   Socket *socket[3];
+   IpAddr clientIpAddr;
+   uint16_t clientPort;
+   char_t buffer[32];
+   size_t n;
+
+   //Payload of the client
+   static const char_t request1[] = "GET / HTTP/1.0\r\n";
+   static const char_t request2[] = "\r\n";
+
+   printf("SYN cookie connection with early data\n");
+
+   //Open a listening socket with a 2-entry SYN queue
+   listener = socketOpen(SOCKET_TYPE_STREAM, SOCKET_IP_PROTO_TCP);
+   socketSetTimeout(listener, 0);
+   socketBind(listener, &IP_ADDR_ANY, TEST_SERVER_PORT);
+   socketListen(listener, 2);
+
+   //The first connection requests fill the SYN queue
+   testInject(1000, TCP_FLAG_SYN, 5000, 0, NULL, 0);
+   testInject(1001, TCP_FLAG_SYN, 6000, 0, NULL, 0);
+   TEST_CHECK(testSynQueueLength(listener) == 2);
+
+   //The next one is answered with a SYN cookie
+   isn = 9000;
+   testSegmentCount = 0;
+   testInject(2000, TCP_FLAG_SYN, isn, 0, NULL, 0);
+   TEST_CHECK(testSegmentCount == 1);
+   TEST_CHECK(testSegment[0].flags == (TCP_FLAG_SYN | TCP_FLAG_ACK));
+   TEST_CHECK(testSegment[0].ackNum == isn + 1);
+   iss = testSegment[0].seqNum;
+
+   //Accept the first connections to make room in the SYN queue
+   for(i = 0; i < 2; i++)
+   {
+      socket[i] = socketAccept(listener, &clientIpAddr, &clientPort);
+      TEST_CHECK(socket[i] != NULL && clientPort == 1000 + i);
+   }
+
+   //The final ACK of the handshake carries the first request
+   testSegmentCount = 0;
+   testInject(2000, TCP_FLAG_ACK | TCP_FLAG_PSH, isn + 1, iss + 1,
+      request1, strlen(request1));
+   TEST_CHECK(testSynQueueLength(listener) == 1);
+   TEST_CHECK(testCountSegments(2000, TCP_FLAG_RST) == 0);
+
+   //The client retransmits the same segment before the connection is accepted
+   testInject(2000, TCP_FLAG_ACK | TCP_FLAG_PSH, isn + 1, iss + 1,
+      request1, strlen(request1));
+   //The following segment must not be mistaken for an invalid cookie
+   testInject(2000, TCP_FLAG_ACK | TCP_FLAG_PSH, isn + 1 + strlen(request1),
+      iss + 1, request2, strlen(request2));
+
+   //Still a single pending connection, and no reset
+   TEST_CHECK(testSynQueueLength(listener) == 1);
+   TEST_CHECK(testCountSegments(2000, TCP_FLAG_RST) == 0);
+
+   //Accept the connection
+   socket[2] = socketAccept(listener, &clientIpAddr, &clientPort);
+   TEST_CHECK(socket[2] != NULL && clientPort == 2000);
+   TEST_CHECK(socket[2] != NULL && socket[2]->state == TCP_STATE_ESTABLISHED);
+   //No other connection is pending
+   TEST_CHECK(socketAccept(listener, NULL, NULL) == NULL);
+
+   //The data is delivered once the client retransmits it
+   if(socket[2] != NULL)
+   {
+      testSegmentCount = 0;
+      testInject(2000, TCP_FLAG_ACK | TCP_FLAG_PSH, isn + 1, iss + 1,
+         request1, strlen(request1));
+      TEST_CHECK(testCountSegments(2000, TCP_FLAG_RST) == 0);
+
+      socketSetTimeout(socket[2], 0);
+      n = 0;
+      socketReceive(socket[2], buffer, sizeof(buffer), &n, 0);
+      TEST_CHECK(n == strlen(request1));
+   }
+
+   //Release resources
+   for(i = 0; i < 3; i++)
+   {
+      if(socket[i] != NULL)
+         socketClose(socket[i]);
+   }
+
+   socketClose(listener);
+}
+
+
+/**
+ * @brief Timers whose action no longer applies or that exceed the wheel range
+ *
+ * The override timer elapses once the data has been sent, so it must not
+ * stay running without being scheduled. The FIN-WAIT-2 timer is longer
+ * than the range of the timing wheel used by the test and must still
+ * elapse on time
+ **/
+
+void testTimerExpiry(void)
+{
+   uint32_t iss;
+   uint32_t isn;
+   size_t written;
+   systime_t time;
+   Socket *listener;
+   Socket *socket;
+
+   printf("Timer expiry\n");
+
+   //The FIN-WAIT-2 timer must take several rounds of the timing wheel
+   TEST_CHECK(TCP_FIN_WAIT_2_TIMER / TCP_TICK_INTERVAL >=
+      (1UL << (TCP_TIMER_WHEEL_LEVELS * TCP_TIMER_WHEEL_BITS)));
+
+   //Open a listening socket
+   listener = socketOpen(SOCKET_TYPE_STREAM, SOCKET_IP_PROTO_TCP);
+   socketSetTimeout(listener, 0);
+   socketBind(listener, &IP_ADDR_ANY, TEST_SERVER_PORT);
+   socketListen(listener, 1);
+
+   //Establish a connection
+   isn = 70000;
+   socket = testConnect(listener, 3000, isn, &iss);
+
+   if(socket != NULL)
+   {
+      //The data is sent at once, and the override timer is started
+      socketSend(socket, "hello", 5, &written, 0);
+      TEST_CHECK(written == 5 && socket->sndUser == 0);
+      TEST_CHECK(tcpTimerRunning(&socket->overrideTimer));
+
+      //The peer acknowledges the data
+      testInject(3000, TCP_FLAG_ACK, isn + 1, iss + 6, NULL, 0);
+
+      //Let the override timer elapse while there is no pending data
+      testAdvance(2 * TCP_OVERRIDE_TIMEOUT);
+      TEST_CHECK(testTimersScheduled(socket));
+
+      //Send a FIN (the call returns before the FIN is acknowledged)
+      socketShutdown(socket, SOCKET_SD_SEND);
+      TEST_CHECK(socket->state == TCP_STATE_FIN_WAIT_1);
+
+      //The peer acknowledges the FIN
+      testInject(3000, TCP_FLAG_ACK, isn + 1, iss + 7, NULL, 0);
+      TEST_CHECK(socket->state == TCP_STATE_FIN_WAIT_2);
+      TEST_CHECK(testTimersScheduled(socket));
+
+      //Wait for the FIN-WAIT-2 timer to elapse
+      for(time = 0; socket->state == TCP_STATE_FIN_WAIT_2 && time < 4 * TCP_FIN_WAIT_2_TIMER; )
+      {
+         testAdvance(TCP_TICK_INTERVAL);
+         time += TCP_TICK_INTERVAL;
+      }
+
+      //The timer must elapse within one tick of its interval
+      TEST_CHECK(socket->state == TCP_STATE_CLOSED);
+      TEST_CHECK(time >= TCP_FIN_WAIT_2_TIMER && time <= TCP_FIN_WAIT_2_TIMER + TCP_TICK_INTERVAL);
+      TEST_CHECK(testTimersScheduled(socket));
+
+      //Release the socket
+      socketClose(socket);
+   }
+
+   //Release resources
+   socketClose(listener);
+}
+
+
+/**
+ * @brief Main entry point
+ * @return Unix style status code
+ **/
+
+int_t main(void)
+{
+   //Initialize the memory pool, the socket and TCP layers
+   memPoolInit();
+   socketInit();
+   tcpInit();
+
+   //Run the scenarios
+   testMemPoolClasses();
+   testSynCookieData();
+   testTimerExpiry();
+   testSendRef();
+   testBulkReceive();
+   testIdleRestart();
+
+   //Summary
+   printf("%u checks, %u failures\n", testCheckCount, testFailCount);
+
+   //Return status code
+   return testFailCount ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,79 @@
+/**
+ * @file net_config.h
+ * @brief CycloneTCP configuration file (TCP host test)
+ *
+ * @section License
+ *
+ * Copyright (C) 2010-2015 Oryx Embedded SARL. All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 1.6.4
+ **/
+
+#ifndef _NET_CONFIG_H
+#define _NET_CONFIG_H
+
+//Trace level for TCP/IP stack debugging
+#define MEM_TRACE_LEVEL 0
+#define TCP_TRACE_LEVEL 0
+#define SOCKET_TRACE_LEVEL 0
+
+//Number of network adapters
+#define NET_INTERFACE_COUNT 1
+
+//Only the TCP layer is exercised
+#define IPV6_SUPPORT DISABLED
+#define UDP_SUPPORT DISABLED
+#define RAW_SOCKET_SUPPORT DISABLED
+#define DNS_CLIENT_SUPPORT DISABLED
+#define MDNS_CLIENT_SUPPORT DISABLED
+#define NBNS_CLIENT_SUPPORT DISABLED
+
+//Number of sockets that can be opened simultaneously
+#define SOCKET_MAX_COUNT 8
+
+//Fixed-size blocks allocation, with a small size class
+#define NET_MEM_POOL_SUPPORT ENABLED
+#define NET_MEM_POOL_BUFFER_COUNT 32
+#define NET_MEM_POOL_SMALL_BUFFER_COUNT 8
+
+//Zero-copy transmission
+#define TCP_ZERO_COPY_SUPPORT ENABLED
+
+//Delayed ACK (can be disabled from the command line to compare the
+//number of segments sent by the receiver of a bulk transfer)
+#ifndef TCP_DELAYED_ACK_SUPPORT
+   #define TCP_DELAYED_ACK_SUPPORT ENABLED
+#endif
+
+//Window scale option, so that SYN cookies encode the shift count (can
+//be disabled from the command line to test the unscaled window)
+#ifndef TCP_WINDOW_SCALE_SUPPORT
+   #define TCP_WINDOW_SCALE_SUPPORT ENABLED
+#endif
+
+//Congestion control, so that restarts after idle can be observed
+#define TCP_CONGESTION_CONTROL_SUPPORT ENABLED
+
+//SYN cookies
+#define TCP_SYN_COOKIE_SUPPORT ENABLED
+
+//Small timing wheel (16 ticks), so that long timers take several rounds
+#define TCP_TIMER_WHEEL_BITS 2
+#define TCP_TIMER_WHEEL_LEVELS 2
+
+#endif